@@ -0,0 +1,186 @@
+// Real-time BC3 (DXT5) encoder for overlay frames — shared by all overlay backends.
+// Used by the compressed upload mode: the frame is split into 64x64 tiles, only
+// tiles whose content hash changed (frame-tiles.h) are encoded, and the encoded
+// blocks are uploaded into a BC3 texture — a quarter of the bytes of BGRA8 for
+// the upload and in VRAM. BC3 keeps a full alpha channel, which the overlay needs, and is
+// sampled natively by every desktop GPU the backends run on.
+//
+// Encoding is a bounding-box fit in the style of J.M.P. van Waveren's
+// "Real-Time DXT Compression": endpoints are the inset min/max of the block's
+// colors and alpha, and every pixel is projected onto the endpoint axis to pick
+// its index. The block bounds use SSE2 / NEON. Quality sits below an offline
+// encoder, which is fine for UI that is redrawn every time it changes.
+
+#ifndef STEAM_OVERLAY_BC3_ENCODER_H
+#define STEAM_OVERLAY_BC3_ENCODER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include "frame-hash.h"
+
+namespace bc3 {
+
+static const int kBlockBytes = 16;   // 8 bytes alpha + 8 bytes color per 4x4 block
+static const int kTileSize = 64;     // tile edge for compressed uploads; a multiple of the block size
+
+// Bytes of BC3 data covering a w x h image
+inline size_t compressedSize(int w, int h) {
+    return (size_t)((w + 3) / 4) * (size_t)((h + 3) / 4) * kBlockBytes;
+}
+
+// Gather the 4x4 BGRA block at (x, y), replicating edge pixels past the frame
+inline void loadBlock(const uint8_t* frame, int w, int h, size_t stride, int x, int y, uint8_t* block) {
+    if (x + 4 <= w && y + 4 <= h) {
+        for (int r = 0; r < 4; r++) {
+            memcpy(block + r * 16, frame + (size_t)(y + r) * stride + (size_t)x * 4, 16);
+        }
+        return;
+    }
+    for (int r = 0; r < 4; r++) {
+        int yy = y + r < h ? y + r : h - 1;
+        for (int c = 0; c < 4; c++) {
+            int xx = x + c < w ? x + c : w - 1;
+            memcpy(block + r * 16 + c * 4, frame + (size_t)yy * stride + (size_t)xx * 4, 4);
+        }
+    }
+}
+
+// Per-channel minimum and maximum of the 16 pixels of a block
+inline void blockBounds(const uint8_t* block, uint8_t* minPixel, uint8_t* maxPixel) {
+#if defined(FRAME_HASH_SSE2)
+    __m128i p0 = _mm_loadu_si128((const __m128i*)block);
+    __m128i p1 = _mm_loadu_si128((const __m128i*)block + 1);
+    __m128i p2 = _mm_loadu_si128((const __m128i*)block + 2);
+    __m128i p3 = _mm_loadu_si128((const __m128i*)block + 3);
+    __m128i lo = _mm_min_epu8(_mm_min_epu8(p0, p1), _mm_min_epu8(p2, p3));
+    __m128i hi = _mm_max_epu8(_mm_max_epu8(p0, p1), _mm_max_epu8(p2, p3));
+    lo = _mm_min_epu8(lo, _mm_shuffle_epi32(lo, _MM_SHUFFLE(1, 0, 3, 2)));
+    hi = _mm_max_epu8(hi, _mm_shuffle_epi32(hi, _MM_SHUFFLE(1, 0, 3, 2)));
+    lo = _mm_min_epu8(lo, _mm_shuffle_epi32(lo, _MM_SHUFFLE(2, 3, 0, 1)));
+    hi = _mm_max_epu8(hi, _mm_shuffle_epi32(hi, _MM_SHUFFLE(2, 3, 0, 1)));
+    uint32_t minValue = (uint32_t)_mm_cvtsi128_si32(lo);
+    uint32_t maxValue = (uint32_t)_mm_cvtsi128_si32(hi);
+    memcpy(minPixel, &minValue, 4);
+    memcpy(maxPixel, &maxValue, 4);
+#elif defined(FRAME_HASH_NEON)
+    uint8x16_t p0 = vld1q_u8(block);
+    uint8x16_t p1 = vld1q_u8(block + 16);
+    uint8x16_t p2 = vld1q_u8(block + 32);
+    uint8x16_t p3 = vld1q_u8(block + 48);
+    uint8x16_t lo = vminq_u8(vminq_u8(p0, p1), vminq_u8(p2, p3));
+    uint8x16_t hi = vmaxq_u8(vmaxq_u8(p0, p1), vmaxq_u8(p2, p3));
+    lo = vminq_u8(lo, vextq_u8(lo, lo, 8));
+    hi = vmaxq_u8(hi, vextq_u8(hi, hi, 8));
+    lo = vminq_u8(lo, vextq_u8(lo, lo, 4));
+    hi = vmaxq_u8(hi, vextq_u8(hi, hi, 4));
+    uint32_t minValue = vgetq_lane_u32(vreinterpretq_u32_u8(lo), 0);
+    uint32_t maxValue = vgetq_lane_u32(vreinterpretq_u32_u8(hi), 0);
+    memcpy(minPixel, &minValue, 4);
+    memcpy(maxPixel, &maxValue, 4);
+#else
+    for (int c = 0; c < 4; c++) {
+        minPixel[c] = maxPixel[c] = block[c];
+    }
+    for (int i = 1; i < 16; i++) {
+        for (int c = 0; c < 4; c++) {
+            uint8_t v = block[i * 4 + c];
+            if (v < minPixel[c]) minPixel[c] = v;
+            if (v > maxPixel[c]) maxPixel[c] = v;
+        }
+    }
+#endif
+}
+
+inline uint16_t pack565(int r, int g, int b) {
+    return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+// The 8-bit color a 565 endpoint decodes to, as r, g, b
+inline void unpack565(uint16_t color, int* rgb) {
+    int r = (color >> 11) & 31, g = (color >> 5) & 63, b = color & 31;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+// Encode one block of 16 BGRA pixels into 16 bytes of BC3
+inline void encodeBlock(const uint8_t* block, uint8_t* out) {
+    uint8_t lo[4], hi[4];
+    blockBounds(block, lo, hi);
+
+    // Alpha: 8-value mode between the inset extremes. Position t along
+    // [alpha1, alpha0] in sevenths maps to the index that decodes closest.
+    static const uint8_t kAlphaIndex[8] = { 1, 7, 6, 5, 4, 3, 2, 0 };
+    int insetAlpha = (hi[3] - lo[3]) >> 5;
+    int alpha0 = hi[3] - insetAlpha;
+    int alpha1 = lo[3] + insetAlpha;
+    uint64_t alphaBits = 0;
+    if (alpha0 > alpha1) {
+        int range = alpha0 - alpha1;
+        for (int i = 0; i < 16; i++) {
+            int offset = block[i * 4 + 3] - alpha1;
+            int t = offset <= 0 ? 0 : (offset * 7 + range / 2) / range;
+            if (t > 7) t = 7;
+            alphaBits |= (uint64_t)kAlphaIndex[t] << (3 * i);
+        }
+    }
+    out[0] = (uint8_t)alpha0;
+    out[1] = (uint8_t)alpha1;
+    for (int k = 0; k < 6; k++) {
+        out[2 + k] = (uint8_t)(alphaBits >> (8 * k));
+    }
+
+    // Color: endpoints from the inset RGB bounding box. BC3 always decodes the
+    // color block in four-color mode, so endpoint order doesn't matter.
+    static const uint8_t kColorIndex[4] = { 1, 3, 2, 0 };
+    int insetB = (hi[0] - lo[0]) >> 4;
+    int insetG = (hi[1] - lo[1]) >> 4;
+    int insetR = (hi[2] - lo[2]) >> 4;
+    uint16_t color0 = pack565(hi[2] - insetR, hi[1] - insetG, hi[0] - insetB);
+    uint16_t color1 = pack565(lo[2] + insetR, lo[1] + insetG, lo[0] + insetB);
+    uint32_t colorBits = 0;
+    if (color0 != color1) {
+        int end0[3], end1[3];
+        unpack565(color0, end0);
+        unpack565(color1, end1);
+        int axisR = end0[0] - end1[0], axisG = end0[1] - end1[1], axisB = end0[2] - end1[2];
+        int range = axisR * axisR + axisG * axisG + axisB * axisB;
+        for (int i = 0; i < 16; i++) {
+            const uint8_t* p = block + i * 4;
+            int dot = (p[2] - end1[0]) * axisR + (p[1] - end1[1]) * axisG + (p[0] - end1[2]) * axisB;
+            int t = dot <= 0 ? 0 : (dot * 3 + range / 2) / range;
+            if (t > 3) t = 3;
+            colorBits |= (uint32_t)kColorIndex[t] << (2 * i);
+        }
+    }
+    out[8] = (uint8_t)color0;
+    out[9] = (uint8_t)(color0 >> 8);
+    out[10] = (uint8_t)color1;
+    out[11] = (uint8_t)(color1 >> 8);
+    for (int k = 0; k < 4; k++) {
+        out[12 + k] = (uint8_t)(colorBits >> (8 * k));
+    }
+}
+
+// Encode the rw x rh rectangle at (x, y) of a w x h BGRA frame — x and y
+// multiples of 4 — into BC3 blocks, row by row. Returns the bytes written,
+// compressedSize(rw, rh).
+inline size_t encodeRect(const uint8_t* frame, int w, int h, size_t stride,
+                         int x, int y, int rw, int rh, uint8_t* out) {
+    uint8_t block[64];
+    uint8_t* next = out;
+    for (int by = y; by < y + rh; by += 4) {
+        for (int bx = x; bx < x + rw; bx += 4) {
+            loadBlock(frame, w, h, stride, bx, by, block);
+            encodeBlock(block, next);
+            next += kBlockBytes;
+        }
+    }
+    return (size_t)(next - out);
+}
+
+} // namespace bc3
+
+#endif // STEAM_OVERLAY_BC3_ENCODER_H
@@ -9,6 +9,15 @@
       "conditions": [
         ['OS=="mac"', {
           "sources": [ "macos-overlay.mm" ],
+          "actions": [
+            {
+              "action_name": "embed_overlay_shaders",
+              "inputs": [ "overlay-shaders.metal", "embed-metal-shaders.js" ],
+              "outputs": [ "<(SHARED_INTERMEDIATE_DIR)/overlay-shaders.h" ],
+              "action": [ "node", "embed-metal-shaders.js", "overlay-shaders.metal", "<(SHARED_INTERMEDIATE_DIR)/overlay-shaders.h" ]
+            }
+          ],
+          "include_dirs": [ "<(SHARED_INTERMEDIATE_DIR)" ],
           "xcode_settings": {
             "OTHER_CFLAGS": [
               "-ObjC++",
@@ -18,7 +27,8 @@
               "-framework Cocoa",
               "-framework Metal",
               "-framework MetalKit",
-              "-framework QuartzCore"
+              "-framework QuartzCore",
+              "-framework IOSurface"
             ]
           }
         }],
@@ -27,7 +37,9 @@
           "libraries": [
             "-lopengl32",
             "-lgdi32",
-            "-luser32"
+            "-luser32",
+            "-ld3d11",
+            "-ldwmapi"
           ],
           "msvs_settings": {
             "VCCLCompilerTool": {
@@ -49,6 +61,32 @@
           ]
         }]
       ]
+    },
+    {
+      "target_name": "steam-native",
+      "sources": [ "steam-native.cpp" ],
+      "defines": [ "NAPI_DISABLE_CPP_EXCEPTIONS" ],
+      "conditions": [
+        ['OS=="mac"', {
+          "xcode_settings": {
+            "OTHER_CFLAGS": [ "-std=c++17" ]
+          }
+        }],
+        ['OS=="win"', {
+          "msvs_settings": {
+            "VCCLCompilerTool": {
+              "AdditionalOptions": [ "/std:c++17" ]
+            }
+          }
+        }],
+        ['OS=="linux"', {
+          "libraries": [ "-ldl" ],
+          "cflags_cc": [
+            "-std=c++17",
+            "-fPIC"
+          ]
+        }]
+      ]
     }
   ]
 }
@@ -0,0 +1,77 @@
+#!/usr/bin/env node
+
+/**
+ * Build step for the macOS overlay (binding.gyp action)
+ *
+ * Compiles overlay-shaders.metal into a .metallib with the Metal toolchain and
+ * writes a header embedding both the library and the source into the addon.
+ * At runtime the overlay loads the precompiled library, so creating a window
+ * doesn't compile shaders; the source is the fallback when the library can't
+ * be loaded. Without the toolchain (`xcrun metal` missing, e.g. a Command Line
+ * Tools install) the header only carries the source and the build still works.
+ *
+ * Usage: node embed-metal-shaders.js <shaders.metal> <output.h>
+ */
+
+const { execFileSync } = require('child_process');
+const fs = require('fs');
+const path = require('path');
+
+// Oldest macOS the overlay supports (Metal 2)
+const MIN_MACOS_VERSION = '10.15';
+
+const [sourcePath, outputPath] = process.argv.slice(2);
+if (!sourcePath || !outputPath) {
+  console.error('Usage: node embed-metal-shaders.js <shaders.metal> <output.h>');
+  process.exit(1);
+}
+
+const source = fs.readFileSync(sourcePath, 'utf8');
+fs.mkdirSync(path.dirname(outputPath), { recursive: true });
+
+function compileLibrary() {
+  const base = path.join(path.dirname(outputPath), path.basename(sourcePath, '.metal'));
+  const airPath = `${base}.air`;
+  const libraryPath = `${base}.metallib`;
+  try {
+    execFileSync('xcrun', ['-sdk', 'macosx', 'metal', '-c', sourcePath, '-o', airPath,
+      `-mmacosx-version-min=${MIN_MACOS_VERSION}`], { stdio: 'pipe' });
+    execFileSync('xcrun', ['-sdk', 'macosx', 'metallib', airPath, '-o', libraryPath], { stdio: 'pipe' });
+    return fs.readFileSync(libraryPath);
+  } catch (error) {
+    const detail = error.stderr ? error.stderr.toString().trim() : error.message;
+    console.warn(`[embed-metal-shaders] Metal toolchain unavailable, shaders compile at runtime: ${detail}`);
+    return null;
+  }
+}
+
+function byteArray(bytes) {
+  const lines = [];
+  for (let i = 0; i < bytes.length; i += 16) {
+    lines.push('    ' + Array.from(bytes.subarray(i, i + 16), (b) => `0x${b.toString(16).padStart(2, '0')}`).join(', ') + ',');
+  }
+  return lines.join('\n');
+}
+
+const library = compileLibrary();
+
+const header = `// Generated by embed-metal-shaders.js from ${path.basename(sourcePath)} — do not edit
+
+#ifndef STEAM_OVERLAY_SHADERS_H
+#define STEAM_OVERLAY_SHADERS_H
+
+#include <cstddef>
+
+// Shader source, compiled at runtime when the precompiled library is missing or rejected
+static const char kOverlayShaderSource[] = ${JSON.stringify(source)};
+
+// Precompiled .metallib; empty when the build had no Metal toolchain
+static const size_t kOverlayShaderLibrarySize = ${library ? library.length : 0};
+static const unsigned char kOverlayShaderLibrary[] = {
+${library ? byteArray(library) : '    0x00,'}
+};
+
+#endif // STEAM_OVERLAY_SHADERS_H
+`;
+
+fs.writeFileSync(outputPath, header);
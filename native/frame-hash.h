@@ -0,0 +1,214 @@
+// Fast content hash for BGRA overlay frames — shared by all overlay backends.
+// Used to detect frames identical to the previous one so the texture upload and
+// buffer swap can be skipped. Structure follows XXH3's long-input loop: 64-byte
+// stripes accumulated into eight 64-bit lanes with a per-stripe key, scrambled
+// every 1 KiB block so stripe order matters. Not a stable or portable hash —
+// values are only ever compared within one process.
+
+#ifndef STEAM_OVERLAY_FRAME_HASH_H
+#define STEAM_OVERLAY_FRAME_HASH_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FRAME_HASH_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define FRAME_HASH_NEON 1
+#endif
+
+namespace frame_hash {
+
+static const uint64_t kPrime64_1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t kPrime64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t kPrime64_3 = 0x165667B19E3779F9ULL;
+static const uint32_t kPrime32_1 = 0x9E3779B1U;
+
+static const size_t kStripeBytes = 64;          // one stripe = 8 lanes x 8 bytes
+static const size_t kStripesPerBlock = 16;      // scramble every 1 KiB
+static const size_t kSecretBytes = kStripeBytes + (kStripesPerBlock - 1) * 8;
+
+inline uint64_t read64(const uint8_t* p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t avalanche(uint64_t h) {
+    h ^= h >> 33;
+    h *= kPrime64_2;
+    h ^= h >> 29;
+    h *= kPrime64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+// Key material: stripe n of a block uses secret[8n .. 8n+63], as in XXH3
+inline const uint8_t* secret() {
+    struct Secret {
+        uint8_t bytes[kSecretBytes];
+        Secret() {
+            uint64_t x = kPrime64_1;
+            for (size_t i = 0; i < kSecretBytes; i += 8) {
+                // splitmix64
+                x += 0x9E3779B97F4A7C15ULL;
+                uint64_t z = x;
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+                z ^= z >> 31;
+                memcpy(bytes + i, &z, sizeof(z));
+            }
+        }
+    };
+    static const Secret s;
+    return s.bytes;
+}
+
+// acc[j] += lo32(d^k)*hi32(d^k) + d[j^1] for each of the 8 lanes of one stripe
+inline void accumulateStripe(uint64_t* acc, const uint8_t* data, const uint8_t* key) {
+#if defined(FRAME_HASH_SSE2)
+    for (int i = 0; i < 4; i++) {
+        __m128i a  = _mm_loadu_si128((const __m128i*)(acc) + i);
+        __m128i d  = _mm_loadu_si128((const __m128i*)(data) + i);
+        __m128i k  = _mm_loadu_si128((const __m128i*)(key) + i);
+        __m128i dk = _mm_xor_si128(d, k);
+        __m128i hi = _mm_shuffle_epi32(dk, _MM_SHUFFLE(0, 3, 0, 1));
+        __m128i product = _mm_mul_epu32(dk, hi);
+        __m128i swapped = _mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2));
+        a = _mm_add_epi64(a, _mm_add_epi64(swapped, product));
+        _mm_storeu_si128((__m128i*)(acc) + i, a);
+    }
+#elif defined(FRAME_HASH_NEON)
+    for (int i = 0; i < 4; i++) {
+        uint64x2_t a  = vld1q_u64(acc + i * 2);
+        uint64x2_t d  = vreinterpretq_u64_u8(vld1q_u8(data + i * 16));
+        uint64x2_t k  = vreinterpretq_u64_u8(vld1q_u8(key + i * 16));
+        uint64x2_t dk = veorq_u64(d, k);
+        uint64x2_t product = vmull_u32(vmovn_u64(dk), vshrn_n_u64(dk, 32));
+        uint64x2_t swapped = vextq_u64(d, d, 1);
+        a = vaddq_u64(a, vaddq_u64(swapped, product));
+        vst1q_u64(acc + i * 2, a);
+    }
+#else
+    for (int j = 0; j < 8; j++) {
+        uint64_t d  = read64(data + j * 8);
+        uint64_t dk = d ^ read64(key + j * 8);
+        acc[j ^ 1] += d;
+        acc[j] += (dk & 0xFFFFFFFFULL) * (dk >> 32);
+    }
+#endif
+}
+
+// acc = (acc ^ (acc >> 47) ^ key) * prime32, once per block
+inline void scramble(uint64_t* acc, const uint8_t* key) {
+#if defined(FRAME_HASH_SSE2)
+    const __m128i prime = _mm_set1_epi32((int)kPrime32_1);
+    for (int i = 0; i < 4; i++) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(acc) + i);
+        __m128i k = _mm_loadu_si128((const __m128i*)(key) + i);
+        a = _mm_xor_si128(a, _mm_srli_epi64(a, 47));
+        a = _mm_xor_si128(a, k);
+        __m128i lo = _mm_mul_epu32(a, prime);
+        __m128i hi = _mm_mul_epu32(_mm_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+        a = _mm_add_epi64(lo, _mm_slli_epi64(hi, 32));
+        _mm_storeu_si128((__m128i*)(acc) + i, a);
+    }
+#else
+    for (int j = 0; j < 8; j++) {
+        uint64_t a = acc[j];
+        a ^= a >> 47;
+        a ^= read64(key + j * 8);
+        a *= kPrime32_1;
+        acc[j] = a;
+    }
+#endif
+}
+
+// Hash `length` bytes. SSE2 on x86-64, NEON on ARM64, scalar elsewhere.
+inline uint64_t hashFrame(const uint8_t* data, size_t length) {
+    const uint8_t* key = secret();
+    uint64_t acc[8] = {
+        kPrime64_3, kPrime64_1, kPrime64_2, kPrime64_1 ^ kPrime64_3,
+        kPrime64_2 ^ kPrime64_3, kPrime64_1 + kPrime64_2, kPrime64_3 * 3, kPrime64_2 * 5
+    };
+
+    const size_t blockBytes = kStripeBytes * kStripesPerBlock;
+    size_t offset = 0;
+
+    for (; offset + blockBytes <= length; offset += blockBytes) {
+        for (size_t s = 0; s < kStripesPerBlock; s++) {
+            accumulateStripe(acc, data + offset + s * kStripeBytes, key + s * 8);
+        }
+        scramble(acc, key + kSecretBytes - kStripeBytes);
+    }
+
+    // Remaining whole stripes of the last partial block
+    size_t stripe = 0;
+    for (; offset + kStripeBytes <= length; offset += kStripeBytes, stripe++) {
+        accumulateStripe(acc, data + offset, key + stripe * 8);
+    }
+
+    uint64_t h = (uint64_t)length * kPrime64_1;
+    for (int j = 0; j < 8; j++) {
+        h = (h ^ avalanche(acc[j] + (uint64_t)j)) * kPrime64_1;
+    }
+
+    // Tail shorter than one stripe
+    for (; offset + 8 <= length; offset += 8) {
+        h ^= avalanche(read64(data + offset));
+        h = (h << 27 | h >> 37) * kPrime64_1;
+    }
+    for (; offset < length; offset++) {
+        h ^= (uint64_t)data[offset] * kPrime64_3;
+        h = (h << 11 | h >> 53) * kPrime64_1;
+    }
+
+    return avalanche(h);
+}
+
+// Hash a rectangle of a larger image: `rows` rows of `rowBytes` bytes, `stride`
+// bytes apart. Whole stripes of each row feed the accumulators as one stream;
+// bytes past a row's last whole stripe are mixed in separately. Used for the
+// per-tile hashes of compressed uploads (see bc3-encoder.h).
+inline uint64_t hashRect(const uint8_t* data, size_t rowBytes, size_t stride, size_t rows) {
+    const uint8_t* key = secret();
+    uint64_t acc[8] = {
+        kPrime64_3, kPrime64_1, kPrime64_2, kPrime64_1 ^ kPrime64_3,
+        kPrime64_2 ^ kPrime64_3, kPrime64_1 + kPrime64_2, kPrime64_3 * 3, kPrime64_2 * 5
+    };
+
+    uint64_t tail = 0;
+    size_t stripe = 0;
+    for (size_t r = 0; r < rows; r++) {
+        const uint8_t* row = data + r * stride;
+        size_t offset = 0;
+        for (; offset + kStripeBytes <= rowBytes; offset += kStripeBytes) {
+            accumulateStripe(acc, row + offset, key + stripe * 8);
+            if (++stripe == kStripesPerBlock) {
+                scramble(acc, key + kSecretBytes - kStripeBytes);
+                stripe = 0;
+            }
+        }
+        for (; offset + 8 <= rowBytes; offset += 8) {
+            tail ^= avalanche(read64(row + offset));
+            tail = (tail << 27 | tail >> 37) * kPrime64_1;
+        }
+        for (; offset < rowBytes; offset++) {
+            tail ^= (uint64_t)row[offset] * kPrime64_3;
+            tail = (tail << 11 | tail >> 53) * kPrime64_1;
+        }
+    }
+
+    uint64_t h = (uint64_t)(rowBytes * rows) * kPrime64_1;
+    for (int j = 0; j < 8; j++) {
+        h = (h ^ avalanche(acc[j] + (uint64_t)j)) * kPrime64_1;
+    }
+    return avalanche(h ^ tail);
+}
+
+} // namespace frame_hash
+
+#endif // STEAM_OVERLAY_FRAME_HASH_H
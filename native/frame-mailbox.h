@@ -0,0 +1,158 @@
+// Single-slot "latest frame wins" mailbox between the N-API thread and a
+// per-window render thread — shared by the Linux and Windows OpenGL backends.
+//
+// Three slots rotate between producer, consumer and the shared "latest" slot.
+// publish() and take() are a single atomic exchange each, so neither side ever
+// blocks on the other: the producer always has a free slot to write into, and a
+// frame that hasn't been taken yet is simply replaced by the newer one.
+
+#ifndef STEAM_OVERLAY_FRAME_MAILBOX_H
+#define STEAM_OVERLAY_FRAME_MAILBOX_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Sub-rectangle of a frame in pixels, top-left origin — used for dirty-region uploads
+struct FrameRect {
+    int x;
+    int y;
+    int width;
+    int height;
+};
+
+// A dirty rectangle plus where its pixels live: inside a full-width frame
+// (rowPixels = frame width) or packed in a FrameSlot (rowPixels = rect width)
+struct FrameRegion {
+    FrameRect rect;
+    const uint8_t* pixels;
+    int rowPixels;
+};
+
+// Regions that read straight out of a full-size w-wide frame
+inline void regionsInFrame(const uint8_t* data, int w, const FrameRect* rects, int rectCount,
+                           std::vector<FrameRegion>& out) {
+    out.clear();
+    for (int i = 0; i < rectCount; i++) {
+        const FrameRect& r = rects[i];
+        out.push_back({ r, data + ((size_t)r.y * w + r.x) * 4, w });
+    }
+}
+
+// One frame handed to the render thread
+struct FrameSlot {
+    // Full frame (width * height * 4 BGRA bytes), or the pixels of each dirty
+    // rectangle packed back to back when isFull is false
+    std::vector<uint8_t> pixels;
+    std::vector<FrameRect> rects;
+    int width = 0;
+    int height = 0;
+    bool isFull = true;
+    // Set instead of pixels when the frame already lives in a platform GPU
+    // texture (shared-texture import); the backend knows the concrete type
+    void* gpuTexture = nullptr;
+
+    void setFull(const uint8_t* data, int w, int h) {
+        size_t size = (size_t)w * (size_t)h * 4;
+        pixels.resize(size);
+        memcpy(pixels.data(), data, size);
+        rects.clear();
+        width = w;
+        height = h;
+        isFull = true;
+        gpuTexture = nullptr;
+    }
+
+    // Point the slot at a GPU texture holding the whole frame. Keeps the pixel
+    // storage allocated for the next CPU frame.
+    void setTexture(void* texture, int w, int h) {
+        rects.clear();
+        width = w;
+        height = h;
+        isFull = true;
+        gpuTexture = texture;
+    }
+
+    // Copy only the dirty rectangles out of a full-size frame. With no rectangles
+    // the slot just asks for the current texture to be presented again.
+    void setRegions(const uint8_t* data, int w, int h, const FrameRect* frameRects, int rectCount) {
+        size_t size = 0;
+        for (int i = 0; i < rectCount; i++) {
+            size += (size_t)frameRects[i].width * (size_t)frameRects[i].height * 4;
+        }
+        pixels.resize(size);
+        rects.assign(frameRects, frameRects + rectCount);
+
+        size_t offset = 0;
+        for (int i = 0; i < rectCount; i++) {
+            const FrameRect& r = frameRects[i];
+            size_t rowBytes = (size_t)r.width * 4;
+            for (int row = 0; row < r.height; row++) {
+                memcpy(pixels.data() + offset, data + ((size_t)(r.y + row) * w + r.x) * 4, rowBytes);
+                offset += rowBytes;
+            }
+        }
+        width = w;
+        height = h;
+        isFull = false;
+        gpuTexture = nullptr;
+    }
+
+    // Regions pointing into the packed pixels of a non-full slot
+    void packedRegions(std::vector<FrameRegion>& out) const {
+        out.clear();
+        size_t offset = 0;
+        for (const FrameRect& r : rects) {
+            out.push_back({ r, pixels.data() + offset, r.width });
+            offset += (size_t)r.width * (size_t)r.height * 4;
+        }
+    }
+};
+
+class FrameMailbox {
+public:
+    static const int kSlotCount = 3;
+
+    // Slot the producer fills before calling publish()
+    FrameSlot& writeSlot() { return slots[writeIndex]; }
+
+    // Stable indices of the producer's and consumer's current slots, for
+    // per-slot resources that must not be touched by the other side
+    int writeSlotIndex() const { return (int)writeIndex; }
+    int readSlotIndex() const { return (int)readIndex; }
+
+    // True while a published frame is still waiting for the consumer.
+    // Only publish() sets this, so the answer is stable for the producer.
+    bool hasPendingFrame() const {
+        return (latest.load(std::memory_order_acquire) & kFreshBit) != 0;
+    }
+
+    // Make the write slot the latest frame. Returns true if it replaced a frame
+    // the consumer never took.
+    bool publish() {
+        uint32_t previous = latest.exchange(writeIndex | kFreshBit, std::memory_order_acq_rel);
+        writeIndex = previous & kIndexMask;
+        return (previous & kFreshBit) != 0;
+    }
+
+    // Consumer: claim the newest frame, or nullptr if nothing new was published.
+    // The returned slot stays valid until the next take().
+    FrameSlot* take() {
+        if (!hasPendingFrame()) return nullptr;
+        uint32_t previous = latest.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = previous & kIndexMask;
+        return &slots[readIndex];
+    }
+
+private:
+    static const uint32_t kIndexMask = 0x3;
+    static const uint32_t kFreshBit = 0x4;
+
+    FrameSlot slots[kSlotCount];
+    std::atomic<uint32_t> latest{2};
+    uint32_t writeIndex = 0;  // producer-owned
+    uint32_t readIndex = 1;   // consumer-owned
+};
+
+#endif // STEAM_OVERLAY_FRAME_MAILBOX_H
@@ -0,0 +1,144 @@
+// Tiled frame uploads — shared by all overlay backends.
+//
+// TileTracker keeps a content hash per fixed-size tile of the previous frame,
+// so only tiles that changed are uploaded: raw BGRA on Linux and Windows, or
+// BC3 blocks with compressedTextures (bc3-encoder.h).
+//
+// The OpenGL backends treat the frame texture as an atlas. The frame sits in
+// its top-left corner, and the atlas only ever grows, geometrically
+// (growCapacity), so a window resize reuses the existing storage instead of
+// deleting and reallocating the texture. appendEdgeGutters copies the frame's
+// last column and row one texel further, so bilinear filtering at the frame's
+// edge never reads texels outside the frame.
+
+#ifndef STEAM_OVERLAY_FRAME_TILES_H
+#define STEAM_OVERLAY_FRAME_TILES_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "frame-hash.h"
+#include "frame-mailbox.h"
+
+namespace frame_tiles {
+
+static const int kTileSize = 128;   // tile edge in pixels for raw BGRA uploads
+
+// Atlas edge length (in texels) for a frame edge of `needed` texels, given the
+// current length. Returns current when the frame already fits with its gutter.
+// Otherwise grows by at least half, rounded up to whole tiles, and stops at
+// maxSize (GL_MAX_TEXTURE_SIZE).
+inline int growCapacity(int current, int needed, int maxSize) {
+    int wanted = needed + 1;  // room for the gutter
+    if (maxSize > 0 && wanted > maxSize) wanted = needed > maxSize ? needed : maxSize;
+    if (current >= wanted) return current;
+
+    int grown = current + current / 2;
+    if (grown < wanted) grown = wanted;
+    grown = (grown + kTileSize - 1) / kTileSize * kTileSize;
+    if (maxSize > 0 && grown > maxSize) grown = wanted;
+    return grown;
+}
+
+// Add regions that repeat the frame's right column and bottom row (and the
+// corner) one texel outside a w x h frame, for every region touching the
+// frame's edge. Only edges with atlas space left beyond them are padded.
+inline void appendEdgeGutters(std::vector<FrameRegion>& regions, int w, int h,
+                              int capacityWidth, int capacityHeight) {
+    bool padRight = capacityWidth > w;
+    bool padBottom = capacityHeight > h;
+    if (!padRight && !padBottom) return;
+
+    size_t count = regions.size();
+    for (size_t i = 0; i < count; i++) {
+        FrameRegion region = regions[i];  // push_back may reallocate
+        const FrameRect& r = region.rect;
+        if (r.width <= 0 || r.height <= 0) continue;
+        bool right = padRight && r.x + r.width == w;
+        bool bottom = padBottom && r.y + r.height == h;
+        const uint8_t* lastRow = region.pixels + (size_t)(r.height - 1) * region.rowPixels * 4;
+
+        if (right) {
+            regions.push_back({ { w, r.y, 1, r.height }, region.pixels + (size_t)(r.width - 1) * 4,
+                                region.rowPixels });
+        }
+        if (bottom) {
+            regions.push_back({ { r.x, h, r.width, 1 }, lastRow, region.rowPixels });
+        }
+        if (right && bottom) {
+            regions.push_back({ { w, h, 1, 1 }, lastRow + (size_t)(r.width - 1) * 4, region.rowPixels });
+        }
+    }
+}
+
+// Remembers a content hash per tile of the previous frame and reports which
+// tiles changed. Runs of changed tiles within a tile row are merged, so a fully
+// changed frame costs one upload per tile row instead of one per tile.
+class TileTracker {
+public:
+    explicit TileTracker(int tileSize = kTileSize) : tileSize(tileSize) {}
+
+    // Forget the previous frame: every tile counts as changed next time,
+    // e.g. after the texture was recreated or written by a region upload
+    void reset() { valid = false; }
+
+    // Fill `changed` with the tiles of frame (tightly packed w x h BGRA) that
+    // differ from the previous call's frame. Everything changes on a resize.
+    void collectChanged(const uint8_t* frame, int w, int h, std::vector<FrameRect>& changed) {
+        changed.clear();
+        int cols = (w + tileSize - 1) / tileSize;
+        int rows = (h + tileSize - 1) / tileSize;
+        bool all = !valid || w != frameWidth || h != frameHeight;
+        if (all) {
+            hashes.assign((size_t)cols * rows, 0);
+            frameWidth = w;
+            frameHeight = h;
+        }
+        valid = true;
+        changedTiles = 0;
+
+        size_t stride = (size_t)w * 4;
+        for (int ty = 0; ty < rows; ty++) {
+            int y = ty * tileSize;
+            int tileHeight = h - y < tileSize ? h - y : tileSize;
+            int runStart = -1;
+            for (int tx = 0; tx <= cols; tx++) {
+                bool tileChanged = false;
+                if (tx < cols) {
+                    int x = tx * tileSize;
+                    int tileWidth = w - x < tileSize ? w - x : tileSize;
+                    uint64_t hash = frame_hash::hashRect(frame + (size_t)y * stride + (size_t)x * 4,
+                                                         (size_t)tileWidth * 4, stride, (size_t)tileHeight);
+                    uint64_t& previous = hashes[(size_t)ty * cols + tx];
+                    tileChanged = all || hash != previous;
+                    previous = hash;
+                }
+                if (tileChanged) {
+                    changedTiles++;
+                    if (runStart < 0) runStart = tx;
+                } else if (runStart >= 0) {
+                    int x = runStart * tileSize;
+                    int end = tx * tileSize < w ? tx * tileSize : w;
+                    changed.push_back({ x, y, end - x, tileHeight });
+                    runStart = -1;
+                }
+            }
+        }
+    }
+
+    // Whether the last collectChanged() found every tile changed
+    bool allChanged() const { return changedTiles == hashes.size(); }
+
+private:
+    std::vector<uint64_t> hashes;
+    int tileSize;
+    int frameWidth = 0;
+    int frameHeight = 0;
+    size_t changedTiles = 0;
+    bool valid = false;
+};
+
+} // namespace frame_tiles
+
+#endif // STEAM_OVERLAY_FRAME_TILES_H
@@ -0,0 +1,115 @@
+// Per-stage frame timing for the overlay backends — reported through getOverlayStats().
+//
+// Each stage keeps a ring of its most recent samples and answers percentile
+// queries from a copy of them, so a reader never stalls the render thread for
+// longer than a short memcpy. Samples are milliseconds measured on the steady clock.
+
+#ifndef STEAM_OVERLAY_FRAME_TIMING_H
+#define STEAM_OVERLAY_FRAME_TIMING_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+namespace frame_timing {
+
+typedef std::chrono::steady_clock Clock;
+
+// Render stages, in pipeline order:
+//   submit — renderFrame on the caller thread (hash plus mailbox copy, or the whole synchronous path)
+//   upload — texture upload
+//   draw   — drawing the textured quad / encoding the draw
+//   swap   — SwapBuffers / glXSwapBuffers, or waiting for the next drawable on macOS
+//   frame  — one presented frame end to end, on whichever thread presents
+enum Stage {
+    kStageSubmit = 0,
+    kStageUpload,
+    kStageDraw,
+    kStageSwap,
+    kStageFrame,
+    kStageCount
+};
+
+static const char* const kStageNames[kStageCount] = { "submit", "upload", "draw", "swap", "frame" };
+
+// Recent samples kept per stage; enough for stable p99s at 60-240 fps
+static const size_t kSampleCount = 512;
+
+inline double elapsedMs(Clock::time_point since) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+}
+
+struct StageSummary {
+    unsigned long long count = 0;
+    double last = 0.0;
+    double average = 0.0;
+    double total = 0.0;
+    double p50 = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+};
+
+class StageHistogram {
+public:
+    void record(double ms) {
+        std::lock_guard<std::mutex> lock(mutex);
+        samples[next] = ms;
+        next = (next + 1) % kSampleCount;
+        if (filled < kSampleCount) filled++;
+        count++;
+        last = ms;
+        total += ms;
+    }
+
+    StageSummary summary() const {
+        StageSummary result;
+        double sorted[kSampleCount];
+        size_t n;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            n = filled;
+            std::copy(samples, samples + n, sorted);
+            result.count = count;
+            result.last = last;
+            result.total = total;
+        }
+        if (n == 0) return result;
+
+        result.average = result.total / (double)result.count;
+        result.p50 = percentile(sorted, n, 0.50);
+        result.p95 = percentile(sorted, n, 0.95);
+        result.p99 = percentile(sorted, n, 0.99);
+        return result;
+    }
+
+private:
+    // Nearest-rank percentile; reorders values
+    static double percentile(double* values, size_t n, double q) {
+        size_t rank = (size_t)(q * (double)(n - 1) + 0.5);
+        std::nth_element(values, values + rank, values + n);
+        return values[rank];
+    }
+
+    mutable std::mutex mutex;
+    double samples[kSampleCount] = {};
+    size_t next = 0;
+    size_t filled = 0;
+    unsigned long long count = 0;
+    double last = 0.0;
+    double total = 0.0;
+};
+
+// All stages of one overlay window, plus how often its texture had to be
+// reallocated (every resize throws the old storage away)
+struct FrameTimings {
+    StageHistogram stages[kStageCount];
+    std::atomic<unsigned long long> textureRecreations{0};
+
+    void record(Stage stage, double ms) { stages[stage].record(ms); }
+};
+
+} // namespace frame_timing
+
+#endif // STEAM_OVERLAY_FRAME_TIMING_H
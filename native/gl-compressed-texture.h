@@ -0,0 +1,110 @@
+// BC3-compressed overlay texture for the OpenGL backends (Linux GLX, Windows WGL).
+// With compressedTextures enabled the texture uses GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+// storage, and each frame only the 64x64 tiles whose content changed are
+// encoded (bc3-encoder.h) and uploaded with glCompressedTexSubImage2D — a
+// quarter of the bytes of a BGRA8 upload for the tiles that are sent at all,
+// and a quarter of the VRAM. Needs GL_EXT_texture_compression_s3tc; init()
+// returns false otherwise and the backend keeps uploading raw BGRA.
+// Include after the platform's GL headers.
+
+#ifndef STEAM_OVERLAY_GL_COMPRESSED_TEXTURE_H
+#define STEAM_OVERLAY_GL_COMPRESSED_TEXTURE_H
+
+#include <cstring>
+#include <vector>
+
+#include "bc3-encoder.h"
+#include "frame-tiles.h"
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+namespace gl_compressed {
+
+typedef void (APIENTRY* CompressedTexImage2DProc)(GLenum, GLint, GLenum, GLsizei, GLsizei, GLint, GLsizei, const void*);
+typedef void (APIENTRY* CompressedTexSubImage2DProc)(GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum, GLsizei, const void*);
+
+// Resolves a GL entry point by name; null when it isn't available
+typedef void* (*ProcLoader)(const char* name);
+
+class CompressedTexture {
+public:
+    // Needs the context current
+    bool init(ProcLoader load) {
+        const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+        if (!extensions || !strstr(extensions, "GL_EXT_texture_compression_s3tc")) {
+            lastError = "GL_EXT_texture_compression_s3tc not supported";
+            return false;
+        }
+        compressedTexImage2D = (CompressedTexImage2DProc)load("glCompressedTexImage2D");
+        compressedTexSubImage2D = (CompressedTexSubImage2DProc)load("glCompressedTexSubImage2D");
+        if (!compressedTexImage2D || !compressedTexSubImage2D) {
+            lastError = "missing compressed texture entry points";
+            return false;
+        }
+        ready = true;
+        return true;
+    }
+
+    bool isReady() const { return ready; }
+
+    // Why init() failed, for the backend's log
+    const char* error() const { return lastError; }
+
+    // BC3 storage for the texture bound to GL_TEXTURE_2D, zero-filled — the
+    // atlas capacity, not the frame size. Every tile of the next upload counts as changed.
+    void allocate(int w, int h) {
+        std::vector<uint8_t> zeros(bc3::compressedSize(w, h), 0);
+        compressedTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, w, h, 0,
+                             (GLsizei)zeros.size(), zeros.data());
+        tracker.reset();
+    }
+
+    // Encode the tiles of frame (tightly packed w x h BGRA, in the top-left of a
+    // capacityWidth x capacityHeight texture) that changed since the last upload
+    // and upload them into the bound texture. Returns the compressed bytes uploaded.
+    size_t upload(const uint8_t* frame, int w, int h, int capacityWidth, int capacityHeight) {
+        tracker.collectChanged(frame, w, h, tiles);
+        // Sub-image uploads must cover whole blocks unless they reach the texture's
+        // edge. Blocks past the frame's edge repeat its last column and row, which
+        // doubles as the atlas gutter, so edge tiles extend one texel further.
+        int paddedWidth = paddedEdge(w, capacityWidth);
+        int paddedHeight = paddedEdge(h, capacityHeight);
+        size_t total = 0;
+        for (FrameRect tile : tiles) {
+            if (tile.x + tile.width == w) tile.width = paddedWidth - tile.x;
+            if (tile.y + tile.height == h) tile.height = paddedHeight - tile.y;
+            encoded.resize(bc3::compressedSize(tile.width, tile.height));
+            size_t bytes = bc3::encodeRect(frame, w, h, (size_t)w * 4, tile.x, tile.y,
+                                           tile.width, tile.height, encoded.data());
+            compressedTexSubImage2D(GL_TEXTURE_2D, 0, tile.x, tile.y, tile.width, tile.height,
+                                    GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, (GLsizei)bytes, encoded.data());
+            total += bytes;
+        }
+        return total;
+    }
+
+private:
+    // Frame edge plus gutter, rounded up to whole blocks, within the texture
+    static int paddedEdge(int frameEdge, int capacity) {
+        int padded = frameEdge < capacity ? (frameEdge + 1 + 3) / 4 * 4 : frameEdge;
+        return padded < capacity ? padded : capacity;
+    }
+
+    CompressedTexImage2DProc compressedTexImage2D = nullptr;
+    CompressedTexSubImage2DProc compressedTexSubImage2D = nullptr;
+    frame_tiles::TileTracker tracker{ bc3::kTileSize };
+    std::vector<FrameRect> tiles;
+    std::vector<uint8_t> encoded;
+    const char* lastError = "not initialized";
+    bool ready = false;
+};
+
+} // namespace gl_compressed
+
+#endif // STEAM_OVERLAY_GL_COMPRESSED_TEXTURE_H
@@ -0,0 +1,357 @@
+// Shader-based textured-quad renderer — shared by the Linux (GLX) and Windows (WGL)
+// OpenGL backends. Draws the overlay texture with a VAO/VBO and a GLSL 330 program
+// instead of glBegin/glEnd and the fixed-function pipeline, which some drivers
+// (Mesa under Gamescope in particular) emulate slowly, and gives textures immutable
+// glTexStorage2D storage where available. Needs a GL 3.3+ context; init() returns
+// false otherwise and the backend keeps its legacy immediate-mode path.
+// The shaders only use core-profile features, so it works in core and
+// compatibility contexts alike. Frames captured below the window's resolution
+// are stretched with a second, sharpening program (see kUpscaleFragmentShader).
+// The frame may fill only the top-left part of its texture (frame-tiles.h);
+// draw() is told how much of it to sample.
+
+#ifndef STEAM_OVERLAY_GL_QUAD_RENDERER_H
+#define STEAM_OVERLAY_GL_QUAD_RENDERER_H
+
+#include <cstdio>
+#include <cstring>
+#include <cstddef>
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+#ifndef GL_BGRA
+#define GL_BGRA 0x80E1
+#endif
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER 0x8892
+#endif
+#ifndef GL_STATIC_DRAW
+#define GL_STATIC_DRAW 0x88E4
+#endif
+#ifndef GL_FRAGMENT_SHADER
+#define GL_FRAGMENT_SHADER 0x8B30
+#endif
+#ifndef GL_VERTEX_SHADER
+#define GL_VERTEX_SHADER 0x8B31
+#endif
+#ifndef GL_COMPILE_STATUS
+#define GL_COMPILE_STATUS 0x8B81
+#endif
+#ifndef GL_LINK_STATUS
+#define GL_LINK_STATUS 0x8B82
+#endif
+
+namespace gl_quad {
+
+// Entry points beyond GL 1.1, resolved through the platform's GetProcAddress
+typedef void (APIENTRY* GenBuffersProc)(GLsizei, GLuint*);
+typedef void (APIENTRY* DeleteBuffersProc)(GLsizei, const GLuint*);
+typedef void (APIENTRY* BindBufferProc)(GLenum, GLuint);
+typedef void (APIENTRY* BufferDataProc)(GLenum, ptrdiff_t, const void*, GLenum);
+typedef void (APIENTRY* GenVertexArraysProc)(GLsizei, GLuint*);
+typedef void (APIENTRY* DeleteVertexArraysProc)(GLsizei, const GLuint*);
+typedef void (APIENTRY* BindVertexArrayProc)(GLuint);
+typedef void (APIENTRY* EnableVertexAttribArrayProc)(GLuint);
+typedef void (APIENTRY* VertexAttribPointerProc)(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*);
+typedef GLuint (APIENTRY* CreateShaderProc)(GLenum);
+typedef void (APIENTRY* DeleteShaderProc)(GLuint);
+typedef void (APIENTRY* ShaderSourceProc)(GLuint, GLsizei, const char* const*, const GLint*);
+typedef void (APIENTRY* CompileShaderProc)(GLuint);
+typedef void (APIENTRY* GetShaderivProc)(GLuint, GLenum, GLint*);
+typedef void (APIENTRY* GetShaderInfoLogProc)(GLuint, GLsizei, GLsizei*, char*);
+typedef GLuint (APIENTRY* CreateProgramProc)(void);
+typedef void (APIENTRY* DeleteProgramProc)(GLuint);
+typedef void (APIENTRY* AttachShaderProc)(GLuint, GLuint);
+typedef void (APIENTRY* LinkProgramProc)(GLuint);
+typedef void (APIENTRY* GetProgramivProc)(GLuint, GLenum, GLint*);
+typedef void (APIENTRY* GetProgramInfoLogProc)(GLuint, GLsizei, GLsizei*, char*);
+typedef void (APIENTRY* UseProgramProc)(GLuint);
+typedef void (APIENTRY* TexStorage2DProc)(GLenum, GLsizei, GLenum, GLsizei, GLsizei);
+typedef GLint (APIENTRY* GetUniformLocationProc)(GLuint, const char*);
+typedef void (APIENTRY* Uniform1fProc)(GLint, GLfloat);
+typedef void (APIENTRY* Uniform2fProc)(GLint, GLfloat, GLfloat);
+
+// Resolves a GL entry point by name; null when it isn't available
+typedef void* (*ProcLoader)(const char* name);
+
+// Full-window quad as a triangle strip: clip-space position, then texture
+// coordinate. Texture row 0 (the top of the frame) maps to the top of the window.
+static const float kQuadVertices[] = {
+    -1.0f,  1.0f,   0.0f, 0.0f,
+     1.0f,  1.0f,   1.0f, 0.0f,
+    -1.0f, -1.0f,   0.0f, 1.0f,
+     1.0f, -1.0f,   1.0f, 1.0f,
+};
+
+static const char* kVertexShader =
+    "#version 330 core\n"
+    "layout(location = 0) in vec2 position;\n"
+    "layout(location = 1) in vec2 texCoord;\n"
+    "uniform vec2 uvScale;\n"
+    "out vec2 uv;\n"
+    "void main() {\n"
+    "    uv = texCoord * uvScale;\n"
+    "    gl_Position = vec4(position, 0.0, 1.0);\n"
+    "}\n";
+
+// The sampler defaults to texture unit 0, where the backends bind the frame
+static const char* kFragmentShader =
+    "#version 330 core\n"
+    "in vec2 uv;\n"
+    "uniform sampler2D frame;\n"
+    "out vec4 color;\n"
+    "void main() {\n"
+    "    color = texture(frame, uv);\n"
+    "}\n";
+
+// Upscaling a reduced-resolution frame: bilinear sample plus an unsharp mask
+// over the four neighbouring source texels, clamped to their min/max so edges
+// get crisper without ringing halos. sharpness 0 is plain bilinear, 1 is strong.
+static const char* kUpscaleFragmentShader =
+    "#version 330 core\n"
+    "in vec2 uv;\n"
+    "uniform sampler2D frame;\n"
+    "uniform vec2 texelSize;\n"
+    "uniform float sharpness;\n"
+    "out vec4 color;\n"
+    "void main() {\n"
+    "    vec4 center = texture(frame, uv);\n"
+    "    vec4 north = texture(frame, uv - vec2(0.0, texelSize.y));\n"
+    "    vec4 south = texture(frame, uv + vec2(0.0, texelSize.y));\n"
+    "    vec4 west = texture(frame, uv - vec2(texelSize.x, 0.0));\n"
+    "    vec4 east = texture(frame, uv + vec2(texelSize.x, 0.0));\n"
+    "    vec4 lo = min(center, min(min(north, south), min(west, east)));\n"
+    "    vec4 hi = max(center, max(max(north, south), max(west, east)));\n"
+    "    vec4 blur = (north + south + west + east) * 0.25;\n"
+    "    color = clamp(center + (center - blur) * (2.0 * sharpness), lo, hi);\n"
+    "}\n";
+
+class QuadRenderer {
+public:
+    // Resolve entry points and build the program and quad. Needs the context
+    // current. Returns false (and leaves nothing allocated) below GL 3.3.
+    bool init(ProcLoader load) {
+        int major = 0, minor = 0;
+        const char* version = (const char*)glGetString(GL_VERSION);
+        if (version) sscanf(version, "%d.%d", &major, &minor);
+        if (major < 3 || (major == 3 && minor < 3)) {
+            snprintf(lastError, sizeof(lastError), "GL %d.%d context, 3.3 required", major, minor);
+            return false;
+        }
+
+        genBuffers = (GenBuffersProc)load("glGenBuffers");
+        deleteBuffers = (DeleteBuffersProc)load("glDeleteBuffers");
+        bindBuffer = (BindBufferProc)load("glBindBuffer");
+        bufferData = (BufferDataProc)load("glBufferData");
+        genVertexArrays = (GenVertexArraysProc)load("glGenVertexArrays");
+        deleteVertexArrays = (DeleteVertexArraysProc)load("glDeleteVertexArrays");
+        bindVertexArray = (BindVertexArrayProc)load("glBindVertexArray");
+        enableVertexAttribArray = (EnableVertexAttribArrayProc)load("glEnableVertexAttribArray");
+        vertexAttribPointer = (VertexAttribPointerProc)load("glVertexAttribPointer");
+        createShader = (CreateShaderProc)load("glCreateShader");
+        deleteShader = (DeleteShaderProc)load("glDeleteShader");
+        shaderSource = (ShaderSourceProc)load("glShaderSource");
+        compileShader = (CompileShaderProc)load("glCompileShader");
+        getShaderiv = (GetShaderivProc)load("glGetShaderiv");
+        getShaderInfoLog = (GetShaderInfoLogProc)load("glGetShaderInfoLog");
+        createProgram = (CreateProgramProc)load("glCreateProgram");
+        deleteProgram = (DeleteProgramProc)load("glDeleteProgram");
+        attachShader = (AttachShaderProc)load("glAttachShader");
+        linkProgram = (LinkProgramProc)load("glLinkProgram");
+        getProgramiv = (GetProgramivProc)load("glGetProgramiv");
+        getProgramInfoLog = (GetProgramInfoLogProc)load("glGetProgramInfoLog");
+        useProgram = (UseProgramProc)load("glUseProgram");
+        getUniformLocation = (GetUniformLocationProc)load("glGetUniformLocation");
+        uniform1f = (Uniform1fProc)load("glUniform1f");
+        uniform2f = (Uniform2fProc)load("glUniform2f");
+
+        if (!genBuffers || !deleteBuffers || !bindBuffer || !bufferData ||
+                !genVertexArrays || !deleteVertexArrays || !bindVertexArray ||
+                !enableVertexAttribArray || !vertexAttribPointer ||
+                !createShader || !deleteShader || !shaderSource || !compileShader ||
+                !getShaderiv || !getShaderInfoLog || !createProgram || !deleteProgram ||
+                !attachShader || !linkProgram || !getProgramiv || !getProgramInfoLog || !useProgram ||
+                !getUniformLocation || !uniform2f) {
+            snprintf(lastError, sizeof(lastError), "GL 3.3 entry points missing");
+            return false;
+        }
+
+        program = link(kFragmentShader);
+        if (!program) return false;
+
+        uvScaleLocation = getUniformLocation(program, "uvScale");
+
+        // Optional: without it reduced-scale frames are stretched bilinearly
+        if (uniform1f) {
+            upscaleProgram = link(kUpscaleFragmentShader);
+            if (upscaleProgram) {
+                upscaleUvScaleLocation = getUniformLocation(upscaleProgram, "uvScale");
+                texelSizeLocation = getUniformLocation(upscaleProgram, "texelSize");
+                sharpnessLocation = getUniformLocation(upscaleProgram, "sharpness");
+            }
+        }
+
+        genVertexArrays(1, &vertexArray);
+        bindVertexArray(vertexArray);
+        genBuffers(1, &vertexBuffer);
+        bindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+        bufferData(GL_ARRAY_BUFFER, sizeof(kQuadVertices), kQuadVertices, GL_STATIC_DRAW);
+        enableVertexAttribArray(0);
+        vertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (const void*)0);
+        enableVertexAttribArray(1);
+        vertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (const void*)(2 * sizeof(float)));
+        bindVertexArray(0);
+        bindBuffer(GL_ARRAY_BUFFER, 0);
+
+        // Immutable storage is GL 4.2 / ARB_texture_storage — optional
+        const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+        if (major > 4 || (major == 4 && minor >= 2) ||
+                (extensions && strstr(extensions, "GL_ARB_texture_storage"))) {
+            texStorage2D = (TexStorage2DProc)load("glTexStorage2D");
+        }
+
+        ready = true;
+        return true;
+    }
+
+    bool isReady() const { return ready; }
+    bool hasTextureStorage() const { return texStorage2D != nullptr; }
+    bool canSharpen() const { return upscaleProgram != 0; }
+
+    // Why init() failed, for the backend's log
+    const char* error() const { return lastError; }
+
+    // Storage for the texture bound to GL_TEXTURE_2D: immutable when supported.
+    // Immutable textures can't be resized, so callers recreate them when they grow.
+    void allocateTexture(int w, int h) {
+        if (texStorage2D) {
+            texStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, w, h);
+        } else {
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
+        }
+    }
+
+    // Clear and draw texture over the whole viewport. Needs the context current.
+    // usedU and usedV are the fraction of the texture the frame covers, from its
+    // top-left corner. A positive sharpness draws through the upscaling program;
+    // textureWidth and textureHeight are then the texture's size in texels.
+    void draw(GLuint texture, int textureWidth = 0, int textureHeight = 0, float sharpness = 0.0f,
+              float usedU = 1.0f, float usedV = 1.0f) {
+        glClear(GL_COLOR_BUFFER_BIT);
+        if (sharpness > 0.0f && upscaleProgram && textureWidth > 0 && textureHeight > 0) {
+            useProgram(upscaleProgram);
+            uniform2f(upscaleUvScaleLocation, usedU, usedV);
+            uniform2f(texelSizeLocation, 1.0f / (float)textureWidth, 1.0f / (float)textureHeight);
+            uniform1f(sharpnessLocation, sharpness);
+        } else {
+            useProgram(program);
+            uniform2f(uvScaleLocation, usedU, usedV);
+        }
+        glBindTexture(GL_TEXTURE_2D, texture);
+        bindVertexArray(vertexArray);
+        glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+        bindVertexArray(0);
+        useProgram(0);
+    }
+
+    // Delete the program and quad. Needs the context current.
+    void destroy() {
+        if (!ready) return;
+        deleteVertexArrays(1, &vertexArray);
+        deleteBuffers(1, &vertexBuffer);
+        deleteProgram(program);
+        if (upscaleProgram) deleteProgram(upscaleProgram);
+        vertexArray = 0;
+        vertexBuffer = 0;
+        program = 0;
+        upscaleProgram = 0;
+        ready = false;
+    }
+
+private:
+    // Build a program from the shared vertex shader and the given fragment shader
+    GLuint link(const char* fragmentSource) {
+        GLuint vertexShader = compile(GL_VERTEX_SHADER, kVertexShader);
+        GLuint fragmentShader = vertexShader ? compile(GL_FRAGMENT_SHADER, fragmentSource) : 0;
+        if (!fragmentShader) {
+            if (vertexShader) deleteShader(vertexShader);
+            return 0;
+        }
+
+        GLuint linked = createProgram();
+        attachShader(linked, vertexShader);
+        attachShader(linked, fragmentShader);
+        linkProgram(linked);
+        // The program keeps the compiled stages alive
+        deleteShader(vertexShader);
+        deleteShader(fragmentShader);
+
+        GLint status = 0;
+        getProgramiv(linked, GL_LINK_STATUS, &status);
+        if (!status) {
+            getProgramInfoLog(linked, sizeof(lastError), nullptr, lastError);
+            deleteProgram(linked);
+            return 0;
+        }
+        return linked;
+    }
+
+    GLuint compile(GLenum stage, const char* source) {
+        GLuint shader = createShader(stage);
+        shaderSource(shader, 1, &source, nullptr);
+        compileShader(shader);
+
+        GLint compiled = 0;
+        getShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+        if (!compiled) {
+            getShaderInfoLog(shader, sizeof(lastError), nullptr, lastError);
+            deleteShader(shader);
+            return 0;
+        }
+        return shader;
+    }
+
+    bool ready = false;
+    GLuint program = 0;
+    GLuint upscaleProgram = 0;
+    GLint uvScaleLocation = -1;
+    GLint upscaleUvScaleLocation = -1;
+    GLint texelSizeLocation = -1;
+    GLint sharpnessLocation = -1;
+    GLuint vertexArray = 0;
+    GLuint vertexBuffer = 0;
+    char lastError[512] = "";
+
+    GenBuffersProc genBuffers = nullptr;
+    DeleteBuffersProc deleteBuffers = nullptr;
+    BindBufferProc bindBuffer = nullptr;
+    BufferDataProc bufferData = nullptr;
+    GenVertexArraysProc genVertexArrays = nullptr;
+    DeleteVertexArraysProc deleteVertexArrays = nullptr;
+    BindVertexArrayProc bindVertexArray = nullptr;
+    EnableVertexAttribArrayProc enableVertexAttribArray = nullptr;
+    VertexAttribPointerProc vertexAttribPointer = nullptr;
+    CreateShaderProc createShader = nullptr;
+    DeleteShaderProc deleteShader = nullptr;
+    ShaderSourceProc shaderSource = nullptr;
+    CompileShaderProc compileShader = nullptr;
+    GetShaderivProc getShaderiv = nullptr;
+    GetShaderInfoLogProc getShaderInfoLog = nullptr;
+    CreateProgramProc createProgram = nullptr;
+    DeleteProgramProc deleteProgram = nullptr;
+    AttachShaderProc attachShader = nullptr;
+    LinkProgramProc linkProgram = nullptr;
+    GetProgramivProc getProgramiv = nullptr;
+    GetProgramInfoLogProc getProgramInfoLog = nullptr;
+    UseProgramProc useProgram = nullptr;
+    TexStorage2DProc texStorage2D = nullptr;
+    GetUniformLocationProc getUniformLocation = nullptr;
+    Uniform1fProc uniform1f = nullptr;
+    Uniform2fProc uniform2f = nullptr;
+};
+
+} // namespace gl_quad
+
+#endif // STEAM_OVERLAY_GL_QUAD_RENDERER_H
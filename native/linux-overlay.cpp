@@ -5,14 +5,20 @@
 
 #include <node_api.h>
 #include <string>
+#include <vector>
 #include <mutex>
 #include <atomic>
 #include <thread>
+#include <condition_variable>
 #include <cstdio>
 #include <cstring>
 #include <cstdlib>
 #include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <cerrno>
 #include <ctime>
+#include <chrono>
 
 // X11 and OpenGL includes
 #include <X11/Xlib.h>
@@ -25,6 +31,15 @@
 #include <GL/glx.h>
 #include <dlfcn.h>
 
+#include "frame-hash.h"
+#include "frame-mailbox.h"
+#include "shared-frame-buffer.h"
+#include "gl-quad-renderer.h"
+#include "gl-compressed-texture.h"
+#include "frame-tiles.h"
+#include "frame-timing.h"
+#include "present-timing.h"
+
 // Global debug flag - controlled from JavaScript via SteamLogger
 static bool g_debugMode = false;
 
@@ -41,64 +56,189 @@ static bool g_debugMode = false;
 #define GL_CLAMP_TO_EDGE 0x812F
 #endif
 
+// Pixel buffer objects (GL 2.1 / ARB_pixel_buffer_object)
+#ifndef GL_PIXEL_UNPACK_BUFFER
+#define GL_PIXEL_UNPACK_BUFFER 0x88EC
+#endif
+
+#ifndef GL_STREAM_DRAW
+#define GL_STREAM_DRAW 0x88E0
+#endif
+
+#ifndef GL_WRITE_ONLY
+#define GL_WRITE_ONLY 0x88B9
+#endif
+
 // GLX extension function types
 typedef GLXContext (*glXCreateContextAttribsARBProc)(Display*, GLXFBConfig, GLXContext, Bool, const int*);
 typedef void (*glXSwapIntervalEXTProc)(Display*, GLXDrawable, int);
+typedef Bool (*glXGetSyncValuesOMLProc)(Display*, GLXDrawable, int64_t*, int64_t*, int64_t*);
+typedef Bool (*glXGetMscRateOMLProc)(Display*, GLXDrawable, int32_t*, int32_t*);
 
-// Linux OpenGL/GLX Overlay Window — glXSwapBuffers is hooked by gameoverlayrenderer64.so
-class LinuxOverlayWindow {
+// Buffer object function types — not exported by libGL's GL 1.x ABI, resolved at runtime
+typedef void (*glGenBuffersProc)(GLsizei, GLuint*);
+typedef void (*glDeleteBuffersProc)(GLsizei, const GLuint*);
+typedef void (*glBindBufferProc)(GLenum, GLuint);
+typedef void (*glBufferDataProc)(GLenum, ptrdiff_t, const void*, GLenum);
+typedef void* (*glMapBufferProc)(GLenum, GLenum);
+typedef GLboolean (*glUnmapBufferProc)(GLenum);
+
+// Dmabuf import (GL_EXT_memory_object_fd), texture swizzles (GL 3.3) and sync objects (GL 3.2)
+#ifndef GL_TEXTURE_TILING_EXT
+#define GL_TEXTURE_TILING_EXT 0x9580
+#endif
+
+#ifndef GL_DEDICATED_MEMORY_OBJECT_EXT
+#define GL_DEDICATED_MEMORY_OBJECT_EXT 0x9581
+#endif
+
+#ifndef GL_LINEAR_TILING_EXT
+#define GL_LINEAR_TILING_EXT 0x9585
+#endif
+
+#ifndef GL_HANDLE_TYPE_OPAQUE_FD_EXT
+#define GL_HANDLE_TYPE_OPAQUE_FD_EXT 0x9586
+#endif
+
+#ifndef GL_TEXTURE_SWIZZLE_R
+#define GL_TEXTURE_SWIZZLE_R 0x8E42
+#define GL_TEXTURE_SWIZZLE_B 0x8E44
+#endif
+
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#define GL_ALREADY_SIGNALED 0x911A
+#define GL_CONDITION_SATISFIED 0x911C
+#endif
+
+// Memory object and sync entry points, resolved at runtime like the buffer objects.
+// Sync objects are passed as void* — GLsync is an opaque pointer.
+typedef void (*glCreateMemoryObjectsEXTProc)(GLsizei, GLuint*);
+typedef void (*glDeleteMemoryObjectsEXTProc)(GLsizei, const GLuint*);
+typedef void (*glMemoryObjectParameterivEXTProc)(GLuint, GLenum, const GLint*);
+typedef void (*glImportMemoryFdEXTProc)(GLuint, uint64_t, GLenum, GLint);
+typedef void (*glTexStorageMem2DEXTProc)(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLuint, uint64_t);
+typedef void* (*glFenceSyncProc)(GLenum, GLbitfield);
+typedef GLenum (*glClientWaitSyncProc)(void*, GLbitfield, uint64_t);
+typedef void (*glDeleteSyncProc)(void*);
+
+// GL entry point lookup for the shader renderer
+static void* loadGLProc(const char* name) {
+    return (void*)glXGetProcAddressARB((const GLubyte*)name);
+}
+
+// Number of pixel buffers in the upload ring. While the GPU is still pulling
+// frame N out of one buffer, frame N+1 is memcpy'd into the next one.
+static const int kPixelBufferCount = 2;
+
+// How long the render thread sleeps between X event checks when no frame arrives.
+// Only used when the event thread couldn't be started.
+static const int kRenderIdleWaitMs = 8;
+
+// Presents between glXGetMscRateOML queries; picks up a move to a display with another refresh rate
+static const unsigned kMscRateRefreshPresents = 120;
+
+// Refocus the overlay this long after the last forwarded input (see processEvents)
+static const long long kIdleRefocusMs = 1500;
+
+// How long a dmabuf import waits for the GPU to finish reading the buffer before
+// giving up; the producer reuses it as soon as importSharedTexture returns
+static const uint64_t kImportFenceTimeoutNs = 100ull * 1000 * 1000;
+
+// How long importSharedTexture waits for the render thread to present a dmabuf
+// (a swap plus the fence above in the worst case) before falling back to bitmaps
+static const int kImportWaitMs = 50;
+
+// Everything the overlay window listens for; all of it is forwarded or tracked by processEvents
+static const long kOverlayEventMask = ExposureMask | StructureNotifyMask | VisibilityChangeMask
+                                    | KeyPressMask | KeyReleaseMask
+                                    | ButtonPressMask | ButtonReleaseMask | PointerMotionMask
+                                    | FocusChangeMask;
+
+// X connection, FBConfig, visual and colormap shared by every overlay window,
+// with the GLX entry points resolved against them. The first window opens them
+// and the last one to be destroyed closes them, so further surfaces (tooltip or
+// notification layers) skip XOpenDisplay, the extension and preload checks and
+// FBConfig selection. Xlib is thread-safe after XInitThreads, so the windows'
+// render threads can all issue GLX calls on the one connection; each window keeps
+// its own context, because a context is current on one thread at a time and each
+// window presents from its own render thread. Windows are created on the main
+// thread or, with createOverlayWindowAsync, on a worker, so acquire and release
+// are serialized by deviceMutex.
+class LinuxOverlayDevice {
 public:
     Display* display = nullptr;
-    Window window = 0;
-    Window electronWindow = 0; // Electron XID — keyboard/mouse events are forwarded here
-    GLXContext glContext = nullptr;
-    Colormap colormap = 0;
+    int screen = 0;
+    Window root = 0;
     GLXFBConfig fbConfig = nullptr;
     XVisualInfo* visualInfo = nullptr;
-    
-    GLuint texture = 0;
-    int texWidth = 0;
-    int texHeight = 0;
-    
-    int width = 0;
-    int height = 0;
-    std::atomic<bool> isDestroyed{false};
-    std::atomic<bool> isMapped{false};  // true while window is XMapRaised, false after XUnmapWindow
-    std::mutex renderMutex;
+    Colormap colormap = 0;
+    glXSwapIntervalEXTProc glXSwapIntervalEXT = nullptr;
+    // GLX_OML_sync_control, for vblank timestamps; null when unsupported
+    glXGetSyncValuesOMLProc glXGetSyncValuesOML = nullptr;
+    glXGetMscRateOMLProc glXGetMscRateOML = nullptr;
 
-    // Cursor warp suppression on Steam overlay close.
-    // When Shift+Tab opens the overlay, Steam saves the cursor position.
-    // When the overlay closes, Steam warps the cursor back to that saved position.
-    // We detect this by: Shift+Tab sets overlayWasOpened=true, then the next FocusIn
-    // (overlay handed focus back to us) triggers a 500ms MotionNotify suppression.
-    // The 30px-distance approach doesn't work because lastMouseX/Y is already at the
-    // restored position (we receive no MotionNotify while the overlay holds focus).
-    bool overlayWasOpened = false;
-    long long suppressMotionUntilMs = 0;
+    // The shared device, opened on first use; null when it can't be opened
+    static LinuxOverlayDevice* acquire() {
+        std::lock_guard<std::mutex> lock(deviceMutex);
+        if (!instance) {
+            LinuxOverlayDevice* device = new LinuxOverlayDevice();
+            if (!device->open()) {
+                delete device;
+                return nullptr;
+            }
+            instance = device;
+        } else {
+            OverlayLog("Reusing X connection and FBConfig (%d overlay windows)", instance->users);
+        }
+        instance->users++;
+        return instance;
+    }
 
-    // Timestamp of the last event forwarded to Electron.
-    // Used by the idle refocus timer to re-grab X11 focus after Chromium steals it
-    // when the user clicks an input element.
-    long long lastForwardedEventMs = 0;
+    // Drop a window's reference; the last one closes the connection
+    void release() {
+        std::lock_guard<std::mutex> lock(deviceMutex);
+        if (--users > 0) {
+            XFlush(display);
+            return;
+        }
+        if (instance == this) instance = nullptr;
+        delete this;
+    }
 
-    // Timestamp of the last XSetInputFocus call. shouldSuppressNextBlur() suppresses
-    // a blur only if it arrives within 200ms of this stamp — that is the spurious
-    // blur caused by our own XSetInputFocus. Any real alt-tab/click-outside blur
-    // arrives independently of our grabs and will not be suppressed.
-    long long lastRequestFocusMs = 0;
-    
-    static long long getMonotonicMs() {
-        struct timespec ts;
-        clock_gettime(CLOCK_MONOTONIC, &ts);
-        return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+    // A GLX context for the shared FBConfig: OpenGL 3.3 compatibility when
+    // glXCreateContextAttribsARB can make one, a legacy context otherwise
+    GLXContext createContext() {
+        std::lock_guard<std::mutex> lock(deviceMutex);
+        GLXContext context = nullptr;
+        if (glXCreateContextAttribsARB && !legacyContexts) {
+            static int contextAttribs[] = {
+                GLX_CONTEXT_MAJOR_VERSION_ARB, 3,
+                GLX_CONTEXT_MINOR_VERSION_ARB, 3,
+                GLX_CONTEXT_PROFILE_MASK_ARB, GLX_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB,
+                None
+            };
+            context = glXCreateContextAttribsARB(display, fbConfig, nullptr, True, contextAttribs);
+            if (!context) {
+                OverlayLog("Failed to create GL 3.3 context, trying legacy");
+                legacyContexts = true;  // the driver won't do better for the next window
+            }
+        }
+        if (!context) {
+            context = glXCreateContext(display, visualInfo, nullptr, True);
+        }
+        return context;
     }
 
-    bool init(int w, int h, const char* title) {
-        width = w;
-        height = h;
-        
-        OverlayLog("Initializing Linux overlay window: %dx%d", w, h);
-        
+private:
+    static LinuxOverlayDevice* instance;
+    static std::mutex deviceMutex;
+    int users = 0;
+    bool legacyContexts = false;
+    glXCreateContextAttribsARBProc glXCreateContextAttribsARB = nullptr;
+
+    bool open() {
         XInitThreads(); // Required for multi-threaded X11 access
         
         // Open X display
@@ -112,8 +252,6 @@ public:
         int eventBase, errorBase;
         if (!XShapeQueryExtension(display, &eventBase, &errorBase)) {
             OverlayLogError("X Shape extension not available");
-            XCloseDisplay(display);
-            display = nullptr;
             return false;
         }
         
@@ -123,8 +261,8 @@ public:
         OverlayLog("XFixes extension: %s", hasXFixes ? "available" : "not available");
         
         // Get default screen
-        int screen = DefaultScreen(display);
-        Window root = RootWindow(display, screen);
+        screen = DefaultScreen(display);
+        root = RootWindow(display, screen);
         
         // Choose FBConfig with alpha support for transparency
         static int fbAttribs[] = {
@@ -146,8 +284,6 @@ public:
         GLXFBConfig* fbConfigs = glXChooseFBConfig(display, screen, fbAttribs, &fbCount);
         if (!fbConfigs || fbCount == 0) {
             OverlayLogError("Failed to choose FBConfig");
-            XCloseDisplay(display);
-            display = nullptr;
             return false;
         }
         
@@ -159,13 +295,253 @@ public:
         visualInfo = glXGetVisualFromFBConfig(display, fbConfig);
         if (!visualInfo) {
             OverlayLogError("Failed to get visual info");
-            XCloseDisplay(display);
-            display = nullptr;
             return false;
         }
         
         // Create colormap
         colormap = XCreateColormap(display, root, visualInfo->visual, AllocNone);
+
+        // Verify gameoverlayrenderer64.so is LD_PRELOADed (hook must be active)
+        {
+            FILE* maps = fopen("/proc/self/maps", "r");
+            if (maps) {
+                char line[512];
+                bool found = false;
+                while (fgets(line, sizeof(line), maps)) {
+                    if (strstr(line, "gameoverlayrenderer64")) {
+                        // Trim newline for clean log
+                        char* nl = strchr(line, '\n'); if (nl) *nl = 0;
+                        printf("[Linux Overlay] gameoverlayrenderer64.so LOADED: %s\n", line);
+                        fflush(stdout);
+                        found = true;
+                        break;
+                    }
+                }
+                fclose(maps);
+                if (!found) {
+                    printf("[Linux Overlay] WARNING: gameoverlayrenderer64.so NOT in /proc/self/maps — overlay hook inactive!\n");
+                    fflush(stdout);
+                }
+            }
+        }
+        
+        glXCreateContextAttribsARB = 
+            (glXCreateContextAttribsARBProc)glXGetProcAddressARB((const GLubyte*)"glXCreateContextAttribsARB");
+        glXSwapIntervalEXT = 
+            (glXSwapIntervalEXTProc)glXGetProcAddressARB((const GLubyte*)"glXSwapIntervalEXT");
+        const char* glxExtensions = glXQueryExtensionsString(display, screen);
+        if (glxExtensions && strstr(glxExtensions, "GLX_OML_sync_control")) {
+            glXGetSyncValuesOML =
+                (glXGetSyncValuesOMLProc)glXGetProcAddressARB((const GLubyte*)"glXGetSyncValuesOML");
+            glXGetMscRateOML =
+                (glXGetMscRateOMLProc)glXGetProcAddressARB((const GLubyte*)"glXGetMscRateOML");
+        }
+        return true;
+    }
+
+    ~LinuxOverlayDevice() {
+        if (colormap) XFreeColormap(display, colormap);
+        if (visualInfo) XFree(visualInfo);
+        if (display) XCloseDisplay(display);
+        OverlayLog("X connection closed");
+    }
+};
+
+LinuxOverlayDevice* LinuxOverlayDevice::instance = nullptr;
+std::mutex LinuxOverlayDevice::deviceMutex;
+
+// Linux OpenGL/GLX Overlay Window — glXSwapBuffers is hooked by gameoverlayrenderer64.so
+class LinuxOverlayWindow {
+public:
+    LinuxOverlayDevice* device = nullptr;  // shared X connection and FBConfig, see LinuxOverlayDevice
+    Display* display = nullptr;
+    Window window = 0;
+    std::atomic<Window> electronWindow{0}; // Electron XID — keyboard/mouse events are forwarded here
+    GLXContext glContext = nullptr;
+    Colormap colormap = 0;
+    GLXFBConfig fbConfig = nullptr;
+    XVisualInfo* visualInfo = nullptr;
+    
+    // Frame texture, used as an atlas: the frame (texWidth x texHeight) sits in
+    // its top-left corner, and the storage (texCapacityWidth x texCapacityHeight)
+    // only grows, geometrically, so resizes rarely reallocate it. Full frames
+    // are diffed per 128x128 tile and only changed tiles are uploaded.
+    GLuint texture = 0;
+    int texWidth = 0;
+    int texHeight = 0;
+    int texCapacityWidth = 0;
+    int texCapacityHeight = 0;
+    GLint maxTextureSize = 0;
+    frame_tiles::TileTracker tileTracker;
+    std::vector<FrameRect> changedTiles;
+    std::vector<FrameRegion> atlasRegions;  // tiles or dirty regions plus edge gutters
+
+    // Draw path, chosen once in init(): a VAO + GLSL 330 quad with immutable
+    // texture storage when the context is GL 3.3+, otherwise (or with
+    // shaderRenderer=false) the fixed-function glBegin/glEnd quad.
+    bool preferShaderRenderer = true;
+    bool useShaderRenderer = false;
+    gl_quad::QuadRenderer quadRenderer;
+    // Frames captured below the window's resolution (captureScale < 1) are
+    // stretched by the GPU; the shader path sharpens them this much (0-1)
+    float upscaleSharpness = 0.5f;
+
+    // Compressed uploads (compressedTextures option): the texture has BC3 storage
+    // and only the 64x64 tiles that changed are encoded — on the render thread,
+    // off Node's main thread — and uploaded. Every upload is then a full frame;
+    // dirty rectangles only select tiles through their hashes. Chosen once in init().
+    bool preferCompressedTextures = false;
+    std::atomic<bool> useCompressedTextures{false};
+    gl_compressed::CompressedTexture compressedTexture;
+
+    // Asynchronous upload ring. When enabled, renderFrame copies the frame into a
+    // pixel buffer and glTexSubImage2D sources from it, so the driver DMAs the data
+    // in the background instead of copying ~14 MB from client memory synchronously.
+    // Falls back to client-memory uploads when PBOs are unavailable or disabled.
+    bool preferPixelBuffers = true;
+    std::atomic<bool> usePixelBuffers{false};
+    GLuint pixelBuffers[kPixelBufferCount] = {};
+    int pixelBufferIndex = 0;
+    size_t pixelBufferSize = 0;
+    glGenBuffersProc glGenBuffers = nullptr;
+    glDeleteBuffersProc glDeleteBuffers = nullptr;
+    glBindBufferProc glBindBuffer = nullptr;
+    glBufferDataProc glBufferData = nullptr;
+    glMapBufferProc glMapBuffer = nullptr;
+    glUnmapBufferProc glUnmapBuffer = nullptr;
+
+    // Shared-texture import. A linear dmabuf is imported into a
+    // GL_EXT_memory_object_fd texture on the GLX context itself and drawn from
+    // there, on whichever thread owns the context. Chosen once in init(); without
+    // it importDmabuf returns false.
+    struct DmabufPlane {
+        int fd;  // importDmabuf's own duplicate, owned by whoever holds the plane
+        int stride;
+        int offset;
+        int width;
+        int height;
+    };
+    bool useDmabufImport = false;
+    glCreateMemoryObjectsEXTProc glCreateMemoryObjectsEXT = nullptr;
+    glDeleteMemoryObjectsEXTProc glDeleteMemoryObjectsEXT = nullptr;
+    glMemoryObjectParameterivEXTProc glMemoryObjectParameterivEXT = nullptr;
+    glImportMemoryFdEXTProc glImportMemoryFdEXT = nullptr;
+    glTexStorageMem2DEXTProc glTexStorageMem2DEXT = nullptr;
+    glFenceSyncProc glFenceSync = nullptr;
+    glClientWaitSyncProc glClientWaitSync = nullptr;
+    glDeleteSyncProc glDeleteSync = nullptr;
+
+    // Upload timing — written by whichever thread uploads, reported to JS through getOverlayStats()
+    std::atomic<unsigned long long> uploadedFrames{0};
+    std::atomic<double> lastUploadMs{0.0};
+    std::atomic<double> totalUploadMs{0.0};
+    std::atomic<size_t> lastUploadBytes{0};
+    // Per-stage timings and texture reallocations, also reported through getOverlayStats()
+    frame_timing::FrameTimings timings;
+    // Last vblank and refresh interval, recorded after every present
+    present_timing::PresentClock presentClock;
+    // Refresh interval from glXGetMscRateOML, re-queried every kMscRateRefreshPresents
+    double mscRefreshMs = 0.0;
+    unsigned presentsSinceMscRate = 0;
+
+    // Content hash of the last full frame handed on for upload. Identical frames
+    // skip the upload and the swap entirely (unless the Steam overlay needs a present).
+    // Caller-thread state, like the two counters below.
+    uint64_t lastFrameHash = 0;
+    bool lastFrameHashValid = false;
+    int lastFrameWidth = 0;
+    int lastFrameHeight = 0;
+    unsigned long long skippedFrames = 0;
+    unsigned long long droppedFrames = 0;  // replaced in the mailbox before the render thread took them
+
+    // Render thread. When enabled (the default) renderFrame only publishes the
+    // frame into the mailbox and returns; the thread owns the GL context and does
+    // the upload, draw and glXSwapBuffers, so vsync waits never block Node's main
+    // thread. With renderThread=false everything runs on the caller, as before.
+    bool preferRenderThread = true;
+    bool useRenderThread = false;
+    std::thread renderThread;
+    FrameMailbox mailbox;
+    std::vector<FrameRegion> uploadRegions;  // scratch list for region uploads
+
+    // Requests to the render thread. Guarded by wakeMutex, which is never held
+    // across GL or X calls.
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    bool stopRequested = false;
+    bool contextRequested = false;  // show() asks for the context to be bound, hide() for it to be released
+    bool contextBound = false;      // render thread's answer — hide() waits for false before unmapping
+    bool viewportDirty = false;
+    int pendingWidth = 0;
+    int pendingHeight = 0;
+    // A dmabuf for the render thread to present. importDmabuf waits (up to
+    // kImportWaitMs) for the answer to its serial, since the producer reuses the
+    // buffer once it returns; a request it gave up on is still answered, but late.
+    DmabufPlane importRequest = {};
+    bool importPending = false;        // posted, not yet taken by the render thread
+    uint64_t importSerial = 0;         // last request posted
+    uint64_t importAnsweredSerial = 0; // last request the render thread finished
+    bool importPresented = false;      // its answer
+    
+    // Input forwarding runs on its own thread and X connection, so events reach
+    // Electron as soon as the server delivers them instead of once per rendered
+    // frame. The window's event mask is selected on eventDisplay only (ButtonPress
+    // can be selected by a single client), and the thread sleeps in poll() on that
+    // connection's fd. Without it, events are pumped from the render path as before.
+    bool useEventThread = false;
+    Display* eventDisplay = nullptr;
+    std::thread eventThread;
+    int eventWakePipe[2] = { -1, -1 };
+    std::atomic<bool> stopEvents{false};
+    
+    int width = 0;
+    int height = 0;
+    std::atomic<bool> isDestroyed{false};
+    std::atomic<bool> isMapped{false};  // true while window is XMapRaised, false after XUnmapWindow
+    std::mutex renderMutex;
+
+    // The input state below is only touched by processEvents, i.e. by the event thread.
+
+    // Cursor warp suppression on Steam overlay close.
+    // When Shift+Tab opens the overlay, Steam saves the cursor position.
+    // When the overlay closes, Steam warps the cursor back to that saved position.
+    // We detect this by: Shift+Tab sets overlayWasOpened=true, then the next FocusIn
+    // (overlay handed focus back to us) triggers a 500ms MotionNotify suppression.
+    // The 30px-distance approach doesn't work because lastMouseX/Y is already at the
+    // restored position (we receive no MotionNotify while the overlay holds focus).
+    bool overlayWasOpened = false;
+    long long suppressMotionUntilMs = 0;
+
+    // Timestamp of the last event forwarded to Electron.
+    // Used by the idle refocus timer to re-grab X11 focus after Chromium steals it
+    // when the user clicks an input element.
+    long long lastForwardedEventMs = 0;
+
+    // Timestamp of the last XSetInputFocus call. shouldSuppressNextBlur() suppresses
+    // a blur only if it arrives within 200ms of this stamp — that is the spurious
+    // blur caused by our own XSetInputFocus. Any real alt-tab/click-outside blur
+    // arrives independently of our grabs and will not be suppressed.
+    std::atomic<long long> lastRequestFocusMs{0};
+    
+    static long long getMonotonicMs() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+    }
+
+    bool init(int w, int h, const char* title) {
+        width = w;
+        height = h;
+        
+        OverlayLog("Initializing Linux overlay window: %dx%d", w, h);
+        
+        device = LinuxOverlayDevice::acquire();
+        if (!device) return false;
+        display = device->display;
+        fbConfig = device->fbConfig;
+        visualInfo = device->visualInfo;
+        colormap = device->colormap;
+        Window root = device->root;
         
         // Receive ALL input — we forward keyboard/mouse to Electron via XSendEvent.
         // The window must hold X11 keyboard focus for gameoverlayrenderer64.so to
@@ -175,10 +551,7 @@ public:
         attrs.background_pixmap = None;
         attrs.background_pixel = 0;
         attrs.border_pixel = 0;
-        attrs.event_mask = ExposureMask | StructureNotifyMask | VisibilityChangeMask
-                         | KeyPressMask | KeyReleaseMask
-                         | ButtonPressMask | ButtonReleaseMask | PointerMotionMask
-                         | FocusChangeMask;
+        attrs.event_mask = kOverlayEventMask;  // moved to eventDisplay by startEventThread()
         attrs.override_redirect = True;  // Bypass KWin stacking entirely — window always on top
         
         // Create window with 32-bit depth for alpha
@@ -195,9 +568,7 @@ public:
         
         if (!window) {
             OverlayLogError("Failed to create X window");
-            XFree(visualInfo);
-            XCloseDisplay(display);
-            display = nullptr;
+            releaseDevice();
             return false;
         }
         
@@ -256,62 +627,15 @@ public:
         XChangeProperty(display, window, wmProtocols, XA_ATOM, 32, PropModeReplace,
                        (unsigned char*)&wmTakeFocus, 1);
 
-        // Verify gameoverlayrenderer64.so is LD_PRELOADed (hook must be active)
-        {
-            FILE* maps = fopen("/proc/self/maps", "r");
-            if (maps) {
-                char line[512];
-                bool found = false;
-                while (fgets(line, sizeof(line), maps)) {
-                    if (strstr(line, "gameoverlayrenderer64")) {
-                        // Trim newline for clean log
-                        char* nl = strchr(line, '\n'); if (nl) *nl = 0;
-                        printf("[Linux Overlay] gameoverlayrenderer64.so LOADED: %s\n", line);
-                        fflush(stdout);
-                        found = true;
-                        break;
-                    }
-                }
-                fclose(maps);
-                if (!found) {
-                    printf("[Linux Overlay] WARNING: gameoverlayrenderer64.so NOT in /proc/self/maps — overlay hook inactive!\n");
-                    fflush(stdout);
-                }
-            }
-        }
-
         OverlayLog("Input forwarding mode: all events forwarded to Electron via XSendEvent");
         
-        // Create modern OpenGL context using glXCreateContextAttribsARB if available
-        glXCreateContextAttribsARBProc glXCreateContextAttribsARB = 
-            (glXCreateContextAttribsARBProc)glXGetProcAddressARB((const GLubyte*)"glXCreateContextAttribsARB");
-        
-        if (glXCreateContextAttribsARB) {
-            // Try to create OpenGL 3.3 core context first, fall back to legacy
-            static int contextAttribs[] = {
-                GLX_CONTEXT_MAJOR_VERSION_ARB, 3,
-                GLX_CONTEXT_MINOR_VERSION_ARB, 3,
-                GLX_CONTEXT_PROFILE_MASK_ARB, GLX_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB,
-                None
-            };
-            
-            glContext = glXCreateContextAttribsARB(display, fbConfig, nullptr, True, contextAttribs);
-            if (!glContext) {
-                OverlayLog("Failed to create GL 3.3 context, trying legacy");
-            }
-        }
-        
-        // Fall back to legacy context creation
-        if (!glContext) {
-            glContext = glXCreateContext(display, visualInfo, nullptr, True);
-        }
-        
+        // OpenGL 3.3 compatibility context if available, legacy otherwise
+        glContext = device->createContext();
         if (!glContext) {
             OverlayLogError("Failed to create GLX context");
             XDestroyWindow(display, window);
-            XFree(visualInfo);
-            XCloseDisplay(display);
-            display = nullptr;
+            window = 0;
+            releaseDevice();
             return false;
         }
         
@@ -319,32 +643,263 @@ public:
         if (!glXMakeCurrent(display, window, glContext)) {
             OverlayLogError("Failed to make GLX context current");
             glXDestroyContext(display, glContext);
+            glContext = nullptr;
             XDestroyWindow(display, window);
-            XFree(visualInfo);
-            XCloseDisplay(display);
-            display = nullptr;
+            window = 0;
+            releaseDevice();
             return false;
         }
         
         // Try to disable vsync for lower latency
-        glXSwapIntervalEXTProc glXSwapIntervalEXT = 
-            (glXSwapIntervalEXTProc)glXGetProcAddressARB((const GLubyte*)"glXSwapIntervalEXT");
-        if (glXSwapIntervalEXT) {
-            glXSwapIntervalEXT(display, window, 0);
+        if (device->glXSwapIntervalEXT) {
+            device->glXSwapIntervalEXT(display, window, 0);
             OverlayLog("VSync disabled");
         }
         
         // Initialize OpenGL state
         initGL();
+        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+        if (preferCompressedTextures) {
+            if (compressedTexture.init(loadGLProc)) {
+                useCompressedTextures = true;
+            } else {
+                OverlayLog("Compressed textures unavailable (%s), uploading BGRA", compressedTexture.error());
+            }
+        }
+        // Compressed tiles are uploaded from client memory; the PBO ring would sit unused
+        if (!useCompressedTextures) initPixelBuffers();
+        initDmabufImport();
+        if (preferShaderRenderer && !quadRenderer.init(loadGLProc)) {
+            OverlayLog("Shader renderer unavailable (%s), using immediate mode", quadRenderer.error());
+        }
+        useShaderRenderer = quadRenderer.isReady();
         
         XSync(display, False);
         
         OverlayLog("Linux overlay window created successfully");
         OverlayLog("OpenGL Version: %s", glGetString(GL_VERSION));
         OverlayLog("OpenGL Renderer: %s", glGetString(GL_RENDERER));
-        
+        OverlayLog("Texture upload path: %s", useCompressedTextures ? "BC3 tiles"
+            : usePixelBuffers ? "pixel buffer ring" : "client memory");
+        OverlayLog("Shared-texture import: %s", useDmabufImport ? "GL_EXT_memory_object_fd" : "unavailable");
+        OverlayLog("Draw path: %s", useShaderRenderer
+            ? (quadRenderer.hasTextureStorage() ? "shader renderer, immutable storage" : "shader renderer")
+            : "immediate mode");
+
+        useEventThread = startEventThread();
+        OverlayLog("Event pumping: %s", useEventThread ? "event thread" : "render path");
+
+        // Hand the context over to the render thread — a GLX context can only be
+        // current on one thread at a time. It binds it again once show() maps the window.
+        if (preferRenderThread) {
+            glXMakeCurrent(display, None, nullptr);
+            useRenderThread = true;
+            renderThread = std::thread(&LinuxOverlayWindow::renderLoop, this);
+        }
+        OverlayLog("Render path: %s", useRenderThread ? "render thread" : "caller thread");
+
+        return true;
+    }
+
+    // Release the context from the calling thread after init() ran on a worker
+    // (createOverlayWindowAsync). Without the render thread, later calls on the
+    // main thread bind it themselves; with it, init() already handed it over.
+    void releaseCallerContext() {
+        if (!useRenderThread && display && glContext) {
+            glXMakeCurrent(display, None, nullptr);
+        }
+    }
+
+    // Resolve buffer object entry points and allocate the PBO ring.
+    // Requires GL 2.1+ or GL_ARB_pixel_buffer_object; otherwise uploads stay synchronous.
+    void initPixelBuffers() {
+        usePixelBuffers = false;
+        if (!preferPixelBuffers) {
+            OverlayLog("Pixel buffer uploads disabled by option");
+            return;
+        }
+
+        int major = 0, minor = 0;
+        const char* version = (const char*)glGetString(GL_VERSION);
+        if (version) sscanf(version, "%d.%d", &major, &minor);
+        const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+        bool hasExtension = extensions && strstr(extensions, "GL_ARB_pixel_buffer_object");
+        if (major < 2 || (major == 2 && minor < 1)) {
+            if (!hasExtension) {
+                OverlayLog("Pixel buffer objects not supported (GL %d.%d)", major, minor);
+                return;
+            }
+        }
+
+        glGenBuffers    = (glGenBuffersProc)glXGetProcAddressARB((const GLubyte*)"glGenBuffers");
+        glDeleteBuffers = (glDeleteBuffersProc)glXGetProcAddressARB((const GLubyte*)"glDeleteBuffers");
+        glBindBuffer    = (glBindBufferProc)glXGetProcAddressARB((const GLubyte*)"glBindBuffer");
+        glBufferData    = (glBufferDataProc)glXGetProcAddressARB((const GLubyte*)"glBufferData");
+        glMapBuffer     = (glMapBufferProc)glXGetProcAddressARB((const GLubyte*)"glMapBuffer");
+        glUnmapBuffer   = (glUnmapBufferProc)glXGetProcAddressARB((const GLubyte*)"glUnmapBuffer");
+
+        if (!glGenBuffers || !glDeleteBuffers || !glBindBuffer ||
+                !glBufferData || !glMapBuffer || !glUnmapBuffer) {
+            OverlayLog("Pixel buffer entry points missing, using client memory uploads");
+            return;
+        }
+
+        glGenBuffers(kPixelBufferCount, pixelBuffers);
+        pixelBufferSize = 0;
+        pixelBufferIndex = 0;
+        usePixelBuffers = true;
+    }
+
+    // Resolve the memory object and sync entry points for importDmabuf. Needs
+    // GL_EXT_memory_object_fd, plus texture swizzles (GL 3.3 / ARB_texture_swizzle)
+    // to read the dmabuf's BGRA bytes through RGBA8 storage. Mesa only: the
+    // extension's opaque fds are by spec exports of Vulkan or GL memory, and a
+    // dmabuf passes as one only because Mesa's drivers import both the same way.
+    void initDmabufImport() {
+        useDmabufImport = false;
+
+        int major = 0, minor = 0;
+        const char* version = (const char*)glGetString(GL_VERSION);
+        if (version) sscanf(version, "%d.%d", &major, &minor);
+        if (!version || !strstr(version, "Mesa")) {
+            OverlayLog("Dmabuf import disabled: not a Mesa driver");
+            return;
+        }
+        const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+        bool hasMemoryObjectFd = extensions && strstr(extensions, "GL_EXT_memory_object_fd");
+        bool hasSwizzle = major > 3 || (major == 3 && minor >= 3) ||
+                          (extensions && strstr(extensions, "GL_ARB_texture_swizzle"));
+        if (!hasMemoryObjectFd || !hasSwizzle) {
+            OverlayLog("Dmabuf import not supported (GL %d.%d%s)", major, minor,
+                       hasMemoryObjectFd ? "" : ", no GL_EXT_memory_object_fd");
+            return;
+        }
+
+        glCreateMemoryObjectsEXT     = (glCreateMemoryObjectsEXTProc)loadGLProc("glCreateMemoryObjectsEXT");
+        glDeleteMemoryObjectsEXT     = (glDeleteMemoryObjectsEXTProc)loadGLProc("glDeleteMemoryObjectsEXT");
+        glMemoryObjectParameterivEXT = (glMemoryObjectParameterivEXTProc)loadGLProc("glMemoryObjectParameterivEXT");
+        glImportMemoryFdEXT          = (glImportMemoryFdEXTProc)loadGLProc("glImportMemoryFdEXT");
+        glTexStorageMem2DEXT         = (glTexStorageMem2DEXTProc)loadGLProc("glTexStorageMem2DEXT");
+        glFenceSync                  = (glFenceSyncProc)loadGLProc("glFenceSync");
+        glClientWaitSync             = (glClientWaitSyncProc)loadGLProc("glClientWaitSync");
+        glDeleteSync                 = (glDeleteSyncProc)loadGLProc("glDeleteSync");
+
+        if (!glCreateMemoryObjectsEXT || !glDeleteMemoryObjectsEXT || !glMemoryObjectParameterivEXT ||
+                !glImportMemoryFdEXT || !glTexStorageMem2DEXT ||
+                !glFenceSync || !glClientWaitSync || !glDeleteSync) {
+            OverlayLog("Dmabuf import entry points missing");
+            return;
+        }
+        useDmabufImport = true;
+    }
+
+    void destroyPixelBuffers() {
+        if (pixelBuffers[0] && glDeleteBuffers) {
+            glDeleteBuffers(kPixelBufferCount, pixelBuffers);
+        }
+        for (int i = 0; i < kPixelBufferCount; i++) pixelBuffers[i] = 0;
+        pixelBufferSize = 0;
+        usePixelBuffers = false;
+    }
+
+    static size_t regionBytes(const FrameRegion* regions, int regionCount) {
+        size_t total = 0;
+        for (int i = 0; i < regionCount; i++) {
+            total += (size_t)regions[i].rect.width * (size_t)regions[i].rect.height * 4;
+        }
+        return total;
+    }
+
+    // Pack the dirty rectangles back to back into the next ring slot, then issue
+    // one glTexSubImage2D per rectangle sourcing from its offset in the PBO.
+    bool uploadRegionsViaPixelBuffer(const FrameRegion* regions, int regionCount) {
+        size_t size = regionBytes(regions, regionCount);
+        if (size == 0) return true;
+        pixelBufferIndex = (pixelBufferIndex + 1) % kPixelBufferCount;
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBuffers[pixelBufferIndex]);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, (ptrdiff_t)size, nullptr, GL_STREAM_DRAW);
+        pixelBufferSize = size;
+
+        uint8_t* dst = (uint8_t*)glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+        if (!dst) {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            return false;
+        }
+        size_t offset = 0;
+        for (int i = 0; i < regionCount; i++) {
+            const FrameRegion& region = regions[i];
+            size_t rowBytes = (size_t)region.rect.width * 4;
+            for (int row = 0; row < region.rect.height; row++) {
+                memcpy(dst + offset, region.pixels + (size_t)row * region.rowPixels * 4, rowBytes);
+                offset += rowBytes;
+            }
+        }
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+        offset = 0;
+        for (int i = 0; i < regionCount; i++) {
+            const FrameRect& r = regions[i].rect;
+            glTexSubImage2D(GL_TEXTURE_2D, 0, r.x, r.y, r.width, r.height,
+                            GL_BGRA, GL_UNSIGNED_BYTE, (const void*)offset);
+            offset += (size_t)r.width * r.height * 4;
+        }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
         return true;
     }
+
+    // Client-memory region upload: GL_UNPACK_ROW_LENGTH lets GL walk the source
+    // rows in place, so nothing needs to be repacked.
+    void uploadRegionsDirect(const FrameRegion* regions, int regionCount) {
+        for (int i = 0; i < regionCount; i++) {
+            const FrameRect& r = regions[i].rect;
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, regions[i].rowPixels);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, r.x, r.y, r.width, r.height, GL_BGRA, GL_UNSIGNED_BYTE,
+                            regions[i].pixels);
+        }
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    }
+
+    // Upload path reported through getOverlayStats() and the upload log
+    const char* uploadPathName() const {
+        return useCompressedTextures ? "bc3" : usePixelBuffers ? "pbo" : "direct";
+    }
+
+    // Upload the given regions into the bound texture. With compressed textures
+    // fullFrame is passed instead, and its changed tiles are encoded and uploaded.
+    void uploadPixels(const uint8_t* fullFrame, int w, int h, const FrameRegion* regions, int regionCount) {
+        auto start = std::chrono::steady_clock::now();
+
+        bool uploaded = false;
+        size_t bytes = regionBytes(regions, regionCount);
+        if (useCompressedTextures && fullFrame) {
+            bytes = compressedTexture.upload(fullFrame, w, h, texCapacityWidth, texCapacityHeight);
+            uploaded = true;
+        } else if (usePixelBuffers) {
+            uploaded = uploadRegionsViaPixelBuffer(regions, regionCount);
+            if (!uploaded) {
+                OverlayLogError("glMapBuffer failed, falling back to client memory uploads");
+                destroyPixelBuffers();
+            }
+        }
+        if (!uploaded) {
+            uploadRegionsDirect(regions, regionCount);
+        }
+
+        double elapsedMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+        lastUploadBytes = bytes;
+        lastUploadMs = elapsedMs;
+        totalUploadMs = totalUploadMs + elapsedMs;  // single writer — the uploading thread
+        unsigned long long frames = ++uploadedFrames;
+        timings.record(frame_timing::kStageUpload, elapsedMs);
+
+        if (frames % 300 == 0) {
+            OverlayLog("Upload (%s): last %.3f ms, avg %.3f ms over %llu frames",
+                uploadPathName(), elapsedMs,
+                totalUploadMs / (double)frames, frames);
+        }
+    }
     
     void initGL() {
         // Set up basic OpenGL state
@@ -372,6 +927,18 @@ public:
         glViewport(0, 0, width, height);
     }
     
+    // Viewport and projection for a w x h window. Needs the context current.
+    void applyViewport(int w, int h) {
+        glViewport(0, 0, w, h);
+        
+        glMatrixMode(GL_PROJECTION);
+        glLoadIdentity();
+        glOrtho(0, w, h, 0, -1, 1);
+        
+        glMatrixMode(GL_MODELVIEW);
+        glLoadIdentity();
+    }
+    
     void show() {
         if (isDestroyed) return;
         
@@ -384,125 +951,689 @@ public:
             // and glXSwapBuffers silently no-ops, preventing Steam's hook from firing.
             XSync(display, False);
             // Re-acquire GL context on the now-viewable window
-            if (glContext) {
+            if (useRenderThread) {
+                {
+                    std::lock_guard<std::mutex> lock(wakeMutex);
+                    contextRequested = true;
+                }
+                wakeCondition.notify_all();
+            } else if (glContext) {
+                glXMakeCurrent(display, window, glContext);
+            }
+            requestFocus(display);
+        }
+    }
+
+    void requestFocus(Display* dpy) {
+        if (!dpy || !window || !isMapped) return;
+        XSetInputFocus(dpy, window, RevertToPointerRoot, CurrentTime);
+        XFlush(dpy);
+        lastRequestFocusMs = getMonotonicMs();
+    }
+
+    void hide() {
+        if (isDestroyed) return;
+        
+        if (display && window) {
+            OverlayLog("Hiding overlay window");
+            isMapped = false;
+            // Release GL context before unmapping to prevent stale drawable state
+            if (useRenderThread) {
+                // The render thread may be mid-swap — wait for it to let go of the context
+                std::unique_lock<std::mutex> lock(wakeMutex);
+                contextRequested = false;
+                wakeCondition.notify_all();
+                if (!wakeCondition.wait_for(lock, std::chrono::milliseconds(250), [this] { return !contextBound; })) {
+                    OverlayLogError("Render thread did not release the GL context before unmap");
+                }
+            } else {
+                glXMakeCurrent(display, None, nullptr);
+            }
+            XUnmapWindow(display, window);
+            XFlush(display);
+        }
+    }
+    
+    void setFrame(int x, int y, int w, int h) {
+        if (isDestroyed) return;
+        
+        OverlayLog("Setting frame: x=%d, y=%d, w=%d, h=%d", x, y, w, h);
+        
+        if (display && window) {
+            XMoveResizeWindow(display, window, x, y, w, h);
+            XFlush(display);
+            
+            // Update OpenGL viewport — on the thread that owns the context
+            if (useRenderThread) {
+                {
+                    std::lock_guard<std::mutex> lock(wakeMutex);
+                    pendingWidth = w;
+                    pendingHeight = h;
+                    viewportDirty = true;
+                }
+                wakeCondition.notify_all();
+            } else if (glContext) {
+                width = w;
+                height = h;
                 glXMakeCurrent(display, window, glContext);
+                applyViewport(w, h);
+            }
+        }
+    }
+    
+    // Upload and present a frame. When rects is non-null only those sub-rectangles
+    // are uploaded and the rest of the texture keeps its previous contents.
+    // Returns false if nothing new was handed on — the window is hidden, or the
+    // frame is identical to the previous one. Identical frames are not presented
+    // either unless forcePresent is set (Steam overlay drawing over a static page).
+    // With the render thread running this only queues the frame and never blocks on GL.
+    bool renderFrame(const uint8_t* data, int w, int h, const FrameRect* rects = nullptr, int rectCount = 0,
+                     bool forcePresent = false) {
+        if (isDestroyed) return false;
+        if (!isMapped) return false;  // Don't render/swap when hidden — avoids GL errors on unmapped window
+        
+        auto submitStart = frame_timing::Clock::now();
+        
+        // Dirty-region frames already say what changed
+        uint64_t hash = 0;
+        bool unchanged = false;
+        if (!rects) {
+            hash = frame_hash::hashFrame(data, (size_t)w * (size_t)h * 4);
+            unchanged = lastFrameHashValid && hash == lastFrameHash && w == lastFrameWidth && h == lastFrameHeight;
+        }
+        
+        if (unchanged && !forcePresent) {
+            skippedFrames++;
+            if (!useRenderThread) {
+                std::lock_guard<std::mutex> lock(renderMutex);
+                if (display && !useEventThread) processEvents(display);
+            }
+            return false;
+        }
+        
+        bool handedOn = useRenderThread ? submitFrame(data, w, h, rects, rectCount, unchanged)
+                                        : renderFrameNow(data, w, h, rects, rectCount, unchanged);
+        if (!handedOn) return false;
+        timings.record(frame_timing::kStageSubmit, frame_timing::elapsedMs(submitStart));
+        
+        if (!unchanged) {
+            lastFrameHash = hash;
+            lastFrameHashValid = (rects == nullptr);
+        }
+        lastFrameWidth = w;
+        lastFrameHeight = h;
+        return !unchanged;
+    }
+    
+    // Present a frame from a shared-texture dmabuf (Electron's offscreen renderer
+    // with useSharedTexture). The overlay has to stay a GLX window for Steam's
+    // glXSwapBuffers hook, so the dmabuf is imported into the GLX context through
+    // GL_EXT_memory_object_fd and drawn on the GPU (see presentDmabuf) — by the
+    // render thread when it runs, which this waits for, up to kImportWaitMs.
+    // Only linear buffers are accepted: the extension has no way to pass a DRM
+    // format modifier, so tiled or compressed layouts can't be described to GL.
+    // Returns false, and the caller should fall back to bitmaps, for those, without
+    // the extension (or a Mesa driver), on timeout, or when the driver rejects the
+    // buffer. The fd stays owned by the caller.
+    bool importDmabuf(int fd, int stride, int offset, uint64_t modifier, int w, int h) {
+        if (isDestroyed || !isMapped) return false;
+        if (!useDmabufImport || modifier != 0 /* DRM_FORMAT_MOD_LINEAR */) return false;
+        if (stride < w * 4 || stride % 4 != 0 || offset < 0) return false;
+        
+        auto submitStart = frame_timing::Clock::now();
+        // The GL takes ownership of an imported fd, and a request the render
+        // thread is late for must not read one the caller has since closed
+        int ownFd = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+        if (ownFd < 0) {
+            OverlayLogError("Failed to duplicate dmabuf fd: %s", strerror(errno));
+            return false;
+        }
+        DmabufPlane plane = { ownFd, stride, offset, w, h };
+        bool presented = false;
+        if (useRenderThread) {
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            importRequest = plane;
+            importPending = true;
+            uint64_t serial = ++importSerial;
+            wakeCondition.notify_all();
+            bool answered = wakeCondition.wait_for(lock, std::chrono::milliseconds(kImportWaitMs),
+                [this, serial] { return importAnsweredSerial >= serial; });
+            if (answered) {
+                presented = importPresented;
+            } else {
+                if (importPending) {
+                    close(importRequest.fd);
+                    importPending = false;
+                }
+                OverlayLog("Render thread busy, dmabuf import timed out");
+            }
+        } else {
+            std::lock_guard<std::mutex> lock(renderMutex);
+            if (!display || !glContext || !window || !glXMakeCurrent(display, window, glContext)) {
+                if (display && glContext && window) {
+                    OverlayLogError("Failed to make context current in importSharedTexture");
+                }
+                close(ownFd);
+                return false;
+            }
+            presented = presentDmabuf(plane);
+            if (!useEventThread) processEvents(display);
+        }
+        
+        // The frame texture still holds the last bitmap frame, so the next one
+        // has to be uploaded whole — see presentDmabuf for the render side. A
+        // timed-out request may still be drawn, so this holds for failures too.
+        lastFrameHashValid = false;
+        lastFrameWidth = 0;
+        lastFrameHeight = 0;
+        if (!presented) return false;
+        timings.record(frame_timing::kStageSubmit, frame_timing::elapsedMs(submitStart));
+        return true;
+    }
+    
+    // Copy the frame into the mailbox and wake the render thread.
+    // presentOnly asks for the current texture to be presented again.
+    bool submitFrame(const uint8_t* data, int w, int h, const FrameRect* rects, int rectCount, bool presentOnly) {
+        // Dirty regions (and present-only frames) are relative to the previous frame,
+        // so they only work if the render thread has already taken it. If it's still
+        // pending it is about to be replaced, and after a resize the texture is
+        // recreated with undefined contents — both cases need the whole frame.
+        // Compressed uploads always need it: tiles are found by hashing the frame.
+        // Only this thread publishes, so a pending frame can't appear behind our back.
+        FrameSlot& slot = mailbox.writeSlot();
+        bool pending = mailbox.hasPendingFrame();
+        bool sizeChanged = w != lastFrameWidth || h != lastFrameHeight;
+        bool useRegions = rects && !useCompressedTextures;
+        if ((useRegions || presentOnly) && !pending && !sizeChanged) {
+            slot.setRegions(data, w, h, rects, presentOnly ? 0 : rectCount);
+        } else {
+            slot.setFull(data, w, h);
+        }
+        
+        if (mailbox.publish()) {
+            droppedFrames++;
+        }
+        {
+            // Empty critical section: orders the publish against the render
+            // thread's predicate check so the wakeup can't be lost
+            std::lock_guard<std::mutex> lock(wakeMutex);
+        }
+        wakeCondition.notify_all();
+        return true;
+    }
+    
+    // Synchronous path (renderThread=false): upload and present on the calling thread
+    bool renderFrameNow(const uint8_t* data, int w, int h, const FrameRect* rects, int rectCount, bool presentOnly) {
+        std::lock_guard<std::mutex> lock(renderMutex);
+        
+        if (!display || !glContext || !window) return false;
+        
+        if (!glXMakeCurrent(display, window, glContext)) {
+            OverlayLogError("Failed to make context current in renderFrame");
+            return false;
+        }
+        
+        // New texture storage is undefined — dirty regions alone can't fill it
+        bool fullUpload = !presentOnly && (!rects || useCompressedTextures ||
+                                           texture == 0 || w != texWidth || h != texHeight);
+        if (fullUpload) {
+            presentFrame(data, w, h, nullptr, 0);
+        } else {
+            regionsInFrame(data, w, rects, presentOnly ? 0 : rectCount, uploadRegions);
+            presentFrame(nullptr, w, h, uploadRegions.data(), (int)uploadRegions.size());
+        }
+        
+        if (!useEventThread) processEvents(display);
+        return true;
+    }
+    
+    // Sharpness for drawing a texture of the given size: only frames smaller than
+    // the window are upscaled, so full-resolution frames keep the plain path
+    float sharpnessFor(int texW, int texH) const {
+        return (texW < width || texH < height) ? upscaleSharpness : 0.0f;
+    }
+    
+    // Upload (the whole frame when fullFrame is non-null, otherwise just the given
+    // regions — possibly none) and draw the texture, then swap. Needs the context current.
+    void presentFrame(const uint8_t* fullFrame, int w, int h, const FrameRegion* regions, int regionCount) {
+        auto frameStart = frame_timing::Clock::now();
+        
+        // Create the texture, or grow it once the frame and its gutter no longer
+        // fit. Smaller frames keep using the storage they have.
+        int capacityWidth = frame_tiles::growCapacity(texCapacityWidth, w, maxTextureSize);
+        int capacityHeight = frame_tiles::growCapacity(texCapacityHeight, h, maxTextureSize);
+        if (texture == 0 || capacityWidth != texCapacityWidth || capacityHeight != texCapacityHeight) {
+            if (texture != 0) {
+                glDeleteTextures(1, &texture);
+                timings.textureRecreations++;
+            }
+            
+            glGenTextures(1, &texture);
+            glBindTexture(GL_TEXTURE_2D, texture);
+            
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            
+            // Allocate texture storage (BGRA format from Electron)
+            if (useCompressedTextures) {
+                compressedTexture.allocate(capacityWidth, capacityHeight);
+            } else if (useShaderRenderer) {
+                quadRenderer.allocateTexture(capacityWidth, capacityHeight);
+            } else {
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, capacityWidth, capacityHeight, 0,
+                             GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
+            }
+            
+            texCapacityWidth = capacityWidth;
+            texCapacityHeight = capacityHeight;
+            tileTracker.reset();
+            
+            OverlayLog("Created %dx%d texture for %dx%d frames", capacityWidth, capacityHeight, w, h);
+        }
+        texWidth = w;
+        texHeight = h;
+        
+        // Upload pixel data
+        glBindTexture(GL_TEXTURE_2D, texture);
+        if (fullFrame && useCompressedTextures) {
+            uploadPixels(fullFrame, w, h, nullptr, 0);
+        } else if (fullFrame || regionCount > 0) {
+            if (fullFrame) {
+                tileTracker.collectChanged(fullFrame, w, h, changedTiles);
+                if (tileTracker.allChanged()) {
+                    atlasRegions.assign(1, { { 0, 0, w, h }, fullFrame, w });
+                } else {
+                    regionsInFrame(fullFrame, w, changedTiles.data(), (int)changedTiles.size(), atlasRegions);
+                }
+            } else {
+                atlasRegions.assign(regions, regions + regionCount);
+                // The texture now holds content the tile hashes never saw
+                tileTracker.reset();
+            }
+            frame_tiles::appendEdgeGutters(atlasRegions, w, h, texCapacityWidth, texCapacityHeight);
+            if (!atlasRegions.empty()) {
+                uploadPixels(nullptr, w, h, atlasRegions.data(), (int)atlasRegions.size());
+            }
+        }
+        
+        drawAndSwap(texture, texCapacityWidth, texCapacityHeight, texWidth, texHeight, frameStart);
+    }
+    
+    // Draw the top-left frameW x frameH of a textureW x textureH texture over the
+    // window and swap. Needs the context current.
+    void drawAndSwap(GLuint source, int textureW, int textureH, int frameW, int frameH,
+                     frame_timing::Clock::time_point frameStart) {
+        // The frame covers the top-left part of the texture
+        float usedU = (float)frameW / (float)textureW;
+        float usedV = (float)frameH / (float)textureH;
+        auto drawStart = frame_timing::Clock::now();
+        if (useShaderRenderer) {
+            quadRenderer.draw(source, textureW, textureH, sharpnessFor(frameW, frameH), usedU, usedV);
+        } else {
+            // Clear with transparent color
+            glClear(GL_COLOR_BUFFER_BIT);
+            
+            // Render textured quad
+            glEnable(GL_TEXTURE_2D);
+            glBindTexture(GL_TEXTURE_2D, source);
+            
+            glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+            
+            // Draw full-screen quad
+            glBegin(GL_QUADS);
+                glTexCoord2f(0.0f, 0.0f); glVertex2f(0.0f, 0.0f);
+                glTexCoord2f(usedU, 0.0f); glVertex2f((float)width, 0.0f);
+                glTexCoord2f(usedU, usedV); glVertex2f((float)width, (float)height);
+                glTexCoord2f(0.0f, usedV); glVertex2f(0.0f, (float)height);
+            glEnd();
+        }
+        
+        // Swap buffers — with vsync on this is where the thread waits for the display
+        auto swapStart = frame_timing::Clock::now();
+        timings.record(frame_timing::kStageDraw,
+            std::chrono::duration<double, std::milli>(swapStart - drawStart).count());
+        glXSwapBuffers(display, window);
+        
+        // Ensure GL commands are flushed
+        glFlush();
+        timings.record(frame_timing::kStageSwap, frame_timing::elapsedMs(swapStart));
+        recordPresent();
+        timings.record(frame_timing::kStageFrame, frame_timing::elapsedMs(frameStart));
+    }
+    
+    // Import a linear dmabuf plane as a texture, draw it and swap, then wait
+    // (bounded) for the GPU to finish reading it. Implicit sync orders those reads
+    // after the producer's rendering. The stride becomes the texture's row length;
+    // the padding is columns the draw doesn't sample. Takes ownership of plane.fd.
+    // Returns false if the driver rejects the buffer. Needs the context current.
+    bool presentDmabuf(const DmabufPlane& plane) {
+        auto frameStart = frame_timing::Clock::now();
+        int textureWidth = plane.stride / 4;
+        int fd = plane.fd;
+        off_t end = lseek(fd, 0, SEEK_END);
+        uint64_t size = end > 0 ? (uint64_t)end
+                                : (uint64_t)plane.offset + (uint64_t)plane.stride * (uint64_t)plane.height;
+        
+        while (glGetError() != GL_NO_ERROR) {
+        }
+        GLuint memory = 0;
+        glCreateMemoryObjectsEXT(1, &memory);
+        GLint dedicated = GL_TRUE;
+        glMemoryObjectParameterivEXT(memory, GL_DEDICATED_MEMORY_OBJECT_EXT, &dedicated);
+        glImportMemoryFdEXT(memory, size, GL_HANDLE_TYPE_OPAQUE_FD_EXT, fd);
+        if (glGetError() != GL_NO_ERROR) {
+            // A failed import leaves the fd with us
+            close(fd);
+            glDeleteMemoryObjectsEXT(1, &memory);
+            OverlayLogError("Failed to import dmabuf");
+            return false;
+        }
+        
+        GLuint imported = 0;
+        glGenTextures(1, &imported);
+        glBindTexture(GL_TEXTURE_2D, imported);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_TILING_EXT, GL_LINEAR_TILING_EXT);
+        glTexStorageMem2DEXT(GL_TEXTURE_2D, 1, GL_RGBA8, textureWidth, plane.height, memory, (uint64_t)plane.offset);
+        if (glGetError() != GL_NO_ERROR) {
+            glDeleteTextures(1, &imported);
+            glDeleteMemoryObjectsEXT(1, &memory);
+            OverlayLogError("Failed to create %dx%d texture from dmabuf", textureWidth, plane.height);
+            return false;
+        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        // DRM_FORMAT_ARGB8888 is B, G, R, A in memory — swap red and blue when sampling
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_BLUE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_RED);
+        
+        drawAndSwap(imported, textureWidth, plane.height, plane.width, plane.height, frameStart);
+        
+        void* fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        GLenum waited = fence ? glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kImportFenceTimeoutNs) : 0;
+        if (fence) glDeleteSync(fence);
+        glDeleteTextures(1, &imported);
+        glDeleteMemoryObjectsEXT(1, &memory);
+        
+        // The window no longer shows the frame texture: present-only and region
+        // frames drawn next would bring back stale content, so force a full upload
+        texWidth = 0;
+        texHeight = 0;
+        
+        if (waited != GL_ALREADY_SIGNALED && waited != GL_CONDITION_SATISFIED) {
+            OverlayLogError("Timed out waiting for the GPU to read the dmabuf");
+            return false;
+        }
+        return true;
+    }
+    
+    // Record the vblank after a present: the latest one GLX_OML_sync_control
+    // reports, whose UST is CLOCK_MONOTONIC microseconds on Mesa, or, without it,
+    // the time the swap returned. Vsync is off, so that is only an estimate.
+    void recordPresent() {
+        auto now = frame_timing::Clock::now();
+        int64_t ust = 0, msc = 0, sbc = 0;
+        if (device->glXGetSyncValuesOML &&
+            device->glXGetSyncValuesOML(display, window, &ust, &msc, &sbc) && ust > 0) {
+            struct timespec ts;
+            clock_gettime(CLOCK_MONOTONIC, &ts);
+            double ageMs = ((double)ts.tv_sec * 1e6 + (double)ts.tv_nsec / 1e3 - (double)ust) / 1000.0;
+            if (ageMs >= 0.0 && ageMs < present_timing::kMaxVblankAgeMs) {
+                if (device->glXGetMscRateOML && (mscRefreshMs == 0.0 || ++presentsSinceMscRate >= kMscRateRefreshPresents)) {
+                    int32_t numerator = 0, denominator = 0;
+                    if (device->glXGetMscRateOML(display, window, &numerator, &denominator) &&
+                        numerator > 0 && denominator > 0) {
+                        mscRefreshMs = 1000.0 * (double)denominator / (double)numerator;
+                    }
+                    presentsSinceMscRate = 0;
+                }
+                presentClock.record(present_timing::before(now, ageMs), mscRefreshMs,
+                                    present_timing::kSourceOml);
+                return;
+            }
+        }
+        presentClock.record(now, 0.0, present_timing::kSourceSwap);
+    }
+    
+    // Render thread body: owns the GL context from init() until destroy(). Binds it
+    // while the window is mapped, presents the newest frame from the mailbox, and
+    // forwards X events while idle if there is no event thread.
+    void renderLoop() {
+        bool viewportStale = false;
+        
+        for (;;) {
+            bool wantContext = false;
+            bool resized = false;
+            bool importing = false;
+            DmabufPlane importPlane = {};
+            uint64_t importingSerial = 0;
+            int newWidth = 0, newHeight = 0;
+            {
+                std::unique_lock<std::mutex> lock(wakeMutex);
+                auto hasWork = [this] {
+                    return stopRequested || viewportDirty || contextRequested != contextBound ||
+                           importPending || (contextBound && mailbox.hasPendingFrame());
+                };
+                if (useEventThread) {
+                    wakeCondition.wait(lock, hasWork);
+                } else {
+                    wakeCondition.wait_for(lock, std::chrono::milliseconds(kRenderIdleWaitMs), hasWork);
+                }
+                if (stopRequested) break;
+                wantContext = contextRequested;
+                resized = viewportDirty;
+                // Take the request: from here the plane and its fd are ours
+                importing = importPending;
+                if (importing) {
+                    importPlane = importRequest;
+                    importingSerial = importSerial;
+                    importPending = false;
+                }
+                newWidth = pendingWidth;
+                newHeight = pendingHeight;
+                viewportDirty = false;
+            }
+            
+            if (wantContext != contextBound) {
+                bool bound = false;
+                if (wantContext) {
+                    bound = glXMakeCurrent(display, window, glContext);
+                    if (!bound) OverlayLogError("Failed to make context current on render thread");
+                } else {
+                    glXMakeCurrent(display, None, nullptr);
+                }
+                {
+                    std::lock_guard<std::mutex> lock(wakeMutex);
+                    contextBound = bound;
+                    // Don't spin retrying — the next show() asks again
+                    if (wantContext && !bound) contextRequested = false;
+                }
+                wakeCondition.notify_all();
+            }
+            
+            if (resized) {
+                width = newWidth;
+                height = newHeight;
+                viewportStale = true;
+            }
+            if (contextBound && viewportStale) {
+                applyViewport(width, height);
+                viewportStale = false;
+            }
+            
+            // Frames stay in the mailbox while hidden and are presented after show()
+            if (contextBound) {
+                FrameSlot* frame = mailbox.take();
+                if (frame) {
+                    if (frame->isFull) {
+                        presentFrame(frame->pixels.data(), frame->width, frame->height, nullptr, 0);
+                    } else {
+                        frame->packedRegions(uploadRegions);
+                        presentFrame(nullptr, frame->width, frame->height,
+                                     uploadRegions.data(), (int)uploadRegions.size());
+                    }
+                }
+            }
+            
+            // After any mailbox frame, which is older
+            if (importing) {
+                bool presented = false;
+                if (contextBound) {
+                    presented = presentDmabuf(importPlane);
+                } else {
+                    close(importPlane.fd);
+                }
+                {
+                    std::lock_guard<std::mutex> lock(wakeMutex);
+                    importAnsweredSerial = importingSerial;
+                    importPresented = presented;
+                }
+                wakeCondition.notify_all();
+            }
+            
+            if (!useEventThread) processEvents(display);
+        }
+        
+        // GL objects belong to the context — delete them while it's current here
+        if (contextBound || glXMakeCurrent(display, window, glContext)) {
+            deleteGLObjects();
+            glXMakeCurrent(display, None, nullptr);
+        }
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            contextBound = false;
+            if (importPending) {
+                close(importRequest.fd);
+                importPending = false;
             }
-            requestFocus();
+            importAnsweredSerial = importSerial;
+            importPresented = false;
         }
+        wakeCondition.notify_all();
     }
-
-    void requestFocus() {
-        if (!display || !window || !isMapped) return;
-        XSetInputFocus(display, window, RevertToPointerRoot, CurrentTime);
-        XFlush(display);
-        lastRequestFocusMs = getMonotonicMs();
-    }
-
-    void hide() {
-        if (isDestroyed) return;
-        
-        if (display && window) {
-            OverlayLog("Hiding overlay window");
-            isMapped = false;
-            // Release GL context before unmapping to prevent stale drawable state
-            glXMakeCurrent(display, None, nullptr);
-            XUnmapWindow(display, window);
-            XFlush(display);
+    
+    void stopRenderThread() {
+        if (!renderThread.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            stopRequested = true;
         }
+        wakeCondition.notify_all();
+        renderThread.join();
     }
     
-    void setFrame(int x, int y, int w, int h) {
-        if (isDestroyed) return;
+    // Delete texture, pixel buffers and shader renderer. Needs the context current.
+    void deleteGLObjects() {
+        if (texture) {
+            glDeleteTextures(1, &texture);
+            texture = 0;
+        }
+        destroyPixelBuffers();
+        quadRenderer.destroy();
+    }
+
+    // Move input selection to a dedicated connection and start the event thread.
+    // Returns false (events stay on the main connection) if that isn't possible.
+    bool startEventThread() {
+        eventDisplay = XOpenDisplay(nullptr);
+        if (!eventDisplay) {
+            OverlayLogError("Failed to open X event connection");
+            return false;
+        }
+        if (pipe2(eventWakePipe, O_CLOEXEC | O_NONBLOCK) != 0) {
+            OverlayLogError("Failed to create event thread wake pipe: %s", strerror(errno));
+            XCloseDisplay(eventDisplay);
+            eventDisplay = nullptr;
+            return false;
+        }
         
-        OverlayLog("Setting frame: x=%d, y=%d, w=%d, h=%d", x, y, w, h);
+        // Drop the mask from the main connection first — selecting ButtonPress
+        // while another client still holds it fails with BadAccess
+        XSelectInput(display, window, NoEventMask);
+        XSync(display, False);
+        XSelectInput(eventDisplay, window, kOverlayEventMask);
+        XSync(eventDisplay, False);
         
-        width = w;
-        height = h;
+        eventThread = std::thread(&LinuxOverlayWindow::eventLoop, this);
+        return true;
+    }
+    
+    // Event thread body: forward everything queued, then sleep until the server
+    // sends more, destroy() writes to the wake pipe, or the idle refocus is due.
+    void eventLoop() {
+        int xfd = ConnectionNumber(eventDisplay);
         
-        if (display && window) {
-            XMoveResizeWindow(display, window, x, y, w, h);
+        while (!stopEvents) {
+            processEvents(eventDisplay);
+            XFlush(eventDisplay);
+            // Round trips (XGetInputFocus) can queue events without leaving data on the fd
+            if (XQLength(eventDisplay) > 0) continue;
             
-            // Update OpenGL viewport
-            if (glContext) {
-                glXMakeCurrent(display, window, glContext);
-                glViewport(0, 0, w, h);
-                
-                glMatrixMode(GL_PROJECTION);
-                glLoadIdentity();
-                glOrtho(0, w, h, 0, -1, 1);
-                
-                glMatrixMode(GL_MODELVIEW);
-                glLoadIdentity();
+            int timeoutMs = -1;
+            if (isMapped && lastForwardedEventMs > 0) {
+                long long remaining = lastForwardedEventMs + kIdleRefocusMs - getMonotonicMs();
+                timeoutMs = remaining >= 0 ? (int)remaining + 1 : 0;
             }
             
-            XFlush(display);
+            struct pollfd fds[2] = {
+                { xfd, POLLIN, 0 },
+                { eventWakePipe[0], POLLIN, 0 },
+            };
+            if (poll(fds, 2, timeoutMs) < 0 && errno != EINTR) {
+                OverlayLogError("poll on X connection failed: %s", strerror(errno));
+                break;
+            }
+            if (fds[1].revents & POLLIN) {
+                char drain[16];
+                while (read(eventWakePipe[0], drain, sizeof(drain)) > 0) {}
+            }
         }
     }
     
-    void renderFrame(const uint8_t* data, int w, int h) {
-        if (isDestroyed) return;
-        if (!isMapped) return;  // Don't render/swap when hidden — avoids GL errors on unmapped window
-        
-        std::lock_guard<std::mutex> lock(renderMutex);
-        
-        if (!display || !glContext || !window) return;
-        
-        if (!glXMakeCurrent(display, window, glContext)) {
-            OverlayLogError("Failed to make context current in renderFrame");
-            return;
-        }
-        
-        // Create or update texture
-        if (texture == 0 || w != texWidth || h != texHeight) {
-            if (texture != 0) {
-                glDeleteTextures(1, &texture);
+    void stopEventThread() {
+        if (eventThread.joinable()) {
+            stopEvents = true;
+            char wake = 1;
+            if (write(eventWakePipe[1], &wake, 1) < 0) {
+                OverlayLogError("Failed to wake event thread: %s", strerror(errno));
             }
-            
-            glGenTextures(1, &texture);
-            glBindTexture(GL_TEXTURE_2D, texture);
-            
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-            
-            // Allocate texture storage (BGRA format from Electron)
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
-            
-            texWidth = w;
-            texHeight = h;
-            
-            OverlayLog("Created texture: %dx%d", w, h);
+            eventThread.join();
         }
-        
-        // Upload pixel data
-        glBindTexture(GL_TEXTURE_2D, texture);
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, w, h, GL_BGRA, GL_UNSIGNED_BYTE, data);
-        
-        // Clear with transparent color
-        glClear(GL_COLOR_BUFFER_BIT);
-        
-        // Render textured quad
-        glEnable(GL_TEXTURE_2D);
-        glBindTexture(GL_TEXTURE_2D, texture);
-        
-        glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
-        
-        // Draw full-screen quad
-        glBegin(GL_QUADS);
-            glTexCoord2f(0.0f, 0.0f); glVertex2f(0.0f, 0.0f);
-            glTexCoord2f(1.0f, 0.0f); glVertex2f((float)width, 0.0f);
-            glTexCoord2f(1.0f, 1.0f); glVertex2f((float)width, (float)height);
-            glTexCoord2f(0.0f, 1.0f); glVertex2f(0.0f, (float)height);
-        glEnd();
-        
-        // Swap buffers
-        glXSwapBuffers(display, window);
-        
-        // Process any pending X events
-        while (XPending(display)) {
-            XEvent event;
-            XNextEvent(display, &event);
+        for (int i = 0; i < 2; i++) {
+            if (eventWakePipe[i] >= 0) close(eventWakePipe[i]);
+            eventWakePipe[i] = -1;
+        }
+        if (eventDisplay) {
+            XCloseDisplay(eventDisplay);
+            eventDisplay = nullptr;
+        }
+    }
+
+    // Next queued event of this window, without blocking. The main connection is
+    // shared by every overlay window, so only this window's events are taken from it.
+    bool nextEvent(Display* dpy, XEvent* event) {
+        if (dpy == eventDisplay) {
+            if (!XPending(dpy)) return false;
+            XNextEvent(dpy, event);
+            return true;
+        }
+        return XCheckIfEvent(dpy, event, isWindowEvent, (XPointer)&window);
+    }
+    
+    static Bool isWindowEvent(Display*, XEvent* event, XPointer arg) {
+        return event->xany.window == *(Window*)arg;
+    }
+
+    // Forward pending X input events to Electron and run the idle refocus check.
+    // Runs on the event thread, or from the render path (with renderMutex held in
+    // synchronous mode) when there is none.
+    void processEvents(Display* dpy) {
+        Window target = electronWindow;
+        XEvent event;
+        while (nextEvent(dpy, &event)) {
 
             if (event.type == KeyPress || event.type == KeyRelease) {
                 bool isShiftTab = (event.xkey.keycode == 23 && (event.xkey.state & ShiftMask));
@@ -512,14 +1643,14 @@ public:
                     isShiftTab ? " [Shift+Tab - overlay opening]" : "");
 
                 // Shift+Tab: do NOT forward to Electron — Steam's hook consumes it.
-                if (!isShiftTab && electronWindow) {
-                    event.xkey.window    = electronWindow;
+                if (!isShiftTab && target) {
+                    event.xkey.window    = target;
                     event.xkey.subwindow = None;
-                    XSendEvent(display, electronWindow, True, NoEventMask, &event);
+                    XSendEvent(dpy, target, True, NoEventMask, &event);
                     lastForwardedEventMs = getMonotonicMs();
                 }
 
-            } else if (electronWindow && (
+            } else if (target && (
                     event.type == ButtonPress || event.type == ButtonRelease ||
                     event.type == MotionNotify)) {
 
@@ -531,9 +1662,9 @@ public:
                 }
 
                 // Forward mouse event to Electron
-                event.xkey.window    = electronWindow;
+                event.xkey.window    = target;
                 event.xkey.subwindow = None;
-                XSendEvent(display, electronWindow, True, NoEventMask, &event);
+                XSendEvent(dpy, target, True, NoEventMask, &event);
 
                 if (event.type == ButtonPress) {
                     suppressMotionUntilMs = 0;
@@ -559,7 +1690,7 @@ public:
                     OverlayLog("FocusIn after overlay: suppressing cursor warp for 500ms");
                 }
             }
-            // Expose/other events: handled on next renderFrame
+            // Expose/other events: nothing to do, the next frame repaints
         }
         
         // Idle refocus: if Chromium stole X11 focus for an input element and the user
@@ -568,17 +1699,14 @@ public:
         // focus — if we already have it, requestFocus() would be a no-op but would
         // refresh the timestamp, causing the next click-outside blur to be suppressed.
         if (isMapped && lastForwardedEventMs > 0 &&
-                getMonotonicMs() - lastForwardedEventMs > 1500) {
+                getMonotonicMs() - lastForwardedEventMs > kIdleRefocusMs) {
             lastForwardedEventMs = 0;
             Window currentFocus; int revertTo;
-            XGetInputFocus(display, &currentFocus, &revertTo);
+            XGetInputFocus(dpy, &currentFocus, &revertTo);
             if (currentFocus != window) {
-                requestFocus();
+                requestFocus(dpy);
             }
         }
-
-        // Ensure GL commands are flushed
-        glFlush();
     }
 
     void destroy() {
@@ -586,11 +1714,14 @@ public:
         
         OverlayLog("Destroying Linux overlay window...");
         
-        // Delete texture
-        if (texture && display && glContext) {
+        // The render thread deletes the GL objects itself on the way out
+        stopRenderThread();
+        stopEventThread();
+        
+        // Delete texture, pixel buffers and shader renderer
+        if ((texture || usePixelBuffers || quadRenderer.isReady()) && display && glContext) {
             glXMakeCurrent(display, window, glContext);
-            glDeleteTextures(1, &texture);
-            texture = 0;
+            deleteGLObjects();
         }
         
         if (glContext && display) {
@@ -604,31 +1735,43 @@ public:
             window = 0;
         }
         
-        if (colormap && display) {
-            XFreeColormap(display, colormap);
-            colormap = 0;
-        }
-        
-        if (visualInfo) {
-            XFree(visualInfo);
-            visualInfo = nullptr;
-        }
-        
-        if (display) {
-            XCloseDisplay(display);
-            display = nullptr;
-        }
+        releaseDevice();
         
         OverlayLog("Linux overlay window destroyed");
     }
     
+    // Hand the shared X connection back; the colormap and visual belong to it
+    void releaseDevice() {
+        if (!device) return;
+        device->release();
+        device = nullptr;
+        display = nullptr;
+        fbConfig = nullptr;
+        visualInfo = nullptr;
+        colormap = 0;
+    }
+    
     ~LinuxOverlayWindow() {
         destroy();
     }
 };
 
 // N-API wrapper functions
-static napi_value CreateOverlayWindow(napi_env env, napi_callback_info info) {
+
+// Options shared by createOverlayWindow and createOverlayWindowAsync: the window
+// (not yet initialized) with its preferences applied, and its size and title
+struct OverlayWindowRequest {
+    LinuxOverlayWindow* window = nullptr;
+    int width = 0;
+    int height = 0;
+    char title[256] = "Steam Overlay";
+    bool initialized = false;
+    napi_deferred deferred = nullptr;
+    napi_async_work work = nullptr;
+};
+
+// Read the options object into request. Throws and returns false on bad arguments.
+static bool ReadOverlayWindowOptions(napi_env env, napi_callback_info info, OverlayWindowRequest* request) {
     napi_status status;
     size_t argc = 1;
     napi_value args[1];
@@ -636,7 +1779,7 @@ static napi_value CreateOverlayWindow(napi_env env, napi_callback_info info) {
     
     if (status != napi_ok || argc < 1) {
         napi_throw_error(env, nullptr, "Expected options object");
-        return nullptr;
+        return false;
     }
     
     // Get options
@@ -645,17 +1788,87 @@ static napi_value CreateOverlayWindow(napi_env env, napi_callback_info info) {
     napi_get_named_property(env, args[0], "height", &heightVal);
     napi_get_named_property(env, args[0], "title", &titleVal);
     
-    int width, height;
-    napi_get_value_int32(env, widthVal, &width);
-    napi_get_value_int32(env, heightVal, &height);
+    napi_get_value_int32(env, widthVal, &request->width);
+    napi_get_value_int32(env, heightVal, &request->height);
     
-    char title[256] = "Steam Overlay";
     size_t titleLen;
-    napi_get_value_string_utf8(env, titleVal, title, sizeof(title), &titleLen);
+    napi_get_value_string_utf8(env, titleVal, request->title, sizeof(request->title), &titleLen);
     
     // Create window
     LinuxOverlayWindow* window = new LinuxOverlayWindow();
-    if (!window->init(width, height, title)) {
+    request->window = window;
+    
+    // Optional: pixelBuffers=false forces synchronous client-memory uploads
+    bool hasPixelBuffers = false;
+    napi_has_named_property(env, args[0], "pixelBuffers", &hasPixelBuffers);
+    if (hasPixelBuffers) {
+        napi_value pixelBuffersVal;
+        bool pixelBuffers = true;
+        napi_get_named_property(env, args[0], "pixelBuffers", &pixelBuffersVal);
+        if (napi_get_value_bool(env, pixelBuffersVal, &pixelBuffers) == napi_ok) {
+            window->preferPixelBuffers = pixelBuffers;
+        }
+    }
+    
+    // Optional: shaderRenderer=false keeps the fixed-function immediate-mode quad
+    bool hasShaderRenderer = false;
+    napi_has_named_property(env, args[0], "shaderRenderer", &hasShaderRenderer);
+    if (hasShaderRenderer) {
+        napi_value shaderRendererVal;
+        bool shaderRenderer = true;
+        napi_get_named_property(env, args[0], "shaderRenderer", &shaderRendererVal);
+        if (napi_get_value_bool(env, shaderRendererVal, &shaderRenderer) == napi_ok) {
+            window->preferShaderRenderer = shaderRenderer;
+        }
+    }
+    
+    // Optional: compressedTextures=true uploads changed tiles as BC3
+    bool hasCompressedTextures = false;
+    napi_has_named_property(env, args[0], "compressedTextures", &hasCompressedTextures);
+    if (hasCompressedTextures) {
+        napi_value compressedTexturesVal;
+        bool compressedTextures = false;
+        napi_get_named_property(env, args[0], "compressedTextures", &compressedTexturesVal);
+        if (napi_get_value_bool(env, compressedTexturesVal, &compressedTextures) == napi_ok) {
+            window->preferCompressedTextures = compressedTextures;
+        }
+    }
+    
+    // Optional: upscaleSharpness (0-1) for frames smaller than the window
+    bool hasUpscaleSharpness = false;
+    napi_has_named_property(env, args[0], "upscaleSharpness", &hasUpscaleSharpness);
+    if (hasUpscaleSharpness) {
+        napi_value sharpnessVal;
+        double sharpness = 0.5;
+        napi_get_named_property(env, args[0], "upscaleSharpness", &sharpnessVal);
+        if (napi_get_value_double(env, sharpnessVal, &sharpness) == napi_ok) {
+            window->upscaleSharpness = (float)(sharpness < 0.0 ? 0.0 : sharpness > 1.0 ? 1.0 : sharpness);
+        }
+    }
+    
+    // Optional: renderThread=false uploads and swaps on the calling thread
+    bool hasRenderThread = false;
+    napi_has_named_property(env, args[0], "renderThread", &hasRenderThread);
+    if (hasRenderThread) {
+        napi_value renderThreadVal;
+        bool renderThread = true;
+        napi_get_named_property(env, args[0], "renderThread", &renderThreadVal);
+        if (napi_get_value_bool(env, renderThreadVal, &renderThread) == napi_ok) {
+            window->preferRenderThread = renderThread;
+        }
+    }
+    
+    return true;
+}
+
+static napi_value CreateOverlayWindow(napi_env env, napi_callback_info info) {
+    OverlayWindowRequest request;
+    if (!ReadOverlayWindowOptions(env, info, &request)) {
+        return nullptr;
+    }
+    
+    LinuxOverlayWindow* window = request.window;
+    if (!window->init(request.width, request.height, request.title)) {
         delete window;
         napi_throw_error(env, nullptr, "Failed to create overlay window");
         return nullptr;
@@ -663,11 +1876,58 @@ static napi_value CreateOverlayWindow(napi_env env, napi_callback_info info) {
     
     // Wrap pointer
     napi_value external;
-    status = napi_create_external(env, window, nullptr, nullptr, &external);
+    napi_create_external(env, window, nullptr, nullptr, &external);
     
     return external;
 }
 
+// createOverlayWindowAsync: the X connection, FBConfig, window, GLX context and
+// shader setup of init() run on a libuv worker, so the main thread never blocks
+// on the X server or the driver while the window comes up.
+static void CreateOverlayWindowExecute(napi_env env, void* data) {
+    OverlayWindowRequest* request = (OverlayWindowRequest*)data;
+    request->initialized = request->window->init(request->width, request->height, request->title);
+    // The window is used (or destroyed, on failure) from the main thread
+    request->window->releaseCallerContext();
+}
+
+static void RejectOverlayWindow(napi_env env, napi_deferred deferred) {
+    napi_value message, error;
+    napi_create_string_utf8(env, "Failed to create overlay window", NAPI_AUTO_LENGTH, &message);
+    napi_create_error(env, nullptr, message, &error);
+    napi_reject_deferred(env, deferred, error);
+}
+
+static void CreateOverlayWindowComplete(napi_env env, napi_status status, void* data) {
+    OverlayWindowRequest* request = (OverlayWindowRequest*)data;
+    if (status == napi_ok && request->initialized) {
+        napi_value external;
+        napi_create_external(env, request->window, nullptr, nullptr, &external);
+        napi_resolve_deferred(env, request->deferred, external);
+    } else {
+        delete request->window;
+        RejectOverlayWindow(env, request->deferred);
+    }
+    napi_delete_async_work(env, request->work);
+    delete request;
+}
+
+static napi_value CreateOverlayWindowAsync(napi_env env, napi_callback_info info) {
+    OverlayWindowRequest* request = new OverlayWindowRequest();
+    if (!ReadOverlayWindowOptions(env, info, request)) {
+        delete request;
+        return nullptr;
+    }
+    
+    napi_value promise, resourceName;
+    napi_create_promise(env, &request->deferred, &promise);
+    napi_create_string_utf8(env, "createOverlayWindowAsync", NAPI_AUTO_LENGTH, &resourceName);
+    napi_create_async_work(env, nullptr, resourceName, CreateOverlayWindowExecute,
+                           CreateOverlayWindowComplete, request, &request->work);
+    napi_queue_async_work(env, request->work);
+    return promise;
+}
+
 static napi_value ShowOverlayWindow(napi_env env, napi_callback_info info) {
     size_t argc = 1;
     napi_value args[1];
@@ -719,11 +1979,83 @@ static napi_value SetOverlayWindowFrame(napi_env env, napi_callback_info info) {
     return nullptr;
 }
 
+// renderFrame(handle, buffer, width, height, forcePresent?) — returns false when the
+// frame matched the previous one and was skipped (or the window is hidden).
+// The buffer is copied before returning, so the caller may reuse it immediately.
 static napi_value RenderFrame(napi_env env, napi_callback_info info) {
-    size_t argc = 4;
-    napi_value args[4];
+    size_t argc = 5;
+    napi_value args[5];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    LinuxOverlayWindow* window;
+    napi_get_value_external(env, args[0], (void**)&window);
+    
+    void* buffer;
+    size_t length;
+    napi_get_buffer_info(env, args[1], &buffer, &length);
+    
+    int width, height;
+    napi_get_value_int32(env, args[2], &width);
+    napi_get_value_int32(env, args[3], &height);
+    
+    bool forcePresent = false;
+    if (argc >= 5) {
+        napi_get_value_bool(env, args[4], &forcePresent);
+    }
+    
+    bool rendered = false;
+    if (window && buffer && width > 0 && height > 0 && length >= (size_t)width * height * 4) {
+        rendered = window->renderFrame((const uint8_t*)buffer, width, height, nullptr, 0, forcePresent);
+    }
+    
+    napi_value result;
+    napi_get_boolean(env, rendered, &result);
+    return result;
+}
+
+// Read an array of { x, y, width, height } objects, clipped to a w x h frame.
+// Empty rectangles are dropped. Returns false if value isn't an array.
+static bool ReadFrameRects(napi_env env, napi_value value, int w, int h, std::vector<FrameRect>& rects) {
+    bool isArray = false;
+    if (napi_is_array(env, value, &isArray) != napi_ok || !isArray) return false;
+
+    uint32_t count = 0;
+    napi_get_array_length(env, value, &count);
+    rects.reserve(count);
+
+    for (uint32_t i = 0; i < count; i++) {
+        napi_value item, field;
+        napi_get_element(env, value, i, &item);
+
+        int x = 0, y = 0, rw = 0, rh = 0;
+        napi_get_named_property(env, item, "x", &field);      napi_get_value_int32(env, field, &x);
+        napi_get_named_property(env, item, "y", &field);      napi_get_value_int32(env, field, &y);
+        napi_get_named_property(env, item, "width", &field);  napi_get_value_int32(env, field, &rw);
+        napi_get_named_property(env, item, "height", &field); napi_get_value_int32(env, field, &rh);
+
+        int x0 = x < 0 ? 0 : x;
+        int y0 = y < 0 ? 0 : y;
+        int x1 = x + rw > w ? w : x + rw;
+        int y1 = y + rh > h ? h : y + rh;
+        if (x1 > x0 && y1 > y0) {
+            rects.push_back({ x0, y0, x1 - x0, y1 - y0 });
+        }
+    }
+    return true;
+}
+
+// renderFrameRegions(handle, buffer, width, height, rects) — uploads only the listed
+// dirty rectangles of a full-size BGRA frame, keeping the rest of the texture
+static napi_value RenderFrameRegions(napi_env env, napi_callback_info info) {
+    size_t argc = 5;
+    napi_value args[5];
     napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
     
+    if (argc < 5) {
+        napi_throw_error(env, nullptr, "Expected window handle, buffer, width, height, rects");
+        return nullptr;
+    }
+    
     LinuxOverlayWindow* window;
     napi_get_value_external(env, args[0], (void**)&window);
     
@@ -735,11 +2067,106 @@ static napi_value RenderFrame(napi_env env, napi_callback_info info) {
     napi_get_value_int32(env, args[2], &width);
     napi_get_value_int32(env, args[3], &height);
     
+    if (width <= 0 || height <= 0 || length < (size_t)width * height * 4) {
+        napi_throw_error(env, nullptr, "Buffer is smaller than width * height * 4");
+        return nullptr;
+    }
+    
+    std::vector<FrameRect> rects;
+    if (!ReadFrameRects(env, args[4], width, height, rects)) {
+        napi_throw_error(env, nullptr, "Expected an array of { x, y, width, height } rects");
+        return nullptr;
+    }
+    
+    bool rendered = false;
     if (window && buffer) {
-        window->renderFrame((const uint8_t*)buffer, width, height);
+        rendered = window->renderFrame((const uint8_t*)buffer, width, height, rects.data(), (int)rects.size());
     }
     
-    return nullptr;
+    napi_value result;
+    napi_get_boolean(env, rendered, &result);
+    return result;
+}
+
+// createSharedFrameBuffer(width, height) — { buffer: ArrayBuffer, shared: boolean }.
+// A persistent page-aligned frame buffer to write frames into and pass (as a
+// Buffer view) to renderFrame/renderFrameRegions, instead of a new Buffer per frame.
+static napi_value CreateSharedFrameBuffer(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int width = 0, height = 0;
+    if (argc >= 2) {
+        napi_get_value_int32(env, args[0], &width);
+        napi_get_value_int32(env, args[1], &height);
+    }
+    if (width <= 0 || height <= 0) {
+        napi_throw_error(env, nullptr, "Expected positive width and height");
+        return nullptr;
+    }
+    
+    bool shared = false;
+    napi_value buffer = shared_frame::createArrayBuffer(env, (size_t)width * (size_t)height * 4, &shared);
+    if (!buffer) {
+        napi_throw_error(env, nullptr, "Failed to allocate frame buffer");
+        return nullptr;
+    }
+    OverlayLog("Frame buffer %dx%d: %s", width, height, shared ? "shared memory" : "ArrayBuffer (external buffers not allowed)");
+    
+    napi_value result, value;
+    napi_create_object(env, &result);
+    napi_set_named_property(env, result, "buffer", buffer);
+    napi_get_boolean(env, shared, &value);
+    napi_set_named_property(env, result, "shared", value);
+    return result;
+}
+
+// importSharedTexture(handle, { fd, stride, offset, modifier }, width, height) —
+// present a BGRA dmabuf plane (Electron's textureInfo.handle.nativePixmap). The
+// modifier is a decimal string, as Electron reports it; only linear buffers are
+// imported. Blocks for at most kImportWaitMs while the render thread presents it.
+// Returns false if it couldn't be imported; the texture may be released either way.
+static napi_value ImportSharedTexture(napi_env env, napi_callback_info info) {
+    size_t argc = 4;
+    napi_value args[4];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    if (argc < 4) {
+        napi_throw_error(env, nullptr, "Expected window handle, texture descriptor, width, height");
+        return nullptr;
+    }
+    
+    LinuxOverlayWindow* window;
+    napi_get_value_external(env, args[0], (void**)&window);
+    
+    int fd = -1, stride = 0, offset = 0;
+    napi_value field;
+    if (napi_get_named_property(env, args[1], "fd", &field) == napi_ok) napi_get_value_int32(env, field, &fd);
+    if (napi_get_named_property(env, args[1], "stride", &field) == napi_ok) napi_get_value_int32(env, field, &stride);
+    if (napi_get_named_property(env, args[1], "offset", &field) == napi_ok) napi_get_value_int32(env, field, &offset);
+    
+    // 64-bit modifiers don't fit a JS number exactly — read the string form
+    uint64_t modifier = 0;
+    char modifierText[32] = "0";
+    size_t modifierLength = 0;
+    if (napi_get_named_property(env, args[1], "modifier", &field) == napi_ok) {
+        napi_get_value_string_utf8(env, field, modifierText, sizeof(modifierText), &modifierLength);
+        modifier = strtoull(modifierText, nullptr, 0);
+    }
+    
+    int width = 0, height = 0;
+    napi_get_value_int32(env, args[2], &width);
+    napi_get_value_int32(env, args[3], &height);
+    
+    bool rendered = false;
+    if (window && fd >= 0 && width > 0 && height > 0) {
+        rendered = window->importDmabuf(fd, stride, offset, modifier, width, height);
+    }
+    
+    napi_value result;
+    napi_get_boolean(env, rendered, &result);
+    return result;
 }
 
 static napi_value DestroyOverlayWindow(napi_env env, napi_callback_info info) {
@@ -848,19 +2275,127 @@ static napi_value ShouldSuppressNextBlur(napi_env env, napi_callback_info info)
     return result;
 }
 
+// Add stages: { submit, upload, draw, swap, frame } (each { count, last, average,
+// p50, p95, p99 } in ms), textureRecreations and swapWaitMs (total time in swaps)
+static void SetTimingStats(napi_env env, napi_value result, const frame_timing::FrameTimings& timings) {
+    napi_value stages, stage, value;
+    napi_create_object(env, &stages);
+    double swapWaitMs = 0.0;
+    for (int i = 0; i < frame_timing::kStageCount; i++) {
+        frame_timing::StageSummary summary = timings.stages[i].summary();
+        if (i == frame_timing::kStageSwap) swapWaitMs = summary.total;
+        
+        napi_create_object(env, &stage);
+        napi_create_double(env, (double)summary.count, &value);
+        napi_set_named_property(env, stage, "count", value);
+        napi_create_double(env, summary.last, &value);
+        napi_set_named_property(env, stage, "last", value);
+        napi_create_double(env, summary.average, &value);
+        napi_set_named_property(env, stage, "average", value);
+        napi_create_double(env, summary.p50, &value);
+        napi_set_named_property(env, stage, "p50", value);
+        napi_create_double(env, summary.p95, &value);
+        napi_set_named_property(env, stage, "p95", value);
+        napi_create_double(env, summary.p99, &value);
+        napi_set_named_property(env, stage, "p99", value);
+        napi_set_named_property(env, stages, frame_timing::kStageNames[i], stage);
+    }
+    napi_set_named_property(env, result, "stages", stages);
+    
+    napi_create_double(env, (double)timings.textureRecreations, &value);
+    napi_set_named_property(env, result, "textureRecreations", value);
+    
+    napi_create_double(env, swapWaitMs, &value);
+    napi_set_named_property(env, result, "swapWaitMs", value);
+}
+
+// Add presentTiming: { source, refreshIntervalMs, msSinceVblank, msUntilVblank,
+// presentedFrames }, the vblank timing as of this call
+static void SetPresentTiming(napi_env env, napi_value result, const present_timing::PresentClock& clock) {
+    present_timing::Snapshot snapshot = clock.snapshot(frame_timing::Clock::now());
+    napi_value timing, value;
+    napi_create_object(env, &timing);
+    napi_create_string_utf8(env, present_timing::kSourceNames[snapshot.source], NAPI_AUTO_LENGTH, &value);
+    napi_set_named_property(env, timing, "source", value);
+    napi_create_double(env, snapshot.refreshMs, &value);
+    napi_set_named_property(env, timing, "refreshIntervalMs", value);
+    napi_create_double(env, snapshot.sinceVblankMs, &value);
+    napi_set_named_property(env, timing, "msSinceVblank", value);
+    napi_create_double(env, snapshot.untilVblankMs, &value);
+    napi_set_named_property(env, timing, "msUntilVblank", value);
+    napi_create_double(env, (double)snapshot.presents, &value);
+    napi_set_named_property(env, timing, "presentedFrames", value);
+    napi_set_named_property(env, result, "presentTiming", timing);
+}
+
+// getOverlayStats(handle) — texture upload timing for the current upload path,
+// plus per-stage timing histograms
+static napi_value GetOverlayStats(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    LinuxOverlayWindow* window = nullptr;
+    napi_get_value_external(env, args[0], (void**)&window);
+    if (!window) {
+        napi_value result; napi_get_null(env, &result); return result;
+    }
+
+    napi_value result, value;
+    napi_create_object(env, &result);
+
+    napi_create_string_utf8(env, window->uploadPathName(), NAPI_AUTO_LENGTH, &value);
+    napi_set_named_property(env, result, "uploadPath", value);
+
+    napi_create_double(env, (double)window->uploadedFrames, &value);
+    napi_set_named_property(env, result, "uploadedFrames", value);
+
+    napi_create_double(env, window->lastUploadMs, &value);
+    napi_set_named_property(env, result, "lastUploadMs", value);
+
+    napi_create_double(env, (double)window->lastUploadBytes, &value);
+    napi_set_named_property(env, result, "lastUploadBytes", value);
+
+    napi_create_double(env, (double)window->skippedFrames, &value);
+    napi_set_named_property(env, result, "skippedFrames", value);
+
+    napi_create_double(env, (double)window->droppedFrames, &value);
+    napi_set_named_property(env, result, "droppedFrames", value);
+
+    napi_get_boolean(env, window->useRenderThread, &value);
+    napi_set_named_property(env, result, "renderThread", value);
+
+    napi_create_string_utf8(env, window->useShaderRenderer ? "shader" : "legacy", NAPI_AUTO_LENGTH, &value);
+    napi_set_named_property(env, result, "renderer", value);
+
+    double avg = window->uploadedFrames ? window->totalUploadMs / (double)window->uploadedFrames : 0.0;
+    napi_create_double(env, avg, &value);
+    napi_set_named_property(env, result, "averageUploadMs", value);
+
+    SetTimingStats(env, result, window->timings);
+    SetPresentTiming(env, result, window->presentClock);
+
+    return result;
+}
+
 // Module initialization - use same function names as other platforms for compatibility
 static napi_value Init(napi_env env, napi_value exports) {
     napi_property_descriptor desc[] = {
         { "createOverlayWindow",      nullptr, CreateOverlayWindow,      nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "createOverlayWindowAsync", nullptr, CreateOverlayWindowAsync, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "showOverlayWindow",        nullptr, ShowOverlayWindow,        nullptr, nullptr, nullptr, napi_default, nullptr },
         { "hideOverlayWindow",        nullptr, HideOverlayWindow,        nullptr, nullptr, nullptr, napi_default, nullptr },
         { "setOverlayFrame",          nullptr, SetOverlayWindowFrame,    nullptr, nullptr, nullptr, napi_default, nullptr },
         { "renderFrame",              nullptr, RenderFrame,              nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "renderFrameRegions",       nullptr, RenderFrameRegions,       nullptr, nullptr, nullptr, napi_default, nullptr },
         { "destroyOverlayWindow",     nullptr, DestroyOverlayWindow,     nullptr, nullptr, nullptr, napi_default, nullptr },
         { "setDebugMode",             nullptr, SetDebugMode,             nullptr, nullptr, nullptr, napi_default, nullptr },
         { "setSteamGameAtomOnWindow",  nullptr, SetSteamGameAtomOnWindow,  nullptr, nullptr, nullptr, napi_default, nullptr },
         { "setElectronWindow",          nullptr, SetElectronWindow,          nullptr, nullptr, nullptr, napi_default, nullptr },
         { "shouldSuppressNextBlur",     nullptr, ShouldSuppressNextBlur,     nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "getOverlayStats",            nullptr, GetOverlayStats,            nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "createSharedFrameBuffer",    nullptr, CreateSharedFrameBuffer,    nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "importSharedTexture",        nullptr, ImportSharedTexture,        nullptr, nullptr, nullptr, napi_default, nullptr },
     };
     
     napi_define_properties(env, exports, sizeof(desc) / sizeof(desc[0]), desc);
@@ -1,7 +1,16 @@
 #import <Cocoa/Cocoa.h>
 #import <Metal/Metal.h>
 #import <MetalKit/MetalKit.h>
+#import <IOSurface/IOSurface.h>
 #import <node_api.h>
+#include <vector>
+#include "frame-hash.h"
+#include "bc3-encoder.h"
+#include "frame-tiles.h"
+#include "shared-frame-buffer.h"
+#include "frame-timing.h"
+#include "present-timing.h"
+#include "overlay-shaders.h"  // generated from overlay-shaders.metal by binding.gyp
 
 // Global debug flag - controlled from JavaScript via SteamLogger
 static BOOL g_debugMode = NO;
@@ -11,6 +20,16 @@ static BOOL g_debugMode = NO;
 // Error logging - always shows
 #define MetalLogError(...) NSLog(__VA_ARGS__)
 
+// In on-demand mode a static page still gets a present this often, so Steam's
+// hooked present keeps running (hotkey detection, overlay notifications)
+static const CFTimeInterval kIdlePresentInterval = 0.25;
+
+// Staging buffers frames are copied into before the GPU blits them into the
+// texture. With three, the CPU can fill one while the GPU copies from another.
+static const int kStagingBufferCount = 3;
+// How long an upload waits for a staging buffer to come back before the frame is dropped
+static const int64_t kStagingWaitNs = 16 * NSEC_PER_MSEC;
+
 // Custom NSWindow that never becomes key or main - allows Electron to stay focused
 @interface MetalOverlayWindow : NSWindow
 @end
@@ -20,10 +39,126 @@ static BOOL g_debugMode = NO;
 - (BOOL)canBecomeMainWindow { return NO; }
 @end
 
+// Metal state shared by every overlay window: the device, the command queue,
+// and the compiled pipeline, sampler and quad they draw with. Compiling the
+// shader source is the slowest part of creating a window; further surfaces
+// (tooltip or notification layers) reuse the pipeline instead. Windows hold the
+// shared object strongly and the cache only weakly, so it goes away with the
+// last window. All of it is immutable once built, and thread-safe to share.
+@interface MetalOverlayDevice : NSObject
+@property (readonly, nonatomic) id<MTLDevice> device;
+@property (readonly, nonatomic) id<MTLCommandQueue> commandQueue;
+@property (readonly, nonatomic) MTLPixelFormat pixelFormat;
+@property (readonly, nonatomic) id<MTLRenderPipelineState> pipelineState;
+@property (readonly, nonatomic) id<MTLBuffer> vertexBuffer;
+@property (readonly, nonatomic) id<MTLSamplerState> samplerState;
+// The shared device for views of this pixel format; nil without Metal. Any thread.
++ (instancetype)sharedDeviceForPixelFormat:(MTLPixelFormat)pixelFormat;
+@end
+
+@implementation MetalOverlayDevice
+
+static __weak MetalOverlayDevice *g_sharedDevice = nil;
+
++ (instancetype)sharedDeviceForPixelFormat:(MTLPixelFormat)pixelFormat {
+    // createOverlayWindowAsync builds it on a worker thread
+    @synchronized (self) {
+        MetalOverlayDevice *shared = g_sharedDevice;
+        if (shared && shared.pixelFormat == pixelFormat) {
+            MetalLog(@"[Metal Overlay] Reusing Metal device and pipeline");
+            return shared;
+        }
+        shared = [[MetalOverlayDevice alloc] initWithPixelFormat:pixelFormat];
+        if (shared) g_sharedDevice = shared;
+        return shared;
+    }
+}
+
+- (instancetype)initWithPixelFormat:(MTLPixelFormat)pixelFormat {
+    self = [super init];
+    if (!self) return nil;
+    
+    id<MTLDevice> device = MTLCreateSystemDefaultDevice();
+    if (!device) {
+        MetalLogError(@"[Metal Overlay] Metal is not supported on this device");
+        return nil;
+    }
+    _device = device;
+    _commandQueue = [device newCommandQueue];
+    _pixelFormat = pixelFormat;
+    
+    // Create vertex buffer for fullscreen quad
+    float vertices[] = {
+        // Position     TexCoord
+        -1.0,  1.0,    0.0, 0.0,  // Top left
+         1.0,  1.0,    1.0, 0.0,  // Top right
+        -1.0, -1.0,    0.0, 1.0,  // Bottom left
+         1.0, -1.0,    1.0, 1.0,  // Bottom right
+    };
+    
+    _vertexBuffer = [device newBufferWithBytes:vertices
+                                        length:sizeof(vertices)
+                                       options:MTLResourceStorageModeShared];
+    
+    // Create sampler state
+    MTLSamplerDescriptor *samplerDescriptor = [MTLSamplerDescriptor new];
+    samplerDescriptor.minFilter = MTLSamplerMinMagFilterLinear;
+    samplerDescriptor.magFilter = MTLSamplerMinMagFilterLinear;
+    samplerDescriptor.sAddressMode = MTLSamplerAddressModeClampToEdge;
+    samplerDescriptor.tAddressMode = MTLSamplerAddressModeClampToEdge;
+    _samplerState = [device newSamplerStateWithDescriptor:samplerDescriptor];
+    
+    // Render pipeline from the library precompiled at build time, or from source
+    id<MTLLibrary> library = [MetalOverlayDevice shaderLibraryForDevice:device];
+    if (!library) {
+        return self;
+    }
+    
+    id<MTLFunction> vertexFunction = [library newFunctionWithName:@"vertexShader"];
+    id<MTLFunction> fragmentFunction = [library newFunctionWithName:@"fragmentShader"];
+    
+    MTLRenderPipelineDescriptor *pipelineDescriptor = [MTLRenderPipelineDescriptor new];
+    pipelineDescriptor.vertexFunction = vertexFunction;
+    pipelineDescriptor.fragmentFunction = fragmentFunction;
+    pipelineDescriptor.colorAttachments[0].pixelFormat = pixelFormat;
+    
+    NSError *error = nil;
+    _pipelineState = [device newRenderPipelineStateWithDescriptor:pipelineDescriptor error:&error];
+    if (!_pipelineState) {
+        MetalLogError(@"[Metal Overlay] Failed to create pipeline state: %@", error);
+    }
+    return self;
+}
+
+// The overlay's shader library: the .metallib embedded at build time, or —
+// when the build had no Metal toolchain or this OS rejects the library —
+// compiled from the embedded source, which takes tens of milliseconds
++ (id<MTLLibrary>)shaderLibraryForDevice:(id<MTLDevice>)device {
+    NSError *error = nil;
+    if (kOverlayShaderLibrarySize > 0) {
+        // Static storage: nothing to copy or free
+        dispatch_data_t data = dispatch_data_create(kOverlayShaderLibrary, kOverlayShaderLibrarySize, nil, ^{});
+        id<MTLLibrary> library = [device newLibraryWithData:data error:&error];
+        if (library) {
+            return library;
+        }
+        MetalLog(@"[Metal Overlay] Precompiled shader library rejected (%@), compiling from source", error);
+    }
+    
+    id<MTLLibrary> library = [device newLibraryWithSource:@(kOverlayShaderSource) options:nil error:&error];
+    if (!library) {
+        MetalLogError(@"[Metal Overlay] Failed to create shader library: %@", error);
+    }
+    return library;
+}
+
+@end
+
 // Metal Window wrapper for Steam overlay integration
 @interface MetalWindowWrapper : NSObject <MTKViewDelegate>
 @property (strong, nonatomic) NSWindow *window;
 @property (strong, nonatomic) MTKView *metalView;
+@property (strong, nonatomic) MetalOverlayDevice *sharedDevice;
 @property (strong, nonatomic) id<MTLDevice> device;
 @property (strong, nonatomic) id<MTLCommandQueue> commandQueue;
 @property (strong, nonatomic) id<MTLTexture> texture;
@@ -34,24 +169,84 @@ static BOOL g_debugMode = NO;
 @property (assign, nonatomic) int height;
 @property (assign, nonatomic) BOOL isDestroyed;
 @property (strong, nonatomic) NSWindow *electronWindow;  // Reference to Electron window for input forwarding
+// Content hash of the last full frame uploaded — identical frames skip the upload
+@property (assign, nonatomic) uint64_t lastFrameHash;
+@property (assign, nonatomic) BOOL lastFrameHashValid;
+@property (assign, nonatomic) unsigned long long skippedFrames;
+// Draw only when a new frame arrives (or a present is requested) instead of
+// redrawing at a fixed rate; matchDisplayRefresh uses the screen's maximum
+// refresh rate (ProMotion) instead of 60 Hz for whatever the view does draw
+@property (assign, nonatomic) BOOL drawOnDemand;
+@property (assign, nonatomic) BOOL matchDisplayRefresh;
+@property (assign, nonatomic) CFTimeInterval lastDrawTime;
+// Upload statistics, reported through getOverlayStats()
+@property (assign, nonatomic) unsigned long long uploadedFrames;
+@property (assign, nonatomic) unsigned long long droppedFrames;  // never presented: ring starved, or replaced before a draw
+@property (assign, nonatomic) unsigned long long lateFrames;     // had to wait for a staging buffer
+@property (assign, nonatomic) double lastUploadMs;
+@property (assign, nonatomic) double totalUploadMs;
+@property (assign, nonatomic) size_t lastUploadBytes;
+@property (assign, nonatomic) unsigned long long uploadsSinceDraw;
+@property (assign, nonatomic) BOOL textureIncomplete;  // a dropped upload or a shared-surface blit left content region uploads can't build on
+// Frames captured below the view's resolution (captureScale < 1) are stretched
+// by the GPU and sharpened this much (0-1)
+@property (assign, nonatomic) float upscaleSharpness;
+// BC3 texture and tile uploads (compressedTextures option) — only the 64x64
+// tiles of a frame that changed are encoded into the staging buffer and blitted.
+// Only switched on when the device samples BC formats.
+@property (readonly, nonatomic) BOOL useCompressedTextures;
+- (void)setCompressedTextures:(BOOL)enabled;
+// Per-stage timings and texture reallocations, reported through getOverlayStats()
+- (const frame_timing::FrameTimings *)timings;
+// When the drawables reached the display, also reported through getOverlayStats()
+- (const present_timing::PresentClock *)presentClock;
 @end
 
-@implementation MetalWindowWrapper
+@implementation MetalWindowWrapper {
+    id<MTLBuffer> _stagingBuffers[kStagingBufferCount];
+    NSUInteger _stagingIndex;
+    dispatch_semaphore_t _stagingSemaphore;  // free staging buffers, signalled from blit completion
+    frame_timing::FrameTimings _timings;
+    present_timing::PresentClock _presentClock;
+    frame_tiles::TileTracker _tileTracker;
+    std::vector<FrameRect> _changedTiles;
+}
+
+- (const frame_timing::FrameTimings *)timings {
+    return &_timings;
+}
+
+- (const present_timing::PresentClock *)presentClock {
+    return &_presentClock;
+}
 
-- (instancetype)initWithWidth:(int)w height:(int)h title:(NSString *)title {
+// From a drawable's presented handler, on a Metal thread. presentedTime is the
+// host time (CACurrentMediaTime) the drawable reached the display, 0 if it never did.
+- (void)recordPresentedTime:(CFTimeInterval)presentedTime refreshMs:(double)refreshMs {
+    if (presentedTime <= 0) return;
+    frame_timing::Clock::time_point now = frame_timing::Clock::now();
+    double ageMs = (CACurrentMediaTime() - presentedTime) * 1000.0;
+    if (ageMs < 0.0 || ageMs >= present_timing::kMaxVblankAgeMs) return;
+    _presentClock.record(present_timing::before(now, ageMs), refreshMs, present_timing::kSourceMetal);
+}
+
+- (instancetype)initWithWidth:(int)w height:(int)h title:(NSString *)title device:(MetalOverlayDevice *)device {
     self = [super init];
     if (self) {
         _width = w;
         _height = h;
+        _upscaleSharpness = 0.5f;
+        _tileTracker = frame_tiles::TileTracker(bc3::kTileSize);
         
-        // Initialize Metal device
-        _device = MTLCreateSystemDefaultDevice();
-        if (!_device) {
-            MetalLogError(@"[Metal Overlay] Metal is not supported on this device");
-            return nil;
-        }
-        
-        _commandQueue = [_device newCommandQueue];
+        // Metal device, queue and pipeline, shared with the other overlay windows
+        _sharedDevice = device;
+        if (!_sharedDevice) return nil;
+        _device = _sharedDevice.device;
+        _commandQueue = _sharedDevice.commandQueue;
+        _pipelineState = _sharedDevice.pipelineState;
+        _vertexBuffer = _sharedDevice.vertexBuffer;
+        _samplerState = _sharedDevice.samplerState;
+        _stagingSemaphore = dispatch_semaphore_create(kStagingBufferCount);
         
         // Create BORDERLESS window - no title bar, no chrome
         // The Electron window behind provides the title bar and controls
@@ -83,6 +278,7 @@ static BOOL g_debugMode = NO;
         _metalView.delegate = self;
         
         // Enable continuous rendering - CRITICAL for Steam overlay
+        // (drawOnDemand switches to event-driven drawing, see setDrawOnDemand:)
         _metalView.enableSetNeedsDisplay = NO;
         _metalView.paused = NO;
         _metalView.preferredFramesPerSecond = 60;
@@ -109,89 +305,14 @@ static BOOL g_debugMode = NO;
         [_window setBackgroundColor:[NSColor clearColor]];
         
         MetalLog(@"[Metal Overlay] Metal window created (borderless, transparent): %dx%d", w, h);
-        
-        // Set up rendering pipeline
-        [self setupRenderPipeline];
     }
     return self;
 }
 
-- (void)setupRenderPipeline {
-    // Create vertex buffer for fullscreen quad
-    float vertices[] = {
-        // Position     TexCoord
-        -1.0,  1.0,    0.0, 0.0,  // Top left
-         1.0,  1.0,    1.0, 0.0,  // Top right
-        -1.0, -1.0,    0.0, 1.0,  // Bottom left
-         1.0, -1.0,    1.0, 1.0,  // Bottom right
-    };
-    
-    _vertexBuffer = [_device newBufferWithBytes:vertices
-                                         length:sizeof(vertices)
-                                        options:MTLResourceStorageModeShared];
-    
-    // Create sampler state
-    MTLSamplerDescriptor *samplerDescriptor = [MTLSamplerDescriptor new];
-    samplerDescriptor.minFilter = MTLSamplerMinMagFilterLinear;
-    samplerDescriptor.magFilter = MTLSamplerMinMagFilterLinear;
-    samplerDescriptor.sAddressMode = MTLSamplerAddressModeClampToEdge;
-    samplerDescriptor.tAddressMode = MTLSamplerAddressModeClampToEdge;
-    _samplerState = [_device newSamplerStateWithDescriptor:samplerDescriptor];
-    
-    // Create render pipeline with inline shader
-    NSString *shaderSource = @R"(
-        #include <metal_stdlib>
-        using namespace metal;
-        
-        struct VertexIn {
-            float2 position;
-            float2 texCoord;
-        };
-        
-        struct VertexOut {
-            float4 position [[position]];
-            float2 texCoord;
-        };
-        
-        vertex VertexOut vertexShader(device VertexIn* vertices [[buffer(0)]],
-                                       uint vid [[vertex_id]]) {
-            VertexOut out;
-            out.position = float4(vertices[vid].position, 0.0, 1.0);
-            out.texCoord = vertices[vid].texCoord;
-            return out;
-        }
-        
-        fragment float4 fragmentShader(VertexOut in [[stage_in]],
-                                       texture2d<float> texture [[texture(0)]],
-                                       sampler textureSampler [[sampler(0)]]) {
-            return texture.sample(textureSampler, in.texCoord);
-        }
-    )";
-    
-    NSError *error = nil;
-    id<MTLLibrary> library = [_device newLibraryWithSource:shaderSource options:nil error:&error];
-    if (!library) {
-        MetalLogError(@"[Metal Overlay] Failed to create shader library: %@", error);
-        return;
-    }
-    
-    id<MTLFunction> vertexFunction = [library newFunctionWithName:@"vertexShader"];
-    id<MTLFunction> fragmentFunction = [library newFunctionWithName:@"fragmentShader"];
-    
-    MTLRenderPipelineDescriptor *pipelineDescriptor = [MTLRenderPipelineDescriptor new];
-    pipelineDescriptor.vertexFunction = vertexFunction;
-    pipelineDescriptor.fragmentFunction = fragmentFunction;
-    pipelineDescriptor.colorAttachments[0].pixelFormat = _metalView.colorPixelFormat;
-    
-    _pipelineState = [_device newRenderPipelineStateWithDescriptor:pipelineDescriptor error:&error];
-    if (!_pipelineState) {
-        MetalLogError(@"[Metal Overlay] Failed to create pipeline state: %@", error);
-    }
-}
-
 - (void)show {
     [_window orderFront:nil];
     // Don't steal focus from Electron window - use orderFront instead of makeKeyAndOrderFront
+    [_metalView setNeedsDisplay:YES];
 }
 
 - (void)hide {
@@ -221,40 +342,345 @@ static BOOL g_debugMode = NO;
     CGFloat macY = screenFrame.size.height - y - h;
     NSRect newFrame = NSMakeRect(x, macY, w, h);
     [_window setFrame:newFrame display:YES animate:NO];
+    // The window may have moved to a screen with a different refresh rate
+    [self applyFrameRate];
+}
+
+// Continuous (the default) redraws at a fixed rate whether or not a frame
+// arrived. On demand pauses the view and draws only through setNeedsDisplay:
+// after an upload, a forced present, or the idle keepalive.
+- (void)setDrawOnDemand:(BOOL)onDemand matchDisplayRefresh:(BOOL)matchRefresh {
+    _drawOnDemand = onDemand;
+    _matchDisplayRefresh = matchRefresh;
+    _metalView.enableSetNeedsDisplay = onDemand;
+    _metalView.paused = onDemand;
+    [self applyFrameRate];
+    MetalLog(@"[Metal Overlay] Drawing %@ at up to %ld fps", onDemand ? @"on demand" : @"continuously",
+             (long)_metalView.preferredFramesPerSecond);
+}
+
+- (void)applyFrameRate {
+    NSInteger fps = 60;
+    if (_matchDisplayRefresh) {
+        if (@available(macOS 12.0, *)) {
+            NSScreen *screen = _window.screen ?: [NSScreen mainScreen];
+            if (screen.maximumFramesPerSecond > 0) {
+                fps = screen.maximumFramesPerSecond;
+            }
+        }
+    }
+    if (_metalView.preferredFramesPerSecond != fps) {
+        _metalView.preferredFramesPerSecond = fps;
+    }
 }
 
-- (void)renderFrame:(const void *)buffer width:(int)w height:(int)h {
+// Upload a full frame. Returns NO if the frame is identical to the previous one
+// and the upload was skipped; forcePresent still requests a redraw in that case.
+- (BOOL)renderFrame:(const void *)buffer width:(int)w height:(int)h forcePresent:(BOOL)forcePresent {
     // Safety check - don't render if destroyed
     if (_isDestroyed || !_device || !_metalView) {
-        return;
+        return NO;
+    }
+    
+    frame_timing::Clock::time_point submitStart = frame_timing::Clock::now();
+    uint64_t hash = frame_hash::hashFrame((const uint8_t *)buffer, (size_t)w * (size_t)h * 4);
+    if (_lastFrameHashValid && hash == _lastFrameHash && _texture &&
+            _texture.width == (NSUInteger)w && _texture.height == (NSUInteger)h) {
+        _skippedFrames++;
+        BOOL idlePresentDue = _drawOnDemand && CACurrentMediaTime() - _lastDrawTime >= kIdlePresentInterval;
+        if (forcePresent || idlePresentDue) {
+            [_metalView setNeedsDisplay:YES];
+        }
+        return NO;
+    }
+    
+    if (![self uploadFrame:buffer width:w height:h]) {
+        _lastFrameHashValid = NO;
+        _textureIncomplete = YES;
+        return NO;
+    }
+    _lastFrameHash = hash;
+    _lastFrameHashValid = YES;
+    _textureIncomplete = NO;
+    _timings.record(frame_timing::kStageSubmit, frame_timing::elapsedMs(submitStart));
+    return YES;
+}
+
+- (void)setCompressedTextures:(BOOL)enabled {
+    BOOL supported = YES;  // every Mac GPU before Apple silicon samples BC formats
+    if (@available(macOS 11.0, *)) {
+        supported = _device.supportsBCTextureCompression;
+    }
+    if (enabled && !supported) {
+        MetalLog(@"[Metal Overlay] BC texture compression not supported, uploading BGRA");
+    }
+    _useCompressedTextures = enabled && supported;
+}
+
+- (BOOL)uploadFrame:(const void *)buffer width:(int)w height:(int)h {
+    [self ensureTextureWidth:w height:h compressed:_useCompressedTextures];
+    if (_useCompressedTextures) {
+        return [self uploadCompressedFrame:(const uint8_t *)buffer width:w height:h];
+    }
+    MTLRegion region = MTLRegionMake2D(0, 0, w, h);
+    return [self uploadRegions:&region count:1 fromFrame:(const uint8_t *)buffer width:w];
+}
+
+// Next free staging buffer of at least total bytes. When all of them are in
+// flight, waits (briefly) for the oldest blit. Returns nil — a dropped frame —
+// if none freed up in time; otherwise finishUpload: must follow.
+- (id<MTLBuffer>)acquireStagingBuffer:(size_t)total {
+    if (dispatch_semaphore_wait(_stagingSemaphore, DISPATCH_TIME_NOW) != 0) {
+        _lateFrames++;
+        if (dispatch_semaphore_wait(_stagingSemaphore, dispatch_time(DISPATCH_TIME_NOW, kStagingWaitNs)) != 0) {
+            _droppedFrames++;
+            return nil;
+        }
+    }
+    
+    // Buffers complete in submission order, so the next one in the ring is the free one
+    id<MTLBuffer> staging = _stagingBuffers[_stagingIndex];
+    if (!staging || staging.length < total) {
+        staging = [_device newBufferWithLength:total
+                                       options:MTLResourceStorageModeShared | MTLResourceCPUCacheModeWriteCombined];
+        if (!staging) {
+            MetalLogError(@"[Metal Overlay] Failed to allocate %zu byte staging buffer", total);
+            dispatch_semaphore_signal(_stagingSemaphore);
+            _droppedFrames++;
+            return nil;
+        }
+        _stagingBuffers[_stagingIndex] = staging;
+    }
+    _stagingIndex = (_stagingIndex + 1) % kStagingBufferCount;
+    return staging;
+}
+
+// Commit the blits from a staging buffer, release the buffer once they have
+// completed, and record the upload
+- (void)finishUpload:(id<MTLCommandBuffer>)commandBuffer bytes:(size_t)total start:(CFTimeInterval)start {
+    static int frameCount = 0;
+    frameCount++;
+    
+    dispatch_semaphore_t semaphore = _stagingSemaphore;
+    [commandBuffer addCompletedHandler:^(id<MTLCommandBuffer> completed) {
+        dispatch_semaphore_signal(semaphore);
+    }];
+    [commandBuffer commit];
+    
+    double elapsedMs = (CACurrentMediaTime() - start) * 1000.0;
+    _uploadedFrames++;
+    _lastUploadMs = elapsedMs;
+    _totalUploadMs += elapsedMs;
+    _lastUploadBytes = total;
+    _timings.record(frame_timing::kStageUpload, elapsedMs);
+    _uploadsSinceDraw++;
+    
+    if (frameCount == 1) {
+        MetalLog(@"[Metal Overlay] First frame uploaded to texture!");
     }
     
+    // Trigger redraw
+    [_metalView setNeedsDisplay:YES];
+}
+
+// Copy regions of a w-wide BGRA frame into the next staging buffer, packed, and
+// blit them into the texture on the GPU. The CPU never writes memory a command
+// buffer may still be reading: the texture is only written by the blit, which
+// the command queue orders after earlier draws that sample it and before later
+// ones, and a staging buffer is only refilled once its blit has completed.
+// Returns NO (a dropped frame) if no staging buffer freed up in time.
+- (BOOL)uploadRegions:(const MTLRegion *)regions count:(NSUInteger)count fromFrame:(const uint8_t *)bytes width:(int)w {
     @autoreleasepool {
-        static int frameCount = 0;
-        frameCount++;
-        
-        // Create or recreate texture if size changed
-        if (!_texture || _texture.width != w || _texture.height != h) {
-            MTLTextureDescriptor *textureDescriptor = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatBGRA8Unorm
-                                                                                                          width:w
-                                                                                                         height:h
-                                                                                                      mipmapped:NO];
-            textureDescriptor.usage = MTLTextureUsageShaderRead;
-            _texture = [_device newTextureWithDescriptor:textureDescriptor];
-            MetalLog(@"[Metal Overlay] Created texture: %dx%d", w, h);
+        CFTimeInterval start = CACurrentMediaTime();
+        
+        size_t total = 0;
+        for (NSUInteger i = 0; i < count; i++) {
+            total += regions[i].size.width * regions[i].size.height * 4;
+        }
+        
+        id<MTLBuffer> staging = [self acquireStagingBuffer:total];
+        if (!staging) {
+            return NO;
+        }
+        
+        id<MTLCommandBuffer> commandBuffer = [_commandQueue commandBuffer];
+        id<MTLBlitCommandEncoder> blit = [commandBuffer blitCommandEncoder];
+        uint8_t *packed = (uint8_t *)staging.contents;
+        size_t offset = 0;
+        size_t frameBytesPerRow = (size_t)w * 4;
+        for (NSUInteger i = 0; i < count; i++) {
+            MTLRegion region = regions[i];
+            size_t rowBytes = region.size.width * 4;
+            const uint8_t *origin = bytes + region.origin.y * frameBytesPerRow + region.origin.x * 4;
+            for (NSUInteger row = 0; row < region.size.height; row++) {
+                memcpy(packed + offset + row * rowBytes, origin + row * frameBytesPerRow, rowBytes);
+            }
+            [blit copyFromBuffer:staging
+                    sourceOffset:offset
+               sourceBytesPerRow:rowBytes
+             sourceBytesPerImage:rowBytes * region.size.height
+                      sourceSize:region.size
+                       toTexture:_texture
+                destinationSlice:0
+                destinationLevel:0
+               destinationOrigin:region.origin];
+            offset += rowBytes * region.size.height;
         }
+        [blit endEncoding];
         
-        // Upload pixel data to texture
-        MTLRegion region = MTLRegionMake2D(0, 0, w, h);
-        [_texture replaceRegion:region mipmapLevel:0 withBytes:buffer bytesPerRow:w * 4];
+        [self finishUpload:commandBuffer bytes:total start:start];
+    }
+    return YES;
+}
+
+// Encode the tiles of a full BGRA frame that changed since the last upload
+// straight into the next staging buffer as BC3 blocks, and blit them into the
+// (BC3) texture. Same staging ring and ordering as uploadRegions:.
+- (BOOL)uploadCompressedFrame:(const uint8_t *)bytes width:(int)w height:(int)h {
+    @autoreleasepool {
+        CFTimeInterval start = CACurrentMediaTime();
+        
+        _tileTracker.collectChanged(bytes, w, h, _changedTiles);
+        size_t total = 0;
+        for (const FrameRect &tile : _changedTiles) {
+            total += bc3::compressedSize(tile.width, tile.height);
+        }
+        if (total == 0) {
+            return YES;
+        }
+        
+        id<MTLBuffer> staging = [self acquireStagingBuffer:total];
+        if (!staging) {
+            // The tracker already took these tiles' new hashes — send everything next time
+            _tileTracker.reset();
+            return NO;
+        }
+        
+        id<MTLCommandBuffer> commandBuffer = [_commandQueue commandBuffer];
+        id<MTLBlitCommandEncoder> blit = [commandBuffer blitCommandEncoder];
+        uint8_t *encoded = (uint8_t *)staging.contents;
+        size_t offset = 0;
+        for (const FrameRect &tile : _changedTiles) {
+            size_t rowBytes = (size_t)((tile.width + 3) / 4) * bc3::kBlockBytes;
+            size_t tileBytes = bc3::encodeRect(bytes, w, h, (size_t)w * 4, tile.x, tile.y,
+                                               tile.width, tile.height, encoded + offset);
+            [blit copyFromBuffer:staging
+                    sourceOffset:offset
+               sourceBytesPerRow:rowBytes
+             sourceBytesPerImage:tileBytes
+                      sourceSize:MTLSizeMake(tile.width, tile.height, 1)
+                       toTexture:_texture
+                destinationSlice:0
+                destinationLevel:0
+               destinationOrigin:MTLOriginMake(tile.x, tile.y, 0)];
+            offset += tileBytes;
+        }
+        [blit endEncoding];
         
-        if (frameCount == 1) {
-            MetalLog(@"[Metal Overlay] First frame uploaded to texture!");
+        [self finishUpload:commandBuffer bytes:total start:start];
+    }
+    return YES;
+}
+
+// Create or recreate the texture if the size or format changed — BC3 for
+// compressed uploads, BGRA8 otherwise
+- (void)ensureTextureWidth:(int)w height:(int)h compressed:(BOOL)compressed {
+    MTLPixelFormat format = compressed ? MTLPixelFormatBC3_RGBA : MTLPixelFormatBGRA8Unorm;
+    if (!_texture || _texture.width != w || _texture.height != h || _texture.pixelFormat != format) {
+        if (_texture) {
+            _timings.textureRecreations++;
+        }
+        // New storage is undefined; every tile has to be uploaded again
+        _tileTracker.reset();
+        MTLTextureDescriptor *textureDescriptor = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:format
+                                                                                                      width:w
+                                                                                                     height:h
+                                                                                                  mipmapped:NO];
+        textureDescriptor.usage = MTLTextureUsageShaderRead;
+        // Only ever written by blits, so it can live in GPU-only memory
+        textureDescriptor.storageMode = MTLStorageModePrivate;
+        _texture = [_device newTextureWithDescriptor:textureDescriptor];
+        MetalLog(@"[Metal Overlay] Created texture: %dx%d", w, h);
+    }
+}
+
+// Present a frame that lives in an IOSurface (Electron's offscreen renderer with
+// useSharedTexture). The surface is wrapped as a Metal texture and blitted into
+// ours on the GPU, and the blit is waited for so the caller may release the
+// surface straight away — the pixels never pass through system memory.
+// Returns NO if the surface isn't a BGRA surface of at least w x h.
+- (BOOL)importIOSurface:(IOSurfaceRef)surface width:(int)w height:(int)h {
+    if (_isDestroyed || !_device || !_metalView || !_commandQueue) {
+        return NO;
+    }
+    if (IOSurfaceGetPixelFormat(surface) != 'BGRA' ||
+            (int)IOSurfaceGetWidth(surface) < w || (int)IOSurfaceGetHeight(surface) < h) {
+        return NO;
+    }
+    
+    @autoreleasepool {
+        MTLTextureDescriptor *descriptor = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatBGRA8Unorm
+                                                                                               width:IOSurfaceGetWidth(surface)
+                                                                                              height:IOSurfaceGetHeight(surface)
+                                                                                           mipmapped:NO];
+        descriptor.usage = MTLTextureUsageShaderRead;
+        id<MTLTexture> source = [_device newTextureWithDescriptor:descriptor iosurface:surface plane:0];
+        if (!source) {
+            MetalLogError(@"[Metal Overlay] Failed to wrap IOSurface in a Metal texture");
+            return NO;
         }
         
-        // Trigger redraw
+        // Texture-to-texture blits need matching formats, so shared surfaces always land in BGRA8
+        [self ensureTextureWidth:w height:h compressed:NO];
+        
+        id<MTLCommandBuffer> commandBuffer = [_commandQueue commandBuffer];
+        id<MTLBlitCommandEncoder> blit = [commandBuffer blitCommandEncoder];
+        [blit copyFromTexture:source
+                  sourceSlice:0
+                  sourceLevel:0
+                 sourceOrigin:MTLOriginMake(0, 0, 0)
+                   sourceSize:MTLSizeMake(w, h, 1)
+                    toTexture:_texture
+             destinationSlice:0
+             destinationLevel:0
+            destinationOrigin:MTLOriginMake(0, 0, 0)];
+        [blit endEncoding];
+        [commandBuffer commit];
+        [commandBuffer waitUntilCompleted];
+        
+        // The texture now holds content the CPU-side hash never saw, and the next
+        // bitmap's dirty rectangles are relative to the previous bitmap, not to
+        // this surface — make the next CPU frame a full upload
+        _lastFrameHashValid = NO;
+        _textureIncomplete = YES;
+        _uploadsSinceDraw++;
         [_metalView setNeedsDisplay:YES];
     }
+    return YES;
+}
+
+// Upload only the given dirty regions of a full-size BGRA frame; the rest of the
+// texture keeps its previous contents. Falls back to a full upload when the
+// texture has to be (re)created, since new storage is undefined, or when an
+// earlier upload was dropped and the texture is missing content.
+- (void)renderFrameRegions:(const void *)buffer width:(int)w height:(int)h regions:(const MTLRegion *)regions count:(NSUInteger)count {
+    if (_isDestroyed || !_device || !_metalView) {
+        return;
+    }
+    
+    // Only part of the texture changes, so the full-frame hash no longer describes it
+    _lastFrameHashValid = NO;
+    
+    // Compressed uploads find the changed tiles themselves, from the whole frame
+    if (!_texture || _texture.width != w || _texture.height != h || _textureIncomplete ||
+            _useCompressedTextures) {
+        _textureIncomplete = ![self uploadFrame:buffer width:w height:h];
+        return;
+    }
+    
+    if (![self uploadRegions:regions count:count fromFrame:(const uint8_t *)buffer width:w]) {
+        _textureIncomplete = YES;
+    }
 }
 
 - (void)mtkView:(MTKView *)view drawableSizeWillChange:(CGSize)size {
@@ -271,12 +697,18 @@ static BOOL g_debugMode = NO;
         static int drawCount = 0;
         drawCount++;
         
+        // currentDrawable blocks until the layer has a drawable free — the
+        // Metal counterpart of a SwapBuffers wait
+        frame_timing::Clock::time_point frameStart = frame_timing::Clock::now();
         id<CAMetalDrawable> drawable = view.currentDrawable;
         MTLRenderPassDescriptor *renderPassDescriptor = view.currentRenderPassDescriptor;
         
         if (!drawable || !renderPassDescriptor) {
             return;
         }
+        frame_timing::Clock::time_point drawStart = frame_timing::Clock::now();
+        _timings.record(frame_timing::kStageSwap,
+            std::chrono::duration<double, std::milli>(drawStart - frameStart).count());
         
         id<MTLCommandBuffer> commandBuffer = [_commandQueue commandBuffer];
         if (!commandBuffer) {
@@ -294,6 +726,10 @@ static BOOL g_debugMode = NO;
             [renderEncoder setVertexBuffer:_vertexBuffer offset:0 atIndex:0];
             [renderEncoder setFragmentTexture:_texture atIndex:0];
             [renderEncoder setFragmentSamplerState:_samplerState atIndex:0];
+            id<MTLTexture> target = drawable.texture;
+            float sharpness = (_texture.width < target.width || _texture.height < target.height)
+                ? _upscaleSharpness : 0.0f;
+            [renderEncoder setFragmentBytes:&sharpness length:sizeof(sharpness) atIndex:0];
             [renderEncoder drawPrimitives:MTLPrimitiveTypeTriangleStrip vertexStart:0 vertexCount:4];
             
             if (drawCount == 1) {
@@ -306,8 +742,31 @@ static BOOL g_debugMode = NO;
         }
         
         [renderEncoder endEncoding];
+        
+        // Present timing for the JS capture loop. The refresh interval comes from
+        // the screen on macOS 12+ and is estimated from the presents otherwise.
+        if (@available(macOS 10.15.4, *)) {
+            double refreshMs = 0.0;
+            if (@available(macOS 12.0, *)) {
+                NSInteger maxFps = (_window.screen ?: [NSScreen mainScreen]).maximumFramesPerSecond;
+                if (maxFps > 0) refreshMs = 1000.0 / (double)maxFps;
+            }
+            __weak MetalWindowWrapper *weakSelf = self;
+            [drawable addPresentedHandler:^(id<MTLDrawable> presented) {
+                [weakSelf recordPresentedTime:presented.presentedTime refreshMs:refreshMs];
+            }];
+        }
         [commandBuffer presentDrawable:drawable];
         [commandBuffer commit];
+        _lastDrawTime = CACurrentMediaTime();
+        _timings.record(frame_timing::kStageDraw, frame_timing::elapsedMs(drawStart));
+        _timings.record(frame_timing::kStageFrame, frame_timing::elapsedMs(frameStart));
+        
+        // Only the newest of several uploads since the last draw reached the screen
+        if (_uploadsSinceDraw > 1) {
+            _droppedFrames += _uploadsSinceDraw - 1;
+        }
+        _uploadsSinceDraw = 0;
     }
 }
 
@@ -336,11 +795,15 @@ static BOOL g_debugMode = NO;
     _window = nil;
     _metalView = nil;
     _texture = nil;
+    for (int i = 0; i < kStagingBufferCount; i++) {
+        _stagingBuffers[i] = nil;
+    }
     _pipelineState = nil;
     _vertexBuffer = nil;
     _samplerState = nil;
     _commandQueue = nil;
     _device = nil;
+    _sharedDevice = nil;
     _electronWindow = nil;
     
     MetalLog(@"[Metal Overlay] Metal window destroyed");
@@ -350,7 +813,24 @@ static BOOL g_debugMode = NO;
 
 // N-API wrapper functions
 
-static napi_value CreateOverlayWindow(napi_env env, napi_callback_info info) {
+// Options shared by createOverlayWindow and createOverlayWindowAsync, and the
+// shared Metal device the window is created with
+struct OverlayWindowRequest {
+    int width = 1280;
+    int height = 720;
+    char title[256] = "Electron Steam App";
+    bool drawOnDemand = false;
+    bool matchDisplayRefresh = false;
+    bool hasUpscaleSharpness = false;
+    double upscaleSharpness = 0.5;
+    bool compressedTextures = false;
+    MetalOverlayDevice *device = nil;
+    napi_deferred deferred = nullptr;
+    napi_async_work work = nullptr;
+};
+
+// Read the options object into request. Throws and returns false on bad arguments.
+static bool ReadOverlayWindowOptions(napi_env env, napi_callback_info info, OverlayWindowRequest *request) {
     napi_status status;
     size_t argc = 1;
     napi_value args[1];
@@ -358,37 +838,74 @@ static napi_value CreateOverlayWindow(napi_env env, napi_callback_info info) {
     
     if (status != napi_ok || argc < 1) {
         napi_throw_error(env, nullptr, "Expected options object");
-        return nullptr;
+        return false;
     }
     
     // Parse options
     napi_value widthVal, heightVal, titleVal;
-    int width = 1280, height = 720;
-    char title[256] = "Electron Steam App";
     
     napi_get_named_property(env, args[0], "width", &widthVal);
     napi_get_named_property(env, args[0], "height", &heightVal);
     napi_get_named_property(env, args[0], "title", &titleVal);
     
-    napi_get_value_int32(env, widthVal, &width);
-    napi_get_value_int32(env, heightVal, &height);
+    napi_get_value_int32(env, widthVal, &request->width);
+    napi_get_value_int32(env, heightVal, &request->height);
     
     size_t titleLen;
-    napi_get_value_string_utf8(env, titleVal, title, sizeof(title), &titleLen);
+    napi_get_value_string_utf8(env, titleVal, request->title, sizeof(request->title), &titleLen);
+    
+    // Optional: drawOnDemand / matchDisplayRefresh (both default false)
+    bool hasOption = false;
+    napi_value optionVal;
+    if (napi_has_named_property(env, args[0], "drawOnDemand", &hasOption) == napi_ok && hasOption) {
+        napi_get_named_property(env, args[0], "drawOnDemand", &optionVal);
+        napi_get_value_bool(env, optionVal, &request->drawOnDemand);
+    }
+    if (napi_has_named_property(env, args[0], "matchDisplayRefresh", &hasOption) == napi_ok && hasOption) {
+        napi_get_named_property(env, args[0], "matchDisplayRefresh", &optionVal);
+        napi_get_value_bool(env, optionVal, &request->matchDisplayRefresh);
+    }
     
-    // Create Metal window
-    MetalWindowWrapper *wrapper = [[MetalWindowWrapper alloc] initWithWidth:width
-                                                                      height:height
-                                                                       title:[NSString stringWithUTF8String:title]];
+    // Optional: upscaleSharpness (0-1) for frames smaller than the view
+    if (napi_has_named_property(env, args[0], "upscaleSharpness", &hasOption) == napi_ok && hasOption) {
+        napi_get_named_property(env, args[0], "upscaleSharpness", &optionVal);
+        request->hasUpscaleSharpness = napi_get_value_double(env, optionVal, &request->upscaleSharpness) == napi_ok;
+    }
+    
+    // Optional: compressedTextures=true uploads changed tiles as BC3
+    if (napi_has_named_property(env, args[0], "compressedTextures", &hasOption) == napi_ok && hasOption) {
+        napi_get_named_property(env, args[0], "compressedTextures", &optionVal);
+        napi_get_value_bool(env, optionVal, &request->compressedTextures);
+    }
+    return true;
+}
+
+// Create the Metal window on the main thread (AppKit requires it) and wrap it
+// for JS. Returns null if the window or the external couldn't be created.
+static napi_value WrapOverlayWindow(napi_env env, OverlayWindowRequest *request) {
+    MetalWindowWrapper *wrapper = [[MetalWindowWrapper alloc] initWithWidth:request->width
+                                                                      height:request->height
+                                                                       title:[NSString stringWithUTF8String:request->title]
+                                                                      device:request->device];
     
     if (!wrapper) {
-        napi_throw_error(env, nullptr, "Failed to create Metal window");
         return nullptr;
     }
     
+    if (request->drawOnDemand || request->matchDisplayRefresh) {
+        [wrapper setDrawOnDemand:request->drawOnDemand matchDisplayRefresh:request->matchDisplayRefresh];
+    }
+    if (request->hasUpscaleSharpness) {
+        double sharpness = request->upscaleSharpness;
+        wrapper.upscaleSharpness = (float)(sharpness < 0.0 ? 0.0 : sharpness > 1.0 ? 1.0 : sharpness);
+    }
+    if (request->compressedTextures) {
+        [wrapper setCompressedTextures:YES];
+    }
+    
     // Wrap pointer in external with destructor callback for proper cleanup
     napi_value external;
-    status = napi_create_external(env, (__bridge_retained void *)wrapper, 
+    napi_status status = napi_create_external(env, (__bridge_retained void *)wrapper, 
         // Destructor callback - called when JS garbage collects the external
         [](napi_env env, void* data, void* hint) {
             if (data) {
@@ -402,13 +919,71 @@ static napi_value CreateOverlayWindow(napi_env env, napi_callback_info info) {
         nullptr, &external);
     
     if (status != napi_ok) {
-        napi_throw_error(env, nullptr, "Failed to create external");
+        MetalWindowWrapper *w = (__bridge_transfer MetalWindowWrapper *)(__bridge void *)wrapper;
+        [w destroy];
         return nullptr;
     }
     
     return external;
 }
 
+static napi_value CreateOverlayWindow(napi_env env, napi_callback_info info) {
+    OverlayWindowRequest request;
+    if (!ReadOverlayWindowOptions(env, info, &request)) {
+        return nullptr;
+    }
+    
+    request.device = [MetalOverlayDevice sharedDeviceForPixelFormat:MTLPixelFormatBGRA8Unorm];
+    napi_value external = WrapOverlayWindow(env, &request);
+    if (!external) {
+        napi_throw_error(env, nullptr, "Failed to create Metal window");
+        return nullptr;
+    }
+    
+    return external;
+}
+
+// createOverlayWindowAsync: the Metal device, command queue and pipeline are
+// set up on a libuv worker — on the first window that includes loading the
+// shader library — and only the AppKit window is created on the main thread.
+static void CreateOverlayWindowExecute(napi_env env, void *data) {
+    OverlayWindowRequest *request = (OverlayWindowRequest *)data;
+    @autoreleasepool {
+        request->device = [MetalOverlayDevice sharedDeviceForPixelFormat:MTLPixelFormatBGRA8Unorm];
+    }
+}
+
+static void CreateOverlayWindowComplete(napi_env env, napi_status status, void *data) {
+    OverlayWindowRequest *request = (OverlayWindowRequest *)data;
+    napi_value external = status == napi_ok ? WrapOverlayWindow(env, request) : nullptr;
+    if (external) {
+        napi_resolve_deferred(env, request->deferred, external);
+    } else {
+        napi_value message, error;
+        napi_create_string_utf8(env, "Failed to create Metal window", NAPI_AUTO_LENGTH, &message);
+        napi_create_error(env, nullptr, message, &error);
+        napi_reject_deferred(env, request->deferred, error);
+    }
+    napi_delete_async_work(env, request->work);
+    delete request;
+}
+
+static napi_value CreateOverlayWindowAsync(napi_env env, napi_callback_info info) {
+    OverlayWindowRequest *request = new OverlayWindowRequest();
+    if (!ReadOverlayWindowOptions(env, info, request)) {
+        delete request;
+        return nullptr;
+    }
+    
+    napi_value promise, resourceName;
+    napi_create_promise(env, &request->deferred, &promise);
+    napi_create_string_utf8(env, "createOverlayWindowAsync", NAPI_AUTO_LENGTH, &resourceName);
+    napi_create_async_work(env, nullptr, resourceName, CreateOverlayWindowExecute,
+                           CreateOverlayWindowComplete, request, &request->work);
+    napi_queue_async_work(env, request->work);
+    return promise;
+}
+
 static napi_value ShowOverlayWindow(napi_env env, napi_callback_info info) {
     napi_status status;
     size_t argc = 1;
@@ -529,8 +1104,8 @@ static napi_value SetOverlayFrame(napi_env env, napi_callback_info info) {
 
 static napi_value RenderFrame(napi_env env, napi_callback_info info) {
     napi_status status;
-    size_t argc = 4;
-    napi_value args[4];
+    size_t argc = 5;
+    napi_value args[5];
     status = napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
     
     if (status != napi_ok || argc < 4) {
@@ -554,8 +1129,97 @@ static napi_value RenderFrame(napi_env env, napi_callback_info info) {
     napi_get_value_int32(env, args[2], &width);
     napi_get_value_int32(env, args[3], &height);
     
+    if (width <= 0 || height <= 0 || bufferLength < (size_t)width * height * 4) {
+        napi_throw_error(env, nullptr, "Buffer is smaller than width * height * 4");
+        return nullptr;
+    }
+    
+    // Optional 5th argument: present even if the frame is unchanged
+    bool forcePresent = false;
+    if (argc >= 5) {
+        napi_get_value_bool(env, args[4], &forcePresent);
+    }
+    
+    MetalWindowWrapper *wrapper = (__bridge MetalWindowWrapper *)data;
+    BOOL rendered = [wrapper renderFrame:buffer width:width height:height forcePresent:forcePresent ? YES : NO];
+    
+    // false = frame matched the previous one and was skipped
+    napi_value result;
+    napi_get_boolean(env, rendered, &result);
+    return result;
+}
+
+// Read an array of { x, y, width, height } objects into Metal regions, clipped to
+// a w x h frame. Empty rectangles are dropped. Returns false if value isn't an array.
+static bool ReadFrameRegions(napi_env env, napi_value value, int w, int h, std::vector<MTLRegion> &regions) {
+    bool isArray = false;
+    if (napi_is_array(env, value, &isArray) != napi_ok || !isArray) return false;
+    
+    uint32_t count = 0;
+    napi_get_array_length(env, value, &count);
+    regions.reserve(count);
+    
+    for (uint32_t i = 0; i < count; i++) {
+        napi_value item, field;
+        napi_get_element(env, value, i, &item);
+        
+        int x = 0, y = 0, rw = 0, rh = 0;
+        napi_get_named_property(env, item, "x", &field);      napi_get_value_int32(env, field, &x);
+        napi_get_named_property(env, item, "y", &field);      napi_get_value_int32(env, field, &y);
+        napi_get_named_property(env, item, "width", &field);  napi_get_value_int32(env, field, &rw);
+        napi_get_named_property(env, item, "height", &field); napi_get_value_int32(env, field, &rh);
+        
+        int x0 = x < 0 ? 0 : x;
+        int y0 = y < 0 ? 0 : y;
+        int x1 = x + rw > w ? w : x + rw;
+        int y1 = y + rh > h ? h : y + rh;
+        if (x1 > x0 && y1 > y0) {
+            regions.push_back(MTLRegionMake2D(x0, y0, x1 - x0, y1 - y0));
+        }
+    }
+    return true;
+}
+
+static napi_value RenderFrameRegions(napi_env env, napi_callback_info info) {
+    napi_status status;
+    size_t argc = 5;
+    napi_value args[5];
+    status = napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    if (status != napi_ok || argc < 5) {
+        napi_throw_error(env, nullptr, "Expected window handle, buffer, width, height, rects");
+        return nullptr;
+    }
+    
+    void *data;
+    status = napi_get_value_external(env, args[0], &data);
+    
+    if (status != napi_ok || !data) {
+        napi_throw_error(env, nullptr, "Invalid window handle");
+        return nullptr;
+    }
+    
+    void *buffer;
+    size_t bufferLength;
+    napi_get_buffer_info(env, args[1], &buffer, &bufferLength);
+    
+    int width, height;
+    napi_get_value_int32(env, args[2], &width);
+    napi_get_value_int32(env, args[3], &height);
+    
+    if (width <= 0 || height <= 0 || bufferLength < (size_t)width * height * 4) {
+        napi_throw_error(env, nullptr, "Buffer is smaller than width * height * 4");
+        return nullptr;
+    }
+    
+    std::vector<MTLRegion> regions;
+    if (!ReadFrameRegions(env, args[4], width, height, regions)) {
+        napi_throw_error(env, nullptr, "Expected an array of { x, y, width, height } rects");
+        return nullptr;
+    }
+    
     MetalWindowWrapper *wrapper = (__bridge MetalWindowWrapper *)data;
-    [wrapper renderFrame:buffer width:width height:height];
+    [wrapper renderFrameRegions:buffer width:width height:height regions:regions.data() count:regions.size()];
     
     napi_value result;
     napi_get_undefined(env, &result);
@@ -589,6 +1253,195 @@ static napi_value DestroyOverlayWindow(napi_env env, napi_callback_info info) {
     return result;
 }
 
+// Add stages: { submit, upload, draw, swap, frame } (each { count, last, average,
+// p50, p95, p99 } in ms), textureRecreations and swapWaitMs (total time in swaps)
+static void SetTimingStats(napi_env env, napi_value result, const frame_timing::FrameTimings& timings) {
+    napi_value stages, stage, value;
+    napi_create_object(env, &stages);
+    double swapWaitMs = 0.0;
+    for (int i = 0; i < frame_timing::kStageCount; i++) {
+        frame_timing::StageSummary summary = timings.stages[i].summary();
+        if (i == frame_timing::kStageSwap) swapWaitMs = summary.total;
+        
+        napi_create_object(env, &stage);
+        napi_create_double(env, (double)summary.count, &value);
+        napi_set_named_property(env, stage, "count", value);
+        napi_create_double(env, summary.last, &value);
+        napi_set_named_property(env, stage, "last", value);
+        napi_create_double(env, summary.average, &value);
+        napi_set_named_property(env, stage, "average", value);
+        napi_create_double(env, summary.p50, &value);
+        napi_set_named_property(env, stage, "p50", value);
+        napi_create_double(env, summary.p95, &value);
+        napi_set_named_property(env, stage, "p95", value);
+        napi_create_double(env, summary.p99, &value);
+        napi_set_named_property(env, stage, "p99", value);
+        napi_set_named_property(env, stages, frame_timing::kStageNames[i], stage);
+    }
+    napi_set_named_property(env, result, "stages", stages);
+    
+    napi_create_double(env, (double)timings.textureRecreations, &value);
+    napi_set_named_property(env, result, "textureRecreations", value);
+    
+    napi_create_double(env, swapWaitMs, &value);
+    napi_set_named_property(env, result, "swapWaitMs", value);
+}
+
+// Add presentTiming: { source, refreshIntervalMs, msSinceVblank, msUntilVblank,
+// presentedFrames }, the vblank timing as of this call
+static void SetPresentTiming(napi_env env, napi_value result, const present_timing::PresentClock& clock) {
+    present_timing::Snapshot snapshot = clock.snapshot(frame_timing::Clock::now());
+    napi_value timing, value;
+    napi_create_object(env, &timing);
+    napi_create_string_utf8(env, present_timing::kSourceNames[snapshot.source], NAPI_AUTO_LENGTH, &value);
+    napi_set_named_property(env, timing, "source", value);
+    napi_create_double(env, snapshot.refreshMs, &value);
+    napi_set_named_property(env, timing, "refreshIntervalMs", value);
+    napi_create_double(env, snapshot.sinceVblankMs, &value);
+    napi_set_named_property(env, timing, "msSinceVblank", value);
+    napi_create_double(env, snapshot.untilVblankMs, &value);
+    napi_set_named_property(env, timing, "msUntilVblank", value);
+    napi_create_double(env, (double)snapshot.presents, &value);
+    napi_set_named_property(env, timing, "presentedFrames", value);
+    napi_set_named_property(env, result, "presentTiming", timing);
+}
+
+// getOverlayStats(handle) — upload and drop statistics for the window, plus
+// per-stage timing histograms
+static napi_value GetOverlayStats(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    void *data = nullptr;
+    if (argc < 1 || napi_get_value_external(env, args[0], &data) != napi_ok || !data) {
+        napi_value result;
+        napi_get_null(env, &result);
+        return result;
+    }
+    MetalWindowWrapper *wrapper = (__bridge MetalWindowWrapper *)data;
+    
+    napi_value result, value;
+    napi_create_object(env, &result);
+    
+    napi_create_string_utf8(env, wrapper.useCompressedTextures ? "bc3" : "blit", NAPI_AUTO_LENGTH, &value);
+    napi_set_named_property(env, result, "uploadPath", value);
+    
+    napi_create_double(env, (double)wrapper.uploadedFrames, &value);
+    napi_set_named_property(env, result, "uploadedFrames", value);
+    
+    napi_create_double(env, wrapper.lastUploadMs, &value);
+    napi_set_named_property(env, result, "lastUploadMs", value);
+    
+    napi_create_double(env, (double)wrapper.lastUploadBytes, &value);
+    napi_set_named_property(env, result, "lastUploadBytes", value);
+    
+    napi_create_double(env, (double)wrapper.skippedFrames, &value);
+    napi_set_named_property(env, result, "skippedFrames", value);
+    
+    napi_create_double(env, (double)wrapper.droppedFrames, &value);
+    napi_set_named_property(env, result, "droppedFrames", value);
+    
+    napi_create_double(env, (double)wrapper.lateFrames, &value);
+    napi_set_named_property(env, result, "lateFrames", value);
+    
+    napi_get_boolean(env, false, &value);
+    napi_set_named_property(env, result, "renderThread", value);
+    
+    napi_create_string_utf8(env, "shader", NAPI_AUTO_LENGTH, &value);
+    napi_set_named_property(env, result, "renderer", value);
+    
+    double avg = wrapper.uploadedFrames ? wrapper.totalUploadMs / (double)wrapper.uploadedFrames : 0.0;
+    napi_create_double(env, avg, &value);
+    napi_set_named_property(env, result, "averageUploadMs", value);
+    
+    SetTimingStats(env, result, *[wrapper timings]);
+    SetPresentTiming(env, result, *[wrapper presentClock]);
+    
+    return result;
+}
+
+// importSharedTexture(handle, { handle: Buffer }, width, height) — present a BGRA
+// IOSurface given its IOSurfaceRef (Electron's textureInfo.handle.ioSurface).
+// Returns false if it couldn't be imported; the texture may be released either way.
+static napi_value ImportSharedTexture(napi_env env, napi_callback_info info) {
+    napi_status status;
+    size_t argc = 4;
+    napi_value args[4];
+    status = napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    if (status != napi_ok || argc < 4) {
+        napi_throw_error(env, nullptr, "Expected window handle, texture descriptor, width, height");
+        return nullptr;
+    }
+    
+    void *data;
+    status = napi_get_value_external(env, args[0], &data);
+    
+    if (status != napi_ok || !data) {
+        napi_throw_error(env, nullptr, "Invalid window handle");
+        return nullptr;
+    }
+    
+    IOSurfaceRef surface = nullptr;
+    napi_value handleVal;
+    void *handleData = nullptr;
+    size_t handleLength = 0;
+    if (napi_get_named_property(env, args[1], "handle", &handleVal) == napi_ok &&
+        napi_get_buffer_info(env, handleVal, &handleData, &handleLength) == napi_ok &&
+        handleLength >= sizeof(IOSurfaceRef)) {
+        memcpy(&surface, handleData, sizeof(IOSurfaceRef));
+    }
+    
+    int width = 0, height = 0;
+    napi_get_value_int32(env, args[2], &width);
+    napi_get_value_int32(env, args[3], &height);
+    
+    BOOL rendered = NO;
+    if (surface && width > 0 && height > 0) {
+        MetalWindowWrapper *wrapper = (__bridge MetalWindowWrapper *)data;
+        rendered = [wrapper importIOSurface:surface width:width height:height];
+    }
+    
+    napi_value result;
+    napi_get_boolean(env, rendered, &result);
+    return result;
+}
+
+// createSharedFrameBuffer(width, height) — { buffer: ArrayBuffer, shared: boolean }.
+// A persistent page-aligned frame buffer to write frames into and pass (as a
+// Buffer view) to renderFrame/renderFrameRegions, instead of a new Buffer per frame.
+static napi_value CreateSharedFrameBuffer(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int width = 0, height = 0;
+    if (argc >= 2) {
+        napi_get_value_int32(env, args[0], &width);
+        napi_get_value_int32(env, args[1], &height);
+    }
+    if (width <= 0 || height <= 0) {
+        napi_throw_error(env, nullptr, "Expected positive width and height");
+        return nullptr;
+    }
+    
+    bool shared = false;
+    napi_value buffer = shared_frame::createArrayBuffer(env, (size_t)width * (size_t)height * 4, &shared);
+    if (!buffer) {
+        napi_throw_error(env, nullptr, "Failed to allocate frame buffer");
+        return nullptr;
+    }
+    MetalLog(@"[Metal Overlay] Frame buffer %dx%d: %s", width, height, shared ? "shared memory" : "ArrayBuffer (external buffers not allowed)");
+    
+    napi_value result, value;
+    napi_create_object(env, &result);
+    napi_set_named_property(env, result, "buffer", buffer);
+    napi_get_boolean(env, shared, &value);
+    napi_set_named_property(env, result, "shared", value);
+    return result;
+}
+
 // Set debug mode for logging
 static napi_value SetDebugMode(napi_env env, napi_callback_info info) {
     napi_status status;
@@ -631,6 +1484,11 @@ static napi_value Init(napi_env env, napi_value exports) {
     status = napi_set_named_property(env, exports, "createOverlayWindow", fn);
     if (status != napi_ok) return nullptr;
     
+    status = napi_create_function(env, nullptr, 0, CreateOverlayWindowAsync, nullptr, &fn);
+    if (status != napi_ok) return nullptr;
+    status = napi_set_named_property(env, exports, "createOverlayWindowAsync", fn);
+    if (status != napi_ok) return nullptr;
+    
     status = napi_create_function(env, nullptr, 0, ShowOverlayWindow, nullptr, &fn);
     if (status != napi_ok) return nullptr;
     status = napi_set_named_property(env, exports, "showOverlayWindow", fn);
@@ -656,11 +1514,31 @@ static napi_value Init(napi_env env, napi_value exports) {
     status = napi_set_named_property(env, exports, "renderFrame", fn);
     if (status != napi_ok) return nullptr;
     
+    status = napi_create_function(env, nullptr, 0, RenderFrameRegions, nullptr, &fn);
+    if (status != napi_ok) return nullptr;
+    status = napi_set_named_property(env, exports, "renderFrameRegions", fn);
+    if (status != napi_ok) return nullptr;
+    
     status = napi_create_function(env, nullptr, 0, DestroyOverlayWindow, nullptr, &fn);
     if (status != napi_ok) return nullptr;
     status = napi_set_named_property(env, exports, "destroyOverlayWindow", fn);
     if (status != napi_ok) return nullptr;
     
+    status = napi_create_function(env, nullptr, 0, CreateSharedFrameBuffer, nullptr, &fn);
+    if (status != napi_ok) return nullptr;
+    status = napi_set_named_property(env, exports, "createSharedFrameBuffer", fn);
+    if (status != napi_ok) return nullptr;
+    
+    status = napi_create_function(env, nullptr, 0, GetOverlayStats, nullptr, &fn);
+    if (status != napi_ok) return nullptr;
+    status = napi_set_named_property(env, exports, "getOverlayStats", fn);
+    if (status != napi_ok) return nullptr;
+    
+    status = napi_create_function(env, nullptr, 0, ImportSharedTexture, nullptr, &fn);
+    if (status != napi_ok) return nullptr;
+    status = napi_set_named_property(env, exports, "importSharedTexture", fn);
+    if (status != napi_ok) return nullptr;
+    
     return exports;
 }
 
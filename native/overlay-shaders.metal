@@ -0,0 +1,48 @@
+// Metal shaders of the macOS overlay: a fullscreen textured quad, and an
+// optional sharpening pass for frames captured below the view's resolution.
+// Compiled into a .metallib and embedded into the addon at build time
+// (embed-metal-shaders.js); compiled from this source at runtime when the
+// Metal toolchain wasn't available to the build.
+
+#include <metal_stdlib>
+using namespace metal;
+
+struct VertexIn {
+    float2 position;
+    float2 texCoord;
+};
+
+struct VertexOut {
+    float4 position [[position]];
+    float2 texCoord;
+};
+
+vertex VertexOut vertexShader(device VertexIn* vertices [[buffer(0)]],
+                               uint vid [[vertex_id]]) {
+    VertexOut out;
+    out.position = float4(vertices[vid].position, 0.0, 1.0);
+    out.texCoord = vertices[vid].texCoord;
+    return out;
+}
+
+// sharpness > 0 when a reduced-resolution frame is stretched over the view:
+// unsharp mask over the four neighbouring source texels, clamped to their
+// min/max so edges get crisper without ringing halos
+fragment float4 fragmentShader(VertexOut in [[stage_in]],
+                               texture2d<float> texture [[texture(0)]],
+                               sampler textureSampler [[sampler(0)]],
+                               constant float &sharpness [[buffer(0)]]) {
+    float4 center = texture.sample(textureSampler, in.texCoord);
+    if (sharpness <= 0.0) {
+        return center;
+    }
+    float2 texel = float2(1.0 / texture.get_width(), 1.0 / texture.get_height());
+    float4 north = texture.sample(textureSampler, in.texCoord - float2(0.0, texel.y));
+    float4 south = texture.sample(textureSampler, in.texCoord + float2(0.0, texel.y));
+    float4 west = texture.sample(textureSampler, in.texCoord - float2(texel.x, 0.0));
+    float4 east = texture.sample(textureSampler, in.texCoord + float2(texel.x, 0.0));
+    float4 lo = min(center, min(min(north, south), min(west, east)));
+    float4 hi = max(center, max(max(north, south), max(west, east)));
+    float4 blur = (north + south + west + east) * 0.25;
+    return clamp(center + (center - blur) * (2.0 * sharpness), lo, hi);
+}
@@ -0,0 +1,120 @@
+// Vblank timing for the overlay backends — reported through getOverlayStats().
+//
+// After every present the backend records the most recent vblank the platform
+// knows about: GLX_OML_sync_control on Linux, DwmGetCompositionTimingInfo on
+// Windows, CAMetalDrawable presentedTime on macOS. Where none is available the
+// time the swap returned stands in for it, which under vsync is a vblank edge.
+// From the last vblank and the refresh interval, snapshot() extrapolates when
+// the next one is due, so the JS capture loop can time capturePage() to land
+// just before it instead of drifting against the display.
+
+#ifndef STEAM_OVERLAY_PRESENT_TIMING_H
+#define STEAM_OVERLAY_PRESENT_TIMING_H
+
+#include <chrono>
+#include <cmath>
+#include <mutex>
+
+#include "frame-timing.h"
+
+namespace present_timing {
+
+typedef frame_timing::Clock Clock;
+
+// Where the vblank timestamps come from
+enum Source {
+    kSourceNone = 0,   // nothing presented yet
+    kSourceSwap,       // swap completion, refresh estimated from the swap intervals
+    kSourceOml,        // glXGetSyncValuesOML / glXGetMscRateOML
+    kSourceDwm,        // DwmGetCompositionTimingInfo
+    kSourceMetal,      // CAMetalDrawable presentedTime
+    kSourceCount
+};
+
+static const char* const kSourceNames[kSourceCount] = { "none", "swap", "oml", "dwm", "metal" };
+
+// Swap intervals kept to estimate the refresh interval without a platform clock
+static const int kIntervalCount = 32;
+
+// Intervals outside this range (ms) are not vblank spacing: no vsync, or a stall
+static const double kMinRefreshMs = 2.0;
+static const double kMaxRefreshMs = 100.0;
+
+// A platform vblank timestamp further back than this (ms) is taken to be in
+// another clock domain and ignored
+static const double kMaxVblankAgeMs = 1000.0;
+
+// The time point ms milliseconds before now
+inline Clock::time_point before(Clock::time_point now, double ms) {
+    return now - std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(ms));
+}
+
+struct Snapshot {
+    Source source = kSourceNone;
+    double refreshMs = 0.0;        // 0 while unknown
+    double sinceVblankMs = 0.0;    // age of the last recorded vblank
+    double untilVblankMs = 0.0;    // time to the next extrapolated vblank; 0 while unknown
+    unsigned long long presents = 0;
+};
+
+class PresentClock {
+public:
+    // The latest vblank happened at `at`. refreshMs is the refresh interval the
+    // platform reports; 0 estimates it from the spacing of the recorded vblanks.
+    // Any thread.
+    void record(Clock::time_point at, double refreshMs, Source source) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (presents > 0) {
+            double interval = std::chrono::duration<double, std::milli>(at - vblank).count();
+            if (interval >= kMinRefreshMs && interval <= kMaxRefreshMs) {
+                intervals[nextInterval] = interval;
+                nextInterval = (nextInterval + 1) % kIntervalCount;
+                if (filledIntervals < kIntervalCount) filledIntervals++;
+            }
+        }
+        if (refreshMs <= 0.0) {
+            // Presents land on whole refreshes: the shortest recent gap is one
+            refreshMs = 0.0;
+            for (int i = 0; i < filledIntervals; i++) {
+                if (refreshMs == 0.0 || intervals[i] < refreshMs) refreshMs = intervals[i];
+            }
+        }
+        vblank = at;
+        refresh = refreshMs;
+        this->source = source;
+        presents++;
+    }
+
+    // The last vblank and the extrapolated next one, relative to now
+    Snapshot snapshot(Clock::time_point now) const {
+        Snapshot result;
+        std::lock_guard<std::mutex> lock(mutex);
+        result.source = source;
+        result.refreshMs = refresh;
+        result.presents = presents;
+        if (presents == 0) return result;
+
+        double since = std::chrono::duration<double, std::milli>(now - vblank).count();
+        result.sinceVblankMs = since;
+        if (refresh > 0.0) {
+            double phase = std::fmod(since, refresh);
+            if (phase < 0.0) phase += refresh;
+            result.untilVblankMs = refresh - phase;
+        }
+        return result;
+    }
+
+private:
+    mutable std::mutex mutex;
+    Clock::time_point vblank;
+    double refresh = 0.0;
+    double intervals[kIntervalCount] = {};
+    int nextInterval = 0;
+    int filledIntervals = 0;
+    Source source = kSourceNone;
+    unsigned long long presents = 0;
+};
+
+} // namespace present_timing
+
+#endif // STEAM_OVERLAY_PRESENT_TIMING_H
@@ -0,0 +1,149 @@
+// Persistent frame buffer backed by a shared memory mapping — shared by all overlay backends.
+// createSharedFrameBuffer() hands the mapping to JS as an external ArrayBuffer, so
+// a producer can write each frame into the same page-aligned memory and pass a view
+// of it to renderFrame/renderFrameRegions instead of allocating a new Buffer per frame.
+// The mapping lives as long as the ArrayBuffer; the native side never keeps a pointer.
+
+#ifndef STEAM_OVERLAY_SHARED_FRAME_BUFFER_H
+#define STEAM_OVERLAY_SHARED_FRAME_BUFFER_H
+
+#include <node_api.h>
+#include <cstddef>
+#include <cstdio>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#include <fcntl.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace shared_frame {
+
+struct Mapping {
+    void* data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    HANDLE section = nullptr;
+#endif
+};
+
+inline size_t pageSize() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (size_t)info.dwAllocationGranularity;
+#else
+    long page = sysconf(_SC_PAGESIZE);
+    return page > 0 ? (size_t)page : 4096;
+#endif
+}
+
+#ifndef _WIN32
+// File descriptor for an anonymous shared memory object, or -1.
+// Linux: memfd_create through syscall() so older glibc builds still link.
+// macOS: a shm_open object that is unlinked straight away.
+inline int openSharedMemory() {
+#if defined(__linux__) && defined(SYS_memfd_create)
+    return (int)syscall(SYS_memfd_create, "steam-overlay-frame", 1u /* MFD_CLOEXEC */);
+#elif defined(__APPLE__)
+    static int counter = 0;
+    char name[64];
+    snprintf(name, sizeof(name), "/steam-overlay-%d-%d", (int)getpid(), ++counter);
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0) shm_unlink(name);
+    return fd;
+#else
+    return -1;
+#endif
+}
+#endif
+
+// Map at least `size` bytes of shared memory, rounded up to whole pages
+inline bool map(size_t size, Mapping& out) {
+    size_t page = pageSize();
+    size = (size + page - 1) / page * page;
+
+#ifdef _WIN32
+    HANDLE section = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                        (DWORD)((unsigned long long)size >> 32), (DWORD)(size & 0xFFFFFFFFu), nullptr);
+    if (!section) return false;
+    void* data = MapViewOfFile(section, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (!data) {
+        CloseHandle(section);
+        return false;
+    }
+    out.section = section;
+#else
+    void* data = MAP_FAILED;
+    int fd = openSharedMemory();
+    if (fd >= 0) {
+        if (ftruncate(fd, (off_t)size) == 0) {
+            data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        // The mapping keeps the object alive
+        close(fd);
+    }
+    if (data == MAP_FAILED) {
+        data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANON, -1, 0);
+    }
+    if (data == MAP_FAILED) return false;
+#endif
+
+    out.data = data;
+    out.size = size;
+    return true;
+}
+
+inline void unmap(Mapping& mapping) {
+    if (!mapping.data) return;
+#ifdef _WIN32
+    UnmapViewOfFile(mapping.data);
+    CloseHandle(mapping.section);
+    mapping.section = nullptr;
+#else
+    munmap(mapping.data, mapping.size);
+#endif
+    mapping.data = nullptr;
+    mapping.size = 0;
+}
+
+inline void finalizeMapping(napi_env env, void* data, void* hint) {
+    Mapping* mapping = (Mapping*)hint;
+    unmap(*mapping);
+    delete mapping;
+}
+
+// ArrayBuffer of at least byteLength bytes over a fresh shared mapping.
+// Runtimes that forbid external buffers (Electron builds with the V8 memory
+// cage) get a regular ArrayBuffer instead — still allocated once and reused
+// by the caller, just not shared memory. *isShared reports which one it is.
+inline napi_value createArrayBuffer(napi_env env, size_t byteLength, bool* isShared) {
+    napi_value result = nullptr;
+    *isShared = false;
+
+    Mapping* mapping = new Mapping();
+    if (map(byteLength, *mapping)) {
+        if (napi_create_external_arraybuffer(env, mapping->data, byteLength,
+                                             finalizeMapping, mapping, &result) == napi_ok) {
+            *isShared = true;
+            return result;
+        }
+        unmap(*mapping);
+    }
+    delete mapping;
+
+    void* data = nullptr;
+    if (napi_create_arraybuffer(env, byteLength, &data, &result) != napi_ok) {
+        return nullptr;
+    }
+    return result;
+}
+
+} // namespace shared_frame
+
+#endif // STEAM_OVERLAY_SHARED_FRAME_BUFFER_H
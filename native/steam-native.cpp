@@ -0,0 +1,1140 @@
+// Native fast paths for the Steamworks flat API
+// Resolves a handful of steam_api exports from the library koffi already loaded and
+// runs the hot per-tick loops in C++, so JS makes one call instead of one FFI
+// crossing per message and field.
+
+#include <node_api.h>
+#include <cstddef>
+#include <atomic>
+#include <cstdint>
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <new>
+#include <thread>
+#include <chrono>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+// ============================================================================
+// Steamworks types (mirrors steamnetworkingtypes.h)
+// ============================================================================
+
+// SteamNetworkingIdentity sits inside the SDK's callback packing block:
+// 4-byte packing on Linux/macOS, 8-byte on Windows
+#if defined(__linux__) || defined(__APPLE__)
+#pragma pack(push, 4)
+#else
+#pragma pack(push, 8)
+#endif
+struct SteamNetworkingIdentity {
+    int32_t m_eType;
+    int32_t m_cbSize;
+    union {
+        uint64_t m_steamID64;
+        char m_szGenericString[32];
+        uint8_t m_genericBytes[32];
+        char m_szUnknownRawString[128];
+        uint8_t m_reserved[128];
+    };
+};
+
+// Only the leading fields are read natively; the rest is copied through to JS
+struct SteamNetConnectionInfo {
+    SteamNetworkingIdentity m_identityRemote;
+    int64_t m_nUserData;
+    uint8_t m_rest[552];
+};
+
+struct SteamNetConnectionStatusChangedCallback {
+    uint32_t m_hConn;
+    SteamNetConnectionInfo m_info;
+    int32_t m_eOldState;
+};
+
+// steam_api_common.h
+struct CallbackMsg {
+    int32_t m_hSteamUser;
+    int m_iCallback;
+    uint8_t* m_pubParam;
+    int m_cubParam;
+};
+
+struct SteamAPICallCompleted {
+    uint64_t m_hAsyncCall;
+    int m_iCallback;
+    uint32_t m_cubParam;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(SteamNetConnectionInfo) == 696, "SteamNetConnectionInfo_t layout mismatch");
+
+// SteamNetworkingMessage_t is declared after the pack(pop), so natural alignment
+struct SteamNetworkingMessage {
+    void* m_pData;
+    int m_cbSize;
+    uint32_t m_conn;
+    SteamNetworkingIdentity m_identityPeer;
+    int64_t m_nConnUserData;
+    int64_t m_usecTimeReceived;
+    int64_t m_nMessageNumber;
+    void (*m_pfnFreeData)(SteamNetworkingMessage* pMsg);
+    void (*m_pfnRelease)(SteamNetworkingMessage* pMsg);
+    int m_nChannel;
+    int m_nFlags;
+    int64_t m_nUserData;
+    uint16_t m_idxLane;
+    uint16_t _pad1__;
+};
+
+#if INTPTR_MAX == INT64_MAX
+static_assert(offsetof(SteamNetworkingMessage, m_nConnUserData) == 152, "SteamNetworkingMessage_t layout mismatch");
+static_assert(offsetof(SteamNetworkingMessage, m_nChannel) == 192, "SteamNetworkingMessage_t layout mismatch");
+static_assert(offsetof(SteamNetworkingMessage, m_idxLane) == 208, "SteamNetworkingMessage_t layout mismatch");
+#endif
+
+// isteaminput.h declares the action data structs with 1-byte packing
+#pragma pack(push, 1)
+struct InputDigitalActionData {
+    bool bState;
+    bool bActive;
+};
+
+struct InputAnalogActionData {
+    int32_t eMode;
+    float x;
+    float y;
+    bool bActive;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(InputAnalogActionData) == 13, "InputAnalogActionData_t layout mismatch");
+
+static const int32_t k_ESteamNetworkingIdentityType_SteamID = 16;
+
+typedef void* (*FnNetworkingSocketsAccessor)();
+typedef int (*FnReceiveMessages)(void* self, uint32_t handle, SteamNetworkingMessage** out, int maxMessages);
+typedef void (*FnMessageRelease)(SteamNetworkingMessage* self);
+typedef void* (*FnNetworkingUtilsAccessor)();
+typedef SteamNetworkingMessage* (*FnAllocateMessage)(void* self, int cbAllocateBuffer);
+typedef void (*FnSendMessages)(void* self, int nMessages, SteamNetworkingMessage* const* pMessages, int64_t* pOutMessageNumberOrResult);
+
+static FnNetworkingSocketsAccessor g_networkingSockets = nullptr;
+static FnReceiveMessages g_receiveOnConnection = nullptr;
+static FnReceiveMessages g_receiveOnPollGroup = nullptr;
+static FnMessageRelease g_releaseMessage = nullptr;
+static FnNetworkingUtilsAccessor g_networkingUtils = nullptr;
+static FnAllocateMessage g_allocateMessage = nullptr;
+static FnSendMessages g_sendMessages = nullptr;
+
+typedef int32_t (*FnGetHSteamPipe)();
+typedef void (*FnManualDispatchInit)();
+typedef void (*FnManualDispatchRunFrame)(int32_t hSteamPipe);
+typedef bool (*FnManualDispatchGetNextCallback)(int32_t hSteamPipe, CallbackMsg* pCallbackMsg);
+typedef void (*FnManualDispatchFreeLastCallback)(int32_t hSteamPipe);
+typedef bool (*FnManualDispatchGetAPICallResult)(int32_t hSteamPipe, uint64_t hSteamAPICall, void* pCallback, int cubCallback, int iCallbackExpected, bool* pbFailed);
+typedef void (*FnNetworkingRunCallbacks)(void* self);
+typedef void (*FnConnectionStatusChanged)(SteamNetConnectionStatusChangedCallback* pInfo);
+typedef bool (*FnSetConnectionStatusChangedCallback)(void* self, FnConnectionStatusChanged fnCallback);
+
+static FnGetHSteamPipe g_getHSteamPipe = nullptr;
+static FnManualDispatchInit g_manualDispatchInit = nullptr;
+static FnManualDispatchRunFrame g_manualDispatchRunFrame = nullptr;
+static FnManualDispatchGetNextCallback g_manualDispatchGetNextCallback = nullptr;
+static FnManualDispatchFreeLastCallback g_manualDispatchFreeLastCallback = nullptr;
+static FnManualDispatchGetAPICallResult g_manualDispatchGetAPICallResult = nullptr;
+static FnNetworkingRunCallbacks g_networkingRunCallbacks = nullptr;
+static FnSetConnectionStatusChangedCallback g_setConnectionStatusChangedCallback = nullptr;
+
+typedef void* (*FnInputAccessor)();
+typedef InputDigitalActionData (*FnGetDigitalActionData)(void* self, uint64_t inputHandle, uint64_t digitalActionHandle);
+typedef InputAnalogActionData (*FnGetAnalogActionData)(void* self, uint64_t inputHandle, uint64_t analogActionHandle);
+
+static FnInputAccessor g_input = nullptr;
+static FnGetDigitalActionData g_getDigitalActionData = nullptr;
+static FnGetAnalogActionData g_getAnalogActionData = nullptr;
+
+typedef void* (*FnUserStatsAccessor)();
+typedef bool (*FnGetStatInt32)(void* self, const char* name, int32_t* pData);
+typedef bool (*FnGetStatFloat)(void* self, const char* name, float* pData);
+typedef bool (*FnSetStatInt32)(void* self, const char* name, int32_t nData);
+typedef bool (*FnSetStatFloat)(void* self, const char* name, float fData);
+
+static FnUserStatsAccessor g_userStats = nullptr;
+static FnGetStatInt32 g_getStatInt32 = nullptr;
+static FnGetStatFloat g_getStatFloat = nullptr;
+static FnSetStatInt32 g_setStatInt32 = nullptr;
+static FnSetStatFloat g_setStatFloat = nullptr;
+
+// ============================================================================
+// Message arena layout
+// ============================================================================
+//
+// [ header: count, payload offset ] [ count entries ] [ payloads, back to back ]
+// All integers little-endian. Entries are fixed-size so JS can index them directly.
+
+static const size_t kArenaHeaderBytes = 16;
+static const size_t kArenaEntryBytes = 64;
+
+// Entry field offsets
+static const size_t kEntryDataOffset = 0;      // uint32 byte offset of the payload in the arena
+static const size_t kEntrySize = 4;            // int32 payload size
+static const size_t kEntryConnection = 8;      // uint32 HSteamNetConnection
+static const size_t kEntryChannel = 12;        // int32
+static const size_t kEntryFlags = 16;          // int32
+static const size_t kEntryLane = 20;           // uint16
+static const size_t kEntryIdentityType = 24;   // int32 ESteamNetworkingIdentityType
+static const size_t kEntrySteamID = 32;        // uint64, 0 unless the peer identity is a SteamID
+static const size_t kEntryConnUserData = 40;   // int64
+static const size_t kEntryTimeReceived = 48;   // int64 microseconds
+static const size_t kEntryMessageNumber = 56;  // int64
+
+static const int kMaxBatchMessages = 4096;
+
+// ============================================================================
+// Send record layout
+// ============================================================================
+//
+// sendBatch takes a packed Buffer of fixed-size records, little-endian:
+// connection u32 @0, flags i32 @4, lane u16 @8, (reserved u16 @10),
+// payload offset u32 @12, payload length u32 @16
+
+static const size_t kSendRecordBytes = 20;
+static const size_t kRecordConnection = 0;
+static const size_t kRecordFlags = 4;
+static const size_t kRecordLane = 8;
+static const size_t kRecordOffset = 12;
+static const size_t kRecordLength = 16;
+
+static const int64_t k_EResultInvalidParam = 8;
+static const int64_t k_EResultFail = 2;
+
+template <typename T>
+static inline T readField(const uint8_t* base, size_t offset) {
+    T value;
+    memcpy(&value, base + offset, sizeof(T));
+    return value;
+}
+
+// One copy of a sendBatch payload shared by every message that points into it.
+// Steam frees message data from its own threads, hence the atomic count.
+struct SharedPayload {
+    std::atomic<int> refs;
+    uint8_t data[1];
+};
+
+static void unrefSharedPayload(SharedPayload* payload) {
+    if (payload && payload->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        payload->refs.~atomic<int>();
+        free(payload);
+    }
+}
+
+// m_pfnFreeData for messages built by sendBatch
+static void releaseSharedPayload(SteamNetworkingMessage* msg) {
+    unrefSharedPayload((SharedPayload*)(intptr_t)msg->m_nUserData);
+}
+
+template <typename T>
+static inline void writeField(uint8_t* base, size_t offset, T value) {
+    memcpy(base + offset, &value, sizeof(T));
+}
+
+// ============================================================================
+// Library binding
+// ============================================================================
+
+static void* resolveSymbol(void* library, const char* name) {
+#ifdef _WIN32
+    return (void*)GetProcAddress((HMODULE)library, name);
+#else
+    return dlsym(library, name);
+#endif
+}
+
+// init(libraryPath) — bind to the steam_api library koffi loaded. Returns false
+// if it can't be opened or is missing an export (older SDK).
+static napi_value Init(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    if (argc < 1) {
+        napi_throw_error(env, nullptr, "Expected steam_api library path");
+        return nullptr;
+    }
+
+    size_t length = 0;
+    napi_get_value_string_utf8(env, args[0], nullptr, 0, &length);
+    std::string path(length, '\0');
+    napi_get_value_string_utf8(env, args[0], &path[0], length + 1, &length);
+
+#ifdef _WIN32
+    // Already loaded by koffi; LoadLibrary only bumps the reference count
+    int wideLength = MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, nullptr, 0);
+    std::vector<wchar_t> widePath(wideLength > 0 ? wideLength : 1, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, widePath.data(), wideLength);
+    void* library = (void*)LoadLibraryW(widePath.data());
+#else
+    void* library = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+#endif
+
+    bool ok = false;
+    if (library) {
+        g_networkingSockets = (FnNetworkingSocketsAccessor)resolveSymbol(library, "SteamAPI_SteamNetworkingSockets_SteamAPI_v012");
+        g_receiveOnConnection = (FnReceiveMessages)resolveSymbol(library, "SteamAPI_ISteamNetworkingSockets_ReceiveMessagesOnConnection");
+        g_receiveOnPollGroup = (FnReceiveMessages)resolveSymbol(library, "SteamAPI_ISteamNetworkingSockets_ReceiveMessagesOnPollGroup");
+        g_releaseMessage = (FnMessageRelease)resolveSymbol(library, "SteamAPI_SteamNetworkingMessage_t_Release");
+        g_networkingUtils = (FnNetworkingUtilsAccessor)resolveSymbol(library, "SteamAPI_SteamNetworkingUtils_SteamAPI_v004");
+        g_allocateMessage = (FnAllocateMessage)resolveSymbol(library, "SteamAPI_ISteamNetworkingUtils_AllocateMessage");
+        g_sendMessages = (FnSendMessages)resolveSymbol(library, "SteamAPI_ISteamNetworkingSockets_SendMessages");
+        ok = g_networkingSockets && g_receiveOnConnection && g_receiveOnPollGroup && g_releaseMessage &&
+             g_networkingUtils && g_allocateMessage && g_sendMessages;
+
+        // Callback pump; optional, startCallbackPump reports when these are missing
+        g_getHSteamPipe = (FnGetHSteamPipe)resolveSymbol(library, "SteamAPI_GetHSteamPipe");
+        g_manualDispatchInit = (FnManualDispatchInit)resolveSymbol(library, "SteamAPI_ManualDispatch_Init");
+        g_manualDispatchRunFrame = (FnManualDispatchRunFrame)resolveSymbol(library, "SteamAPI_ManualDispatch_RunFrame");
+        g_manualDispatchGetNextCallback = (FnManualDispatchGetNextCallback)resolveSymbol(library, "SteamAPI_ManualDispatch_GetNextCallback");
+        g_manualDispatchFreeLastCallback = (FnManualDispatchFreeLastCallback)resolveSymbol(library, "SteamAPI_ManualDispatch_FreeLastCallback");
+        g_manualDispatchGetAPICallResult = (FnManualDispatchGetAPICallResult)resolveSymbol(library, "SteamAPI_ManualDispatch_GetAPICallResult");
+        g_networkingRunCallbacks = (FnNetworkingRunCallbacks)resolveSymbol(library, "SteamAPI_ISteamNetworkingSockets_RunCallbacks");
+        g_setConnectionStatusChangedCallback = (FnSetConnectionStatusChangedCallback)resolveSymbol(library, "SteamAPI_ISteamNetworkingUtils_SetGlobalCallback_SteamNetConnectionStatusChanged");
+
+        // Input snapshot; optional, snapshotActionState throws when these are missing
+        g_input = (FnInputAccessor)resolveSymbol(library, "SteamAPI_SteamInput_v006");
+        g_getDigitalActionData = (FnGetDigitalActionData)resolveSymbol(library, "SteamAPI_ISteamInput_GetDigitalActionData");
+        g_getAnalogActionData = (FnGetAnalogActionData)resolveSymbol(library, "SteamAPI_ISteamInput_GetAnalogActionData");
+
+        // Batched stats; optional, getStats/setStats throw when these are missing
+        g_userStats = (FnUserStatsAccessor)resolveSymbol(library, "SteamAPI_SteamUserStats_v013");
+        g_getStatInt32 = (FnGetStatInt32)resolveSymbol(library, "SteamAPI_ISteamUserStats_GetStatInt32");
+        g_getStatFloat = (FnGetStatFloat)resolveSymbol(library, "SteamAPI_ISteamUserStats_GetStatFloat");
+        g_setStatInt32 = (FnSetStatInt32)resolveSymbol(library, "SteamAPI_ISteamUserStats_SetStatInt32");
+        g_setStatFloat = (FnSetStatFloat)resolveSymbol(library, "SteamAPI_ISteamUserStats_SetStatFloat");
+    }
+
+    napi_value result;
+    napi_get_boolean(env, ok, &result);
+    return result;
+}
+
+// ============================================================================
+// Batched receive
+// ============================================================================
+
+// receiveMessages(handle, isPollGroup, maxMessages, arenaHolder) — drain up to
+// maxMessages from a connection or poll group into arenaHolder.buffer, replacing
+// it with a larger Buffer when the batch doesn't fit. Messages are released
+// before returning. Returns the message count (0 when nothing arrived).
+static napi_value ReceiveMessages(napi_env env, napi_callback_info info) {
+    size_t argc = 4;
+    napi_value args[4];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    if (argc < 4) {
+        napi_throw_error(env, nullptr, "Expected handle, isPollGroup, maxMessages, arena holder");
+        return nullptr;
+    }
+    if (!g_releaseMessage) {
+        napi_throw_error(env, nullptr, "Steam library not bound");
+        return nullptr;
+    }
+
+    uint32_t handle = 0;
+    bool isPollGroup = false;
+    int maxMessages = 0;
+    napi_get_value_uint32(env, args[0], &handle);
+    napi_get_value_bool(env, args[1], &isPollGroup);
+    napi_get_value_int32(env, args[2], &maxMessages);
+    if (maxMessages <= 0) maxMessages = 1;
+    if (maxMessages > kMaxBatchMessages) maxMessages = kMaxBatchMessages;
+
+    napi_value count;
+    void* iface = g_networkingSockets();
+    if (!iface) {
+        napi_create_int32(env, 0, &count);
+        return count;
+    }
+
+    // Reused across calls on the main thread only
+    static std::vector<SteamNetworkingMessage*> messages;
+    messages.resize((size_t)maxMessages);
+
+    FnReceiveMessages receive = isPollGroup ? g_receiveOnPollGroup : g_receiveOnConnection;
+    int received = receive(iface, handle, messages.data(), maxMessages);
+    if (received <= 0) {
+        napi_create_int32(env, 0, &count);
+        return count;
+    }
+
+    size_t payloadOffset = kArenaHeaderBytes + (size_t)received * kArenaEntryBytes;
+    size_t required = payloadOffset;
+    for (int i = 0; i < received; i++) {
+        // Keep each payload 8-byte aligned so typed-array views over it work
+        required += ((size_t)messages[i]->m_cbSize + 7) & ~(size_t)7;
+    }
+
+    napi_value arena;
+    uint8_t* base = nullptr;
+    size_t capacity = 0;
+    bool isBuffer = false;
+    if (napi_get_named_property(env, args[3], "buffer", &arena) == napi_ok &&
+        napi_is_buffer(env, arena, &isBuffer) == napi_ok && isBuffer) {
+        napi_get_buffer_info(env, arena, (void**)&base, &capacity);
+    }
+
+    if (capacity < required) {
+        size_t grown = capacity ? capacity : 64 * 1024;
+        while (grown < required) grown *= 2;
+        if (napi_create_buffer(env, grown, (void**)&base, &arena) != napi_ok) {
+            for (int i = 0; i < received; i++) g_releaseMessage(messages[i]);
+            napi_throw_error(env, nullptr, "Failed to grow message arena");
+            return nullptr;
+        }
+        napi_set_named_property(env, args[3], "buffer", arena);
+    }
+
+    writeField<uint32_t>(base, 0, (uint32_t)received);
+    writeField<uint32_t>(base, 4, (uint32_t)payloadOffset);
+
+    size_t offset = payloadOffset;
+    for (int i = 0; i < received; i++) {
+        SteamNetworkingMessage* msg = messages[i];
+        uint8_t* entry = base + kArenaHeaderBytes + (size_t)i * kArenaEntryBytes;
+        bool isSteamID = msg->m_identityPeer.m_eType == k_ESteamNetworkingIdentityType_SteamID;
+
+        memset(entry, 0, kArenaEntryBytes);
+        writeField<uint32_t>(entry, kEntryDataOffset, (uint32_t)offset);
+        writeField<int32_t>(entry, kEntrySize, msg->m_cbSize);
+        writeField<uint32_t>(entry, kEntryConnection, msg->m_conn);
+        writeField<int32_t>(entry, kEntryChannel, msg->m_nChannel);
+        writeField<int32_t>(entry, kEntryFlags, msg->m_nFlags);
+        writeField<uint16_t>(entry, kEntryLane, msg->m_idxLane);
+        writeField<int32_t>(entry, kEntryIdentityType, msg->m_identityPeer.m_eType);
+        writeField<uint64_t>(entry, kEntrySteamID, isSteamID ? msg->m_identityPeer.m_steamID64 : 0);
+        writeField<int64_t>(entry, kEntryConnUserData, msg->m_nConnUserData);
+        writeField<int64_t>(entry, kEntryTimeReceived, msg->m_usecTimeReceived);
+        writeField<int64_t>(entry, kEntryMessageNumber, msg->m_nMessageNumber);
+
+        if (msg->m_cbSize > 0 && msg->m_pData) {
+            memcpy(base + offset, msg->m_pData, (size_t)msg->m_cbSize);
+        }
+        offset += ((size_t)msg->m_cbSize + 7) & ~(size_t)7;
+
+        g_releaseMessage(msg);
+    }
+
+    napi_create_int32(env, received, &count);
+    return count;
+}
+
+// ============================================================================
+// Batched send
+// ============================================================================
+
+// sendBatch(records, payload, results?) — send one message per 20-byte record in
+// a single SendMessages call. Each record points at a slice of payload; the
+// payload is copied once into a shared block, so fanning the same bytes out to
+// many connections costs no copy per message. Results (message number, or
+// -EResult on failure) go into results when it is a large enough BigInt64Array,
+// otherwise into a new one, which is returned.
+static napi_value SendBatch(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value args[3];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    if (argc < 2) {
+        napi_throw_error(env, nullptr, "Expected records buffer, payload buffer");
+        return nullptr;
+    }
+    if (!g_sendMessages) {
+        napi_throw_error(env, nullptr, "Steam library not bound");
+        return nullptr;
+    }
+
+    uint8_t* records = nullptr;
+    size_t recordsLength = 0;
+    uint8_t* payloadData = nullptr;
+    size_t payloadLength = 0;
+    if (napi_get_buffer_info(env, args[0], (void**)&records, &recordsLength) != napi_ok ||
+        napi_get_buffer_info(env, args[1], (void**)&payloadData, &payloadLength) != napi_ok) {
+        napi_throw_type_error(env, nullptr, "Expected records and payload Buffers");
+        return nullptr;
+    }
+    size_t count = recordsLength / kSendRecordBytes;
+
+    // Reuse the caller's results array when it fits
+    napi_value results = nullptr;
+    int64_t* out = nullptr;
+    if (argc >= 3) {
+        bool isTypedArray = false;
+        napi_is_typedarray(env, args[2], &isTypedArray);
+        if (isTypedArray) {
+            napi_typedarray_type type;
+            size_t length = 0;
+            void* data = nullptr;
+            napi_get_typedarray_info(env, args[2], &type, &length, &data, nullptr, nullptr);
+            if (type == napi_bigint64_array && length >= count) {
+                results = args[2];
+                out = (int64_t*)data;
+            }
+        }
+    }
+    if (!results) {
+        napi_value arrayBuffer;
+        void* data = nullptr;
+        if (napi_create_arraybuffer(env, count * sizeof(int64_t), &data, &arrayBuffer) != napi_ok ||
+            napi_create_typedarray(env, napi_bigint64_array, count, arrayBuffer, 0, &results) != napi_ok) {
+            napi_throw_error(env, nullptr, "Failed to allocate results array");
+            return nullptr;
+        }
+        out = (int64_t*)data;
+    }
+    if (count == 0) return results;
+
+    void* sockets = g_networkingSockets();
+    void* utils = g_networkingUtils();
+    if (!sockets || !utils) {
+        for (size_t i = 0; i < count; i++) out[i] = -k_EResultFail;
+        return results;
+    }
+
+    SharedPayload* payload = (SharedPayload*)malloc(sizeof(SharedPayload) + payloadLength);
+    if (!payload) {
+        napi_throw_error(env, nullptr, "Failed to allocate payload");
+        return nullptr;
+    }
+    new (&payload->refs) std::atomic<int>(1);  // held by this call until every message is queued
+    memcpy(payload->data, payloadData, payloadLength);
+
+    // Main thread only, reused across calls
+    static std::vector<SteamNetworkingMessage*> messages;
+    static std::vector<size_t> messageRecord;
+    static std::vector<int64_t> messageResults;
+    messages.clear();
+    messageRecord.clear();
+
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t* record = records + i * kSendRecordBytes;
+        uint32_t offset = readField<uint32_t>(record, kRecordOffset);
+        uint32_t length = readField<uint32_t>(record, kRecordLength);
+        if ((size_t)offset + (size_t)length > payloadLength) {
+            out[i] = -k_EResultInvalidParam;
+            continue;
+        }
+
+        SteamNetworkingMessage* msg = g_allocateMessage(utils, 0);
+        if (!msg) {
+            out[i] = -k_EResultFail;
+            continue;
+        }
+        payload->refs.fetch_add(1, std::memory_order_relaxed);
+        msg->m_pData = payload->data + offset;
+        msg->m_cbSize = (int)length;
+        msg->m_pfnFreeData = releaseSharedPayload;
+        msg->m_nUserData = (int64_t)(intptr_t)payload;
+        msg->m_conn = readField<uint32_t>(record, kRecordConnection);
+        msg->m_nFlags = readField<int32_t>(record, kRecordFlags);
+        msg->m_idxLane = readField<uint16_t>(record, kRecordLane);
+        messages.push_back(msg);
+        messageRecord.push_back(i);
+    }
+
+    if (!messages.empty()) {
+        // Steam takes ownership of every message, even ones it fails to send
+        messageResults.resize(messages.size());
+        g_sendMessages(sockets, (int)messages.size(), messages.data(), messageResults.data());
+        for (size_t m = 0; m < messages.size(); m++) {
+            out[messageRecord[m]] = messageResults[m];
+        }
+    }
+
+    // Drop this call's reference; the block lives until Steam frees the last message
+    unrefSharedPayload(payload);
+
+    return results;
+}
+
+// ============================================================================
+// Manual-dispatch callback pump
+// ============================================================================
+//
+// A dedicated thread runs SteamAPI_ManualDispatch_RunFrame and, optionally,
+// ISteamNetworkingSockets::RunCallbacks, so callback delivery no longer waits for
+// the JS event loop. Each callback payload is copied into a single-producer
+// single-consumer ring (pump thread in, JS thread out) and JS is woken through a
+// threadsafe function at most once per pump frame, draining everything queued.
+
+static const int k_iSteamAPICallCompleted = 703;
+static const int k_iSteamNetConnectionStatusChangedCallback = 1221;
+
+enum PumpEventKind {
+    kPumpCallback = 0,    // broadcast callback, e.g. PersonaStateChange_t
+    kPumpCallResult = 1,  // completed SteamAPICall_t result
+};
+
+struct PumpEvent {
+    int kind;
+    int callbackId;
+    uint64_t callHandle;
+    bool ioFailure;
+    std::vector<uint8_t> data;
+};
+
+// Bounded lock-free SPSC ring of owned events
+class PumpEventQueue {
+public:
+    static const size_t kCapacity = 4096;  // power of two
+
+    // Producer: false (and the event is dropped) when the ring is full
+    bool push(PumpEvent* event) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) >= kCapacity) return false;
+        slots_[tail & (kCapacity - 1)] = event;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer: nullptr when empty
+    PumpEvent* pop() {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) return nullptr;
+        PumpEvent* event = slots_[head & (kCapacity - 1)];
+        head_.store(head + 1, std::memory_order_release);
+        return event;
+    }
+
+private:
+    PumpEvent* slots_[kCapacity] = {};
+    std::atomic<size_t> head_{0};
+    std::atomic<size_t> tail_{0};
+};
+
+struct CallbackPump {
+    std::thread thread;
+    std::atomic<bool> running{false};
+    std::atomic<bool> wakePending{false};
+    std::atomic<uint64_t> droppedEvents{0};
+    napi_threadsafe_function deliver = nullptr;
+    PumpEventQueue queue;
+    int32_t pipe = 0;
+    int intervalMs = 5;
+    bool pumpNetworking = false;
+};
+
+static CallbackPump* g_pump = nullptr;
+static bool g_manualDispatchEnabled = false;
+static bool g_pumpCleanupHookAdded = false;
+
+static void enqueueEvent(CallbackPump* pump, int kind, int callbackId, uint64_t callHandle, bool ioFailure,
+                         const void* data, size_t size) {
+    PumpEvent* event = new PumpEvent();
+    event->kind = kind;
+    event->callbackId = callbackId;
+    event->callHandle = callHandle;
+    event->ioFailure = ioFailure;
+    event->data.assign((const uint8_t*)data, (const uint8_t*)data + size);
+    if (!pump->queue.push(event)) {
+        delete event;
+        pump->droppedEvents.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// Steam calls this from ISteamNetworkingSockets::RunCallbacks, i.e. on the pump thread
+static void onConnectionStatusChanged(SteamNetConnectionStatusChangedCallback* info) {
+    CallbackPump* pump = g_pump;
+    if (pump && info) {
+        enqueueEvent(pump, kPumpCallback, k_iSteamNetConnectionStatusChangedCallback, 0, false, info, sizeof(*info));
+    }
+}
+
+static void pumpFrame(CallbackPump* pump) {
+    g_manualDispatchRunFrame(pump->pipe);
+
+    CallbackMsg msg;
+    std::vector<uint8_t> result;
+    while (g_manualDispatchGetNextCallback(pump->pipe, &msg)) {
+        if (msg.m_iCallback == k_iSteamAPICallCompleted) {
+            SteamAPICallCompleted completed;
+            memcpy(&completed, msg.m_pubParam, sizeof(completed));
+            result.resize(completed.m_cubParam);
+            bool ioFailure = false;
+            if (g_manualDispatchGetAPICallResult(pump->pipe, completed.m_hAsyncCall, result.data(),
+                                                 (int)completed.m_cubParam, completed.m_iCallback, &ioFailure)) {
+                enqueueEvent(pump, kPumpCallResult, completed.m_iCallback, completed.m_hAsyncCall, ioFailure,
+                             result.data(), result.size());
+            } else {
+                enqueueEvent(pump, kPumpCallResult, completed.m_iCallback, completed.m_hAsyncCall, true, nullptr, 0);
+            }
+        } else {
+            enqueueEvent(pump, kPumpCallback, msg.m_iCallback, 0, false, msg.m_pubParam, (size_t)msg.m_cubParam);
+        }
+        g_manualDispatchFreeLastCallback(pump->pipe);
+    }
+
+    if (pump->pumpNetworking) {
+        void* sockets = g_networkingSockets();
+        if (sockets) g_networkingRunCallbacks(sockets);
+    }
+}
+
+static void pumpThreadMain(CallbackPump* pump) {
+    while (pump->running.load(std::memory_order_acquire)) {
+        pumpFrame(pump);
+
+        // One wake-up per batch; the JS side drains everything queued so far
+        if (!pump->wakePending.exchange(true, std::memory_order_acq_rel)) {
+            if (napi_call_threadsafe_function(pump->deliver, nullptr, napi_tsfn_nonblocking) != napi_ok) {
+                pump->wakePending.store(false, std::memory_order_release);
+            }
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(pump->intervalMs));
+    }
+}
+
+static void deleteEvents(CallbackPump* pump) {
+    while (PumpEvent* event = pump->queue.pop()) delete event;
+}
+
+// Runs on the JS thread: hand every queued event to the JS callback as one array
+static void deliverEvents(napi_env env, napi_value jsCallback, void* context, void* /*data*/) {
+    CallbackPump* pump = (CallbackPump*)context;
+    pump->wakePending.store(false, std::memory_order_release);
+    if (!env) {
+        deleteEvents(pump);
+        return;
+    }
+
+    napi_value events;
+    napi_create_array(env, &events);
+    uint32_t count = 0;
+    while (PumpEvent* event = pump->queue.pop()) {
+        napi_value item, value;
+        napi_create_object(env, &item);
+
+        napi_create_int32(env, event->kind, &value);
+        napi_set_named_property(env, item, "kind", value);
+        napi_create_int32(env, event->callbackId, &value);
+        napi_set_named_property(env, item, "callbackId", value);
+        if (event->kind == kPumpCallResult) {
+            napi_create_bigint_uint64(env, event->callHandle, &value);
+            napi_set_named_property(env, item, "callHandle", value);
+            napi_get_boolean(env, event->ioFailure, &value);
+            napi_set_named_property(env, item, "ioFailure", value);
+        }
+        napi_create_buffer_copy(env, event->data.size(), event->data.data(), nullptr, &value);
+        napi_set_named_property(env, item, "data", value);
+
+        napi_set_element(env, events, count++, item);
+        delete event;
+    }
+    if (count == 0) return;
+
+    napi_value global;
+    napi_get_global(env, &global);
+    napi_call_function(env, global, jsCallback, 1, &events, nullptr);
+}
+
+static void stopPump() {
+    CallbackPump* pump = g_pump;
+    if (!pump) return;
+
+    pump->running.store(false, std::memory_order_release);
+    if (pump->thread.joinable()) pump->thread.join();
+
+    if (pump->pumpNetworking) {
+        void* utils = g_networkingUtils();
+        if (utils) g_setConnectionStatusChangedCallback(utils, nullptr);
+    }
+    g_pump = nullptr;
+
+    // The queue is freed with the pump once the threadsafe function finalizes
+    napi_release_threadsafe_function(pump->deliver, napi_tsfn_abort);
+}
+
+// Environment teardown: the pump thread must be joined before anything is freed
+static void cleanupPump(void* /*arg*/) {
+    stopPump();
+}
+
+static void finalizePump(napi_env /*env*/, void* data, void* /*hint*/) {
+    CallbackPump* pump = (CallbackPump*)data;
+    deleteEvents(pump);
+    delete pump;
+}
+
+// startCallbackPump(onEvents, intervalMs, pumpNetworking) — switch Steam to manual
+// dispatch and run it on a native thread. onEvents receives arrays of
+// { kind, callbackId, callHandle?, ioFailure?, data }. Manual dispatch can't be
+// turned off again, so after this SteamAPI_RunCallbacks must no longer be called.
+// Returns false if the library lacks the manual-dispatch exports.
+static napi_value StartCallbackPump(napi_env env, napi_callback_info info) {
+    size_t argc = 3;
+    napi_value args[3];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    napi_value result;
+    if (argc < 1) {
+        napi_throw_error(env, nullptr, "Expected event callback");
+        return nullptr;
+    }
+    if (g_pump) {
+        napi_get_boolean(env, true, &result);
+        return result;
+    }
+    if (!g_getHSteamPipe || !g_manualDispatchInit || !g_manualDispatchRunFrame || !g_manualDispatchGetNextCallback ||
+        !g_manualDispatchFreeLastCallback || !g_manualDispatchGetAPICallResult || !g_networkingRunCallbacks ||
+        !g_setConnectionStatusChangedCallback) {
+        napi_get_boolean(env, false, &result);
+        return result;
+    }
+
+    int intervalMs = 5;
+    bool pumpNetworking = true;
+    if (argc >= 2) napi_get_value_int32(env, args[1], &intervalMs);
+    if (argc >= 3) napi_get_value_bool(env, args[2], &pumpNetworking);
+    if (intervalMs < 1) intervalMs = 1;
+
+    int32_t pipe = g_getHSteamPipe();
+    if (!pipe) {
+        napi_get_boolean(env, false, &result);
+        return result;
+    }
+
+    CallbackPump* pump = new CallbackPump();
+    pump->pipe = pipe;
+    pump->intervalMs = intervalMs;
+    pump->pumpNetworking = pumpNetworking;
+
+    napi_value name;
+    napi_create_string_utf8(env, "steamCallbackPump", NAPI_AUTO_LENGTH, &name);
+    if (napi_create_threadsafe_function(env, args[0], nullptr, name, 0, 1, pump, finalizePump, pump,
+                                        deliverEvents, &pump->deliver) != napi_ok) {
+        delete pump;
+        napi_throw_error(env, nullptr, "Failed to create callback delivery function");
+        return nullptr;
+    }
+    // Don't keep the process alive just for the pump
+    napi_unref_threadsafe_function(env, pump->deliver);
+    if (!g_pumpCleanupHookAdded) {
+        napi_add_env_cleanup_hook(env, cleanupPump, nullptr);
+        g_pumpCleanupHookAdded = true;
+    }
+
+    if (!g_manualDispatchEnabled) {
+        g_manualDispatchInit();
+        g_manualDispatchEnabled = true;
+    }
+
+    if (pumpNetworking) {
+        // Route status changes through our own callback so they fire on the pump thread
+        void* utils = g_networkingUtils();
+        if (utils) g_setConnectionStatusChangedCallback(utils, onConnectionStatusChanged);
+    }
+
+    g_pump = pump;
+    pump->running.store(true, std::memory_order_release);
+    pump->thread = std::thread(pumpThreadMain, pump);
+
+    napi_get_boolean(env, true, &result);
+    return result;
+}
+
+// stopCallbackPump() — stop the pump thread (e.g. before SteamAPI_Shutdown).
+// Steam stays in manual-dispatch mode.
+static napi_value StopCallbackPump(napi_env env, napi_callback_info info) {
+    stopPump();
+    return nullptr;
+}
+
+// getCallbackPumpStats() — { running, droppedEvents }
+static napi_value GetCallbackPumpStats(napi_env env, napi_callback_info info) {
+    napi_value result, value;
+    napi_create_object(env, &result);
+    napi_get_boolean(env, g_pump != nullptr, &value);
+    napi_set_named_property(env, result, "running", value);
+    napi_create_double(env, g_pump ? (double)g_pump->droppedEvents.load() : 0.0, &value);
+    napi_set_named_property(env, result, "droppedEvents", value);
+    return result;
+}
+
+// ============================================================================
+// Input action snapshot
+// ============================================================================
+//
+// One call reads every (controller, action) pair into caller-owned typed arrays.
+// Entries are controller-major: entry = controllerIndex * actionCount + actionIndex.
+//   digital (Uint8Array):   2 bytes per entry — state, active
+//   analog  (Float32Array): 4 floats per entry — x, y, eMode, active
+
+static const size_t kDigitalEntryBytes = 2;
+static const size_t kAnalogEntryFloats = 4;
+
+static bool getBigUint64Array(napi_env env, napi_value value, uint64_t** data, size_t* length) {
+    napi_typedarray_type type;
+    void* raw = nullptr;
+    if (napi_get_typedarray_info(env, value, &type, length, &raw, nullptr, nullptr) != napi_ok ||
+        type != napi_biguint64_array) {
+        return false;
+    }
+    *data = (uint64_t*)raw;
+    return true;
+}
+
+// snapshotActionState(inputHandles, digitalActions, analogActions, digitalOut, analogOut)
+// — handles are BigUint64Arrays; outputs must hold at least the entries above.
+// Returns the number of controllers read.
+static napi_value SnapshotActionState(napi_env env, napi_callback_info info) {
+    size_t argc = 5;
+    napi_value args[5];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    if (argc < 5) {
+        napi_throw_error(env, nullptr, "Expected input handles, digital actions, analog actions, digital out, analog out");
+        return nullptr;
+    }
+    if (!g_input || !g_getDigitalActionData || !g_getAnalogActionData) {
+        napi_throw_error(env, nullptr, "Steam Input exports not available");
+        return nullptr;
+    }
+
+    uint64_t* handles = nullptr;
+    uint64_t* digitalActions = nullptr;
+    uint64_t* analogActions = nullptr;
+    size_t handleCount = 0, digitalCount = 0, analogCount = 0;
+    if (!getBigUint64Array(env, args[0], &handles, &handleCount) ||
+        !getBigUint64Array(env, args[1], &digitalActions, &digitalCount) ||
+        !getBigUint64Array(env, args[2], &analogActions, &analogCount)) {
+        napi_throw_type_error(env, nullptr, "Expected BigUint64Array handles");
+        return nullptr;
+    }
+
+    napi_typedarray_type digitalType, analogType;
+    size_t digitalOutLength = 0, analogOutLength = 0;
+    void* digitalRaw = nullptr;
+    void* analogRaw = nullptr;
+    if (napi_get_typedarray_info(env, args[3], &digitalType, &digitalOutLength, &digitalRaw, nullptr, nullptr) != napi_ok ||
+        digitalType != napi_uint8_array ||
+        napi_get_typedarray_info(env, args[4], &analogType, &analogOutLength, &analogRaw, nullptr, nullptr) != napi_ok ||
+        analogType != napi_float32_array) {
+        napi_throw_type_error(env, nullptr, "Expected Uint8Array and Float32Array outputs");
+        return nullptr;
+    }
+    if (digitalOutLength < handleCount * digitalCount * kDigitalEntryBytes ||
+        analogOutLength < handleCount * analogCount * kAnalogEntryFloats) {
+        napi_throw_range_error(env, nullptr, "Snapshot output arrays are too small");
+        return nullptr;
+    }
+
+    uint8_t* digitalOut = (uint8_t*)digitalRaw;
+    float* analogOut = (float*)analogRaw;
+    void* input = g_input();
+    if (!input) {
+        memset(digitalOut, 0, handleCount * digitalCount * kDigitalEntryBytes);
+        memset(analogOut, 0, handleCount * analogCount * kAnalogEntryFloats * sizeof(float));
+        handleCount = 0;
+    }
+
+    for (size_t c = 0; c < handleCount; c++) {
+        uint8_t* digitalRow = digitalOut + c * digitalCount * kDigitalEntryBytes;
+        for (size_t a = 0; a < digitalCount; a++) {
+            InputDigitalActionData data = g_getDigitalActionData(input, handles[c], digitalActions[a]);
+            digitalRow[a * kDigitalEntryBytes] = data.bState ? 1 : 0;
+            digitalRow[a * kDigitalEntryBytes + 1] = data.bActive ? 1 : 0;
+        }
+
+        float* analogRow = analogOut + c * analogCount * kAnalogEntryFloats;
+        for (size_t a = 0; a < analogCount; a++) {
+            InputAnalogActionData data = g_getAnalogActionData(input, handles[c], analogActions[a]);
+            float* entry = analogRow + a * kAnalogEntryFloats;
+            entry[0] = data.x;
+            entry[1] = data.y;
+            entry[2] = (float)data.eMode;
+            entry[3] = data.bActive ? 1.0f : 0.0f;
+        }
+    }
+
+    napi_value result;
+    napi_create_uint32(env, (uint32_t)handleCount, &result);
+    return result;
+}
+
+// ============================================================================
+// Batched user stats
+// ============================================================================
+//
+// One call gets or sets a list of stats of one type. Values travel as a
+// Float64Array (exact for int32 and float); a Uint8Array gets 1 per stat that
+// Steam accepted. StoreStats stays in JS, where the write-behind coalesces it.
+
+static bool getTypedArray(napi_env env, napi_value value, napi_typedarray_type expected, void** data, size_t* length) {
+    napi_typedarray_type type;
+    if (napi_get_typedarray_info(env, value, &type, length, data, nullptr, nullptr) != napi_ok) return false;
+    return type == expected;
+}
+
+// Copies element `index` of a JS string array into name; false if it isn't a string
+static bool getStatName(napi_env env, napi_value names, uint32_t index, std::string& name) {
+    napi_value element;
+    size_t length = 0;
+    if (napi_get_element(env, names, index, &element) != napi_ok ||
+        napi_get_value_string_utf8(env, element, nullptr, 0, &length) != napi_ok) {
+        return false;
+    }
+    name.resize(length);
+    napi_get_value_string_utf8(env, element, &name[0], length + 1, &length);
+    return true;
+}
+
+// Shared argument checks for getStats/setStats; returns the stat count or -1 after throwing
+static int64_t readStatsArgs(napi_env env, napi_value* args, double** values, uint8_t** flags) {
+    bool isArray = false;
+    napi_is_array(env, args[0], &isArray);
+    if (!isArray) {
+        napi_throw_type_error(env, nullptr, "Expected an array of stat names");
+        return -1;
+    }
+    uint32_t count = 0;
+    napi_get_array_length(env, args[0], &count);
+
+    size_t valueLength = 0, flagLength = 0;
+    if (!getTypedArray(env, args[2], napi_float64_array, (void**)values, &valueLength) ||
+        !getTypedArray(env, args[3], napi_uint8_array, (void**)flags, &flagLength)) {
+        napi_throw_type_error(env, nullptr, "Expected Float64Array values and Uint8Array flags");
+        return -1;
+    }
+    if (valueLength < count || flagLength < count) {
+        napi_throw_range_error(env, nullptr, "Stat arrays are shorter than the name list");
+        return -1;
+    }
+    return count;
+}
+
+// getStats(names, isFloat, valuesOut, foundOut) — read each stat; returns how many were found
+static napi_value GetStats(napi_env env, napi_callback_info info) {
+    size_t argc = 4;
+    napi_value args[4];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    if (argc < 4) {
+        napi_throw_error(env, nullptr, "Expected names, isFloat, values out, found out");
+        return nullptr;
+    }
+    if (!g_userStats || !g_getStatInt32 || !g_getStatFloat) {
+        napi_throw_error(env, nullptr, "Steam UserStats exports not available");
+        return nullptr;
+    }
+
+    bool isFloat = false;
+    napi_get_value_bool(env, args[1], &isFloat);
+    double* values = nullptr;
+    uint8_t* found = nullptr;
+    int64_t count = readStatsArgs(env, args, &values, &found);
+    if (count < 0) return nullptr;
+
+    void* userStats = g_userStats();
+    uint32_t foundCount = 0;
+    std::string name;
+    for (uint32_t i = 0; i < (uint32_t)count; i++) {
+        bool ok = false;
+        values[i] = 0.0;
+        if (userStats && getStatName(env, args[0], i, name)) {
+            if (isFloat) {
+                float value = 0.0f;
+                ok = g_getStatFloat(userStats, name.c_str(), &value);
+                if (ok) values[i] = value;
+            } else {
+                int32_t value = 0;
+                ok = g_getStatInt32(userStats, name.c_str(), &value);
+                if (ok) values[i] = value;
+            }
+        }
+        found[i] = ok ? 1 : 0;
+        if (ok) foundCount++;
+    }
+
+    napi_value result;
+    napi_create_uint32(env, foundCount, &result);
+    return result;
+}
+
+// Whether a JS number converts to the stat type without leaving its range
+// (NaN, infinities and out-of-range values are undefined behaviour to cast).
+// Int stats truncate toward zero; setStats in SteamStatsManager.ts mirrors this check.
+static bool statValueFits(double value, bool isFloat) {
+    if (!std::isfinite(value)) return false;
+    if (isFloat) return std::fabs(value) <= FLT_MAX;
+    double whole = std::trunc(value);
+    return whole >= (double)INT32_MIN && whole <= (double)INT32_MAX;
+}
+
+// setStats(names, isFloat, values, setOut) — set each stat without storing; values that
+// don't fit the stat type are skipped (setOut 0). Returns how many were set
+static napi_value SetStats(napi_env env, napi_callback_info info) {
+    size_t argc = 4;
+    napi_value args[4];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+
+    if (argc < 4) {
+        napi_throw_error(env, nullptr, "Expected names, isFloat, values, set out");
+        return nullptr;
+    }
+    if (!g_userStats || !g_setStatInt32 || !g_setStatFloat) {
+        napi_throw_error(env, nullptr, "Steam UserStats exports not available");
+        return nullptr;
+    }
+
+    bool isFloat = false;
+    napi_get_value_bool(env, args[1], &isFloat);
+    double* values = nullptr;
+    uint8_t* set = nullptr;
+    int64_t count = readStatsArgs(env, args, &values, &set);
+    if (count < 0) return nullptr;
+
+    void* userStats = g_userStats();
+    uint32_t setCount = 0;
+    std::string name;
+    for (uint32_t i = 0; i < (uint32_t)count; i++) {
+        bool ok = false;
+        if (userStats && statValueFits(values[i], isFloat) && getStatName(env, args[0], i, name)) {
+            ok = isFloat
+                ? g_setStatFloat(userStats, name.c_str(), (float)values[i])
+                : g_setStatInt32(userStats, name.c_str(), (int32_t)std::trunc(values[i]));
+        }
+        set[i] = ok ? 1 : 0;
+        if (ok) setCount++;
+    }
+
+    napi_value result;
+    napi_create_uint32(env, setCount, &result);
+    return result;
+}
+
+// Module initialization
+static napi_value InitModule(napi_env env, napi_value exports) {
+    napi_property_descriptor desc[] = {
+        { "init",            nullptr, Init,            nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "receiveMessages", nullptr, ReceiveMessages, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "sendBatch",       nullptr, SendBatch,       nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "startCallbackPump",    nullptr, StartCallbackPump,    nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "stopCallbackPump",     nullptr, StopCallbackPump,     nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "getCallbackPumpStats", nullptr, GetCallbackPumpStats, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "snapshotActionState",  nullptr, SnapshotActionState,  nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "getStats",             nullptr, GetStats,             nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "setStats",             nullptr, SetStats,             nullptr, nullptr, nullptr, napi_default, nullptr },
+    };
+
+    napi_define_properties(env, exports, sizeof(desc) / sizeof(desc[0]), desc);
+    return exports;
+}
+
+NAPI_MODULE(NODE_GYP_MODULE_NAME, InitModule)
@@ -4,14 +4,31 @@
 
 #include <node_api.h>
 #include <string>
+#include <vector>
 #include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
 #include <cstdio>
+#include <cstring>
 
 #include <windows.h>
+#include <dwmapi.h>
+#include <d3d11_4.h>
 #include <GL/gl.h>
+#include "frame-hash.h"
+#include "frame-mailbox.h"
+#include "shared-frame-buffer.h"
+#include "gl-quad-renderer.h"
+#include "gl-compressed-texture.h"
+#include "frame-tiles.h"
+#include "frame-timing.h"
+#include "present-timing.h"
 #pragma comment(lib, "opengl32.lib")
 #pragma comment(lib, "gdi32.lib")
 #pragma comment(lib, "user32.lib")
+#pragma comment(lib, "d3d11.lib")
+#pragma comment(lib, "dwmapi.lib")
 
 // Global debug flag - controlled from JavaScript via SteamLogger
 static bool g_debugMode = false;
@@ -29,6 +46,108 @@ static bool g_debugMode = false;
 #define GL_CLAMP_TO_EDGE 0x812F
 #endif
 
+// WGL_NV_DX_interop — lets GL sample a D3D11 texture in place (shared-texture import)
+#ifndef WGL_ACCESS_READ_ONLY_NV
+#define WGL_ACCESS_READ_ONLY_NV 0x0000
+typedef HANDLE (WINAPI* PFNWGLDXOPENDEVICENVPROC)(void* dxDevice);
+typedef BOOL (WINAPI* PFNWGLDXCLOSEDEVICENVPROC)(HANDLE hDevice);
+typedef HANDLE (WINAPI* PFNWGLDXREGISTEROBJECTNVPROC)(HANDLE hDevice, void* dxObject, GLuint name, GLenum type, GLenum access);
+typedef BOOL (WINAPI* PFNWGLDXUNREGISTEROBJECTNVPROC)(HANDLE hDevice, HANDLE hObject);
+typedef BOOL (WINAPI* PFNWGLDXLOCKOBJECTSNVPROC)(HANDLE hDevice, GLint count, HANDLE* hObjects);
+typedef BOOL (WINAPI* PFNWGLDXUNLOCKOBJECTSNVPROC)(HANDLE hDevice, GLint count, HANDLE* hObjects);
+#endif
+
+// Longest importSharedTexture waits for the producer's keyed mutex or for its
+// GPU copy fence (ms) before giving up on the frame
+static const DWORD kImportCopyTimeoutMs = 100;
+
+// GL entry point lookup for the shader renderer
+static void* loadGLProc(const char* name) {
+    void* proc = (void*)wglGetProcAddress(name);
+    // Some drivers report failure with small sentinel values instead of null
+    if (proc == (void*)1 || proc == (void*)2 || proc == (void*)3 || proc == (void*)-1) return nullptr;
+    return proc;
+}
+
+// State shared by every overlay window: the pixel format chosen for the first
+// window's DC, and the D3D11 device shared-texture imports copy through. Further
+// surfaces (tooltip or notification layers) reuse them instead of running
+// ChoosePixelFormat and D3D11CreateDevice again; the device is released with the
+// last window. Each window keeps its own context — a WGL context is current on
+// one thread at a time, and each window presents from its own render thread.
+// Touched from N-API calls, except the pixel format, which createOverlayWindowAsync
+// chooses on a worker and pixelFormatMutex guards.
+struct WGLOverlayDevice {
+    std::mutex pixelFormatMutex;
+    int pixelFormat = 0;
+    PIXELFORMATDESCRIPTOR pfd = {};
+    ID3D11Device* d3dDevice = nullptr;
+    ID3D11Device1* d3dDevice1 = nullptr;
+    ID3D11DeviceContext* d3dContext = nullptr;
+    bool d3dFailed = false;
+    int users = 0;
+    
+    // Pick the pixel format on the first window's DC; false when there is none
+    bool choosePixelFormat(HDC hdc, const PIXELFORMATDESCRIPTOR& wanted) {
+        std::lock_guard<std::mutex> lock(pixelFormatMutex);
+        if (pixelFormat) return true;
+        pixelFormat = ChoosePixelFormat(hdc, &wanted);
+        if (!pixelFormat) return false;
+        DescribePixelFormat(hdc, pixelFormat, sizeof(PIXELFORMATDESCRIPTOR), &pfd);
+        return true;
+    }
+    
+    // The D3D11 device, created on first use; false when it can't be
+    bool ensureD3D() {
+        if (d3dDevice1) return true;
+        if (d3dFailed) return false;
+        d3dFailed = true;  // until everything below succeeded
+        
+        D3D_FEATURE_LEVEL level;
+        if (FAILED(D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_HARDWARE, nullptr, 0, nullptr, 0,
+                                     D3D11_SDK_VERSION, &d3dDevice, &level, &d3dContext))) {
+            OverlayLogError("Failed to create D3D11 device for shared textures");
+            releaseD3D();
+            return false;
+        }
+        if (FAILED(d3dDevice->QueryInterface(__uuidof(ID3D11Device1), (void**)&d3dDevice1))) {
+            OverlayLogError("ID3D11Device1 unavailable - shared textures need Windows 8 or later");
+            releaseD3D();
+            return false;
+        }
+        
+        // Every window's render thread locks its interop objects through this device
+        ID3D11Multithread* multithread = nullptr;
+        if (SUCCEEDED(d3dContext->QueryInterface(__uuidof(ID3D11Multithread), (void**)&multithread))) {
+            multithread->SetMultithreadProtected(TRUE);
+            multithread->Release();
+        }
+        
+        d3dFailed = false;
+        OverlayLog("D3D11 device ready for shared textures (feature level 0x%x)", (unsigned)level);
+        return true;
+    }
+    
+    void releaseD3D() {
+        if (d3dContext) { d3dContext->Release(); d3dContext = nullptr; }
+        if (d3dDevice1) { d3dDevice1->Release(); d3dDevice1 = nullptr; }
+        if (d3dDevice) { d3dDevice->Release(); d3dDevice = nullptr; }
+    }
+    
+    void acquire() {
+        if (users++ > 0) OverlayLog("Reusing pixel format and D3D11 device (%d overlay windows)", users - 1);
+    }
+    
+    // The windows hold their own references on the D3D11 objects
+    void release() {
+        if (--users > 0) return;
+        releaseD3D();
+        d3dFailed = false;
+    }
+};
+
+static WGLOverlayDevice g_overlayDevice;
+
 // OpenGL Overlay Window class
 class GLOverlayWindow {
 public:
@@ -36,15 +155,114 @@ public:
     HDC hdc = nullptr;
     HGLRC hglrc = nullptr;
     
+    // Frame texture, used as an atlas: the frame (texWidth x texHeight) sits in
+    // its top-left corner, and the storage (texCapacityWidth x texCapacityHeight)
+    // only grows, geometrically, so resizes rarely reallocate it. Full frames
+    // are diffed per 128x128 tile and only changed tiles are uploaded.
     GLuint texture = 0;
     int texWidth = 0;
     int texHeight = 0;
+    int texCapacityWidth = 0;
+    int texCapacityHeight = 0;
+    GLint maxTextureSize = 0;
+    frame_tiles::TileTracker tileTracker;
+    std::vector<FrameRect> changedTiles;
+    std::vector<FrameRegion> atlasRegions;  // tiles or dirty regions plus edge gutters
+    
+    // Draw path, chosen once in init(): a VAO + GLSL 330 quad with immutable
+    // texture storage when the driver's context is GL 3.3+, otherwise (or with
+    // shaderRenderer=false) the fixed-function glBegin/glEnd quad.
+    bool preferShaderRenderer = true;
+    bool useShaderRenderer = false;
+    gl_quad::QuadRenderer quadRenderer;
+    // Frames captured below the window's resolution (captureScale < 1) are
+    // stretched by the GPU; the shader path sharpens them this much (0-1)
+    float upscaleSharpness = 0.5f;
+    
+    // Compressed uploads (compressedTextures option): the texture has BC3 storage
+    // and only the 64x64 tiles that changed are encoded — on the render thread,
+    // off Node's main thread — and uploaded. Every upload is then a full frame;
+    // dirty rectangles only select tiles through their hashes. Chosen once in init().
+    bool preferCompressedTextures = false;
+    std::atomic<bool> useCompressedTextures{false};
+    gl_compressed::CompressedTexture compressedTexture;
     
     int width = 0;
     int height = 0;
-    bool isDestroyed = false;
+    std::atomic<bool> isDestroyed{false};
     std::mutex renderMutex;
     
+    // Content hash of the last full frame handed on for upload. Identical frames
+    // skip the upload and the swap entirely (unless the Steam overlay needs a present).
+    // Caller-thread state, like the two counters below.
+    uint64_t lastFrameHash = 0;
+    bool lastFrameHashValid = false;
+    int lastFrameWidth = 0;
+    int lastFrameHeight = 0;
+    unsigned long long skippedFrames = 0;
+    unsigned long long droppedFrames = 0;  // replaced in the mailbox before the render thread took them
+    
+    // Per-stage timings and texture reallocations, reported through getOverlayStats().
+    // lastUploadBytes is written by whichever thread uploads.
+    frame_timing::FrameTimings timings;
+    std::atomic<size_t> lastUploadBytes{0};
+    // Last vblank and refresh interval, recorded after every present
+    present_timing::PresentClock presentClock;
+    
+    // Render thread. When enabled (the default) renderFrame only publishes the
+    // frame into the mailbox and returns; the thread keeps the WGL context current
+    // and does the upload, draw and SwapBuffers, so vsync waits never block Node's
+    // main thread. The window itself stays owned by the creating thread, which
+    // keeps receiving its messages. With renderThread=false everything runs on the caller.
+    bool preferRenderThread = true;
+    bool useRenderThread = false;
+    std::thread renderThread;
+    FrameMailbox mailbox;
+    std::vector<FrameRegion> uploadRegions;  // scratch list for region uploads
+    
+    // Requests to the render thread, guarded by wakeMutex
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    bool stopRequested = false;
+    bool viewportDirty = false;
+    int pendingWidth = 0;
+    int pendingHeight = 0;
+    
+    // Shared-texture import (importSharedTexture). Caller-thread side: the D3D11
+    // device shared by all windows (WGLOverlayDevice), and one texture per mailbox slot that the incoming shared
+    // texture is copied into on the GPU (slot 0 only without the render thread).
+    ID3D11Device* d3dDevice = nullptr;
+    ID3D11Device1* d3dDevice1 = nullptr;
+    ID3D11DeviceContext* d3dContext = nullptr;
+    // Signalled after each copy from a shared texture without a keyed mutex, so
+    // the caller thread can wait for it on an event instead of polling
+    ID3D11DeviceContext4* d3dContext4 = nullptr;
+    ID3D11Fence* copyFence = nullptr;
+    UINT64 copyFenceValue = 0;
+    HANDLE copyFenceEvent = nullptr;
+    bool holdsDevice = false;  // counted in g_overlayDevice.users
+    ID3D11Texture2D* importTextures[FrameMailbox::kSlotCount] = {};
+    bool importUnavailable = false;
+    bool fenceUnavailableLogged = false;
+    
+    // GL side, owned by whichever thread has the context current: each slot's
+    // texture registered with WGL_NV_DX_interop. The registration holds a
+    // reference on the D3D texture, so a resized slot can't be freed under it.
+    struct InteropTexture {
+        ID3D11Texture2D* source = nullptr;
+        GLuint name = 0;
+        HANDLE object = nullptr;
+    };
+    InteropTexture interopTextures[FrameMailbox::kSlotCount];
+    HANDLE interopDevice = nullptr;
+    std::atomic<bool> interopFailed{false};  // no WGL_NV_DX_interop — callers fall back to bitmaps
+    PFNWGLDXOPENDEVICENVPROC dxOpenDevice = nullptr;
+    PFNWGLDXCLOSEDEVICENVPROC dxCloseDevice = nullptr;
+    PFNWGLDXREGISTEROBJECTNVPROC dxRegisterObject = nullptr;
+    PFNWGLDXUNREGISTEROBJECTNVPROC dxUnregisterObject = nullptr;
+    PFNWGLDXLOCKOBJECTSNVPROC dxLockObjects = nullptr;
+    PFNWGLDXUNLOCKOBJECTSNVPROC dxUnlockObjects = nullptr;
+    
     static LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam) {
         switch (msg) {
             case WM_NCHITTEST:
@@ -61,6 +279,21 @@ public:
     }
     
     bool init(int w, int h, const char* title) {
+        return createWindow(w, h, title) && initContext();
+    }
+    
+    // Release the context from the calling thread after initContext() ran on a
+    // worker. Without the render thread, later calls on the main thread bind it
+    // themselves; with it, initContext() already handed it over.
+    void releaseCallerContext() {
+        if (!useRenderThread && hglrc) {
+            wglMakeCurrent(nullptr, nullptr);
+        }
+    }
+    
+    // The HWND and its DC. Runs on the main thread, which owns the window and
+    // pumps its messages.
+    bool createWindow(int w, int h, const char* title) {
         width = w;
         height = h;
         
@@ -99,6 +332,8 @@ public:
             OverlayLogError("Failed to create window");
             return false;
         }
+        g_overlayDevice.acquire();
+        holdsDevice = true;
         
         // Get device context
         hdc = GetDC(hwnd);
@@ -106,7 +341,13 @@ public:
             OverlayLogError("Failed to get device context");
             return false;
         }
-        
+        return true;
+    }
+    
+    // Pixel format, WGL context and GL state for the window's DC. Runs on the
+    // main thread, or on a worker with createOverlayWindowAsync — a DC can be
+    // made current on any thread, which is what the render thread relies on too.
+    bool initContext() {
         // Set pixel format for OpenGL
         PIXELFORMATDESCRIPTOR pfd = {};
         pfd.nSize = sizeof(PIXELFORMATDESCRIPTOR);
@@ -118,13 +359,13 @@ public:
         pfd.cDepthBits = 24;
         pfd.iLayerType = PFD_MAIN_PLANE;
         
-        int pixelFormat = ChoosePixelFormat(hdc, &pfd);
-        if (!pixelFormat) {
+        // Every window draws to the same display, so the first window's choice holds for all
+        if (!g_overlayDevice.choosePixelFormat(hdc, pfd)) {
             OverlayLogError("Failed to choose pixel format");
             return false;
         }
         
-        if (!SetPixelFormat(hdc, pixelFormat, &pfd)) {
+        if (!SetPixelFormat(hdc, g_overlayDevice.pixelFormat, &g_overlayDevice.pfd)) {
             OverlayLogError("Failed to set pixel format");
             return false;
         }
@@ -143,10 +384,34 @@ public:
         
         // Initialize OpenGL
         initGL();
+        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+        if (preferShaderRenderer && !quadRenderer.init(loadGLProc)) {
+            OverlayLog("Shader renderer unavailable (%s), using immediate mode", quadRenderer.error());
+        }
+        useShaderRenderer = quadRenderer.isReady();
+        if (preferCompressedTextures) {
+            if (compressedTexture.init(loadGLProc)) {
+                useCompressedTextures = true;
+            } else {
+                OverlayLog("Compressed textures unavailable (%s), uploading BGRA", compressedTexture.error());
+            }
+        }
         
-        OverlayLog("OpenGL overlay window created: %dx%d", w, h);
+        OverlayLog("OpenGL overlay window created: %dx%d", width, height);
         OverlayLog("OpenGL Version: %s", glGetString(GL_VERSION));
         OverlayLog("OpenGL Renderer: %s", glGetString(GL_RENDERER));
+        OverlayLog("Draw path: %s", useShaderRenderer
+            ? (quadRenderer.hasTextureStorage() ? "shader renderer, immutable storage" : "shader renderer")
+            : "immediate mode");
+        OverlayLog("Texture upload path: %s", useCompressedTextures ? "BC3 tiles" : "client memory");
+        
+        // A WGL context can only be current on one thread — hand it to the render thread
+        if (preferRenderThread) {
+            wglMakeCurrent(nullptr, nullptr);
+            useRenderThread = true;
+            renderThread = std::thread(&GLOverlayWindow::renderLoop, this);
+        }
+        OverlayLog("Render path: %s", useRenderThread ? "render thread" : "caller thread");
         
         return true;
     }
@@ -213,39 +478,141 @@ public:
             OverlayLog("Setting window frame: logical x=%d, y=%d, w=%d, h=%d -> physical x=%d, y=%d, w=%d, h=%d (scale=%.2f)", 
                 x, y, w, h, physX, physY, physW, physH, scale);
             
-            width = physW;
-            height = physH;
-            
             SetWindowPos(hwnd, HWND_TOPMOST, physX, physY, physW, physH, 
                 SWP_NOACTIVATE | SWP_SHOWWINDOW);
             
-            // Update OpenGL viewport
-            if (hglrc && hdc) {
+            // Update OpenGL viewport — on the thread that owns the context
+            if (useRenderThread) {
+                {
+                    std::lock_guard<std::mutex> lock(wakeMutex);
+                    pendingWidth = physW;
+                    pendingHeight = physH;
+                    viewportDirty = true;
+                }
+                wakeCondition.notify_all();
+            } else if (hglrc && hdc) {
+                width = physW;
+                height = physH;
                 wglMakeCurrent(hdc, hglrc);
-                glViewport(0, 0, physW, physH);
-                
-                glMatrixMode(GL_PROJECTION);
-                glLoadIdentity();
-                glOrtho(0, physW, physH, 0, -1, 1);
-                
-                glMatrixMode(GL_MODELVIEW);
-                glLoadIdentity();
+                applyViewport(physW, physH);
             }
         }
     }
     
-    void renderFrame(const uint8_t* data, int w, int h) {
-        if (isDestroyed) return;
+    // Viewport and projection for a w x h window. Needs the context current.
+    void applyViewport(int w, int h) {
+        glViewport(0, 0, w, h);
+        
+        glMatrixMode(GL_PROJECTION);
+        glLoadIdentity();
+        glOrtho(0, w, h, 0, -1, 1);
+        
+        glMatrixMode(GL_MODELVIEW);
+        glLoadIdentity();
+    }
+    
+    // Upload and present a frame. When rects is non-null only those sub-rectangles
+    // are uploaded and the rest of the texture keeps its previous contents.
+    // Returns false if the frame is identical to the previous one; such frames are
+    // not presented either unless forcePresent is set (Steam overlay needs a present).
+    // With the render thread running this only queues the frame and never blocks on GL.
+    bool renderFrame(const uint8_t* data, int w, int h, const FrameRect* rects = nullptr, int rectCount = 0,
+                     bool forcePresent = false) {
+        if (isDestroyed) return false;
+        auto submitStart = frame_timing::Clock::now();
+        
+        // Dirty-region frames already say what changed
+        uint64_t hash = 0;
+        bool unchanged = false;
+        if (!rects) {
+            hash = frame_hash::hashFrame(data, (size_t)w * (size_t)h * 4);
+            unchanged = lastFrameHashValid && hash == lastFrameHash && w == lastFrameWidth && h == lastFrameHeight;
+        }
+        
+        if (unchanged && !forcePresent) {
+            skippedFrames++;
+            return false;
+        }
+        
+        bool handedOn = useRenderThread ? submitFrame(data, w, h, rects, rectCount, unchanged)
+                                        : renderFrameNow(data, w, h, rects, rectCount, unchanged);
+        if (!handedOn) return false;
+        timings.record(frame_timing::kStageSubmit, frame_timing::elapsedMs(submitStart));
         
+        if (!unchanged) {
+            lastFrameHash = hash;
+            lastFrameHashValid = (rects == nullptr);
+        }
+        lastFrameWidth = w;
+        lastFrameHeight = h;
+        return !unchanged;
+    }
+    
+    // Copy the frame into the mailbox and wake the render thread.
+    // presentOnly asks for the current texture to be presented again.
+    bool submitFrame(const uint8_t* data, int w, int h, const FrameRect* rects, int rectCount, bool presentOnly) {
+        // Regions are relative to the previous frame: if that one is still pending
+        // (about to be replaced) or the size changed, send the whole frame instead.
+        // Compressed uploads always need it: tiles are found by hashing the frame.
+        FrameSlot& slot = mailbox.writeSlot();
+        bool pending = mailbox.hasPendingFrame();
+        bool sizeChanged = w != lastFrameWidth || h != lastFrameHeight;
+        bool useRegions = rects && !useCompressedTextures;
+        if ((useRegions || presentOnly) && !pending && !sizeChanged) {
+            slot.setRegions(data, w, h, rects, presentOnly ? 0 : rectCount);
+        } else {
+            slot.setFull(data, w, h);
+        }
+        
+        if (mailbox.publish()) {
+            droppedFrames++;
+        }
+        {
+            // Orders the publish against the render thread's predicate check
+            std::lock_guard<std::mutex> lock(wakeMutex);
+        }
+        wakeCondition.notify_all();
+        return true;
+    }
+    
+    // Synchronous path (renderThread=false): upload and present on the calling thread
+    bool renderFrameNow(const uint8_t* data, int w, int h, const FrameRect* rects, int rectCount, bool presentOnly) {
         std::lock_guard<std::mutex> lock(renderMutex);
         
-        if (!hglrc || !hdc) return;
-        if (!wglMakeCurrent(hdc, hglrc)) return;
+        if (!hglrc || !hdc) return false;
+        if (!wglMakeCurrent(hdc, hglrc)) return false;
         
-        // Create or update texture
-        if (texture == 0 || w != texWidth || h != texHeight) {
+        // New texture storage is undefined — dirty regions alone can't fill it
+        bool fullUpload = !presentOnly && (!rects || useCompressedTextures ||
+                                           texture == 0 || w != texWidth || h != texHeight);
+        if (fullUpload) {
+            presentFrame(data, w, h, nullptr, 0);
+        } else {
+            regionsInFrame(data, w, rects, presentOnly ? 0 : rectCount, uploadRegions);
+            presentFrame(nullptr, w, h, uploadRegions.data(), (int)uploadRegions.size());
+        }
+        return true;
+    }
+    
+    // Sharpness for drawing a texture of the given size: only frames smaller than
+    // the window are upscaled, so full-resolution frames keep the plain path
+    float sharpnessFor(int texW, int texH) const {
+        return (texW < width || texH < height) ? upscaleSharpness : 0.0f;
+    }
+    
+    // Upload (the whole frame when fullFrame is non-null, otherwise just the given
+    // regions — possibly none) and draw the texture, then swap. Needs the context current.
+    void presentFrame(const uint8_t* fullFrame, int w, int h, const FrameRegion* regions, int regionCount) {
+        auto frameStart = frame_timing::Clock::now();
+        
+        // Create the texture, or grow it once the frame and its gutter no longer
+        // fit. Smaller frames keep using the storage they have.
+        int capacityWidth = frame_tiles::growCapacity(texCapacityWidth, w, maxTextureSize);
+        int capacityHeight = frame_tiles::growCapacity(texCapacityHeight, h, maxTextureSize);
+        if (texture == 0 || capacityWidth != texCapacityWidth || capacityHeight != texCapacityHeight) {
             if (texture != 0) {
                 glDeleteTextures(1, &texture);
+                timings.textureRecreations++;
             }
             
             glGenTextures(1, &texture);
@@ -257,47 +624,469 @@ public:
             glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
             
             // Allocate texture storage (BGRA format from Electron)
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
+            if (useCompressedTextures) {
+                compressedTexture.allocate(capacityWidth, capacityHeight);
+            } else if (useShaderRenderer) {
+                quadRenderer.allocateTexture(capacityWidth, capacityHeight);
+            } else {
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, capacityWidth, capacityHeight, 0,
+                             GL_BGRA, GL_UNSIGNED_BYTE, nullptr);
+            }
             
-            texWidth = w;
-            texHeight = h;
+            texCapacityWidth = capacityWidth;
+            texCapacityHeight = capacityHeight;
+            tileTracker.reset();
             
-            OverlayLog("Created texture: %dx%d", w, h);
+            OverlayLog("Created %dx%d texture for %dx%d frames", capacityWidth, capacityHeight, w, h);
         }
+        texWidth = w;
+        texHeight = h;
         
         // Upload pixel data
         glBindTexture(GL_TEXTURE_2D, texture);
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, w, h, GL_BGRA, GL_UNSIGNED_BYTE, data);
+        if (fullFrame && useCompressedTextures) {
+            auto uploadStart = frame_timing::Clock::now();
+            lastUploadBytes = compressedTexture.upload(fullFrame, w, h, texCapacityWidth, texCapacityHeight);
+            timings.record(frame_timing::kStageUpload, frame_timing::elapsedMs(uploadStart));
+        } else if (fullFrame || regionCount > 0) {
+            auto uploadStart = frame_timing::Clock::now();
+            if (fullFrame) {
+                tileTracker.collectChanged(fullFrame, w, h, changedTiles);
+                if (tileTracker.allChanged()) {
+                    atlasRegions.assign(1, { { 0, 0, w, h }, fullFrame, w });
+                } else {
+                    regionsInFrame(fullFrame, w, changedTiles.data(), (int)changedTiles.size(), atlasRegions);
+                }
+            } else {
+                atlasRegions.assign(regions, regions + regionCount);
+                // The texture now holds content the tile hashes never saw
+                tileTracker.reset();
+            }
+            frame_tiles::appendEdgeGutters(atlasRegions, w, h, texCapacityWidth, texCapacityHeight);
+            
+            // GL_UNPACK_ROW_LENGTH lets GL walk the source rows in place
+            size_t bytes = 0;
+            for (const FrameRegion& region : atlasRegions) {
+                const FrameRect& r = region.rect;
+                glPixelStorei(GL_UNPACK_ROW_LENGTH, region.rowPixels);
+                glTexSubImage2D(GL_TEXTURE_2D, 0, r.x, r.y, r.width, r.height, GL_BGRA, GL_UNSIGNED_BYTE,
+                                region.pixels);
+                bytes += (size_t)r.width * r.height * 4;
+            }
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+            lastUploadBytes = bytes;
+            timings.record(frame_timing::kStageUpload, frame_timing::elapsedMs(uploadStart));
+        }
+        
+        // The frame covers the top-left part of the texture
+        drawAndSwap(texture, sharpnessFor(texWidth, texHeight),
+                    (float)texWidth / (float)texCapacityWidth, (float)texHeight / (float)texCapacityHeight);
+        timings.record(frame_timing::kStageFrame, frame_timing::elapsedMs(frameStart));
+    }
+    
+    // Draw tex and swap, timing both. With vsync on SwapBuffers is where the thread
+    // waits for the display. Needs the context current.
+    void drawAndSwap(GLuint tex, float sharpness, float usedU, float usedV) {
+        auto drawStart = frame_timing::Clock::now();
+        drawTexture(tex, sharpness, usedU, usedV);
+        
+        auto swapStart = frame_timing::Clock::now();
+        timings.record(frame_timing::kStageDraw,
+            std::chrono::duration<double, std::milli>(swapStart - drawStart).count());
+        SwapBuffers(hdc);
+        timings.record(frame_timing::kStageSwap, frame_timing::elapsedMs(swapStart));
+        recordPresent();
+    }
+    
+    // Record the vblank after a present: the compositor's last vblank from
+    // DwmGetCompositionTimingInfo, in QPC ticks, or the time the swap returned
+    // when DWM doesn't report one
+    void recordPresent() {
+        auto now = frame_timing::Clock::now();
+        DWM_TIMING_INFO info = {};
+        info.cbSize = sizeof(info);
+        LARGE_INTEGER counter, frequency;
+        if (SUCCEEDED(DwmGetCompositionTimingInfo(nullptr, &info)) && info.qpcVBlank &&
+            QueryPerformanceCounter(&counter) && QueryPerformanceFrequency(&frequency)) {
+            double ticksPerMs = (double)frequency.QuadPart / 1000.0;
+            double ageMs = ((double)counter.QuadPart - (double)info.qpcVBlank) / ticksPerMs;
+            if (ageMs >= 0.0 && ageMs < present_timing::kMaxVblankAgeMs) {
+                presentClock.record(present_timing::before(now, ageMs), (double)info.qpcRefreshPeriod / ticksPerMs,
+                                    present_timing::kSourceDwm);
+                return;
+            }
+        }
+        presentClock.record(now, 0.0, present_timing::kSourceSwap);
+    }
+    
+    // Clear and draw tex over the whole window, sharpening it when it is the
+    // (smaller) frame texture. usedU and usedV are the part of the frame texture
+    // the frame covers. Needs the context current.
+    void drawTexture(GLuint tex, float sharpness = 0.0f, float usedU = 1.0f, float usedV = 1.0f) {
+        if (useShaderRenderer) {
+            quadRenderer.draw(tex, texCapacityWidth, texCapacityHeight, sharpness, usedU, usedV);
+            return;
+        }
         
-        // Clear and render
         glClear(GL_COLOR_BUFFER_BIT);
         
         glEnable(GL_TEXTURE_2D);
-        glBindTexture(GL_TEXTURE_2D, texture);
+        glBindTexture(GL_TEXTURE_2D, tex);
         
         // Draw full-screen quad
         glBegin(GL_QUADS);
             glTexCoord2f(0.0f, 0.0f); glVertex2f(0.0f, 0.0f);
-            glTexCoord2f(1.0f, 0.0f); glVertex2f((float)width, 0.0f);
-            glTexCoord2f(1.0f, 1.0f); glVertex2f((float)width, (float)height);
-            glTexCoord2f(0.0f, 1.0f); glVertex2f(0.0f, (float)height);
+            glTexCoord2f(usedU, 0.0f); glVertex2f((float)width, 0.0f);
+            glTexCoord2f(usedU, usedV); glVertex2f((float)width, (float)height);
+            glTexCoord2f(0.0f, usedV); glVertex2f(0.0f, (float)height);
         glEnd();
+    }
+    
+    // Present a frame that lives in a D3D11 shared texture (the NT handle from
+    // Electron's offscreen renderer with useSharedTexture). The texture is copied
+    // GPU-side into our own slot texture; the pixels never pass through system
+    // memory. The caller may release the texture as soon as this returns, so the
+    // copy has to be ordered before the producer's next write to it:
+    //  - keyed-mutex textures: the copy sits between AcquireSync/ReleaseSync and
+    //    the GPU orders the producer's next acquire after it — no CPU wait
+    //  - otherwise: a fence is signalled after the copy and waited for on its
+    //    event, bounded by kImportCopyTimeoutMs
+    // Returns false if the texture can't be imported — the caller should fall
+    // back to bitmaps.
+    bool importSharedTexture(HANDLE sharedHandle, int w, int h) {
+        if (isDestroyed || interopFailed || !ensureD3DDevice()) return false;
+        
+        ID3D11Texture2D* source = nullptr;
+        if (FAILED(d3dDevice1->OpenSharedResource1(sharedHandle, __uuidof(ID3D11Texture2D), (void**)&source))) {
+            OverlayLogError("Failed to open shared texture handle");
+            return false;
+        }
+        
+        D3D11_TEXTURE2D_DESC desc;
+        source->GetDesc(&desc);
+        int slotIndex = useRenderThread ? mailbox.writeSlotIndex() : 0;
+        ID3D11Texture2D* target = nullptr;
+        if (desc.Format == DXGI_FORMAT_B8G8R8A8_UNORM && (int)desc.Width >= w && (int)desc.Height >= h) {
+            target = ensureImportTexture(slotIndex, w, h);
+        }
+        if (!target) {
+            source->Release();
+            return false;
+        }
+        
+        bool copied = copySharedTexture(source, target, w, h);
+        source->Release();
+        if (!copied) return false;
+        
+        if (useRenderThread) {
+            mailbox.writeSlot().setTexture(target, w, h);
+            if (mailbox.publish()) {
+                droppedFrames++;
+            }
+            {
+                std::lock_guard<std::mutex> lock(wakeMutex);
+            }
+            wakeCondition.notify_all();
+        } else {
+            std::lock_guard<std::mutex> lock(renderMutex);
+            if (!hglrc || !hdc || !wglMakeCurrent(hdc, hglrc)) return false;
+            if (!presentTexture(0, target)) return false;
+            texWidth = 0;  // the next CPU frame must re-upload everything
+        }
+        
+        // The GL texture no longer matches the screen — the next CPU frame goes up whole
+        lastFrameWidth = 0;
+        lastFrameHeight = 0;
+        lastFrameHashValid = false;
+        return true;
+    }
+    
+    // Copy the shared texture into target, ordered against the producer as
+    // described at importSharedTexture. false if it can't be synchronised.
+    bool copySharedTexture(ID3D11Texture2D* source, ID3D11Texture2D* target, int w, int h) {
+        D3D11_BOX box = { 0, 0, 0, (UINT)w, (UINT)h, 1 };
+        
+        IDXGIKeyedMutex* keyedMutex = nullptr;
+        if (SUCCEEDED(source->QueryInterface(__uuidof(IDXGIKeyedMutex), (void**)&keyedMutex))) {
+            // S_OK only; WAIT_TIMEOUT and WAIT_ABANDONED are success codes
+            HRESULT acquired = keyedMutex->AcquireSync(0, kImportCopyTimeoutMs);
+            if (acquired == S_OK) {
+                d3dContext->CopySubresourceRegion(target, 0, 0, 0, 0, source, 0, &box);
+                keyedMutex->ReleaseSync(0);
+                d3dContext->Flush();
+            } else {
+                OverlayLogError("Shared texture keyed mutex not released within %u ms", (unsigned)kImportCopyTimeoutMs);
+            }
+            keyedMutex->Release();
+            return acquired == S_OK;
+        }
+        
+        if (!copyFence) {
+            if (!fenceUnavailableLogged) {
+                OverlayLogError("Shared texture has no keyed mutex and D3D11 fences are unavailable - using bitmaps");
+                fenceUnavailableLogged = true;
+            }
+            return false;
+        }
+        
+        d3dContext->CopySubresourceRegion(target, 0, 0, 0, 0, source, 0, &box);
+        copyFenceValue++;
+        if (FAILED(d3dContext4->Signal(copyFence, copyFenceValue)) ||
+            FAILED(copyFence->SetEventOnCompletion(copyFenceValue, copyFenceEvent))) {
+            return false;
+        }
+        d3dContext->Flush();
+        if (WaitForSingleObject(copyFenceEvent, kImportCopyTimeoutMs) != WAIT_OBJECT_0) {
+            OverlayLogError("Shared texture copy didn't finish within %u ms", (unsigned)kImportCopyTimeoutMs);
+            return false;
+        }
+        return true;
+    }
+    
+    bool ensureD3DDevice() {
+        if (d3dDevice1) return true;
+        if (importUnavailable) return false;
+        importUnavailable = true;  // until everything below succeeded
+        
+        if (!g_overlayDevice.ensureD3D()) return false;
+        d3dDevice = g_overlayDevice.d3dDevice;
+        d3dDevice1 = g_overlayDevice.d3dDevice1;
+        d3dContext = g_overlayDevice.d3dContext;
+        d3dDevice->AddRef();
+        d3dDevice1->AddRef();
+        d3dContext->AddRef();
+        
+        // Fences need Windows 10 1703; without them only keyed-mutex textures import
+        ID3D11Device5* device5 = nullptr;
+        if (SUCCEEDED(d3dDevice->QueryInterface(__uuidof(ID3D11Device5), (void**)&device5))) {
+            if (SUCCEEDED(d3dContext->QueryInterface(__uuidof(ID3D11DeviceContext4), (void**)&d3dContext4)) &&
+                SUCCEEDED(device5->CreateFence(0, D3D11_FENCE_FLAG_NONE, __uuidof(ID3D11Fence), (void**)&copyFence))) {
+                copyFenceEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+            }
+            device5->Release();
+        }
+        if (!copyFenceEvent) releaseCopyFence();
+        
+        importUnavailable = false;
+        return true;
+    }
+    
+    void releaseCopyFence() {
+        if (copyFenceEvent) { CloseHandle(copyFenceEvent); copyFenceEvent = nullptr; }
+        if (copyFence) { copyFence->Release(); copyFence = nullptr; }
+        if (d3dContext4) { d3dContext4->Release(); d3dContext4 = nullptr; }
+    }
+    
+    // The slot's texture at w x h, recreated when the size changes
+    ID3D11Texture2D* ensureImportTexture(int slotIndex, int w, int h) {
+        ID3D11Texture2D*& target = importTextures[slotIndex];
+        if (target) {
+            D3D11_TEXTURE2D_DESC desc;
+            target->GetDesc(&desc);
+            if ((int)desc.Width == w && (int)desc.Height == h) return target;
+            target->Release();
+            target = nullptr;
+        }
+        
+        D3D11_TEXTURE2D_DESC desc = {};
+        desc.Width = (UINT)w;
+        desc.Height = (UINT)h;
+        desc.MipLevels = 1;
+        desc.ArraySize = 1;
+        desc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+        desc.SampleDesc.Count = 1;
+        desc.Usage = D3D11_USAGE_DEFAULT;
+        desc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
+        if (FAILED(d3dDevice->CreateTexture2D(&desc, nullptr, &target))) {
+            OverlayLogError("Failed to create %dx%d import texture", w, h);
+            target = nullptr;
+        }
+        return target;
+    }
+    
+    bool ensureInteropDevice() {
+        if (interopDevice) return true;
+        if (interopFailed) return false;
+        
+        dxOpenDevice = (PFNWGLDXOPENDEVICENVPROC)wglGetProcAddress("wglDXOpenDeviceNV");
+        dxCloseDevice = (PFNWGLDXCLOSEDEVICENVPROC)wglGetProcAddress("wglDXCloseDeviceNV");
+        dxRegisterObject = (PFNWGLDXREGISTEROBJECTNVPROC)wglGetProcAddress("wglDXRegisterObjectNV");
+        dxUnregisterObject = (PFNWGLDXUNREGISTEROBJECTNVPROC)wglGetProcAddress("wglDXUnregisterObjectNV");
+        dxLockObjects = (PFNWGLDXLOCKOBJECTSNVPROC)wglGetProcAddress("wglDXLockObjectsNV");
+        dxUnlockObjects = (PFNWGLDXUNLOCKOBJECTSNVPROC)wglGetProcAddress("wglDXUnlockObjectsNV");
+        
+        if (dxOpenDevice && dxCloseDevice && dxRegisterObject && dxUnregisterObject && dxLockObjects && dxUnlockObjects) {
+            interopDevice = dxOpenDevice(d3dDevice);
+        }
+        if (!interopDevice) {
+            OverlayLogError("WGL_NV_DX_interop unavailable - shared textures disabled, using bitmaps");
+            interopFailed = true;
+            return false;
+        }
+        return true;
+    }
+    
+    // Draw the slot's D3D11 texture through the interop and swap. Needs the context current.
+    bool presentTexture(int slotIndex, ID3D11Texture2D* source) {
+        if (!ensureInteropDevice()) return false;
+        auto frameStart = frame_timing::Clock::now();
+        
+        InteropTexture& interop = interopTextures[slotIndex];
+        if (interop.source != source) {
+            releaseInteropTexture(interop);
+            glGenTextures(1, &interop.name);
+            interop.object = dxRegisterObject(interopDevice, source, interop.name, GL_TEXTURE_2D, WGL_ACCESS_READ_ONLY_NV);
+            if (!interop.object) {
+                OverlayLogError("wglDXRegisterObjectNV failed - shared textures disabled, using bitmaps");
+                glDeleteTextures(1, &interop.name);
+                interop.name = 0;
+                interopFailed = true;
+                return false;
+            }
+            source->AddRef();
+            interop.source = source;
+            
+            glBindTexture(GL_TEXTURE_2D, interop.name);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        }
+        
+        if (!dxLockObjects(interopDevice, 1, &interop.object)) return false;
+        auto drawStart = frame_timing::Clock::now();
+        drawTexture(interop.name);
+        dxUnlockObjects(interopDevice, 1, &interop.object);
         
-        // Swap buffers
+        auto swapStart = frame_timing::Clock::now();
+        timings.record(frame_timing::kStageDraw,
+            std::chrono::duration<double, std::milli>(swapStart - drawStart).count());
         SwapBuffers(hdc);
+        timings.record(frame_timing::kStageSwap, frame_timing::elapsedMs(swapStart));
+        recordPresent();
+        timings.record(frame_timing::kStageFrame, frame_timing::elapsedMs(frameStart));
+        return true;
     }
     
-    void destroy() {
-        if (isDestroyed) return;
-        isDestroyed = true;
+    void releaseInteropTexture(InteropTexture& interop) {
+        if (interop.object) {
+            dxUnregisterObject(interopDevice, interop.object);
+            interop.object = nullptr;
+        }
+        if (interop.name) {
+            glDeleteTextures(1, &interop.name);
+            interop.name = 0;
+        }
+        if (interop.source) {
+            interop.source->Release();
+            interop.source = nullptr;
+        }
+    }
+    
+    // Drop every interop registration. Needs the context current.
+    void releaseInterop() {
+        for (InteropTexture& interop : interopTextures) {
+            releaseInteropTexture(interop);
+        }
+        if (interopDevice) {
+            dxCloseDevice(interopDevice);
+            interopDevice = nullptr;
+        }
+    }
+    
+    void releaseD3D() {
+        for (ID3D11Texture2D*& target : importTextures) {
+            if (target) {
+                target->Release();
+                target = nullptr;
+            }
+        }
+        releaseCopyFence();
+        if (d3dContext) { d3dContext->Release(); d3dContext = nullptr; }
+        if (d3dDevice1) { d3dDevice1->Release(); d3dDevice1 = nullptr; }
+        if (d3dDevice) { d3dDevice->Release(); d3dDevice = nullptr; }
+    }
+    
+    // Render thread body: keeps the context current from init() until destroy()
+    // and presents the newest frame from the mailbox whenever one arrives.
+    void renderLoop() {
+        if (!wglMakeCurrent(hdc, hglrc)) {
+            OverlayLogError("Failed to make OpenGL context current on render thread");
+        }
         
-        OverlayLog("Destroying OpenGL overlay...");
+        for (;;) {
+            bool resized = false;
+            int newWidth = 0, newHeight = 0;
+            {
+                std::unique_lock<std::mutex> lock(wakeMutex);
+                wakeCondition.wait(lock, [this] {
+                    return stopRequested || viewportDirty || mailbox.hasPendingFrame();
+                });
+                if (stopRequested) break;
+                resized = viewportDirty;
+                newWidth = pendingWidth;
+                newHeight = pendingHeight;
+                viewportDirty = false;
+            }
+            
+            if (resized) {
+                width = newWidth;
+                height = newHeight;
+                applyViewport(newWidth, newHeight);
+            }
+            
+            FrameSlot* frame = mailbox.take();
+            if (frame) {
+                if (frame->gpuTexture) {
+                    presentTexture(mailbox.readSlotIndex(), (ID3D11Texture2D*)frame->gpuTexture);
+                } else if (frame->isFull) {
+                    presentFrame(frame->pixels.data(), frame->width, frame->height, nullptr, 0);
+                } else {
+                    frame->packedRegions(uploadRegions);
+                    presentFrame(nullptr, frame->width, frame->height,
+                                 uploadRegions.data(), (int)uploadRegions.size());
+                }
+            }
+        }
         
-        // Delete texture
+        // The texture belongs to the context — delete it while it's current here
         if (texture) {
             glDeleteTextures(1, &texture);
             texture = 0;
         }
+        releaseInterop();
+        quadRenderer.destroy();
+        wglMakeCurrent(nullptr, nullptr);
+    }
+    
+    void stopRenderThread() {
+        if (!renderThread.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            stopRequested = true;
+        }
+        wakeCondition.notify_all();
+        renderThread.join();
+    }
+    
+    void destroy() {
+        if (isDestroyed.exchange(true)) return;
+        
+        OverlayLog("Destroying OpenGL overlay...");
+        
+        // The render thread deletes the texture itself on the way out
+        stopRenderThread();
+        
+        // Without the render thread, GL objects are deleted here with the context current
+        if (hglrc && !useRenderThread && wglMakeCurrent(hdc, hglrc)) {
+            if (texture) {
+                glDeleteTextures(1, &texture);
+                texture = 0;
+            }
+            releaseInterop();
+            quadRenderer.destroy();
+        }
+        releaseD3D();
         
         if (hglrc) {
             wglMakeCurrent(nullptr, nullptr);
@@ -315,6 +1104,11 @@ public:
             hwnd = nullptr;
         }
         
+        if (holdsDevice) {
+            g_overlayDevice.release();
+            holdsDevice = false;
+        }
+        
         OverlayLog("OpenGL overlay destroyed");
     }
     
@@ -324,7 +1118,21 @@ public:
 };
 
 // N-API wrapper functions
-static napi_value CreateOverlayWindow(napi_env env, napi_callback_info info) {
+
+// Options shared by createOverlayWindow and createOverlayWindowAsync: the window
+// (not yet initialized) with its preferences applied, and its size and title
+struct OverlayWindowRequest {
+    GLOverlayWindow* window = nullptr;
+    int width = 0;
+    int height = 0;
+    char title[256] = "Steam Overlay";
+    bool initialized = false;
+    napi_deferred deferred = nullptr;
+    napi_async_work work = nullptr;
+};
+
+// Read the options object into request. Throws and returns false on bad arguments.
+static bool ReadOverlayWindowOptions(napi_env env, napi_callback_info info, OverlayWindowRequest* request) {
     napi_status status;
     size_t argc = 1;
     napi_value args[1];
@@ -332,7 +1140,7 @@ static napi_value CreateOverlayWindow(napi_env env, napi_callback_info info) {
     
     if (status != napi_ok || argc < 1) {
         napi_throw_error(env, nullptr, "Expected options object");
-        return nullptr;
+        return false;
     }
     
     // Get options
@@ -341,17 +1149,75 @@ static napi_value CreateOverlayWindow(napi_env env, napi_callback_info info) {
     napi_get_named_property(env, args[0], "height", &heightVal);
     napi_get_named_property(env, args[0], "title", &titleVal);
     
-    int width, height;
-    napi_get_value_int32(env, widthVal, &width);
-    napi_get_value_int32(env, heightVal, &height);
+    napi_get_value_int32(env, widthVal, &request->width);
+    napi_get_value_int32(env, heightVal, &request->height);
     
-    char title[256] = "Steam Overlay";
     size_t titleLen;
-    napi_get_value_string_utf8(env, titleVal, title, sizeof(title), &titleLen);
+    napi_get_value_string_utf8(env, titleVal, request->title, sizeof(request->title), &titleLen);
     
     // Create window
     GLOverlayWindow* window = new GLOverlayWindow();
-    if (!window->init(width, height, title)) {
+    request->window = window;
+    
+    // Optional: shaderRenderer=false keeps the fixed-function immediate-mode quad
+    bool hasShaderRenderer = false;
+    napi_has_named_property(env, args[0], "shaderRenderer", &hasShaderRenderer);
+    if (hasShaderRenderer) {
+        napi_value shaderRendererVal;
+        bool shaderRenderer = true;
+        napi_get_named_property(env, args[0], "shaderRenderer", &shaderRendererVal);
+        if (napi_get_value_bool(env, shaderRendererVal, &shaderRenderer) == napi_ok) {
+            window->preferShaderRenderer = shaderRenderer;
+        }
+    }
+    
+    // Optional: compressedTextures=true uploads changed tiles as BC3
+    bool hasCompressedTextures = false;
+    napi_has_named_property(env, args[0], "compressedTextures", &hasCompressedTextures);
+    if (hasCompressedTextures) {
+        napi_value compressedTexturesVal;
+        bool compressedTextures = false;
+        napi_get_named_property(env, args[0], "compressedTextures", &compressedTexturesVal);
+        if (napi_get_value_bool(env, compressedTexturesVal, &compressedTextures) == napi_ok) {
+            window->preferCompressedTextures = compressedTextures;
+        }
+    }
+    
+    // Optional: upscaleSharpness (0-1) for frames smaller than the window
+    bool hasUpscaleSharpness = false;
+    napi_has_named_property(env, args[0], "upscaleSharpness", &hasUpscaleSharpness);
+    if (hasUpscaleSharpness) {
+        napi_value sharpnessVal;
+        double sharpness = 0.5;
+        napi_get_named_property(env, args[0], "upscaleSharpness", &sharpnessVal);
+        if (napi_get_value_double(env, sharpnessVal, &sharpness) == napi_ok) {
+            window->upscaleSharpness = (float)(sharpness < 0.0 ? 0.0 : sharpness > 1.0 ? 1.0 : sharpness);
+        }
+    }
+    
+    // Optional: renderThread=false uploads and swaps on the calling thread
+    bool hasRenderThread = false;
+    napi_has_named_property(env, args[0], "renderThread", &hasRenderThread);
+    if (hasRenderThread) {
+        napi_value renderThreadVal;
+        bool renderThread = true;
+        napi_get_named_property(env, args[0], "renderThread", &renderThreadVal);
+        if (napi_get_value_bool(env, renderThreadVal, &renderThread) == napi_ok) {
+            window->preferRenderThread = renderThread;
+        }
+    }
+    
+    return true;
+}
+
+static napi_value CreateOverlayWindow(napi_env env, napi_callback_info info) {
+    OverlayWindowRequest request;
+    if (!ReadOverlayWindowOptions(env, info, &request)) {
+        return nullptr;
+    }
+    
+    GLOverlayWindow* window = request.window;
+    if (!window->init(request.width, request.height, request.title)) {
         delete window;
         napi_throw_error(env, nullptr, "Failed to create overlay window");
         return nullptr;
@@ -359,11 +1225,65 @@ static napi_value CreateOverlayWindow(napi_env env, napi_callback_info info) {
     
     // Wrap pointer
     napi_value external;
-    status = napi_create_external(env, window, nullptr, nullptr, &external);
+    napi_create_external(env, window, nullptr, nullptr, &external);
     
     return external;
 }
 
+// createOverlayWindowAsync: the HWND is created here on the main thread, which
+// owns its messages; pixel format, context, GL state and shader compilation run
+// on a libuv worker.
+static void CreateOverlayWindowExecute(napi_env env, void* data) {
+    OverlayWindowRequest* request = (OverlayWindowRequest*)data;
+    request->initialized = request->window->initContext();
+    // The window is used (or destroyed, on failure) from the main thread
+    request->window->releaseCallerContext();
+}
+
+static void RejectOverlayWindow(napi_env env, napi_deferred deferred) {
+    napi_value message, error;
+    napi_create_string_utf8(env, "Failed to create overlay window", NAPI_AUTO_LENGTH, &message);
+    napi_create_error(env, nullptr, message, &error);
+    napi_reject_deferred(env, deferred, error);
+}
+
+static void CreateOverlayWindowComplete(napi_env env, napi_status status, void* data) {
+    OverlayWindowRequest* request = (OverlayWindowRequest*)data;
+    if (status == napi_ok && request->initialized) {
+        napi_value external;
+        napi_create_external(env, request->window, nullptr, nullptr, &external);
+        napi_resolve_deferred(env, request->deferred, external);
+    } else {
+        delete request->window;
+        RejectOverlayWindow(env, request->deferred);
+    }
+    napi_delete_async_work(env, request->work);
+    delete request;
+}
+
+static napi_value CreateOverlayWindowAsync(napi_env env, napi_callback_info info) {
+    OverlayWindowRequest* request = new OverlayWindowRequest();
+    if (!ReadOverlayWindowOptions(env, info, request)) {
+        delete request;
+        return nullptr;
+    }
+    
+    napi_value promise, resourceName;
+    napi_create_promise(env, &request->deferred, &promise);
+    if (!request->window->createWindow(request->width, request->height, request->title)) {
+        delete request->window;
+        RejectOverlayWindow(env, request->deferred);
+        delete request;
+        return promise;
+    }
+    
+    napi_create_string_utf8(env, "createOverlayWindowAsync", NAPI_AUTO_LENGTH, &resourceName);
+    napi_create_async_work(env, nullptr, resourceName, CreateOverlayWindowExecute,
+                           CreateOverlayWindowComplete, request, &request->work);
+    napi_queue_async_work(env, request->work);
+    return promise;
+}
+
 static napi_value ShowOverlayWindow(napi_env env, napi_callback_info info) {
     size_t argc = 1;
     napi_value args[1];
@@ -415,9 +1335,12 @@ static napi_value SetOverlayWindowFrame(napi_env env, napi_callback_info info) {
     return nullptr;
 }
 
+// renderFrame(handle, buffer, width, height, forcePresent?) — returns false when the
+// frame matched the previous one and was skipped.
+// The buffer is copied before returning, so the caller may reuse it immediately.
 static napi_value RenderFrame(napi_env env, napi_callback_info info) {
-    size_t argc = 4;
-    napi_value args[4];
+    size_t argc = 5;
+    napi_value args[5];
     napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
     
     GLOverlayWindow* window;
@@ -431,11 +1354,271 @@ static napi_value RenderFrame(napi_env env, napi_callback_info info) {
     napi_get_value_int32(env, args[2], &width);
     napi_get_value_int32(env, args[3], &height);
     
+    bool forcePresent = false;
+    if (argc >= 5) {
+        napi_get_value_bool(env, args[4], &forcePresent);
+    }
+    
+    bool rendered = false;
+    if (window && buffer && width > 0 && height > 0 && length >= (size_t)width * height * 4) {
+        rendered = window->renderFrame((const uint8_t*)buffer, width, height, nullptr, 0, forcePresent);
+    }
+    
+    napi_value result;
+    napi_get_boolean(env, rendered, &result);
+    return result;
+}
+
+// Read an array of { x, y, width, height } objects, clipped to a w x h frame.
+// Empty rectangles are dropped. Returns false if value isn't an array.
+static bool ReadFrameRects(napi_env env, napi_value value, int w, int h, std::vector<FrameRect>& rects) {
+    bool isArray = false;
+    if (napi_is_array(env, value, &isArray) != napi_ok || !isArray) return false;
+    
+    uint32_t count = 0;
+    napi_get_array_length(env, value, &count);
+    rects.reserve(count);
+    
+    for (uint32_t i = 0; i < count; i++) {
+        napi_value item, field;
+        napi_get_element(env, value, i, &item);
+        
+        int x = 0, y = 0, rw = 0, rh = 0;
+        napi_get_named_property(env, item, "x", &field);      napi_get_value_int32(env, field, &x);
+        napi_get_named_property(env, item, "y", &field);      napi_get_value_int32(env, field, &y);
+        napi_get_named_property(env, item, "width", &field);  napi_get_value_int32(env, field, &rw);
+        napi_get_named_property(env, item, "height", &field); napi_get_value_int32(env, field, &rh);
+        
+        int x0 = x < 0 ? 0 : x;
+        int y0 = y < 0 ? 0 : y;
+        int x1 = x + rw > w ? w : x + rw;
+        int y1 = y + rh > h ? h : y + rh;
+        if (x1 > x0 && y1 > y0) {
+            rects.push_back({ x0, y0, x1 - x0, y1 - y0 });
+        }
+    }
+    return true;
+}
+
+// renderFrameRegions(handle, buffer, width, height, rects) — uploads only the listed
+// dirty rectangles of a full-size BGRA frame, keeping the rest of the texture
+static napi_value RenderFrameRegions(napi_env env, napi_callback_info info) {
+    size_t argc = 5;
+    napi_value args[5];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    if (argc < 5) {
+        napi_throw_error(env, nullptr, "Expected window handle, buffer, width, height, rects");
+        return nullptr;
+    }
+    
+    GLOverlayWindow* window;
+    napi_get_value_external(env, args[0], (void**)&window);
+    
+    void* buffer;
+    size_t length;
+    napi_get_buffer_info(env, args[1], &buffer, &length);
+    
+    int width, height;
+    napi_get_value_int32(env, args[2], &width);
+    napi_get_value_int32(env, args[3], &height);
+    
+    if (width <= 0 || height <= 0 || length < (size_t)width * height * 4) {
+        napi_throw_error(env, nullptr, "Buffer is smaller than width * height * 4");
+        return nullptr;
+    }
+    
+    std::vector<FrameRect> rects;
+    if (!ReadFrameRects(env, args[4], width, height, rects)) {
+        napi_throw_error(env, nullptr, "Expected an array of { x, y, width, height } rects");
+        return nullptr;
+    }
+    
+    bool rendered = false;
     if (window && buffer) {
-        window->renderFrame((const uint8_t*)buffer, width, height);
+        rendered = window->renderFrame((const uint8_t*)buffer, width, height, rects.data(), (int)rects.size());
     }
     
-    return nullptr;
+    napi_value result;
+    napi_get_boolean(env, rendered, &result);
+    return result;
+}
+
+// createSharedFrameBuffer(width, height) — { buffer: ArrayBuffer, shared: boolean }.
+// A persistent page-aligned frame buffer to write frames into and pass (as a
+// Buffer view) to renderFrame/renderFrameRegions, instead of a new Buffer per frame.
+static napi_value CreateSharedFrameBuffer(napi_env env, napi_callback_info info) {
+    size_t argc = 2;
+    napi_value args[2];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    int width = 0, height = 0;
+    if (argc >= 2) {
+        napi_get_value_int32(env, args[0], &width);
+        napi_get_value_int32(env, args[1], &height);
+    }
+    if (width <= 0 || height <= 0) {
+        napi_throw_error(env, nullptr, "Expected positive width and height");
+        return nullptr;
+    }
+    
+    bool shared = false;
+    napi_value buffer = shared_frame::createArrayBuffer(env, (size_t)width * (size_t)height * 4, &shared);
+    if (!buffer) {
+        napi_throw_error(env, nullptr, "Failed to allocate frame buffer");
+        return nullptr;
+    }
+    OverlayLog("Frame buffer %dx%d: %s", width, height, shared ? "shared memory" : "ArrayBuffer (external buffers not allowed)");
+    
+    napi_value result, value;
+    napi_create_object(env, &result);
+    napi_set_named_property(env, result, "buffer", buffer);
+    napi_get_boolean(env, shared, &value);
+    napi_set_named_property(env, result, "shared", value);
+    return result;
+}
+
+// importSharedTexture(handle, { handle: Buffer }, width, height) — present a BGRA
+// D3D11 shared texture given its NT handle (Electron's textureInfo.handle.ntHandle).
+// Returns false if it couldn't be imported; the texture may be released either way.
+static napi_value ImportSharedTexture(napi_env env, napi_callback_info info) {
+    size_t argc = 4;
+    napi_value args[4];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    if (argc < 4) {
+        napi_throw_error(env, nullptr, "Expected window handle, texture descriptor, width, height");
+        return nullptr;
+    }
+    
+    GLOverlayWindow* window;
+    napi_get_value_external(env, args[0], (void**)&window);
+    
+    HANDLE sharedHandle = nullptr;
+    napi_value handleVal;
+    void* handleData = nullptr;
+    size_t handleLength = 0;
+    if (napi_get_named_property(env, args[1], "handle", &handleVal) == napi_ok &&
+        napi_get_buffer_info(env, handleVal, &handleData, &handleLength) == napi_ok &&
+        handleLength >= sizeof(HANDLE)) {
+        memcpy(&sharedHandle, handleData, sizeof(HANDLE));
+    }
+    
+    int width = 0, height = 0;
+    napi_get_value_int32(env, args[2], &width);
+    napi_get_value_int32(env, args[3], &height);
+    
+    bool rendered = false;
+    if (window && sharedHandle && width > 0 && height > 0) {
+        rendered = window->importSharedTexture(sharedHandle, width, height);
+    }
+    
+    napi_value result;
+    napi_get_boolean(env, rendered, &result);
+    return result;
+}
+
+// Add stages: { submit, upload, draw, swap, frame } (each { count, last, average,
+// p50, p95, p99 } in ms), textureRecreations and swapWaitMs (total time in swaps)
+static void SetTimingStats(napi_env env, napi_value result, const frame_timing::FrameTimings& timings) {
+    napi_value stages, stage, value;
+    napi_create_object(env, &stages);
+    double swapWaitMs = 0.0;
+    for (int i = 0; i < frame_timing::kStageCount; i++) {
+        frame_timing::StageSummary summary = timings.stages[i].summary();
+        if (i == frame_timing::kStageSwap) swapWaitMs = summary.total;
+        
+        napi_create_object(env, &stage);
+        napi_create_double(env, (double)summary.count, &value);
+        napi_set_named_property(env, stage, "count", value);
+        napi_create_double(env, summary.last, &value);
+        napi_set_named_property(env, stage, "last", value);
+        napi_create_double(env, summary.average, &value);
+        napi_set_named_property(env, stage, "average", value);
+        napi_create_double(env, summary.p50, &value);
+        napi_set_named_property(env, stage, "p50", value);
+        napi_create_double(env, summary.p95, &value);
+        napi_set_named_property(env, stage, "p95", value);
+        napi_create_double(env, summary.p99, &value);
+        napi_set_named_property(env, stage, "p99", value);
+        napi_set_named_property(env, stages, frame_timing::kStageNames[i], stage);
+    }
+    napi_set_named_property(env, result, "stages", stages);
+    
+    napi_create_double(env, (double)timings.textureRecreations, &value);
+    napi_set_named_property(env, result, "textureRecreations", value);
+    
+    napi_create_double(env, swapWaitMs, &value);
+    napi_set_named_property(env, result, "swapWaitMs", value);
+}
+
+// Add presentTiming: { source, refreshIntervalMs, msSinceVblank, msUntilVblank,
+// presentedFrames }, the vblank timing as of this call
+static void SetPresentTiming(napi_env env, napi_value result, const present_timing::PresentClock& clock) {
+    present_timing::Snapshot snapshot = clock.snapshot(frame_timing::Clock::now());
+    napi_value timing, value;
+    napi_create_object(env, &timing);
+    napi_create_string_utf8(env, present_timing::kSourceNames[snapshot.source], NAPI_AUTO_LENGTH, &value);
+    napi_set_named_property(env, timing, "source", value);
+    napi_create_double(env, snapshot.refreshMs, &value);
+    napi_set_named_property(env, timing, "refreshIntervalMs", value);
+    napi_create_double(env, snapshot.sinceVblankMs, &value);
+    napi_set_named_property(env, timing, "msSinceVblank", value);
+    napi_create_double(env, snapshot.untilVblankMs, &value);
+    napi_set_named_property(env, timing, "msUntilVblank", value);
+    napi_create_double(env, (double)snapshot.presents, &value);
+    napi_set_named_property(env, timing, "presentedFrames", value);
+    napi_set_named_property(env, result, "presentTiming", timing);
+}
+
+// getOverlayStats(handle) — texture upload statistics and per-stage timing histograms
+static napi_value GetOverlayStats(napi_env env, napi_callback_info info) {
+    size_t argc = 1;
+    napi_value args[1];
+    napi_get_cb_info(env, info, &argc, args, nullptr, nullptr);
+    
+    GLOverlayWindow* window = nullptr;
+    napi_get_value_external(env, args[0], (void**)&window);
+    if (!window) {
+        napi_value result; napi_get_null(env, &result); return result;
+    }
+    
+    frame_timing::StageSummary upload = window->timings.stages[frame_timing::kStageUpload].summary();
+    
+    napi_value result, value;
+    napi_create_object(env, &result);
+    
+    napi_create_string_utf8(env, window->useCompressedTextures ? "bc3" : "direct", NAPI_AUTO_LENGTH, &value);
+    napi_set_named_property(env, result, "uploadPath", value);
+    
+    napi_create_double(env, (double)upload.count, &value);
+    napi_set_named_property(env, result, "uploadedFrames", value);
+    
+    napi_create_double(env, upload.last, &value);
+    napi_set_named_property(env, result, "lastUploadMs", value);
+    
+    napi_create_double(env, (double)window->lastUploadBytes, &value);
+    napi_set_named_property(env, result, "lastUploadBytes", value);
+    
+    napi_create_double(env, (double)window->skippedFrames, &value);
+    napi_set_named_property(env, result, "skippedFrames", value);
+    
+    napi_create_double(env, (double)window->droppedFrames, &value);
+    napi_set_named_property(env, result, "droppedFrames", value);
+    
+    napi_get_boolean(env, window->useRenderThread, &value);
+    napi_set_named_property(env, result, "renderThread", value);
+    
+    napi_create_string_utf8(env, window->useShaderRenderer ? "shader" : "legacy", NAPI_AUTO_LENGTH, &value);
+    napi_set_named_property(env, result, "renderer", value);
+    
+    napi_create_double(env, upload.average, &value);
+    napi_set_named_property(env, result, "averageUploadMs", value);
+    
+    SetTimingStats(env, result, window->timings);
+    SetPresentTiming(env, result, window->presentClock);
+    
+    return result;
 }
 
 static napi_value DestroyOverlayWindow(napi_env env, napi_callback_info info) {
@@ -469,12 +1652,17 @@ static napi_value SetDebugMode(napi_env env, napi_callback_info info) {
 static napi_value Init(napi_env env, napi_value exports) {
     napi_property_descriptor desc[] = {
         { "createOverlayWindow", nullptr, CreateOverlayWindow, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "createOverlayWindowAsync", nullptr, CreateOverlayWindowAsync, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "showOverlayWindow", nullptr, ShowOverlayWindow, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "hideOverlayWindow", nullptr, HideOverlayWindow, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "setOverlayFrame", nullptr, SetOverlayWindowFrame, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "renderFrame", nullptr, RenderFrame, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "renderFrameRegions", nullptr, RenderFrameRegions, nullptr, nullptr, nullptr, napi_default, nullptr },
         { "destroyOverlayWindow", nullptr, DestroyOverlayWindow, nullptr, nullptr, nullptr, napi_default, nullptr },
-        { "setDebugMode", nullptr, SetDebugMode, nullptr, nullptr, nullptr, napi_default, nullptr }
+        { "setDebugMode", nullptr, SetDebugMode, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "createSharedFrameBuffer", nullptr, CreateSharedFrameBuffer, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "importSharedTexture", nullptr, ImportSharedTexture, nullptr, nullptr, nullptr, napi_default, nullptr },
+        { "getOverlayStats", nullptr, GetOverlayStats, nullptr, nullptr, nullptr, napi_default, nullptr }
     };
     
     napi_define_properties(env, exports, sizeof(desc) / sizeof(desc[0]), desc);
@@ -1,7 +1,9 @@
 import * as path from 'path';
-import { SteamInitOptions, SteamStatus } from '../types';
+import { performance } from 'perf_hooks';
+import { CallbackPumpOptions, SteamInitOptions, SteamStartupTimings, SteamStatus } from '../types';
 import { SteamLibraryLoader } from './SteamLibraryLoader';
 import { SteamLogger } from './SteamLogger';
+import { SteamCallbackPump } from './SteamCallbackPump';
 
 /**
  * SteamAPICore
@@ -65,6 +67,12 @@ export class SteamAPICore {
   /** Pointer to the ISteamMatchmaking interface */
   private matchmakingInterface: any = null;
 
+  /** Native manual-dispatch pump (opt-in, idle until started) */
+  private callbackPump: SteamCallbackPump;
+
+  /** Duration of the last SteamAPI_Init() call, in milliseconds */
+  private steamApiInitMs: number = 0;
+
   /**
    * Creates a new SteamAPICore instance
    * 
@@ -72,6 +80,7 @@ export class SteamAPICore {
    */
   constructor(libraryLoader: SteamLibraryLoader) {
     this.libraryLoader = libraryLoader;
+    this.callbackPump = new SteamCallbackPump(libraryLoader);
   }
 
   /**
@@ -189,7 +198,9 @@ export class SteamAPICore {
       SteamLogger.debug('[Steamworks] Initializing Steam API...');
       
       // Initialize Steam API
+      const initStart = performance.now();
       const initResult = this.libraryLoader.SteamAPI_Init();
+      this.steamApiInitMs = performance.now() - initStart;
       
       if (!initResult) {
         throw new Error('SteamAPI_Init() failed. Make sure Steam client is running and you\'re logged in.');
@@ -260,6 +271,10 @@ export class SteamAPICore {
       this.initialized = true;
       SteamLogger.debug('[Steamworks] Steam API initialized successfully!');
       SteamLogger.debug(`[Steamworks] Connected to Steam for App ID: ${this.appId}`);
+
+      if (options.reportStartupTiming) {
+        this.logStartupTimings();
+      }
       
       return true;
 
@@ -298,6 +313,7 @@ export class SteamAPICore {
   shutdown(): void {
     if (this.libraryLoader.isLoaded() && this.initialized) {
       SteamLogger.debug('[Steamworks] Shutting down Steam API...');
+      this.callbackPump.stop();
       this.libraryLoader.SteamAPI_Shutdown();
       this.initialized = false;
       this.userStatsInterface = null;
@@ -374,6 +390,10 @@ export class SteamAPICore {
    * - `SteamAPI_RunCallbacks()` - Process all pending Steam callbacks
    */
   runCallbacks(): void {
+    // The native pump owns dispatch; SteamAPI_RunCallbacks is invalid in manual-dispatch mode
+    if (this.callbackPump.isRunning()) {
+      return;
+    }
     if (this.initialized && this.libraryLoader.isLoaded()) {
       try {
         this.libraryLoader.SteamAPI_RunCallbacks();
@@ -383,6 +403,68 @@ export class SteamAPICore {
     }
   }
 
+  /**
+   * Deliver Steam callbacks from a native thread instead of runCallbacks()
+   * 
+   * Switches Steam to manual dispatch and runs it, plus
+   * ISteamNetworkingSockets::RunCallbacks, on a dedicated native thread. Callback
+   * payloads are queued natively and handed to JS in batches, so callbacks
+   * (e.g. connection status changes) are collected even while the main thread is
+   * busy. Once started, runCallbacks() is a no-op.
+   * 
+   * @param options - Pump interval and whether to pump networking callbacks
+   * @returns true if the pump is running; false if the native addon isn't
+   *          available, in which case keep calling runCallbacks()
+   * 
+   * @remarks
+   * - Call after init(); manual dispatch stays on until shutdown
+   * - Requires the steam-native addon (built with the overlay module)
+   * 
+   * Steamworks SDK Functions:
+   * - `SteamAPI_ManualDispatch_Init()` - Enable manual dispatch
+   * - `SteamAPI_ManualDispatch_RunFrame()` - Pump the callback queue
+   * - `SteamAPI_ManualDispatch_GetNextCallback()` / `SteamAPI_ManualDispatch_FreeLastCallback()`
+   * - `SteamAPI_ManualDispatch_GetAPICallResult()` - Fetch completed call results
+   */
+  startCallbackPump(options?: CallbackPumpOptions): boolean {
+    if (!this.initialized) {
+      SteamLogger.warn('[Steamworks] Cannot start callback pump: Steam API not initialized');
+      return false;
+    }
+    return this.callbackPump.start(options);
+  }
+
+  /**
+   * Get how long startup took: library load, SteamAPI_Init() and the function
+   * groups bound so far (interfaces are bound on first use)
+   */
+  getStartupTimings(): SteamStartupTimings {
+    const loader = this.libraryLoader.getStartupTimings();
+    return {
+      libraryLoadMs: loader.libraryLoadMs,
+      steamApiInitMs: this.steamApiInitMs,
+      bindingMs: loader.bindingMs,
+    };
+  }
+
+  private logStartupTimings(): void {
+    const timings = this.getStartupTimings();
+    const groups = Object.entries(timings.bindingMs);
+    const bindingTotal = groups.reduce((sum, [, ms]) => sum + ms, 0);
+    SteamLogger.info(
+      `[Steamworks] Startup timing: library load ${timings.libraryLoadMs.toFixed(2)}ms, ` +
+      `SteamAPI_Init ${timings.steamApiInitMs.toFixed(2)}ms, ` +
+      `bindings ${bindingTotal.toFixed(2)}ms (${groups.map(([group, ms]) => `${group} ${ms.toFixed(2)}ms`).join(', ')})`
+    );
+  }
+
+  /**
+   * Get the native callback pump, for managers that subscribe to pumped callbacks
+   */
+  getCallbackPump(): SteamCallbackPump {
+    return this.callbackPump;
+  }
+
   /**
    * Check if the Steam client is running
    * 
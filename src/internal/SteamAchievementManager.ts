@@ -1,14 +1,16 @@
-import * as koffi from 'koffi';
 import { 
   SteamAchievement, 
   AchievementProgressLimits, 
   UserAchievement, 
   AchievementGlobalStats,
-  AchievementWithIcon 
+  AchievementWithIcon,
+  AchievementState
 } from '../types';
 import { SteamLibraryLoader } from './SteamLibraryLoader';
 import { SteamAPICore } from './SteamAPICore';
 import { SteamLogger } from './SteamLogger';
+import { SteamScratch } from './SteamScratch';
+import { SteamStatsStore } from './SteamStatsStore';
 
 /**
  * SteamAchievementManager
@@ -35,15 +37,24 @@ export class SteamAchievementManager {
   /** Steam API core for initialization and callback management */
   private apiCore: SteamAPICore;
 
+  /** StoreStats write-behind, shared with the stats manager */
+  private statsStore: SteamStatsStore;
+
   /**
    * Creates a new SteamAchievementManager instance
    * 
    * @param libraryLoader - The Steam library loader for FFI calls
    * @param apiCore - The Steam API core for lifecycle management
+   * @param statsStore - StoreStats write-behind shared with the stats manager
    */
-  constructor(libraryLoader: SteamLibraryLoader, apiCore: SteamAPICore) {
+  constructor(
+    libraryLoader: SteamLibraryLoader,
+    apiCore: SteamAPICore,
+    statsStore: SteamStatsStore = new SteamStatsStore(libraryLoader, apiCore)
+  ) {
     this.libraryLoader = libraryLoader;
     this.apiCore = apiCore;
+    this.statsStore = statsStore;
   }
 
   /**
@@ -113,14 +124,14 @@ export class SteamAchievementManager {
           ) || '';
 
           // Check if unlocked and get unlock time
-          const unlockedPtr = koffi.alloc('bool', 1);
-          const unlockTimePtr = koffi.alloc('uint32', 1);
+          const unlockedPtr = SteamScratch.slot(0);
+          const unlockTimePtr = SteamScratch.slot(1);
           const hasAchievement = this.libraryLoader.SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime(
             userStatsInterface, apiName, unlockedPtr, unlockTimePtr
           );
           
-          const unlocked = hasAchievement ? koffi.decode(unlockedPtr, 'bool') : false;
-          const unlockTime = hasAchievement && unlocked ? koffi.decode(unlockTimePtr, 'uint32') : 0;
+          const unlocked = hasAchievement ? SteamScratch.bool(unlockedPtr) : false;
+          const unlockTime = hasAchievement && unlocked ? unlockTimePtr.readUInt32LE(0) : 0;
 
           achievements.push({
             apiName,
@@ -190,13 +201,11 @@ export class SteamAchievementManager {
       const result = this.libraryLoader.SteamAPI_ISteamUserStats_SetAchievement(userStatsInterface, achievementName);
       
       if (result) {
-        // Store stats to commit the achievement to Steam servers
-        const storeResult = this.libraryLoader.SteamAPI_ISteamUserStats_StoreStats(userStatsInterface);
+        // Store now (with any pending stats) so the unlock notification shows;
+        // the store runs callbacks to process the unlock
+        const storeResult = this.statsStore.flush();
         
         if (storeResult) {
-          // Run callbacks to process the achievement unlock
-          this.apiCore.runCallbacks();
-          
           SteamLogger.debug(`[Steamworks] Achievement unlocked successfully: ${achievementName}`);
           return true;
         } else {
@@ -261,13 +270,10 @@ export class SteamAchievementManager {
       const result = this.libraryLoader.SteamAPI_ISteamUserStats_ClearAchievement(userStatsInterface, achievementName);
       
       if (result) {
-        // Store stats to commit the change to Steam servers
-        const storeResult = this.libraryLoader.SteamAPI_ISteamUserStats_StoreStats(userStatsInterface);
+        // Store stats to commit the change to Steam servers (runs callbacks)
+        const storeResult = this.statsStore.flush();
         
         if (storeResult) {
-          // Run callbacks to process the change
-          this.apiCore.runCallbacks();
-          
           console.log(`[Steamworks] Achievement cleared successfully: ${achievementName}`);
           return true;
         } else {
@@ -320,13 +326,13 @@ export class SteamAchievementManager {
     }
 
     try {
-      const unlockedPtr = koffi.alloc('bool', 1);
-      const unlockTimePtr = koffi.alloc('uint32', 1);
+      const unlockedPtr = SteamScratch.slot(0);
+      const unlockTimePtr = SteamScratch.slot(1);
       const hasAchievement = this.libraryLoader.SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime(
         userStatsInterface, achievementName, unlockedPtr, unlockTimePtr
       );
       
-      return hasAchievement ? koffi.decode(unlockedPtr, 'bool') : false;
+      return hasAchievement ? SteamScratch.bool(unlockedPtr) : false;
 
     } catch (error) {
       SteamLogger.error(`[Steamworks] ERROR: Error checking achievement ${achievementName}:`, (error as Error).message);
@@ -334,6 +340,143 @@ export class SteamAchievementManager {
     }
   }
 
+  /**
+   * Get the unlock state of several achievements in a single pass
+   * 
+   * Reads only unlock status and time, without the display attributes that
+   * getAllAchievements() fetches for every achievement, so it suits frequent
+   * checks of a known set of achievements.
+   * 
+   * @param achievementNames - API names of the achievements to check
+   * @returns Promise resolving to states in request order; unknown achievements are left out
+   * 
+   * @example
+   * ```typescript
+   * const states = await achievementManager.getAchievementStates(['ACH_WIN_ONE_GAME', 'ACH_WIN_100_GAMES']);
+   * const remaining = states.filter(s => !s.unlocked).map(s => s.apiName);
+   * ```
+   * 
+   * @remarks
+   * - Returns empty array if Steam API is not initialized
+   * - Unlock time is a Unix timestamp (seconds), 0 while locked
+   * 
+   * Steamworks SDK Functions:
+   * - `SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime()` - Get unlock status and time
+   */
+  async getAchievementStates(achievementNames: string[]): Promise<AchievementState[]> {
+    if (!this.apiCore.isInitialized()) {
+      SteamLogger.warn('[Steamworks] WARNING: Steam API not initialized');
+      return [];
+    }
+
+    const userStatsInterface = this.apiCore.getUserStatsInterface();
+    if (!userStatsInterface) {
+      SteamLogger.warn('[Steamworks] WARNING: UserStats interface not available');
+      return [];
+    }
+
+    try {
+      const states: AchievementState[] = [];
+      const missing: string[] = [];
+
+      for (const apiName of achievementNames) {
+        const unlockedPtr = SteamScratch.slot(0);
+        const unlockTimePtr = SteamScratch.slot(1);
+        const hasAchievement = this.libraryLoader.SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime(
+          userStatsInterface, apiName, unlockedPtr, unlockTimePtr
+        );
+        if (!hasAchievement) {
+          missing.push(apiName);
+          continue;
+        }
+
+        const unlocked = SteamScratch.bool(unlockedPtr);
+        states.push({
+          apiName,
+          unlocked,
+          unlockTime: unlocked ? unlockTimePtr.readUInt32LE(0) : 0
+        });
+      }
+
+      if (missing.length > 0) {
+        SteamLogger.warn(`[Steamworks] WARNING: Unknown achievements: ${missing.join(', ')}`);
+      }
+      return states;
+
+    } catch (error) {
+      SteamLogger.error('[Steamworks] ERROR: Failed to get achievement states:', (error as Error).message);
+      return [];
+    }
+  }
+
+  /**
+   * Unlock several achievements with a single store
+   * 
+   * Sets every achievement, then calls StoreStats() once for all of them
+   * (and any pending stats) instead of once per unlockAchievement() call.
+   * 
+   * @param achievementNames - API names of the achievements to unlock
+   * @returns Promise resolving to true if every achievement was set and stored
+   * 
+   * @example
+   * ```typescript
+   * await achievementManager.unlockAchievements(['ACH_FINISH_ACT_1', 'ACH_NO_DAMAGE']);
+   * ```
+   * 
+   * @remarks
+   * - Achievements that were set are stored even if others failed
+   * - Steam overlay shows a notification for each newly unlocked achievement
+   * 
+   * Steamworks SDK Functions:
+   * - `SteamAPI_ISteamUserStats_SetAchievement()` - Mark achievement as unlocked
+   * - `SteamAPI_ISteamUserStats_StoreStats()` - Store achievements to Steam servers
+   * - `SteamAPI_RunCallbacks()` - Process unlock notifications
+   */
+  async unlockAchievements(achievementNames: string[]): Promise<boolean> {
+    if (!this.apiCore.isInitialized()) {
+      SteamLogger.warn('[Steamworks] WARNING: Steam API not initialized');
+      return false;
+    }
+
+    const userStatsInterface = this.apiCore.getUserStatsInterface();
+    if (!userStatsInterface) {
+      SteamLogger.warn('[Steamworks] WARNING: UserStats interface not available');
+      return false;
+    }
+
+    try {
+      const failed: string[] = [];
+      let unlocked = 0;
+
+      for (const apiName of achievementNames) {
+        if (this.libraryLoader.SteamAPI_ISteamUserStats_SetAchievement(userStatsInterface, apiName)) {
+          unlocked++;
+        } else {
+          failed.push(apiName);
+        }
+      }
+
+      if (failed.length > 0) {
+        SteamLogger.error(`[Steamworks] ERROR: Failed to set achievements: ${failed.join(', ')}`);
+      }
+      if (unlocked === 0) {
+        return false;
+      }
+
+      if (!this.statsStore.flush()) {
+        SteamLogger.error(`[Steamworks] ERROR: Failed to store stats for ${unlocked} achievement(s)`);
+        return false;
+      }
+
+      SteamLogger.debug(`[Steamworks] Unlocked ${unlocked} achievement(s)`);
+      return failed.length === 0;
+
+    } catch (error) {
+      SteamLogger.error('[Steamworks] ERROR: Error unlocking achievements:', (error as Error).message);
+      return false;
+    }
+  }
+
   /**
    * Get a specific achievement by its API name
    * 
@@ -588,8 +731,8 @@ export class SteamAchievementManager {
     }
 
     try {
-      const minPtr = koffi.alloc('int32', 1);
-      const maxPtr = koffi.alloc('int32', 1);
+      const minPtr = SteamScratch.slot(0);
+      const maxPtr = SteamScratch.slot(1);
       
       const result = this.libraryLoader.SteamAPI_ISteamUserStats_GetAchievementProgressLimitsInt32(
         userStatsInterface,
@@ -600,8 +743,8 @@ export class SteamAchievementManager {
       
       if (result) {
         return {
-          minProgress: koffi.decode(minPtr, 'int32'),
-          maxProgress: koffi.decode(maxPtr, 'int32')
+          minProgress: minPtr.readInt32LE(0),
+          maxProgress: maxPtr.readInt32LE(0)
         };
       }
       
@@ -651,8 +794,8 @@ export class SteamAchievementManager {
     }
 
     try {
-      const minPtr = koffi.alloc('float', 1);
-      const maxPtr = koffi.alloc('float', 1);
+      const minPtr = SteamScratch.slot(0);
+      const maxPtr = SteamScratch.slot(1);
       
       const result = this.libraryLoader.SteamAPI_ISteamUserStats_GetAchievementProgressLimitsFloat(
         userStatsInterface,
@@ -663,8 +806,8 @@ export class SteamAchievementManager {
       
       if (result) {
         return {
-          minProgress: koffi.decode(minPtr, 'float'),
-          maxProgress: koffi.decode(maxPtr, 'float')
+          minProgress: minPtr.readFloatLE(0),
+          maxProgress: maxPtr.readFloatLE(0)
         };
       }
       
@@ -794,8 +937,8 @@ export class SteamAchievementManager {
 
     try {
       const steamIdNum = BigInt(steamId);
-      const unlockedPtr = koffi.alloc('bool', 1);
-      const unlockTimePtr = koffi.alloc('uint32', 1);
+      const unlockedPtr = SteamScratch.slot(0);
+      const unlockTimePtr = SteamScratch.slot(1);
       
       const result = this.libraryLoader.SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime(
         userStatsInterface,
@@ -815,8 +958,8 @@ export class SteamAchievementManager {
           userStatsInterface, achievementName, 'desc'
         ) || '';
         
-        const unlocked = koffi.decode(unlockedPtr, 'bool');
-        const unlockTime = unlocked ? koffi.decode(unlockTimePtr, 'uint32') : 0;
+        const unlocked = SteamScratch.bool(unlockedPtr);
+        const unlockTime = unlocked ? unlockTimePtr.readUInt32LE(0) : 0;
         
         return {
           steamId,
@@ -941,7 +1084,7 @@ export class SteamAchievementManager {
     }
 
     try {
-      const percentPtr = koffi.alloc('float', 1);
+      const percentPtr = SteamScratch.slot();
       
       const result = this.libraryLoader.SteamAPI_ISteamUserStats_GetAchievementAchievedPercent(
         userStatsInterface,
@@ -950,7 +1093,7 @@ export class SteamAchievementManager {
       );
       
       if (result) {
-        const percent = koffi.decode(percentPtr, 'float');
+        const percent = percentPtr.readFloatLE(0);
         console.log(`[Steamworks] Achievement ${achievementName} global unlock: ${percent.toFixed(2)}%`);
         return percent;
       }
@@ -1059,9 +1202,9 @@ export class SteamAchievementManager {
     }
 
     try {
-      const nameBuffer = Buffer.alloc(256);
-      const percentPtr = koffi.alloc('float', 1);
-      const unlockedPtr = koffi.alloc('bool', 1);
+      const nameBuffer = SteamScratch.bytes(256);
+      const percentPtr = SteamScratch.slot(0);
+      const unlockedPtr = SteamScratch.slot(1);
       
       const iterator = this.libraryLoader.SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo(
         userStatsInterface,
@@ -1073,8 +1216,8 @@ export class SteamAchievementManager {
       
       if (iterator !== -1) {
         const apiName = nameBuffer.toString('utf8').split('\0')[0];
-        const percent = koffi.decode(percentPtr, 'float');
-        const unlocked = koffi.decode(unlockedPtr, 'bool');
+        const percent = percentPtr.readFloatLE(0);
+        const unlocked = SteamScratch.bool(unlockedPtr);
         
         return { apiName, percent, unlocked, iterator };
       }
@@ -1143,9 +1286,9 @@ export class SteamAchievementManager {
     }
 
     try {
-      const nameBuffer = Buffer.alloc(256);
-      const percentPtr = koffi.alloc('float', 1);
-      const unlockedPtr = koffi.alloc('bool', 1);
+      const nameBuffer = SteamScratch.bytes(256);
+      const percentPtr = SteamScratch.slot(0);
+      const unlockedPtr = SteamScratch.slot(1);
       
       const iterator = this.libraryLoader.SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo(
         userStatsInterface,
@@ -1158,8 +1301,8 @@ export class SteamAchievementManager {
       
       if (iterator !== -1) {
         const apiName = nameBuffer.toString('utf8').split('\0')[0];
-        const percent = koffi.decode(percentPtr, 'float');
-        const unlocked = koffi.decode(unlockedPtr, 'bool');
+        const percent = percentPtr.readFloatLE(0);
+        const unlocked = SteamScratch.bool(unlockedPtr);
         
         return { apiName, percent, unlocked, iterator };
       }
@@ -1328,11 +1471,10 @@ export class SteamAchievementManager {
       );
       
       if (result) {
-        // Store the reset
-        const storeResult = this.libraryLoader.SteamAPI_ISteamUserStats_StoreStats(userStatsInterface);
+        // Store the reset (runs callbacks)
+        const storeResult = this.statsStore.flush();
         
         if (storeResult) {
-          this.apiCore.runCallbacks();
           console.log(`[Steamworks] All stats reset successfully`);
           return true;
         } else {
@@ -17,6 +17,7 @@ import * as koffi from 'koffi';
 import { SteamLibraryLoader } from './SteamLibraryLoader';
 import { SteamAPICore } from './SteamAPICore';
 import { SteamLogger } from './SteamLogger';
+import { SteamScratch } from './SteamScratch';
 import type {
   AppId,
   DepotId,
@@ -346,9 +347,9 @@ export class SteamAppsManager {
       const apps = this.getSteamApps();
       if (!apps) return null;
 
-      const appIdOut = koffi.alloc('uint32', 1);
-      const availableOut = koffi.alloc('bool', 1);
-      const nameBuffer = Buffer.alloc(256);
+      const appIdOut = SteamScratch.slot(0);
+      const availableOut = SteamScratch.slot(1);
+      const nameBuffer = SteamScratch.bytes(256);
 
       const success = this.libraryLoader.SteamAPI_ISteamApps_BGetDLCDataByIndex(
         apps,
@@ -362,8 +363,8 @@ export class SteamAppsManager {
       if (!success) return null;
 
       return {
-        appId: koffi.decode(appIdOut, 'uint32'),
-        available: koffi.decode(availableOut, 'bool'),
+        appId: appIdOut.readUInt32LE(0),
+        available: SteamScratch.bool(availableOut),
         name: nameBuffer.toString('utf8').replace(/\0/g, '').trim()
       };
     } catch (error) {
@@ -473,8 +474,8 @@ export class SteamAppsManager {
       const apps = this.getSteamApps();
       if (!apps) return null;
 
-      const bytesDownloaded = koffi.alloc('uint64', 1);
-      const bytesTotal = koffi.alloc('uint64', 1);
+      const bytesDownloaded = SteamScratch.slot(0);
+      const bytesTotal = SteamScratch.slot(1);
 
       const downloading = this.libraryLoader.SteamAPI_ISteamApps_GetDlcDownloadProgress(
         apps,
@@ -485,8 +486,8 @@ export class SteamAppsManager {
 
       if (!downloading) return null;
 
-      const downloaded = BigInt(koffi.decode(bytesDownloaded, 'uint64'));
-      const total = BigInt(koffi.decode(bytesTotal, 'uint64'));
+      const downloaded = bytesDownloaded.readBigUInt64LE(0);
+      const total = bytesTotal.readBigUInt64LE(0);
       const percent = total > BigInt(0) 
         ? Number((downloaded * BigInt(100)) / total) 
         : 0;
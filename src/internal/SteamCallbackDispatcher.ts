@@ -0,0 +1,301 @@
+import * as koffi from 'koffi';
+import { SteamLibraryLoader } from './SteamLibraryLoader';
+import { SteamAPICore } from './SteamAPICore';
+import { SteamLogger } from './SteamLogger';
+import { SteamCallbackPump } from './SteamCallbackPump';
+
+/** Interval between dispatcher ticks while calls are outstanding, in milliseconds */
+const DISPATCH_TICK_MS = 16;
+
+/** How long a pumped call result nobody is waiting for yet is kept, in milliseconds */
+const UNCLAIMED_RESULT_TTL_MS = 30000;
+
+/** Most unclaimed call results kept at once; the oldest is dropped beyond this */
+const MAX_UNCLAIMED_RESULTS = 64;
+
+/**
+ * An outstanding SteamAPICall_t waiting for its result
+ */
+interface PendingCall {
+  resultStruct: any;
+  callbackId: number;
+  deadline: number;
+  timeoutMs: number;
+  /** Receives the filled result buffer, or null on failure/timeout */
+  complete: (result: any | null) => void;
+}
+
+/**
+ * A call result the native pump delivered before anyone waited for its handle
+ */
+interface UnclaimedResult {
+  callbackId: number;
+  ioFailure: boolean;
+  data: Buffer;
+  expiresAt: number;
+}
+
+/**
+ * SteamCallbackDispatcher
+ *
+ * Single pump for every async Steam API call in flight. Instead of each call
+ * running its own sleep-and-check loop, pending calls are kept in a map keyed
+ * by SteamAPICall_t handle and one timer ticks every frame (~16ms) while the
+ * map is non-empty: it runs the Steam callbacks once, checks each handle, and
+ * resolves the ones that completed. Completion latency is one tick and there is
+ * only ever one timer, however many calls are outstanding.
+ *
+ * When the native callback pump is running, completions arrive as pumped call
+ * results instead and the tick only enforces timeouts. Manual dispatch delivers
+ * each result once, so a result that arrives before its waitForResult() (the
+ * caller awaited something in between) is held for a while and claimed there.
+ *
+ * One dispatcher exists per SteamAPICore; managers share it through
+ * {@link SteamCallbackDispatcher.get}.
+ */
+export class SteamCallbackDispatcher {
+  private static instances = new WeakMap<SteamAPICore, SteamCallbackDispatcher>();
+
+  private libraryLoader: SteamLibraryLoader;
+  private apiCore: SteamAPICore;
+  private pending: Map<bigint, PendingCall[]> = new Map();
+  /** Pumped call results that arrived before their waiter, in arrival order */
+  private unclaimed: Map<bigint, UnclaimedResult> = new Map();
+  private timer: ReturnType<typeof setTimeout> | null = null;
+  // Reused out-params for IsAPICallCompleted/GetAPICallResult
+  private failedOut = koffi.alloc('bool', 1);
+
+  private constructor(libraryLoader: SteamLibraryLoader, apiCore: SteamAPICore) {
+    this.libraryLoader = libraryLoader;
+    this.apiCore = apiCore;
+    apiCore.getCallbackPump().onCallResult((callHandle, callbackId, ioFailure, data) =>
+      this.completeFromPump(callHandle, callbackId, ioFailure, data)
+    );
+  }
+
+  /**
+   * Get the shared dispatcher for a SteamAPICore, creating it on first use
+   */
+  static get(libraryLoader: SteamLibraryLoader, apiCore: SteamAPICore): SteamCallbackDispatcher {
+    let dispatcher = SteamCallbackDispatcher.instances.get(apiCore);
+    if (!dispatcher) {
+      dispatcher = new SteamCallbackDispatcher(libraryLoader, apiCore);
+      SteamCallbackDispatcher.instances.set(apiCore, dispatcher);
+    }
+    return dispatcher;
+  }
+
+  /**
+   * Number of calls currently waiting for a result
+   */
+  getPendingCount(): number {
+    let count = 0;
+    for (const calls of this.pending.values()) count += calls.length;
+    return count;
+  }
+
+  /**
+   * Wait for an async call's result
+   *
+   * @param callHandle - SteamAPICall_t from the async operation
+   * @param resultStruct - Koffi struct type for the result
+   * @param callbackId - The callback ID for this result type
+   * @param timeoutMs - Give up after this long
+   * @returns Koffi-allocated buffer holding the result struct, or null on failure/timeout
+   */
+  waitForResult(callHandle: bigint, resultStruct: any, callbackId: number, timeoutMs: number): Promise<any | null> {
+    if (callHandle === 0n) {
+      return Promise.resolve(null);
+    }
+
+    const delivered = this.claimUnclaimed(callHandle);
+    if (delivered) {
+      return Promise.resolve(
+        this.decodePumpedResult(delivered.callbackId, delivered.ioFailure, delivered.data, resultStruct, callbackId)
+      );
+    }
+
+    return new Promise(resolve => {
+      const call: PendingCall = {
+        resultStruct,
+        callbackId,
+        deadline: Date.now() + timeoutMs,
+        timeoutMs,
+        complete: resolve,
+      };
+      const calls = this.pending.get(callHandle);
+      if (calls) {
+        calls.push(call);
+      } else {
+        this.pending.set(callHandle, [call]);
+      }
+      this.schedule();
+    });
+  }
+
+  private schedule(): void {
+    if (this.timer === null && this.pending.size > 0) {
+      this.timer = setTimeout(() => {
+        this.timer = null;
+        this.tick();
+        this.schedule();
+      }, DISPATCH_TICK_MS);
+    }
+  }
+
+  /**
+   * Run callbacks once and resolve every pending call that completed
+   */
+  private tick(): void {
+    if (this.apiCore.getCallbackPump().isRunning()) {
+      this.expire(Date.now());
+      return;
+    }
+
+    const utilsInterface = this.apiCore.getUtilsInterface();
+    if (!utilsInterface) {
+      SteamLogger.error('[Steamworks] Utils interface not available');
+      this.failAll();
+      return;
+    }
+
+    this.apiCore.runCallbacks();
+
+    const now = Date.now();
+    for (const [callHandle, calls] of this.pending) {
+      const isCompleted = this.libraryLoader.SteamAPI_ISteamUtils_IsAPICallCompleted(
+        utilsInterface,
+        callHandle,
+        this.failedOut
+      );
+
+      if (isCompleted) {
+        // A result can only be fetched once; waiters on the same handle share it
+        this.pending.delete(callHandle);
+        const result = this.fetchResult(utilsInterface, callHandle, calls[0]);
+        for (const call of calls) {
+          call.complete(result);
+        }
+        continue;
+      }
+
+      this.expireCalls(callHandle, calls, now);
+    }
+  }
+
+  /**
+   * Time out every pending call past its deadline
+   */
+  private expire(now: number): void {
+    for (const [callHandle, calls] of this.pending) {
+      this.expireCalls(callHandle, calls, now);
+    }
+  }
+
+  private expireCalls(callHandle: bigint, calls: PendingCall[], now: number): void {
+    const remaining = calls.filter(call => {
+      if (now < call.deadline) return true;
+      SteamLogger.warn(`[Steamworks] API call timed out after ${call.timeoutMs}ms`);
+      call.complete(null);
+      return false;
+    });
+    if (remaining.length === 0) {
+      this.pending.delete(callHandle);
+    } else if (remaining.length !== calls.length) {
+      this.pending.set(callHandle, remaining);
+    }
+  }
+
+  /**
+   * Resolve waiters from a call result delivered by the native pump
+   */
+  private completeFromPump(callHandle: bigint, callbackId: number, ioFailure: boolean, data: Buffer): void {
+    const calls = this.pending.get(callHandle);
+    if (!calls) {
+      this.holdUnclaimed(callHandle, { callbackId, ioFailure, data, expiresAt: Date.now() + UNCLAIMED_RESULT_TTL_MS });
+      return;
+    }
+    this.pending.delete(callHandle);
+
+    const call = calls[0];
+    const result = this.decodePumpedResult(callbackId, ioFailure, data, call.resultStruct, call.callbackId);
+    for (const waiter of calls) {
+      waiter.complete(result);
+    }
+  }
+
+  /**
+   * Convert a pumped call result into the koffi result struct, or null on failure
+   */
+  private decodePumpedResult(
+    deliveredId: number,
+    ioFailure: boolean,
+    data: Buffer,
+    resultStruct: any,
+    callbackId: number
+  ): any | null {
+    if (ioFailure || deliveredId !== callbackId) {
+      SteamLogger.error(`[Steamworks] API call failed. Callback ID: ${callbackId}, delivered: ${deliveredId}, IO failure: ${ioFailure}`);
+      return null;
+    }
+    return SteamCallbackPump.toNative(data, resultStruct);
+  }
+
+  /**
+   * Keep a result nobody waits for yet, dropping expired and excess entries
+   */
+  private holdUnclaimed(callHandle: bigint, result: UnclaimedResult): void {
+    const now = Date.now();
+    for (const [handle, held] of this.unclaimed) {
+      if (held.expiresAt <= now) this.unclaimed.delete(handle);
+    }
+    this.unclaimed.delete(callHandle);
+    this.unclaimed.set(callHandle, result);
+    while (this.unclaimed.size > MAX_UNCLAIMED_RESULTS) {
+      const oldest = this.unclaimed.keys().next().value as bigint;
+      this.unclaimed.delete(oldest);
+    }
+  }
+
+  /**
+   * Take the held result for a handle, if one arrived and hasn't expired
+   */
+  private claimUnclaimed(callHandle: bigint): UnclaimedResult | null {
+    const held = this.unclaimed.get(callHandle);
+    if (!held) return null;
+    this.unclaimed.delete(callHandle);
+    return held.expiresAt > Date.now() ? held : null;
+  }
+
+  private fetchResult(utilsInterface: any, callHandle: bigint, call: PendingCall): any | null {
+    const result = koffi.alloc(call.resultStruct, 1);
+
+    const success = this.libraryLoader.SteamAPI_ISteamUtils_GetAPICallResult(
+      utilsInterface,
+      callHandle,
+      result,
+      koffi.sizeof(call.resultStruct),
+      call.callbackId,
+      this.failedOut
+    );
+
+    if (success && !koffi.decode(this.failedOut, 'bool')) {
+      return result;
+    }
+
+    const failureReason = this.libraryLoader.SteamAPI_ISteamUtils_GetAPICallFailureReason(
+      utilsInterface,
+      callHandle
+    );
+    SteamLogger.error(`[Steamworks] API call failed. Callback ID: ${call.callbackId}, Struct size: ${koffi.sizeof(call.resultStruct)}, Reason: ${failureReason}`);
+    return null;
+  }
+
+  private failAll(): void {
+    const pending = this.pending;
+    this.pending = new Map();
+    for (const calls of pending.values()) {
+      for (const call of calls) call.complete(null);
+    }
+  }
+}
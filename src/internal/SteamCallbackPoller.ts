@@ -1,6 +1,7 @@
 import * as koffi from 'koffi';
 import { SteamLibraryLoader } from './SteamLibraryLoader';
 import { SteamAPICore } from './SteamAPICore';
+import { SteamCallbackDispatcher } from './SteamCallbackDispatcher';
 import {
   K_I_CREATE_ITEM_RESULT,
   K_I_SUBMIT_ITEM_UPDATE_RESULT,
@@ -41,7 +42,8 @@ import {
  * 
  * How it works:
  * 1. Steam async operation returns a SteamAPICall_t handle
- * 2. Poll ISteamUtils::IsAPICallCompleted() to check completion
+ * 2. The handle is queued on the shared SteamCallbackDispatcher, which checks
+ *    ISteamUtils::IsAPICallCompleted() for every pending call once per tick
  * 3. Call ISteamUtils::GetAPICallResult() to retrieve result struct
  * 4. Decode Koffi struct and return typed result
  * 
@@ -60,23 +62,26 @@ import {
 export class SteamCallbackPoller {
   private libraryLoader: SteamLibraryLoader;
   private apiCore: SteamAPICore;
+  private dispatcher: SteamCallbackDispatcher;
 
   constructor(libraryLoader: SteamLibraryLoader, apiCore: SteamAPICore) {
     this.libraryLoader = libraryLoader;
     this.apiCore = apiCore;
+    this.dispatcher = SteamCallbackDispatcher.get(libraryLoader, apiCore);
   }
 
   /**
    * Poll for API call completion and retrieve result
    * 
-   * Polls Steam API to check if an async call has completed, then retrieves
-   * the result struct using ISteamUtils functions.
+   * Waits on the shared dispatcher for an async call to complete, then decodes
+   * the result struct retrieved with ISteamUtils functions. Completion is seen
+   * on the next dispatcher tick (~16ms) rather than after a fixed sleep.
    * 
    * @param callHandle - The SteamAPICall_t handle from the async operation
    * @param resultStruct - Koffi struct type for the result
    * @param callbackId - The callback ID for this result type
-   * @param maxRetries - Maximum number of polling attempts (default: 50)
-   * @param delayMs - Delay between polling attempts in ms (default: 100)
+   * @param maxRetries - Timeout, together with delayMs, as maxRetries * delayMs (default: 50)
+   * @param delayMs - Timeout unit in ms (default: 100)
    * @returns The decoded result struct, or null if failed/timeout
    * 
    * @example
@@ -94,7 +99,7 @@ export class SteamCallbackPoller {
    * 
    * @remarks
    * - Default timeout: 5 seconds (50 retries * 100ms)
-   * - Automatically calls runCallbacks() during polling
+   * - The dispatcher calls runCallbacks() once per tick while calls are pending
    * - Returns null on timeout or failure
    * - Logs failure reason using GetAPICallFailureReason()
    */
@@ -105,55 +110,18 @@ export class SteamCallbackPoller {
     maxRetries: number = 50,
     delayMs: number = 100
   ): Promise<T | null> {
-    const utilsInterface = this.apiCore.getUtilsInterface();
-    if (!utilsInterface) {
-      console.error('[Steamworks] Utils interface not available');
+    const result = await this.dispatcher.waitForResult(
+      callHandle,
+      resultStruct,
+      callbackId,
+      maxRetries * delayMs
+    );
+    if (!result) {
       return null;
     }
 
-    // Poll for completion
-    for (let i = 0; i < maxRetries; i++) {
-      await new Promise(resolve => setTimeout(resolve, delayMs));
-      this.apiCore.runCallbacks();
-
-      const failed = koffi.alloc('bool', 1);
-      const isCompleted = this.libraryLoader.SteamAPI_ISteamUtils_IsAPICallCompleted(
-        utilsInterface,
-        callHandle,
-        failed
-      );
-
-      if (isCompleted) {
-        // Get the result
-        const result = koffi.alloc(resultStruct, 1);
-        const failedResult = koffi.alloc('bool', 1);
-        
-        const success = this.libraryLoader.SteamAPI_ISteamUtils_GetAPICallResult(
-          utilsInterface,
-          callHandle,
-          result,
-          koffi.sizeof(resultStruct),
-          callbackId,
-          failedResult
-        );
-
-        if (success && !koffi.decode(failedResult, 'bool')) {
-          // Use custom parsing for packed structs, otherwise use standard Koffi decoding
-          const decoded = this.decodeCallbackResult<T>(callbackId, result, resultStruct);
-          return decoded;
-        } else {
-          const failureReason = this.libraryLoader.SteamAPI_ISteamUtils_GetAPICallFailureReason(
-            utilsInterface,
-            callHandle
-          );
-          console.error(`[Steamworks] API call failed. Callback ID: ${callbackId}, Struct size: ${koffi.sizeof(resultStruct)}, Reason: ${failureReason}`);
-          return null;
-        }
-      }
-    }
-
-    console.warn(`[Steamworks] API call timed out after ${maxRetries * delayMs}ms`);
-    return null;
+    // Use custom parsing for packed structs, otherwise use standard Koffi decoding
+    return this.decodeCallbackResult<T>(callbackId, result, resultStruct);
   }
 
   /**
@@ -214,7 +182,7 @@ export class SteamCallbackPoller {
    * @returns Parsed CreateItemResult_t object
    */
   private parseCreateItemResult(result: any): CreateItemResultType {
-    const rawBytes = koffi.decode(result, koffi.array('uint8', 24));
+    const rawBytes = koffi.decode(result, SteamCallbackPoller.byteArray(24));
     const buffer = Buffer.from(rawBytes);
     
     // Detect platform and parse accordingly
@@ -245,7 +213,7 @@ export class SteamCallbackPoller {
    * @returns Parsed SubmitItemUpdateResult_t object
    */
   private parseSubmitItemUpdateResult(result: any): SubmitItemUpdateResultType {
-    const rawBytes = koffi.decode(result, koffi.array('uint8', 16));
+    const rawBytes = koffi.decode(result, SteamCallbackPoller.byteArray(16));
     const buffer = Buffer.from(rawBytes);
     
     return {
@@ -265,7 +233,7 @@ export class SteamCallbackPoller {
    * @returns Parsed RemoteStorageSubscribePublishedFileResult_t object
    */
   private parseSubscribeResult(result: any): RemoteStorageSubscribePublishedFileResultType {
-    const rawBytes = koffi.decode(result, koffi.array('uint8', 12));
+    const rawBytes = koffi.decode(result, SteamCallbackPoller.byteArray(12));
     const buffer = Buffer.from(rawBytes);
     
     return {
@@ -284,7 +252,7 @@ export class SteamCallbackPoller {
    * @returns Parsed RemoteStorageUnsubscribePublishedFileResult_t object
    */
   private parseUnsubscribeResult(result: any): RemoteStorageUnsubscribePublishedFileResultType {
-    const rawBytes = koffi.decode(result, koffi.array('uint8', 12));
+    const rawBytes = koffi.decode(result, SteamCallbackPoller.byteArray(12));
     const buffer = Buffer.from(rawBytes);
     
     return {
@@ -303,7 +271,7 @@ export class SteamCallbackPoller {
    * @returns Parsed SetUserItemVoteResult_t object
    */
   private parseSetUserItemVoteResult(result: any): SetUserItemVoteResultType {
-    const rawBytes = koffi.decode(result, koffi.array('uint8', 13));
+    const rawBytes = koffi.decode(result, SteamCallbackPoller.byteArray(13));
     const buffer = Buffer.from(rawBytes);
     
     return {
@@ -323,7 +291,7 @@ export class SteamCallbackPoller {
    * @returns Parsed GetUserItemVoteResult_t object
    */
   private parseGetUserItemVoteResult(result: any): GetUserItemVoteResultType {
-    const rawBytes = koffi.decode(result, koffi.array('uint8', 15));
+    const rawBytes = koffi.decode(result, SteamCallbackPoller.byteArray(15));
     const buffer = Buffer.from(rawBytes);
     
     return {
@@ -346,7 +314,7 @@ export class SteamCallbackPoller {
    * @returns Parsed LobbyCreated_t object
    */
   private parseLobbyCreatedResult(result: any): LobbyCreatedType {
-    const rawBytes = koffi.decode(result, koffi.array('uint8', 16));
+    const rawBytes = koffi.decode(result, SteamCallbackPoller.byteArray(16));
     const buffer = Buffer.from(rawBytes);
     
     if (process.platform === 'win32') {
@@ -374,7 +342,7 @@ export class SteamCallbackPoller {
    * @returns Parsed LobbyEnter_t object
    */
   private parseLobbyEnterResult(result: any): LobbyEnterType {
-    const rawBytes = koffi.decode(result, koffi.array('uint8', 24));
+    const rawBytes = koffi.decode(result, SteamCallbackPoller.byteArray(24));
     const buffer = Buffer.from(rawBytes);
     
     if (process.platform === 'win32') {
@@ -406,7 +374,7 @@ export class SteamCallbackPoller {
    * @returns Parsed LobbyMatchList_t object
    */
   private parseLobbyMatchListResult(result: any): LobbyMatchListType {
-    const rawBytes = koffi.decode(result, koffi.array('uint8', 4));
+    const rawBytes = koffi.decode(result, SteamCallbackPoller.byteArray(4));
     const buffer = Buffer.from(rawBytes);
     
     return {
@@ -454,8 +422,25 @@ export class SteamCallbackPoller {
       const INFO_START = IS_WIN64 ? 8 : 4;
       const TOTAL_SIZE = INFO_START + STEAM_NET_CONNECTION_INFO_SIZE + 4;
       
-      const rawBytes = koffi.decode(infoPtr, koffi.array('uint8', TOTAL_SIZE));
-      const buffer = Buffer.from(rawBytes);
+      const rawBytes = koffi.decode(infoPtr, SteamCallbackPoller.byteArray(TOTAL_SIZE));
+      return SteamCallbackPoller.parseConnectionStatusChangedBuffer(Buffer.from(rawBytes));
+    } catch (error) {
+      console.error('[Steamworks] Error parsing connection status callback:', error);
+      return null;
+    }
+  }
+
+  /**
+   * Parse SteamNetConnectionStatusChangedCallback_t from a copy of the struct,
+   * as delivered by the native callback pump
+   * 
+   * @param buffer - Bytes of the callback struct
+   * @returns Parsed callback data, or null if parsing failed
+   */
+  static parseConnectionStatusChangedBuffer(buffer: Buffer): SteamNetConnectionStatusChangedCallbackType | null {
+    try {
+      const IS_WIN64 = process.platform === 'win32' && process.arch === 'x64';
+      const INFO_START = IS_WIN64 ? 8 : 4;
       
       const connection = buffer.readUInt32LE(0);
       const infoBuffer = buffer.subarray(INFO_START, INFO_START + STEAM_NET_CONNECTION_INFO_SIZE);
@@ -532,6 +517,21 @@ export class SteamCallbackPoller {
     };
   }
 
+  /** uint8[size] koffi types, built once per size instead of on every decode */
+  private static readonly byteArrayTypes = new Map<number, koffi.IKoffiCType>();
+
+  /**
+   * koffi array type for decoding `size` raw bytes
+   */
+  private static byteArray(size: number): koffi.IKoffiCType {
+    let type = SteamCallbackPoller.byteArrayTypes.get(size);
+    if (!type) {
+      type = koffi.array('uint8', size);
+      SteamCallbackPoller.byteArrayTypes.set(size, type);
+    }
+    return type;
+  }
+
   /**
    * Read a null-terminated C string from a buffer
    */
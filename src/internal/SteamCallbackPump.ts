@@ -0,0 +1,177 @@
+import * as koffi from 'koffi';
+import { CallbackPumpOptions, CallbackPumpStats } from '../types';
+import { SteamLibraryLoader } from './SteamLibraryLoader';
+import { SteamLogger } from './SteamLogger';
+import { CallbackPumpEvent, SteamNativeModule, loadSteamNativeAddon } from './SteamNativeAddon';
+
+/** Handler for a broadcast callback; receives a copy of the callback struct */
+export type PumpCallbackHandler = (data: Buffer) => void;
+
+/** Handler for a completed SteamAPICall_t */
+export type PumpCallResultHandler = (callHandle: bigint, callbackId: number, ioFailure: boolean, data: Buffer) => void;
+
+/**
+ * SteamCallbackPump
+ *
+ * Runs Steam callback dispatch on a native thread instead of a JS `setInterval`.
+ * The native addon switches Steam to manual dispatch, runs
+ * `SteamAPI_ManualDispatch_RunFrame` (and `ISteamNetworkingSockets::RunCallbacks`)
+ * on its own thread, and delivers queued callback payloads to JS in batches, so
+ * callbacks keep being collected while the event loop is busy.
+ *
+ * While the pump runs, `SteamAPI_RunCallbacks` must not be called —
+ * SteamAPICore.runCallbacks() becomes a no-op — and managers subscribe here for
+ * the callbacks they need. Manual dispatch can't be switched off again, so the
+ * pump is opt-in and is meant to run until shutdown.
+ */
+export class SteamCallbackPump {
+  private libraryLoader: SteamLibraryLoader;
+  private addon: SteamNativeModule | null = null;
+  private running: boolean = false;
+  private networking: boolean = false;
+  private callbackHandlers: Map<number, Set<PumpCallbackHandler>> = new Map();
+  private callResultHandlers: Set<PumpCallResultHandler> = new Set();
+
+  constructor(libraryLoader: SteamLibraryLoader) {
+    this.libraryLoader = libraryLoader;
+  }
+
+  /**
+   * Start the pump. Call after the Steam API is initialized.
+   *
+   * @returns true if the pump is running, false if the native addon or the
+   *          manual-dispatch exports aren't available
+   */
+  start(options: CallbackPumpOptions = {}): boolean {
+    if (this.running) return true;
+
+    this.addon = loadSteamNativeAddon(this.libraryLoader.getLibraryPath());
+    if (!this.addon) {
+      SteamLogger.warn('[Steamworks] Callback pump unavailable: native addon not loaded');
+      return false;
+    }
+
+    const networking = options.networking !== false;
+    const started = this.addon.startCallbackPump(
+      (events) => this.deliver(events),
+      options.intervalMs ?? 5,
+      networking
+    );
+    if (!started) {
+      SteamLogger.warn('[Steamworks] Callback pump unavailable: Steam library lacks manual dispatch');
+      return false;
+    }
+
+    this.running = true;
+    this.networking = networking;
+    SteamLogger.debug(`[Steamworks] Callback pump started (networking: ${networking})`);
+    return true;
+  }
+
+  /**
+   * Stop the pump thread. Steam stays in manual-dispatch mode; this is meant
+   * for shutdown.
+   */
+  stop(): void {
+    if (!this.running || !this.addon) return;
+    this.addon.stopCallbackPump();
+    this.running = false;
+    SteamLogger.debug('[Steamworks] Callback pump stopped');
+  }
+
+  /**
+   * Whether the pump thread is delivering callbacks
+   */
+  isRunning(): boolean {
+    return this.running;
+  }
+
+  /**
+   * Whether ISteamNetworkingSockets callbacks are run by the pump
+   */
+  isPumpingNetworking(): boolean {
+    return this.running && this.networking;
+  }
+
+  /**
+   * Pump state
+   */
+  getStats(): CallbackPumpStats {
+    if (!this.addon) {
+      return { running: false, droppedEvents: 0 };
+    }
+    return this.addon.getCallbackPumpStats();
+  }
+
+  /**
+   * Subscribe to a broadcast callback by k_iCallback id
+   *
+   * @returns Function that removes the handler
+   */
+  onCallback(callbackId: number, handler: PumpCallbackHandler): () => void {
+    let handlers = this.callbackHandlers.get(callbackId);
+    if (!handlers) {
+      handlers = new Set();
+      this.callbackHandlers.set(callbackId, handlers);
+    }
+    handlers.add(handler);
+    return () => handlers!.delete(handler);
+  }
+
+  /**
+   * Subscribe to every completed SteamAPICall_t
+   *
+   * @returns Function that removes the handler
+   */
+  onCallResult(handler: PumpCallResultHandler): () => void {
+    this.callResultHandlers.add(handler);
+    return () => this.callResultHandlers.delete(handler);
+  }
+
+  /** uint8[size] koffi types, built once per payload size instead of on every delivery */
+  private static readonly byteArrayTypes = new Map<number, koffi.IKoffiCType>();
+
+  /**
+   * Copy a delivered payload into native memory typed as `resultStruct`, for
+   * decoders written against koffi pointers
+   */
+  static toNative(data: Buffer, resultStruct: any): any {
+    const result = koffi.alloc(resultStruct, 1);
+    const length = Math.min(data.length, koffi.sizeof(resultStruct));
+    if (length > 0) {
+      koffi.encode(result, SteamCallbackPump.byteArray(length), data.subarray(0, length));
+    }
+    return result;
+  }
+
+  /**
+   * koffi array type for encoding `size` raw bytes
+   */
+  private static byteArray(size: number): koffi.IKoffiCType {
+    let type = SteamCallbackPump.byteArrayTypes.get(size);
+    if (!type) {
+      type = koffi.array('uint8', size);
+      SteamCallbackPump.byteArrayTypes.set(size, type);
+    }
+    return type;
+  }
+
+  private deliver(events: CallbackPumpEvent[]): void {
+    for (const event of events) {
+      try {
+        if (event.kind === 1) {
+          for (const handler of this.callResultHandlers) {
+            handler(event.callHandle!, event.callbackId, event.ioFailure === true, event.data);
+          }
+        } else {
+          const handlers = this.callbackHandlers.get(event.callbackId);
+          if (handlers) {
+            for (const handler of handlers) handler(event.data);
+          }
+        }
+      } catch (error) {
+        SteamLogger.error(`[Steamworks] Error in pumped callback ${event.callbackId}:`, error);
+      }
+    }
+  }
+}
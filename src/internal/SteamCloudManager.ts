@@ -1,11 +1,14 @@
 import { SteamLibraryLoader } from './SteamLibraryLoader';
 import { SteamAPICore } from './SteamAPICore';
 import { SteamLogger } from './SteamLogger';
+import { SteamCallbackPoller } from './SteamCallbackPoller';
+import { CloudReadStream, CloudWriteStream } from './SteamCloudStreams';
 import {
   CloudFileInfo,
   CloudQuota,
   CloudFileReadResult,
-  CloudBatchWriteResult
+  CloudBatchWriteResult,
+  CloudStreamOptions
 } from '../types';
 
 /**
@@ -16,6 +19,7 @@ import {
  * 
  * Key Features:
  * - File operations (read, write, delete, check existence)
+ * - Streaming reads and writes for large files
  * - Quota management (check available space)
  * - File iteration and metadata retrieval
  * - Automatic synchronization across devices
@@ -68,6 +72,9 @@ export class SteamCloudManager {
   /** Steam API core for initialization and callback management */
   private apiCore: SteamAPICore;
 
+  /** Callback poller for async reads */
+  private callbackPoller: SteamCallbackPoller;
+
   /**
    * Creates a new SteamCloudManager instance
    * 
@@ -77,6 +84,7 @@ export class SteamCloudManager {
   constructor(libraryLoader: SteamLibraryLoader, apiCore: SteamAPICore) {
     this.libraryLoader = libraryLoader;
     this.apiCore = apiCore;
+    this.callbackPoller = new SteamCallbackPoller(libraryLoader, apiCore);
   }
 
   /**
@@ -197,6 +205,81 @@ export class SteamCloudManager {
     }
   }
 
+  /**
+   * Opens a Readable stream over a Steam Cloud file
+   * 
+   * @param filename - The name of the file to read
+   * @param options - Chunk size per FileReadAsync request (default: 1MB)
+   * @returns A Readable that emits the file in chunks
+   * 
+   * @remarks
+   * - Chunks are fetched with `FileReadAsync`, so the event loop keeps running
+   *   while Steam reads the file
+   * - Only chunks the consumer hasn't taken yet are held in memory, instead of
+   *   one Buffer the size of the whole file
+   * - Emits `'error'` if the file doesn't exist or a read fails
+   * 
+   * @example
+   * ```typescript
+   * import { pipeline } from 'stream/promises';
+   * 
+   * await pipeline(
+   *   steam.cloud.createReadStream('world.sav'),
+   *   zlib.createGunzip(),
+   *   fs.createWriteStream('world.local')
+   * );
+   * ```
+   */
+  createReadStream(filename: string, options?: CloudStreamOptions): CloudReadStream {
+    const remoteStorage = this.getInterfaceForStream();
+    return new CloudReadStream(this.libraryLoader, remoteStorage, this.callbackPoller, filename, options);
+  }
+
+  /**
+   * Opens a Writable stream into a Steam Cloud file
+   * 
+   * @param filename - The name of the file to write (will be converted to lowercase)
+   * @param options - Chunk size per FileWriteStreamWriteChunk call (default: 1MB)
+   * @returns A Writable; the file is committed when the stream finishes
+   * 
+   * @remarks
+   * - Built on `FileWriteStreamOpen` / `FileWriteStreamWriteChunk` / `FileWriteStreamClose`
+   * - Small writes are coalesced into one reused chunk buffer; large writes are
+   *   passed to Steam without copying
+   * - Destroying the stream before it finishes calls `FileWriteStreamCancel`,
+   *   leaving the previous version of the file untouched
+   * 
+   * @example
+   * ```typescript
+   * import { pipeline } from 'stream/promises';
+   * 
+   * await pipeline(
+   *   fs.createReadStream('world.local'),
+   *   zlib.createGzip(),
+   *   steam.cloud.createWriteStream('world.sav')
+   * );
+   * ```
+   */
+  createWriteStream(filename: string, options?: CloudStreamOptions): CloudWriteStream {
+    const remoteStorage = this.getInterfaceForStream();
+    return new CloudWriteStream(this.libraryLoader, remoteStorage, filename, options);
+  }
+
+  /**
+   * Get the remote storage interface for a new stream; the stream errors when it's null
+   */
+  private getInterfaceForStream(): any {
+    if (!this.apiCore.isInitialized()) {
+      SteamLogger.error('[Steamworks] Steam API not initialized');
+      return null;
+    }
+    const remoteStorage = this.apiCore.getRemoteStorageInterface();
+    if (!remoteStorage) {
+      SteamLogger.error('[Steamworks] ISteamRemoteStorage interface not available');
+    }
+    return remoteStorage;
+  }
+
   /**
    * Checks if a file exists in Steam Cloud
    * 
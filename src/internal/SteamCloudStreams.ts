@@ -0,0 +1,245 @@
+import * as koffi from 'koffi';
+import { Readable, Writable } from 'stream';
+import { SteamLibraryLoader } from './SteamLibraryLoader';
+import { SteamCallbackPoller } from './SteamCallbackPoller';
+import { CloudConstants, CloudStreamOptions } from '../types';
+import {
+  K_I_REMOTE_STORAGE_FILE_READ_ASYNC_COMPLETE,
+  RemoteStorageFileReadAsyncCompleteType
+} from './callbackTypes';
+
+/** Default bytes per chunk for cloud streams */
+const DEFAULT_CHUNK_SIZE = 1024 * 1024;
+
+/** k_UGCFileStreamHandleInvalid */
+const INVALID_WRITE_STREAM_HANDLE = BigInt('0xFFFFFFFFFFFFFFFF');
+
+/** k_EResultOK */
+const RESULT_OK = 1;
+
+// RemoteStorageFileReadAsyncComplete_t - field offsets are the same under the
+// SDK's 4- and 8-byte callback packing; only the trailing padding differs
+const RemoteStorageFileReadAsyncComplete_t = koffi.struct('RemoteStorageFileReadAsyncComplete_t', {
+  m_hFileReadAsync: 'uint64',
+  m_eResult: 'int',
+  m_nOffset: 'uint32',
+  m_cubRead: 'uint32',
+});
+
+function resolveChunkSize(options?: CloudStreamOptions): number {
+  const chunkSize = options?.chunkSize ?? DEFAULT_CHUNK_SIZE;
+  return Math.max(1, Math.min(Math.floor(chunkSize), CloudConstants.MAX_CLOUD_FILE_CHUNK_SIZE));
+}
+
+/**
+ * Readable stream over a Steam Cloud file
+ *
+ * Reads the file one chunk at a time with FileReadAsync, so the event loop is
+ * never blocked on a large read and only the chunks the consumer hasn't taken
+ * yet are held in memory. Each chunk is read straight into the Buffer that is
+ * pushed downstream, with no intermediate copy.
+ */
+export class CloudReadStream extends Readable {
+  private libraryLoader: SteamLibraryLoader;
+  private remoteStorage: any;
+  private poller: SteamCallbackPoller;
+  private filename: string;
+  private chunkSize: number;
+  private fileSize: number;
+  private offset: number = 0;
+  private reading: boolean = false;
+
+  constructor(
+    libraryLoader: SteamLibraryLoader,
+    remoteStorage: any,
+    poller: SteamCallbackPoller,
+    filename: string,
+    options?: CloudStreamOptions
+  ) {
+    super();
+    this.libraryLoader = libraryLoader;
+    this.remoteStorage = remoteStorage;
+    this.poller = poller;
+    this.filename = filename;
+    this.chunkSize = resolveChunkSize(options);
+
+    this.fileSize = remoteStorage && libraryLoader.SteamAPI_ISteamRemoteStorage_FileExists(remoteStorage, filename)
+      ? libraryLoader.SteamAPI_ISteamRemoteStorage_GetFileSize(remoteStorage, filename)
+      : -1;
+    if (this.fileSize < 0) {
+      this.destroy(new Error(`Steam Cloud file not found: ${filename}`));
+    }
+  }
+
+  /** Total size of the file in bytes */
+  get size(): number {
+    return Math.max(this.fileSize, 0);
+  }
+
+  _read(): void {
+    if (this.reading) return;
+    if (this.offset >= this.fileSize) {
+      this.push(null);
+      return;
+    }
+
+    this.reading = true;
+    this.readChunk().then(
+      chunk => {
+        this.reading = false;
+        if (this.destroyed) return;
+        this.offset += chunk.length;
+        this.push(chunk);
+        if (this.offset >= this.fileSize) this.push(null);
+      },
+      error => {
+        this.reading = false;
+        this.destroy(error);
+      }
+    );
+  }
+
+  private async readChunk(): Promise<Buffer> {
+    const toRead = Math.min(this.chunkSize, this.fileSize - this.offset);
+    const callHandle = BigInt(this.libraryLoader.SteamAPI_ISteamRemoteStorage_FileReadAsync(
+      this.remoteStorage,
+      this.filename,
+      this.offset,
+      toRead
+    ));
+    if (callHandle === 0n) {
+      throw new Error(`FileReadAsync failed for ${this.filename} at offset ${this.offset}`);
+    }
+
+    const result = await this.poller.poll<RemoteStorageFileReadAsyncCompleteType>(
+      callHandle,
+      RemoteStorageFileReadAsyncComplete_t,
+      K_I_REMOTE_STORAGE_FILE_READ_ASYNC_COMPLETE
+    );
+    if (!result || result.m_eResult !== RESULT_OK || result.m_cubRead === 0) {
+      throw new Error(`Steam Cloud read failed for ${this.filename} (EResult ${result ? result.m_eResult : 'timeout'})`);
+    }
+
+    const chunk = Buffer.allocUnsafe(result.m_cubRead);
+    const completed = this.libraryLoader.SteamAPI_ISteamRemoteStorage_FileReadAsyncComplete(
+      this.remoteStorage,
+      callHandle,
+      chunk,
+      chunk.length
+    );
+    if (!completed) {
+      throw new Error(`FileReadAsyncComplete failed for ${this.filename}`);
+    }
+    return chunk;
+  }
+}
+
+/**
+ * Writable stream into a Steam Cloud file
+ *
+ * Wraps FileWriteStreamOpen / WriteChunk / Close. Small writes are coalesced
+ * into one reusable chunk buffer; writes of at least a chunk go to Steam
+ * directly. Nothing is committed until the stream finishes, and destroying it
+ * early cancels the write and leaves the previous file intact.
+ */
+export class CloudWriteStream extends Writable {
+  private libraryLoader: SteamLibraryLoader;
+  private remoteStorage: any;
+  private filename: string;
+  private handle: bigint = INVALID_WRITE_STREAM_HANDLE;
+  private chunk: Buffer;
+  private chunkLength: number = 0;
+  private bytesWrittenTotal: number = 0;
+
+  constructor(
+    libraryLoader: SteamLibraryLoader,
+    remoteStorage: any,
+    filename: string,
+    options?: CloudStreamOptions
+  ) {
+    super();
+    this.libraryLoader = libraryLoader;
+    this.remoteStorage = remoteStorage;
+    this.filename = filename;
+    this.chunk = Buffer.allocUnsafe(resolveChunkSize(options));
+
+    if (remoteStorage) {
+      this.handle = BigInt(libraryLoader.SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen(remoteStorage, filename));
+    }
+    if (this.handle === INVALID_WRITE_STREAM_HANDLE) {
+      this.destroy(new Error(`FileWriteStreamOpen failed for ${filename}`));
+    }
+  }
+
+  /** Bytes handed to the stream so far */
+  get bytesWritten(): number {
+    return this.bytesWrittenTotal;
+  }
+
+  _write(data: Buffer, _encoding: BufferEncoding, callback: (error?: Error | null) => void): void {
+    try {
+      this.bytesWrittenTotal += data.length;
+      let offset = 0;
+
+      // Top up a partially filled chunk first, so bytes stay in order
+      if (this.chunkLength > 0) {
+        offset = data.copy(this.chunk, this.chunkLength, 0, Math.min(data.length, this.chunk.length - this.chunkLength));
+        this.chunkLength += offset;
+        if (this.chunkLength === this.chunk.length) this.flushChunk();
+      }
+
+      // Whole chunks are written from the caller's buffer without copying
+      while (data.length - offset >= this.chunk.length) {
+        this.writeChunk(data.subarray(offset, offset + this.chunk.length));
+        offset += this.chunk.length;
+      }
+
+      if (offset < data.length) {
+        this.chunkLength += data.copy(this.chunk, this.chunkLength, offset);
+      }
+      callback();
+    } catch (error) {
+      callback(error as Error);
+    }
+  }
+
+  _final(callback: (error?: Error | null) => void): void {
+    try {
+      this.flushChunk();
+      const handle = this.handle;
+      this.handle = INVALID_WRITE_STREAM_HANDLE;
+      if (!this.libraryLoader.SteamAPI_ISteamRemoteStorage_FileWriteStreamClose(this.remoteStorage, handle)) {
+        throw new Error(`FileWriteStreamClose failed for ${this.filename}`);
+      }
+      callback();
+    } catch (error) {
+      callback(error as Error);
+    }
+  }
+
+  _destroy(error: Error | null, callback: (error?: Error | null) => void): void {
+    if (this.handle !== INVALID_WRITE_STREAM_HANDLE) {
+      this.libraryLoader.SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel(this.remoteStorage, this.handle);
+      this.handle = INVALID_WRITE_STREAM_HANDLE;
+    }
+    callback(error);
+  }
+
+  private flushChunk(): void {
+    if (this.chunkLength === 0) return;
+    this.writeChunk(this.chunk.subarray(0, this.chunkLength));
+    this.chunkLength = 0;
+  }
+
+  private writeChunk(data: Buffer): void {
+    // WriteChunk copies the bytes before returning, so the buffer can be reused
+    if (!this.libraryLoader.SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk(
+      this.remoteStorage,
+      this.handle,
+      data,
+      data.length
+    )) {
+      throw new Error(`FileWriteStreamWriteChunk failed for ${this.filename}`);
+    }
+  }
+}
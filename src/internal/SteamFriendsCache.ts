@@ -0,0 +1,225 @@
+import * as koffi from 'koffi';
+import { SteamLibraryLoader, CCallbackBase, FnCallbackRunPtr, FnCallbackRunResultPtr, FnGetCallbackSizeBytesPtr } from './SteamLibraryLoader';
+import { SteamAPICore } from './SteamAPICore';
+import { SteamLogger } from './SteamLogger';
+import type { SteamFriendsManager } from './SteamFriendsManager';
+import { K_I_PERSONA_STATE_CHANGE, PersonaStateChangeType } from './callbackTypes';
+import { EFriendFlags, EPersonaChange, FriendInfo } from '../types';
+
+// PersonaStateChange_t: [uint64 m_ulSteamID:0-7][int32 m_nChangeFlags:8-11]
+// plus 4 bytes of tail padding under MSVC's pack(8); field offsets are the same
+const PersonaStateChange_t = koffi.struct('PersonaStateChange_t', {
+  m_ulSteamID: 'uint64',
+  m_nChangeFlags: 'int'
+});
+const PERSONA_STATE_CHANGE_SIZE = process.platform === 'win32' ? 16 : 12;
+
+/** Changes that alter a FriendInfo row; avatar, game, level and rich presence changes don't */
+const FRIEND_INFO_CHANGES =
+  EPersonaChange.Name |
+  EPersonaChange.Status |
+  EPersonaChange.ComeOnline |
+  EPersonaChange.GoneOffline |
+  EPersonaChange.RelationshipChanged |
+  EPersonaChange.NameFirstSet |
+  EPersonaChange.Nickname;
+
+/**
+ * Friend IDs for one EFriendFlags filter and the snapshot built from them
+ */
+interface FriendList {
+  steamIds: string[];
+  snapshot: FriendInfo[] | null;
+}
+
+/**
+ * SteamFriendsCache
+ *
+ * Friends list and persona data kept up to date from PersonaStateChange_t.
+ * The first read enumerates the list and fetches each friend once; after that
+ * a callback only marks the friend it names as dirty, and the next read
+ * re-fetches just the dirty friends. Reads return the same snapshot array
+ * until something in it changes.
+ *
+ * Callbacks arrive through the native callback pump when it is running, and
+ * through a registered CCallbackBase (run by SteamAPI_RunCallbacks) otherwise.
+ */
+export class SteamFriendsCache {
+  private libraryLoader: SteamLibraryLoader;
+  private apiCore: SteamAPICore;
+  private friends: SteamFriendsManager;
+
+  private entries: Map<string, FriendInfo> = new Map();
+  private lists: Map<number, FriendList> = new Map();
+  private dirty: Set<string> = new Set();
+  private listsStale: boolean = false;
+
+  // Registered CCallbackBase and the koffi objects it points at, kept alive while registered
+  private callbackObject: any = null;
+  private callbackVTable: any = null;
+  private callbackFunctions: any[] = [];
+
+  constructor(libraryLoader: SteamLibraryLoader, apiCore: SteamAPICore, friends: SteamFriendsManager) {
+    this.libraryLoader = libraryLoader;
+    this.apiCore = apiCore;
+    this.friends = friends;
+
+    apiCore.getCallbackPump().onCallback(K_I_PERSONA_STATE_CHANGE, (data) =>
+      this.handlePersonaStateChange(data.readBigUInt64LE(0), data.readInt32LE(8))
+    );
+  }
+
+  /**
+   * Current friends for a filter, fetching only what changed since the last read
+   */
+  getSnapshot(friendFlags: EFriendFlags): readonly FriendInfo[] {
+    if (!this.ensureSubscribed()) {
+      // Without change notifications a cached list could never be trusted
+      return this.friends.getAllFriends(friendFlags);
+    }
+
+    if (this.listsStale) {
+      this.lists.clear();
+      this.listsStale = false;
+    }
+
+    if (this.dirty.size > 0) {
+      for (const steamId of this.dirty) {
+        if (this.entries.has(steamId)) {
+          this.entries.set(steamId, this.fetchFriend(steamId));
+        }
+      }
+      this.dirty.clear();
+      for (const list of this.lists.values()) {
+        list.snapshot = null;
+      }
+    }
+
+    let list = this.lists.get(friendFlags);
+    if (!list) {
+      list = { steamIds: this.enumerate(friendFlags), snapshot: null };
+      this.lists.set(friendFlags, list);
+    }
+
+    if (!list.snapshot) {
+      list.snapshot = list.steamIds.map(steamId => {
+        let entry = this.entries.get(steamId);
+        if (!entry) {
+          entry = this.fetchFriend(steamId);
+          this.entries.set(steamId, entry);
+        }
+        return entry;
+      });
+    }
+    return list.snapshot;
+  }
+
+  /**
+   * Forget everything; the next read re-enumerates and re-fetches all friends
+   */
+  invalidate(): void {
+    this.entries.clear();
+    this.lists.clear();
+    this.dirty.clear();
+    this.listsStale = false;
+  }
+
+  /**
+   * Unregister the Steam callback. Must run before SteamAPI_Shutdown().
+   */
+  cleanup(): void {
+    if (this.callbackObject) {
+      this.libraryLoader.SteamAPI_UnregisterCallback(this.callbackObject);
+      for (const func of this.callbackFunctions) {
+        koffi.unregister(func);
+      }
+    }
+    this.callbackObject = null;
+    this.callbackVTable = null;
+    this.callbackFunctions = [];
+    this.invalidate();
+  }
+
+  private handlePersonaStateChange(steamIdValue: bigint, changeFlags: number): void {
+    if ((changeFlags & FRIEND_INFO_CHANGES) === 0) return;
+
+    // New friends, removed friends and accepted requests move users between lists
+    if (changeFlags & EPersonaChange.RelationshipChanged) {
+      this.listsStale = true;
+    }
+
+    const steamId = steamIdValue.toString();
+    if (this.entries.has(steamId)) {
+      this.dirty.add(steamId);
+    }
+  }
+
+  private enumerate(friendFlags: EFriendFlags): string[] {
+    const steamIds: string[] = [];
+    const count = this.friends.getFriendCount(friendFlags);
+    for (let i = 0; i < count; i++) {
+      const steamId = this.friends.getFriendByIndex(i, friendFlags);
+      if (steamId) steamIds.push(steamId);
+    }
+    return steamIds;
+  }
+
+  private fetchFriend(steamId: string): FriendInfo {
+    return {
+      steamId,
+      personaName: this.friends.getFriendPersonaName(steamId),
+      personaState: this.friends.getFriendPersonaState(steamId),
+      relationship: this.friends.getFriendRelationship(steamId),
+    };
+  }
+
+  /**
+   * Make sure persona changes reach the cache
+   */
+  private ensureSubscribed(): boolean {
+    if (this.callbackObject || this.apiCore.getCallbackPump().isRunning()) return true;
+    if (!this.apiCore.isInitialized()) return false;
+
+    try {
+      const run = (_self: any, pvParam: any) => {
+        try {
+          const change: PersonaStateChangeType = koffi.decode(pvParam, PersonaStateChange_t);
+          this.handlePersonaStateChange(BigInt(change.m_ulSteamID), change.m_nChangeFlags);
+        } catch (error) {
+          SteamLogger.error('[Steamworks] Error in persona state change callback:', error);
+        }
+      };
+      const runResult = (self: any, pvParam: any) => run(self, pvParam);
+      const getSize = () => PERSONA_STATE_CHANGE_SIZE;
+
+      this.callbackFunctions = [
+        koffi.register(run, FnCallbackRunPtr),
+        koffi.register(runResult, FnCallbackRunResultPtr),
+        koffi.register(getSize, FnGetCallbackSizeBytesPtr),
+      ];
+
+      this.callbackVTable = koffi.alloc('void*', 3);
+      koffi.encode(this.callbackVTable, koffi.array('void*', 3), this.callbackFunctions);
+
+      this.callbackObject = koffi.alloc(CCallbackBase, 1);
+      koffi.encode(this.callbackObject, CCallbackBase, {
+        vfptr: this.callbackVTable,
+        m_nCallbackFlags: 0,
+        _pad: [0, 0, 0],
+        m_iCallback: K_I_PERSONA_STATE_CHANGE
+      });
+
+      this.libraryLoader.SteamAPI_RegisterCallback(this.callbackObject, K_I_PERSONA_STATE_CHANGE);
+      return true;
+    } catch (error) {
+      SteamLogger.error('[Steamworks] Failed to register persona state change callback:', error);
+      for (const func of this.callbackFunctions) {
+        koffi.unregister(func);
+      }
+      this.callbackObject = null;
+      this.callbackVTable = null;
+      this.callbackFunctions = [];
+      return false;
+    }
+  }
+}
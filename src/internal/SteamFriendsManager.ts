@@ -2,6 +2,8 @@ import * as koffi from 'koffi';
 import { SteamLibraryLoader } from './SteamLibraryLoader';
 import { SteamAPICore } from './SteamAPICore';
 import { SteamLogger } from './SteamLogger';
+import { SteamScratch } from './SteamScratch';
+import { SteamFriendsCache } from './SteamFriendsCache';
 import { 
   EFriendRelationship, 
   EPersonaState, 
@@ -74,6 +76,9 @@ export class SteamFriendsManager {
   /** Steam API core for initialization and callback management */
   private apiCore: SteamAPICore;
 
+  /** Friends list and persona cache behind getFriendsSnapshot */
+  private friendsCache: SteamFriendsCache;
+
   /** FriendGameInfo_t struct for game information */
   private static FriendGameInfo_t = koffi.struct('FriendGameInfo_t', {
     m_gameID: 'uint64',
@@ -92,6 +97,7 @@ export class SteamFriendsManager {
   constructor(libraryLoader: SteamLibraryLoader, apiCore: SteamAPICore) {
     this.libraryLoader = libraryLoader;
     this.apiCore = apiCore;
+    this.friendsCache = new SteamFriendsCache(libraryLoader, apiCore, this);
   }
 
   /**
@@ -468,6 +474,63 @@ export class SteamFriendsManager {
     return friends;
   }
 
+  /**
+   * Gets all friends from a cache that is updated as their personas change
+   * 
+   * @param friendFlags - Flags to filter which friends to retrieve (default: {@link EFriendFlags.Immediate})
+   * @returns Snapshot array of {@link FriendInfo}; treat it as read-only
+   * 
+   * @remarks
+   * Same data as {@link getAllFriends}, without its per-friend API calls on every
+   * read. The first call enumerates the list and fetches each friend; after that
+   * `PersonaStateChange_t` callbacks mark the friends whose name, state or
+   * relationship changed, and only those are fetched again on the next call.
+   * When nothing changed, the same array is returned, so `snapshot !== previous`
+   * is a cheap "re-render" check.
+   * 
+   * Changes are picked up as callbacks run, so call `steam.runCallbacks()`
+   * regularly or start the native callback pump.
+   * 
+   * @example
+   * ```typescript
+   * let shown: readonly FriendInfo[] = [];
+   * setInterval(() => {
+   *   steam.runCallbacks();
+   *   const friends = steam.friends.getFriendsSnapshot();
+   *   if (friends !== shown) {
+   *     shown = friends;
+   *     renderSocialPanel(friends);
+   *   }
+   * }, 250);
+   * ```
+   * 
+   * @see {@link invalidateFriendsCache}
+   */
+  getFriendsSnapshot(friendFlags: EFriendFlags = EFriendFlags.Immediate): readonly FriendInfo[] {
+    if (!this.apiCore.isInitialized()) {
+      SteamLogger.warn('[Steamworks] WARNING: Steam API not initialized');
+      return [];
+    }
+    return this.friendsCache.getSnapshot(friendFlags);
+  }
+
+  /**
+   * Drops the friends cache so the next {@link getFriendsSnapshot} re-fetches everyone
+   */
+  invalidateFriendsCache(): void {
+    this.friendsCache.invalidate();
+  }
+
+  /**
+   * Unregisters the persona change callback
+   * 
+   * @remarks
+   * Called by `steam.shutdown()` before `SteamAPI_Shutdown()`.
+   */
+  cleanup(): void {
+    this.friendsCache.cleanup();
+  }
+
   /**
    * Gets a friend's current Steam level
    * 
@@ -583,7 +646,7 @@ export class SteamFriendsManager {
     }
 
     try {
-      const gameInfoPtr = koffi.alloc(SteamFriendsManager.FriendGameInfo_t, 1);
+      const gameInfoPtr = SteamScratch.bytes(koffi.sizeof(SteamFriendsManager.FriendGameInfo_t));
       const isPlaying = this.libraryLoader.SteamAPI_ISteamFriends_GetFriendGamePlayed(
         friendsInterface, 
         BigInt(steamId), 
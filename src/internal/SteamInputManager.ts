@@ -7,6 +7,9 @@ import {
   InputDigitalActionData,
   InputAnalogActionData,
   InputMotionData,
+  InputActionSnapshot,
+  INPUT_DIGITAL_SNAPSHOT_STRIDE,
+  INPUT_ANALOG_SNAPSHOT_STRIDE,
   SteamInputType,
   ControllerInfo,
   DeviceBindingRevision,
@@ -18,6 +21,7 @@ import {
 } from '../types';
 import { SteamLibraryLoader } from './SteamLibraryLoader';
 import { SteamLogger } from './SteamLogger';
+import { SteamNativeModule, loadSteamNativeAddon } from './SteamNativeAddon';
 
 /**
  * Controller type names for display
@@ -84,6 +88,12 @@ export class SteamInputManager {
   /** Cached ISteamInput interface pointer */
   private steamInputInterface: any = null;
 
+  /** Native addon for the action snapshot; undefined until first looked up */
+  private nativeAddon: SteamNativeModule | null | undefined = undefined;
+
+  /** Reused BigUint64Array copies of handle lists passed as plain arrays */
+  private handleScratch: BigUint64Array[] = [new BigUint64Array(0), new BigUint64Array(0), new BigUint64Array(0)];
+
   /**
    * Creates a new SteamInputManager instance
    * 
@@ -684,6 +694,123 @@ export class SteamInputManager {
     }
   }
 
+  // ========================================
+  // Action Snapshot
+  // ========================================
+
+  /**
+   * Read every digital and analog action for a set of controllers in one call
+   * 
+   * Replaces one `getDigitalActionData`/`getAnalogActionData` per action per
+   * controller with a single native call that writes into preallocated typed
+   * arrays (see {@link InputActionSnapshot} for the layout). Pass the previous
+   * snapshot back in and BigUint64Array handle lists to poll without allocating.
+   * Falls back to the per-action koffi calls when the native addon isn't
+   * available. Call after `runFrame()`.
+   * 
+   * @param inputHandles - Controllers to read
+   * @param digitalActions - Digital action handles, in output order
+   * @param analogActions - Analog action handles, in output order
+   * @param snapshot - Snapshot to refill; reallocated only when it is too small
+   * @returns The filled snapshot
+   * 
+   * @example
+   * ```typescript
+   * const handles = new BigUint64Array(inputManager.getConnectedControllers());
+   * const digital = new BigUint64Array([jumpHandle, fireHandle]);
+   * const analog = new BigUint64Array([moveHandle]);
+   * let snapshot: InputActionSnapshot | undefined;
+   * 
+   * // Every frame
+   * inputManager.runFrame();
+   * snapshot = inputManager.snapshotActionState(handles, digital, analog, snapshot);
+   * for (let c = 0; c < snapshot.controllerCount; c++) {
+   *   const jumpPressed = snapshot.digital[(c * 2 + 0) * INPUT_DIGITAL_SNAPSHOT_STRIDE] === 1;
+   *   const moveX = snapshot.analog[c * INPUT_ANALOG_SNAPSHOT_STRIDE];
+   * }
+   * ```
+   */
+  snapshotActionState(
+    inputHandles: BigUint64Array | InputHandle[],
+    digitalActions: BigUint64Array | InputDigitalActionHandle[],
+    analogActions: BigUint64Array | InputAnalogActionHandle[],
+    snapshot?: InputActionSnapshot
+  ): InputActionSnapshot {
+    const handles = this.toHandleArray(inputHandles, 0);
+    const digitalHandles = this.toHandleArray(digitalActions, 1);
+    const analogHandles = this.toHandleArray(analogActions, 2);
+
+    const digitalLength = handles.length * digitalHandles.length * INPUT_DIGITAL_SNAPSHOT_STRIDE;
+    const analogLength = handles.length * analogHandles.length * INPUT_ANALOG_SNAPSHOT_STRIDE;
+    const out: InputActionSnapshot = snapshot ?? {
+      controllerCount: 0,
+      digitalActionCount: 0,
+      analogActionCount: 0,
+      digital: new Uint8Array(digitalLength),
+      analog: new Float32Array(analogLength),
+    };
+    if (out.digital.length < digitalLength) out.digital = new Uint8Array(digitalLength);
+    if (out.analog.length < analogLength) out.analog = new Float32Array(analogLength);
+    out.controllerCount = handles.length;
+    out.digitalActionCount = digitalHandles.length;
+    out.analogActionCount = analogHandles.length;
+
+    const addon = this.getNativeAddon();
+    if (addon) {
+      try {
+        addon.snapshotActionState(handles, digitalHandles, analogHandles, out.digital, out.analog);
+        return out;
+      } catch (error) {
+        SteamLogger.debug('[Steamworks] Native input snapshot unavailable, using koffi:', error);
+        this.nativeAddon = null;
+      }
+    }
+
+    for (let c = 0; c < handles.length; c++) {
+      for (let a = 0; a < digitalHandles.length; a++) {
+        const data = this.getDigitalActionData(handles[c], digitalHandles[a]);
+        const entry = (c * digitalHandles.length + a) * INPUT_DIGITAL_SNAPSHOT_STRIDE;
+        out.digital[entry] = data.state ? 1 : 0;
+        out.digital[entry + 1] = data.active ? 1 : 0;
+      }
+      for (let a = 0; a < analogHandles.length; a++) {
+        const data = this.getAnalogActionData(handles[c], analogHandles[a]);
+        const entry = (c * analogHandles.length + a) * INPUT_ANALOG_SNAPSHOT_STRIDE;
+        out.analog[entry] = data.x;
+        out.analog[entry + 1] = data.y;
+        out.analog[entry + 2] = data.mode;
+        out.analog[entry + 3] = data.active ? 1 : 0;
+      }
+    }
+    return out;
+  }
+
+  /**
+   * Get the native addon, loading it on first use
+   * @private
+   */
+  private getNativeAddon(): SteamNativeModule | null {
+    if (this.nativeAddon === undefined) {
+      this.nativeAddon = loadSteamNativeAddon(this.libraryLoader.getLibraryPath());
+    }
+    return this.nativeAddon;
+  }
+
+  /**
+   * Copy a plain handle list into a reused BigUint64Array
+   * @private
+   */
+  private toHandleArray(handles: BigUint64Array | bigint[], slot: number): BigUint64Array {
+    if (handles instanceof BigUint64Array) return handles;
+    let scratch = this.handleScratch[slot];
+    if (scratch.length !== handles.length) {
+      scratch = new BigUint64Array(handles.length);
+      this.handleScratch[slot] = scratch;
+    }
+    scratch.set(handles);
+    return scratch;
+  }
+
   // ========================================
   // Motion Data
   // ========================================
@@ -3,8 +3,11 @@ import { SteamLibraryLoader } from './SteamLibraryLoader';
 import { SteamAPICore } from './SteamAPICore';
 import { SteamCallbackPoller } from './SteamCallbackPoller';
 import { SteamLogger } from './SteamLogger';
+import { SteamLeaderboardRangeCache, BatchSlice, emptyLeaderboardBatch, joinByRank, sliceByRank } from './SteamLeaderboardRangeCache';
 import {
   LeaderboardEntry,
+  LeaderboardEntryBatch,
+  LeaderboardCacheOptions,
   LeaderboardInfo,
   LeaderboardScoreUploadResult,
   LeaderboardSortMethod,
@@ -70,6 +73,15 @@ const LeaderboardEntry_t = koffi.struct('LeaderboardEntry_t', {
   m_hUGC: 'uint64'          // UGC handle attached to entry
 });
 
+/** k_cLeaderboardDetailsMax */
+const LEADERBOARD_DETAILS_MAX = 64;
+
+const LEADERBOARD_ENTRY_SIZE = koffi.sizeof(LeaderboardEntry_t);
+const LEADERBOARD_ENTRY_RANK = koffi.offsetof(LeaderboardEntry_t, 'm_nGlobalRank');
+const LEADERBOARD_ENTRY_SCORE = koffi.offsetof(LeaderboardEntry_t, 'm_nScore');
+const LEADERBOARD_ENTRY_DETAILS = koffi.offsetof(LeaderboardEntry_t, 'm_cDetails');
+const LEADERBOARD_ENTRY_UGC = koffi.offsetof(LeaderboardEntry_t, 'm_hUGC');
+
 // Callback IDs (k_iSteamUserStatsCallbacks = 1100)
 const k_iCallback_LeaderboardFindResult = 1104;
 const k_iCallback_LeaderboardScoresDownloaded = 1105;
@@ -146,6 +158,13 @@ export class SteamLeaderboardManager {
   /** Callback poller for retrieving async operation results */
   private callbackPoller: SteamCallbackPoller;
 
+  /** Downloaded global rank ranges, per leaderboard */
+  private rangeCache: SteamLeaderboardRangeCache = new SteamLeaderboardRangeCache();
+
+  // Reused out-buffers for GetDownloadedLeaderboardEntry
+  private entryBuffer = Buffer.alloc(LEADERBOARD_ENTRY_SIZE);
+  private detailsBuffer = Buffer.alloc(LEADERBOARD_DETAILS_MAX * 4);
+
   /**
    * Creates a new SteamLeaderboardManager instance
    * 
@@ -528,6 +547,10 @@ export class SteamLeaderboardManager {
         globalRankPrevious: result.m_nGlobalRankPrevious
       };
 
+      if (uploadResult.scoreChanged) {
+        this.rangeCache.invalidate(leaderboardHandle);
+      }
+
       console.log(`[Steamworks] Score uploaded: ${result.m_nScore} | Rank: ${result.m_nGlobalRankPrevious} → ${result.m_nGlobalRankNew} | Changed: ${result.m_bScoreChanged === 1}`);
       return uploadResult;
     } catch (error: any) {
@@ -608,81 +631,135 @@ export class SteamLeaderboardManager {
     }
 
     try {
-      console.log(`[Steamworks] Downloading entries (${rangeStart} to ${rangeEnd})`);
-      
-      const callHandle = this.libraryLoader.SteamAPI_ISteamUserStats_DownloadLeaderboardEntries(
-        userStatsInterface,
-        leaderboardHandle,
-        dataRequest,
-        rangeStart,
-        rangeEnd
-      );
-
-      if (callHandle === BigInt(0)) {
-        SteamLogger.error(`[Steamworks] Failed to download entries`);
+      const batch = await this.requestEntries(userStatsInterface, leaderboardHandle, dataRequest, rangeStart, rangeEnd);
+      if (!batch) {
+        return [];
+      }
+      if (batch.count === 0) {
+        console.log(`[Steamworks] No entries downloaded`);
         return [];
       }
 
-      const result = await this.callbackPoller.poll<LeaderboardScoresDownloadedType>(
-        callHandle,
-        LeaderboardScoresDownloaded_t,
-        k_iCallback_LeaderboardScoresDownloaded
-      );
+      const entries = this.toEntries(batch);
+      console.log(`[Steamworks] Downloaded ${entries.length} entries`);
+      return entries;
+    } catch (error: any) {
+      SteamLogger.error(`[Steamworks] Error downloading entries:`, error.message);
+      return [];
+    }
+  }
 
-      if (!result) {
-        SteamLogger.error(`[Steamworks] Failed to get download result`);
-        return [];
+  /**
+   * Download leaderboard entries as a typed-array batch
+   * 
+   * Same ranges as {@link downloadLeaderboardEntries}, but every entry is decoded
+   * into shared typed arrays through reused buffers instead of one object per
+   * row. Global requests go through a range cache: ranks downloaded within the
+   * cache TTL are reused, and only the ranks that are missing are requested, so
+   * paging 1-100 and then 50-150 downloads just 101-150.
+   * 
+   * @param leaderboardHandle - Handle to the leaderboard
+   * @param dataRequest - Type of data to request
+   * @param rangeStart - Start of range (1-based for global, offset for around user)
+   * @param rangeEnd - End of range (1-based for global, offset for around user)
+   * @returns Promise resolving to the batch (count 0 if there are no entries), or null on error
+   * 
+   * @example
+   * ```typescript
+   * const top = await leaderboardManager.downloadLeaderboardEntryBatch(
+   *   leaderboard.handle,
+   *   LeaderboardDataRequest.Global,
+   *   1,
+   *   1000
+   * );
+   * if (top) {
+   *   for (let i = 0; i < top.count; i++) {
+   *     console.log(`${top.globalRanks[i]}. ${top.steamIds[i]}: ${top.scores[i]}`);
+   *   }
+   * }
+   * ```
+   * 
+   * @remarks
+   * - Only Global requests are cached; around-user and friends ranges depend on the current user
+   * - Uploading a score that changes the board invalidates its cached ranges
+   * - Tune or disable the cache with {@link configureLeaderboardCache}
+   * 
+   * Steamworks SDK Functions:
+   * - `SteamAPI_ISteamUserStats_DownloadLeaderboardEntries()` - Download leaderboard entries
+   * - `SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry()` - Get individual entry data
+   */
+  async downloadLeaderboardEntryBatch(
+    leaderboardHandle: bigint,
+    dataRequest: LeaderboardDataRequest,
+    rangeStart: number,
+    rangeEnd: number
+  ): Promise<LeaderboardEntryBatch | null> {
+    if (!this.apiCore.isInitialized()) {
+      SteamLogger.warn('[Steamworks] Steam API not initialized');
+      return null;
+    }
+
+    const userStatsInterface = this.apiCore.getUserStatsInterface();
+    if (!userStatsInterface) {
+      SteamLogger.warn('[Steamworks] UserStats interface not available');
+      return null;
+    }
+
+    try {
+      if (dataRequest !== LeaderboardDataRequest.Global || !this.rangeCache.isEnabled()) {
+        return await this.requestEntries(userStatsInterface, leaderboardHandle, dataRequest, rangeStart, rangeEnd);
       }
 
-      if (result.m_cEntryCount === 0) {
-        console.log(`[Steamworks] No entries downloaded`);
-        return [];
+      const start = Math.max(1, rangeStart);
+      if (rangeEnd < start) {
+        return emptyLeaderboardBatch();
       }
 
-      // Now retrieve each individual entry using GetDownloadedLeaderboardEntry
-      const entries: LeaderboardEntry[] = [];
-      const entriesHandle = result.m_hSteamLeaderboardEntries;
-      
-      for (let i = 0; i < result.m_cEntryCount; i++) {
-        const entryData = koffi.alloc(LeaderboardEntry_t, 1);
-        const detailsArray = koffi.alloc('int32', 64); // Max 64 details
-        
-        const success = this.libraryLoader.SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry(
-          userStatsInterface,
-          entriesHandle,
-          i,
-          entryData,
-          detailsArray,
-          64
-        );
-
-        if (success) {
-          const entry = koffi.decode(entryData, LeaderboardEntry_t);
-          const details: number[] = [];
-          
-          // Read details if any
-          for (let j = 0; j < entry.m_cDetails && j < 64; j++) {
-            details.push(koffi.decode(detailsArray, 'int32', j));
-          }
-
-          entries.push({
-            steamId: entry.m_steamIDUser.toString(),
-            globalRank: entry.m_nGlobalRank,
-            score: entry.m_nScore,
-            details,
-            ugcHandle: entry.m_hUGC
-          });
+      const missing = this.rangeCache.missingRanges(leaderboardHandle, start, rangeEnd);
+      const cached = this.rangeCache.cachedSlices(leaderboardHandle, start, rangeEnd);
+      const downloaded = await Promise.all(missing.map(([from, to]) =>
+        this.requestEntries(userStatsInterface, leaderboardHandle, dataRequest, from, to)
+      ));
+      const fresh: BatchSlice[] = [];
+      for (let i = 0; i < missing.length; i++) {
+        const batch = downloaded[i];
+        if (!batch) {
+          return null;
         }
+        this.rangeCache.insert(leaderboardHandle, missing[i][0], missing[i][1], batch);
+        fresh.push(sliceByRank(batch, missing[i][0], missing[i][1]));
       }
 
-      console.log(`[Steamworks] Downloaded ${entries.length} entries`);
-      return entries;
+      if (missing.length === 1 && missing[0][0] === start && missing[0][1] === rangeEnd) {
+        return downloaded[0];
+      }
+      // Joined from what was downloaded and what was cached beforehand, not re-read
+      // from the cache: insert() may already have evicted part of the range
+      return joinByRank([...cached, ...fresh]);
     } catch (error: any) {
       SteamLogger.error(`[Steamworks] Error downloading entries:`, error.message);
-      return [];
+      return null;
     }
   }
 
+  /**
+   * Configure the global-range cache used by {@link downloadLeaderboardEntryBatch}
+   * 
+   * @param options - Fields to change; `ttlMs: 0` disables the cache
+   */
+  configureLeaderboardCache(options: LeaderboardCacheOptions): void {
+    this.rangeCache.configure(options);
+  }
+
+  /**
+   * Drop cached leaderboard ranges
+   * 
+   * @param leaderboardHandle - Only drop this leaderboard's ranges; all of them if omitted
+   */
+  invalidateLeaderboardCache(leaderboardHandle?: bigint): void {
+    this.rangeCache.invalidate(leaderboardHandle);
+  }
+
   /**
    * Download leaderboard entries for specific users
    * 
@@ -770,41 +847,9 @@ export class SteamLeaderboardManager {
         return [];
       }
 
-      // Now retrieve each individual entry using GetDownloadedLeaderboardEntry
-      const entries: LeaderboardEntry[] = [];
-      const entriesHandle = result.m_hSteamLeaderboardEntries;
-      
-      for (let i = 0; i < result.m_cEntryCount; i++) {
-        const entryData = koffi.alloc(LeaderboardEntry_t, 1);
-        const detailsArray = koffi.alloc('int32', 64); // Max 64 details
-        
-        const success = this.libraryLoader.SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry(
-          userStatsInterface,
-          entriesHandle,
-          i,
-          entryData,
-          detailsArray,
-          64
-        );
-
-        if (success) {
-          const entry = koffi.decode(entryData, LeaderboardEntry_t);
-          const details: number[] = [];
-          
-          // Read details if any
-          for (let j = 0; j < entry.m_cDetails && j < 64; j++) {
-            details.push(koffi.decode(detailsArray, 'int32', j));
-          }
-
-          entries.push({
-            steamId: entry.m_steamIDUser.toString(),
-            globalRank: entry.m_nGlobalRank,
-            score: entry.m_nScore,
-            details,
-            ugcHandle: entry.m_hUGC
-          });
-        }
-      }
+      const entries = this.toEntries(
+        this.decodeEntries(userStatsInterface, result.m_hSteamLeaderboardEntries, result.m_cEntryCount)
+      );
 
       console.log(`[Steamworks] Downloaded ${entries.length} user entries`);
       return entries;
@@ -814,6 +859,124 @@ export class SteamLeaderboardManager {
     }
   }
 
+  /**
+   * Send DownloadLeaderboardEntries and decode the result
+   */
+  private async requestEntries(
+    userStatsInterface: any,
+    leaderboardHandle: bigint,
+    dataRequest: LeaderboardDataRequest,
+    rangeStart: number,
+    rangeEnd: number
+  ): Promise<LeaderboardEntryBatch | null> {
+    console.log(`[Steamworks] Downloading entries (${rangeStart} to ${rangeEnd})`);
+
+    const callHandle = this.libraryLoader.SteamAPI_ISteamUserStats_DownloadLeaderboardEntries(
+      userStatsInterface,
+      leaderboardHandle,
+      dataRequest,
+      rangeStart,
+      rangeEnd
+    );
+
+    if (callHandle === BigInt(0)) {
+      SteamLogger.error(`[Steamworks] Failed to download entries`);
+      return null;
+    }
+
+    const result = await this.callbackPoller.poll<LeaderboardScoresDownloadedType>(
+      callHandle,
+      LeaderboardScoresDownloaded_t,
+      k_iCallback_LeaderboardScoresDownloaded
+    );
+
+    if (!result) {
+      SteamLogger.error(`[Steamworks] Failed to get download result`);
+      return null;
+    }
+
+    return this.decodeEntries(userStatsInterface, result.m_hSteamLeaderboardEntries, result.m_cEntryCount);
+  }
+
+  /**
+   * Read every downloaded entry into one batch
+   * 
+   * Each GetDownloadedLeaderboardEntry call writes into the same entry and
+   * details buffers, which are read with plain Buffer reads; the only
+   * allocations are the batch's column arrays.
+   */
+  private decodeEntries(userStatsInterface: any, entriesHandle: bigint, entryCount: number): LeaderboardEntryBatch {
+    const batch: LeaderboardEntryBatch = {
+      count: 0,
+      steamIds: new BigUint64Array(entryCount),
+      globalRanks: new Int32Array(entryCount),
+      scores: new Int32Array(entryCount),
+      ugcHandles: new BigUint64Array(entryCount),
+      detailsOffsets: new Uint32Array(entryCount + 1),
+      details: new Int32Array(0),
+    };
+
+    let details = new Int32Array(Math.min(entryCount, 256) * 4);
+    let detailCount = 0;
+
+    for (let i = 0; i < entryCount; i++) {
+      const success = this.libraryLoader.SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry(
+        userStatsInterface,
+        entriesHandle,
+        i,
+        this.entryBuffer,
+        this.detailsBuffer,
+        LEADERBOARD_DETAILS_MAX
+      );
+      if (!success) continue;
+
+      const row = batch.count++;
+      batch.steamIds[row] = this.entryBuffer.readBigUInt64LE(0);
+      batch.globalRanks[row] = this.entryBuffer.readInt32LE(LEADERBOARD_ENTRY_RANK);
+      batch.scores[row] = this.entryBuffer.readInt32LE(LEADERBOARD_ENTRY_SCORE);
+      batch.ugcHandles[row] = this.entryBuffer.readBigUInt64LE(LEADERBOARD_ENTRY_UGC);
+      batch.detailsOffsets[row] = detailCount;
+
+      const rowDetails = Math.max(0, Math.min(this.entryBuffer.readInt32LE(LEADERBOARD_ENTRY_DETAILS), LEADERBOARD_DETAILS_MAX));
+      if (detailCount + rowDetails > details.length) {
+        const grown = new Int32Array(Math.max(details.length * 2, detailCount + rowDetails));
+        grown.set(details.subarray(0, detailCount));
+        details = grown;
+      }
+      for (let j = 0; j < rowDetails; j++) {
+        details[detailCount++] = this.detailsBuffer.readInt32LE(j * 4);
+      }
+    }
+    batch.detailsOffsets[batch.count] = detailCount;
+    batch.details = details.slice(0, detailCount);
+
+    if (batch.count < entryCount) {
+      batch.steamIds = batch.steamIds.slice(0, batch.count);
+      batch.globalRanks = batch.globalRanks.slice(0, batch.count);
+      batch.scores = batch.scores.slice(0, batch.count);
+      batch.ugcHandles = batch.ugcHandles.slice(0, batch.count);
+      batch.detailsOffsets = batch.detailsOffsets.slice(0, batch.count + 1);
+    }
+    return batch;
+  }
+
+  /**
+   * Expand a batch into LeaderboardEntry objects
+   */
+  private toEntries(batch: LeaderboardEntryBatch): LeaderboardEntry[] {
+    const entries: LeaderboardEntry[] = new Array(batch.count);
+    for (let i = 0; i < batch.count; i++) {
+      entries[i] = {
+        steamId: batch.steamIds[i].toString(),
+        globalRank: batch.globalRanks[i],
+        score: batch.scores[i],
+        details: Array.from(batch.details.subarray(batch.detailsOffsets[i], batch.detailsOffsets[i + 1])),
+        ugcHandle: batch.ugcHandles[i]
+      };
+    }
+    return entries;
+  }
+
   // ========================================
   // UGC Attachment
   // ========================================
@@ -0,0 +1,219 @@
+import { LeaderboardEntryBatch, LeaderboardCacheOptions } from '../types';
+
+const DEFAULT_TTL_MS = 60 * 1000;
+const DEFAULT_MAX_ENTRIES = 10000;
+
+/**
+ * A downloaded span of global ranks [start, end] and the rows Steam returned
+ * for it (fewer than end - start + 1 past the end of the board)
+ */
+interface RankSegment {
+  start: number;
+  end: number;
+  batch: LeaderboardEntryBatch;
+  fetchedAt: number;
+}
+
+/** Rows [from, to) of a batch */
+export interface BatchSlice {
+  batch: LeaderboardEntryBatch;
+  from: number;
+  to: number;
+}
+
+/**
+ * Create an empty batch
+ */
+export function emptyLeaderboardBatch(): LeaderboardEntryBatch {
+  return {
+    count: 0,
+    steamIds: new BigUint64Array(0),
+    globalRanks: new Int32Array(0),
+    scores: new Int32Array(0),
+    ugcHandles: new BigUint64Array(0),
+    detailsOffsets: new Uint32Array(1),
+    details: new Int32Array(0),
+  };
+}
+
+/**
+ * Build one batch out of row slices of others, in the order given
+ */
+function joinSlices(slices: BatchSlice[]): LeaderboardEntryBatch {
+  let count = 0;
+  let detailCount = 0;
+  for (const { batch, from, to } of slices) {
+    count += to - from;
+    detailCount += batch.detailsOffsets[to] - batch.detailsOffsets[from];
+  }
+
+  const joined: LeaderboardEntryBatch = {
+    count,
+    steamIds: new BigUint64Array(count),
+    globalRanks: new Int32Array(count),
+    scores: new Int32Array(count),
+    ugcHandles: new BigUint64Array(count),
+    detailsOffsets: new Uint32Array(count + 1),
+    details: new Int32Array(detailCount),
+  };
+
+  let row = 0;
+  let detail = 0;
+  for (const { batch, from, to } of slices) {
+    joined.steamIds.set(batch.steamIds.subarray(from, to), row);
+    joined.globalRanks.set(batch.globalRanks.subarray(from, to), row);
+    joined.scores.set(batch.scores.subarray(from, to), row);
+    joined.ugcHandles.set(batch.ugcHandles.subarray(from, to), row);
+
+    const detailsFrom = batch.detailsOffsets[from];
+    for (let i = from; i < to; i++) {
+      joined.detailsOffsets[row + i - from] = detail + batch.detailsOffsets[i] - detailsFrom;
+    }
+    joined.details.set(batch.details.subarray(detailsFrom, batch.detailsOffsets[to]), detail);
+    row += to - from;
+    detail += batch.detailsOffsets[to] - detailsFrom;
+  }
+  joined.detailsOffsets[count] = detail;
+  return joined;
+}
+
+/**
+ * Rows of a rank-sorted batch whose rank lies in [start, end]
+ */
+export function sliceByRank(batch: LeaderboardEntryBatch, start: number, end: number): BatchSlice {
+  let from = 0;
+  while (from < batch.count && batch.globalRanks[from] < start) from++;
+  let to = from;
+  while (to < batch.count && batch.globalRanks[to] <= end) to++;
+  return { batch, from, to };
+}
+
+/**
+ * Build one batch out of slices covering disjoint rank ranges, in rank order
+ */
+export function joinByRank(slices: BatchSlice[]): LeaderboardEntryBatch {
+  const rows = slices.filter(slice => slice.to > slice.from);
+  rows.sort((a, b) => a.batch.globalRanks[a.from] - b.batch.globalRanks[b.from]);
+  return rows.length > 0 ? joinSlices(rows) : emptyLeaderboardBatch();
+}
+
+/**
+ * SteamLeaderboardRangeCache
+ *
+ * Remembers which global rank ranges of each leaderboard have been downloaded,
+ * so a request that overlaps earlier ones only has to fetch the ranks that are
+ * missing. Ranges expire after a TTL; uploading a changed score invalidates the
+ * leaderboard, since it can shift every rank below it.
+ */
+export class SteamLeaderboardRangeCache {
+  private ttlMs: number = DEFAULT_TTL_MS;
+  private maxEntries: number = DEFAULT_MAX_ENTRIES;
+  /** Segments per leaderboard handle, sorted by start and non-overlapping */
+  private boards: Map<bigint, RankSegment[]> = new Map();
+
+  configure(options: LeaderboardCacheOptions): void {
+    if (options.ttlMs !== undefined) this.ttlMs = Math.max(0, options.ttlMs);
+    if (options.maxEntriesPerLeaderboard !== undefined) {
+      this.maxEntries = Math.max(0, Math.floor(options.maxEntriesPerLeaderboard));
+    }
+    if (!this.isEnabled()) this.boards.clear();
+  }
+
+  isEnabled(): boolean {
+    return this.ttlMs > 0 && this.maxEntries > 0;
+  }
+
+  /**
+   * Rank ranges within [start, end] that aren't cached (or have expired)
+   */
+  missingRanges(handle: bigint, start: number, end: number): Array<[number, number]> {
+    const segments = this.liveSegments(handle);
+    const missing: Array<[number, number]> = [];
+    let next = start;
+    for (const segment of segments) {
+      if (segment.end < next) continue;
+      if (segment.start > end) break;
+      if (segment.start > next) missing.push([next, segment.start - 1]);
+      next = segment.end + 1;
+      if (next > end) break;
+    }
+    if (next <= end) missing.push([next, end]);
+    return missing;
+  }
+
+  /**
+   * Store a freshly downloaded range, replacing whatever overlapped it
+   */
+  insert(handle: bigint, start: number, end: number, batch: LeaderboardEntryBatch): void {
+    if (!this.isEnabled()) return;
+
+    const now = Date.now();
+    const kept: RankSegment[] = [];
+    for (const segment of this.liveSegments(handle)) {
+      if (segment.end < start || segment.start > end) {
+        kept.push(segment);
+        continue;
+      }
+      if (segment.start < start) {
+        kept.push(this.trim(segment, segment.start, start - 1));
+      }
+      if (segment.end > end) {
+        kept.push(this.trim(segment, end + 1, segment.end));
+      }
+    }
+    kept.push({ start, end, batch, fetchedAt: now });
+    kept.sort((a, b) => a.start - b.start);
+
+    // Over the row budget: drop the oldest ranges first
+    let rows = kept.reduce((total, segment) => total + segment.batch.count, 0);
+    while (rows > this.maxEntries && kept.length > 0) {
+      let oldest = 0;
+      for (let i = 1; i < kept.length; i++) {
+        if (kept[i].fetchedAt < kept[oldest].fetchedAt) oldest = i;
+      }
+      rows -= kept[oldest].batch.count;
+      kept.splice(oldest, 1);
+    }
+    this.boards.set(handle, kept);
+  }
+
+  /**
+   * Cached rows for ranks [start, end], one slice per live segment
+   *
+   * Take these together with {@link missingRanges}: the segments can expire or
+   * be evicted by a later {@link insert}, the slices stay valid.
+   */
+  cachedSlices(handle: bigint, start: number, end: number): BatchSlice[] {
+    const slices: BatchSlice[] = [];
+    for (const segment of this.liveSegments(handle)) {
+      if (segment.end < start || segment.start > end) continue;
+      const slice = sliceByRank(segment.batch, start, end);
+      if (slice.to > slice.from) slices.push(slice);
+    }
+    return slices;
+  }
+
+  /**
+   * Drop cached ranges for one leaderboard, or for all of them
+   */
+  invalidate(handle?: bigint): void {
+    if (handle === undefined) {
+      this.boards.clear();
+    } else {
+      this.boards.delete(handle);
+    }
+  }
+
+  private liveSegments(handle: bigint): RankSegment[] {
+    const segments = this.boards.get(handle);
+    if (!segments) return [];
+    const cutoff = Date.now() - this.ttlMs;
+    const live = segments.filter(segment => segment.fetchedAt > cutoff);
+    if (live.length !== segments.length) this.boards.set(handle, live);
+    return live;
+  }
+
+  private trim(segment: RankSegment, start: number, end: number): RankSegment {
+    return { start, end, batch: joinSlices([sliceByRank(segment.batch, start, end)]), fetchedAt: segment.fetchedAt };
+  }
+}
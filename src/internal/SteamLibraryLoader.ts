@@ -1,5 +1,6 @@
 import * as koffi from 'koffi';
 import * as path from 'path';
+import { performance } from 'perf_hooks';
 import * as fs from 'fs';
 import { SteamLogger } from './SteamLogger';
 
@@ -70,11 +71,46 @@ export const InputMotionData_t = koffi.struct('InputMotionData_t', {
   rotVelZ: 'float',
 });
 
+/**
+ * Groups of FFI declarations, one per Steam interface. 'core' is bound in load();
+ * the others are bound the first time one of their functions is accessed.
+ */
+type BindingGroup =
+  | 'core'
+  | 'userStats'
+  | 'utils'
+  | 'networkingUtils'
+  | 'networkingSockets'
+  | 'friends'
+  | 'remoteStorage'
+  | 'ugc'
+  | 'input'
+  | 'screenshots'
+  | 'apps'
+  | 'matchmaking'
+  | 'user';
+
+const LAZY_BINDING_GROUPS: BindingGroup[] = [
+  'userStats', 'utils', 'networkingUtils', 'networkingSockets', 'friends', 'remoteStorage',
+  'ugc', 'input', 'screenshots', 'apps', 'matchmaking', 'user',
+];
+
+// Stand-in library for listing a group's function names without declaring them
+const NAME_RECORDING_LIB = { func: () => null } as unknown as koffi.IKoffiLib;
+
 /**
  * Handles loading the Steamworks native library and FFI function declarations
  */
 export class SteamLibraryLoader {
   private steamLib: koffi.IKoffiLib | null = null;
+  private libraryPath: string | null = null;
+
+  // Function names of each group not bound yet, with lazy accessors installed
+  private pendingGroups: Map<BindingGroup, string[]> = new Map();
+  private startupTimings: { libraryLoadMs: number; bindingMs: Record<string, number> } = {
+    libraryLoadMs: 0,
+    bindingMs: {},
+  };
 
   // Koffi function declarations
   public SteamAPI_Init!: koffi.KoffiFunction;
@@ -394,6 +430,14 @@ export class SteamLibraryLoader {
   // Batch operations
   public SteamAPI_ISteamRemoteStorage_BeginFileWriteBatch!: koffi.KoffiFunction;
   public SteamAPI_ISteamRemoteStorage_EndFileWriteBatch!: koffi.KoffiFunction;
+  
+  // Async reads and write streams
+  public SteamAPI_ISteamRemoteStorage_FileReadAsync!: koffi.KoffiFunction;
+  public SteamAPI_ISteamRemoteStorage_FileReadAsyncComplete!: koffi.KoffiFunction;
+  public SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen!: koffi.KoffiFunction;
+  public SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk!: koffi.KoffiFunction;
+  public SteamAPI_ISteamRemoteStorage_FileWriteStreamClose!: koffi.KoffiFunction;
+  public SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel!: koffi.KoffiFunction;
 
   // ========================================
   // ISteamUGC (Workshop) API Functions
@@ -816,7 +860,10 @@ export class SteamLibraryLoader {
   }
 
   /**
-   * Load the Steamworks library and bind all FFI functions
+   * Load the Steamworks library and bind the core FFI functions
+   * 
+   * Interface functions (Friends, Workshop, Input, ...) are declared per group on
+   * first use, so apps only pay for the interfaces they touch.
    * @param sdkPath Optional custom path to steamworks_sdk folder
    */
   load(sdkPath?: string): void {
@@ -829,668 +876,750 @@ export class SteamLibraryLoader {
     
     SteamLogger.debug(`[Steamworks] Loading library: ${libPath}`);
     
+    const loadStart = performance.now();
     this.steamLib = koffi.load(libPath);
+    this.libraryPath = libPath;
+    this.startupTimings = { libraryLoadMs: performance.now() - loadStart, bindingMs: {} };
 
-    // Define function signatures using Koffi
-    this.SteamAPI_Init = this.steamLib.func('SteamAPI_InitSafe', 'bool', []);
-    this.SteamAPI_Shutdown = this.steamLib.func('SteamAPI_Shutdown', 'void', []);
-    this.SteamAPI_RunCallbacks = this.steamLib.func('SteamAPI_RunCallbacks', 'void', []);
-    this.SteamAPI_IsSteamRunning = this.steamLib.func('SteamAPI_IsSteamRunning', 'bool', []);
-    this.SteamAPI_RestartAppIfNecessary = this.steamLib.func('SteamAPI_RestartAppIfNecessary', 'bool', ['uint32']);
+    // Core functions and interface accessors are bound now; every other
+    // interface's functions are bound the first time one of them is used
+    this.bindGroup('core');
+    for (const group of LAZY_BINDING_GROUPS) {
+      this.installLazyGroup(group);
+    }
+  }
+
+  /**
+   * Declare a group's functions, replacing its lazy accessors
+   */
+  private bindGroup(group: BindingGroup): void {
+    const names = this.pendingGroups.get(group);
+    if (names) {
+      this.pendingGroups.delete(group);
+      for (const name of names) {
+        delete (this as any)[name];
+      }
+    }
+    if (!this.steamLib) return;
+
+    const start = performance.now();
+    this.getBinder(group).call(this, this.steamLib);
+    const elapsed = performance.now() - start;
+    this.startupTimings.bindingMs[group] = elapsed;
+    SteamLogger.debug(`[Steamworks] Bound ${group} functions in ${elapsed.toFixed(2)}ms`);
+  }
+
+  /**
+   * Install accessors that bind a group on first access to any of its functions
+   */
+  private installLazyGroup(group: BindingGroup): void {
+    const names: string[] = [];
+    const recorder = new Proxy({}, {
+      set: (_target, name) => {
+        names.push(String(name));
+        return true;
+      },
+    });
+    this.getBinder(group).call(recorder as SteamLibraryLoader, NAME_RECORDING_LIB);
+
+    this.pendingGroups.set(group, names);
+    for (const name of names) {
+      Object.defineProperty(this, name, {
+        configurable: true,
+        enumerable: true,
+        get: () => {
+          this.bindGroup(group);
+          return (this as any)[name];
+        },
+      });
+    }
+  }
+
+  private getBinder(group: BindingGroup): (lib: koffi.IKoffiLib) => void {
+    const binders: Record<BindingGroup, (lib: koffi.IKoffiLib) => void> = {
+      core: this.bindCoreFunctions,
+      userStats: this.bindUserStatsFunctions,
+      utils: this.bindUtilsFunctions,
+      networkingUtils: this.bindNetworkingUtilsFunctions,
+      networkingSockets: this.bindNetworkingSocketsFunctions,
+      friends: this.bindFriendsFunctions,
+      remoteStorage: this.bindRemoteStorageFunctions,
+      ugc: this.bindUgcFunctions,
+      input: this.bindInputFunctions,
+      screenshots: this.bindScreenshotsFunctions,
+      apps: this.bindAppsFunctions,
+      matchmaking: this.bindMatchmakingFunctions,
+      user: this.bindUserFunctions,
+    };
+    return binders[group];
+  }
+
+  /**
+   * Core entry points, callback registration and interface accessors
+   */
+  private bindCoreFunctions(lib: koffi.IKoffiLib): void {
+    this.SteamAPI_Init = lib.func('SteamAPI_InitSafe', 'bool', []);
+    this.SteamAPI_Shutdown = lib.func('SteamAPI_Shutdown', 'void', []);
+    this.SteamAPI_RunCallbacks = lib.func('SteamAPI_RunCallbacks', 'void', []);
+    this.SteamAPI_IsSteamRunning = lib.func('SteamAPI_IsSteamRunning', 'bool', []);
+    this.SteamAPI_RestartAppIfNecessary = lib.func('SteamAPI_RestartAppIfNecessary', 'bool', ['uint32']);
     
     // Callback registration functions for manual callback handling
     // RegisterCallback(pCallback, iCallback) -> void
-    this.SteamAPI_RegisterCallback = this.steamLib.func('SteamAPI_RegisterCallback', 'void', ['void*', 'int']);
+    this.SteamAPI_RegisterCallback = lib.func('SteamAPI_RegisterCallback', 'void', ['void*', 'int']);
     // UnregisterCallback(pCallback) -> void
-    this.SteamAPI_UnregisterCallback = this.steamLib.func('SteamAPI_UnregisterCallback', 'void', ['void*']);
-    
-    this.SteamAPI_SteamUserStats_v013 = this.steamLib.func('SteamAPI_SteamUserStats_v013', 'void*', []);
-    this.SteamAPI_SteamUser_v023 = this.steamLib.func('SteamAPI_SteamUser_v023', 'void*', []);
-    this.SteamAPI_SteamUtils_v010 = this.steamLib.func('SteamAPI_SteamUtils_v010', 'void*', []);
-    
-    this.SteamAPI_ISteamUserStats_GetNumAchievements = this.steamLib.func('SteamAPI_ISteamUserStats_GetNumAchievements', 'uint32', ['void*']);
-    this.SteamAPI_ISteamUserStats_GetAchievementName = this.steamLib.func('SteamAPI_ISteamUserStats_GetAchievementName', 'str', ['void*', 'uint32']);
-    this.SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute = this.steamLib.func('SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute', 'str', ['void*', 'str', 'str']);
-    this.SteamAPI_ISteamUserStats_GetAchievement = this.steamLib.func('SteamAPI_ISteamUserStats_GetAchievement', 'bool', ['void*', 'str', 'bool*']);
-    this.SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime = this.steamLib.func('SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime', 'bool', ['void*', 'str', 'bool*', 'uint32*']);
-    this.SteamAPI_ISteamUserStats_SetAchievement = this.steamLib.func('SteamAPI_ISteamUserStats_SetAchievement', 'bool', ['void*', 'str']);
-    this.SteamAPI_ISteamUserStats_ClearAchievement = this.steamLib.func('SteamAPI_ISteamUserStats_ClearAchievement', 'bool', ['void*', 'str']);
-    this.SteamAPI_ISteamUserStats_StoreStats = this.steamLib.func('SteamAPI_ISteamUserStats_StoreStats', 'bool', ['void*']);
-    this.SteamAPI_ISteamUserStats_RequestCurrentStats = this.steamLib.func('SteamAPI_ISteamUserStats_RequestUserStats', 'uint64', ['void*', 'uint64']);
-    this.SteamAPI_ISteamUser_GetSteamID = this.steamLib.func('SteamAPI_ISteamUser_GetSteamID', 'uint64', ['void*']);
+    this.SteamAPI_UnregisterCallback = lib.func('SteamAPI_UnregisterCallback', 'void', ['void*']);
+    
+    // Interface accessors
+    this.SteamAPI_SteamUserStats_v013 = lib.func('SteamAPI_SteamUserStats_v013', 'void*', []);
+    this.SteamAPI_SteamUser_v023 = lib.func('SteamAPI_SteamUser_v023', 'void*', []);
+    this.SteamAPI_SteamUtils_v010 = lib.func('SteamAPI_SteamUtils_v010', 'void*', []);
+    this.SteamAPI_SteamNetworkingUtils_SteamAPI_v004 = lib.func('SteamAPI_SteamNetworkingUtils_SteamAPI_v004', 'void*', []);
+    this.SteamAPI_SteamNetworkingSockets_SteamAPI_v012 = lib.func('SteamAPI_SteamNetworkingSockets_SteamAPI_v012', 'void*', []);
+    this.SteamAPI_SteamFriends_v018 = lib.func('SteamAPI_SteamFriends_v018', 'void*', []);
+    this.SteamAPI_SteamRemoteStorage_v016 = lib.func('SteamAPI_SteamRemoteStorage_v016', 'void*', []);
+    this.SteamAPI_SteamUGC_v021 = lib.func('SteamAPI_SteamUGC_v021', 'void*', []);
+    this.SteamAPI_SteamInput_v006 = lib.func('SteamAPI_SteamInput_v006', 'void*', []);
+    this.SteamAPI_SteamScreenshots_v003 = lib.func('SteamAPI_SteamScreenshots_v003', 'void*', []);
+    this.SteamAPI_SteamApps_v009 = lib.func('SteamAPI_SteamApps_v009', 'void*', []);
+    this.SteamAPI_SteamMatchmaking_v009 = lib.func('SteamAPI_SteamMatchmaking_v009', 'void*', []);
+  }
+
+  /**
+   * ISteamUserStats functions (achievements, stats, leaderboards)
+   */
+  private bindUserStatsFunctions(lib: koffi.IKoffiLib): void {
+    this.SteamAPI_ISteamUserStats_GetNumAchievements = lib.func('SteamAPI_ISteamUserStats_GetNumAchievements', 'uint32', ['void*']);
+    this.SteamAPI_ISteamUserStats_GetAchievementName = lib.func('SteamAPI_ISteamUserStats_GetAchievementName', 'str', ['void*', 'uint32']);
+    this.SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute = lib.func('SteamAPI_ISteamUserStats_GetAchievementDisplayAttribute', 'str', ['void*', 'str', 'str']);
+    this.SteamAPI_ISteamUserStats_GetAchievement = lib.func('SteamAPI_ISteamUserStats_GetAchievement', 'bool', ['void*', 'str', 'bool*']);
+    this.SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime = lib.func('SteamAPI_ISteamUserStats_GetAchievementAndUnlockTime', 'bool', ['void*', 'str', 'bool*', 'uint32*']);
+    this.SteamAPI_ISteamUserStats_SetAchievement = lib.func('SteamAPI_ISteamUserStats_SetAchievement', 'bool', ['void*', 'str']);
+    this.SteamAPI_ISteamUserStats_ClearAchievement = lib.func('SteamAPI_ISteamUserStats_ClearAchievement', 'bool', ['void*', 'str']);
+    this.SteamAPI_ISteamUserStats_StoreStats = lib.func('SteamAPI_ISteamUserStats_StoreStats', 'bool', ['void*']);
+    this.SteamAPI_ISteamUserStats_RequestCurrentStats = lib.func('SteamAPI_ISteamUserStats_RequestUserStats', 'uint64', ['void*', 'uint64']);
     
     // Achievement icon and visual functions
-    this.SteamAPI_ISteamUserStats_GetAchievementIcon = this.steamLib.func('SteamAPI_ISteamUserStats_GetAchievementIcon', 'int', ['void*', 'str']);
-    this.SteamAPI_ISteamUserStats_IndicateAchievementProgress = this.steamLib.func('SteamAPI_ISteamUserStats_IndicateAchievementProgress', 'bool', ['void*', 'str', 'uint32', 'uint32']);
+    this.SteamAPI_ISteamUserStats_GetAchievementIcon = lib.func('SteamAPI_ISteamUserStats_GetAchievementIcon', 'int', ['void*', 'str']);
+    this.SteamAPI_ISteamUserStats_IndicateAchievementProgress = lib.func('SteamAPI_ISteamUserStats_IndicateAchievementProgress', 'bool', ['void*', 'str', 'uint32', 'uint32']);
     
     // Achievement progress limits
-    this.SteamAPI_ISteamUserStats_GetAchievementProgressLimitsInt32 = this.steamLib.func('SteamAPI_ISteamUserStats_GetAchievementProgressLimitsInt32', 'bool', ['void*', 'str', 'int32*', 'int32*']);
-    this.SteamAPI_ISteamUserStats_GetAchievementProgressLimitsFloat = this.steamLib.func('SteamAPI_ISteamUserStats_GetAchievementProgressLimitsFloat', 'bool', ['void*', 'str', 'float*', 'float*']);
+    this.SteamAPI_ISteamUserStats_GetAchievementProgressLimitsInt32 = lib.func('SteamAPI_ISteamUserStats_GetAchievementProgressLimitsInt32', 'bool', ['void*', 'str', 'int32*', 'int32*']);
+    this.SteamAPI_ISteamUserStats_GetAchievementProgressLimitsFloat = lib.func('SteamAPI_ISteamUserStats_GetAchievementProgressLimitsFloat', 'bool', ['void*', 'str', 'float*', 'float*']);
     
     // Friend/user achievements
-    this.SteamAPI_ISteamUserStats_RequestUserStats = this.steamLib.func('SteamAPI_ISteamUserStats_RequestUserStats', 'uint64', ['void*', 'uint64']);
-    this.SteamAPI_ISteamUserStats_GetUserAchievement = this.steamLib.func('SteamAPI_ISteamUserStats_GetUserAchievement', 'bool', ['void*', 'uint64', 'str', 'bool*']);
-    this.SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime = this.steamLib.func('SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime', 'bool', ['void*', 'uint64', 'str', 'bool*', 'uint32*']);
+    this.SteamAPI_ISteamUserStats_RequestUserStats = lib.func('SteamAPI_ISteamUserStats_RequestUserStats', 'uint64', ['void*', 'uint64']);
+    this.SteamAPI_ISteamUserStats_GetUserAchievement = lib.func('SteamAPI_ISteamUserStats_GetUserAchievement', 'bool', ['void*', 'uint64', 'str', 'bool*']);
+    this.SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime = lib.func('SteamAPI_ISteamUserStats_GetUserAchievementAndUnlockTime', 'bool', ['void*', 'uint64', 'str', 'bool*', 'uint32*']);
     
     // Global achievement percentages
-    this.SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages = this.steamLib.func('SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages', 'uint64', ['void*']);
-    this.SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo = this.steamLib.func('SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo', 'int', ['void*', 'char*', 'uint32', 'float*', 'bool*']);
-    this.SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo = this.steamLib.func('SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo', 'int', ['void*', 'int', 'char*', 'uint32', 'float*', 'bool*']);
-    this.SteamAPI_ISteamUserStats_GetAchievementAchievedPercent = this.steamLib.func('SteamAPI_ISteamUserStats_GetAchievementAchievedPercent', 'bool', ['void*', 'str', 'float*']);
+    this.SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages = lib.func('SteamAPI_ISteamUserStats_RequestGlobalAchievementPercentages', 'uint64', ['void*']);
+    this.SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo = lib.func('SteamAPI_ISteamUserStats_GetMostAchievedAchievementInfo', 'int', ['void*', 'char*', 'uint32', 'float*', 'bool*']);
+    this.SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo = lib.func('SteamAPI_ISteamUserStats_GetNextMostAchievedAchievementInfo', 'int', ['void*', 'int', 'char*', 'uint32', 'float*', 'bool*']);
+    this.SteamAPI_ISteamUserStats_GetAchievementAchievedPercent = lib.func('SteamAPI_ISteamUserStats_GetAchievementAchievedPercent', 'bool', ['void*', 'str', 'float*']);
     
     // Reset stats
-    this.SteamAPI_ISteamUserStats_ResetAllStats = this.steamLib.func('SteamAPI_ISteamUserStats_ResetAllStats', 'bool', ['void*', 'bool']);
-    
-    // ========================================
-    // Stats API Functions
-    // ========================================
+    this.SteamAPI_ISteamUserStats_ResetAllStats = lib.func('SteamAPI_ISteamUserStats_ResetAllStats', 'bool', ['void*', 'bool']);
     
     // User stats (get/set)
-    this.SteamAPI_ISteamUserStats_GetStatInt32 = this.steamLib.func('SteamAPI_ISteamUserStats_GetStatInt32', 'bool', ['void*', 'str', 'int32*']);
-    this.SteamAPI_ISteamUserStats_GetStatFloat = this.steamLib.func('SteamAPI_ISteamUserStats_GetStatFloat', 'bool', ['void*', 'str', 'float*']);
-    this.SteamAPI_ISteamUserStats_SetStatInt32 = this.steamLib.func('SteamAPI_ISteamUserStats_SetStatInt32', 'bool', ['void*', 'str', 'int32']);
-    this.SteamAPI_ISteamUserStats_SetStatFloat = this.steamLib.func('SteamAPI_ISteamUserStats_SetStatFloat', 'bool', ['void*', 'str', 'float']);
-    this.SteamAPI_ISteamUserStats_UpdateAvgRateStat = this.steamLib.func('SteamAPI_ISteamUserStats_UpdateAvgRateStat', 'bool', ['void*', 'str', 'float', 'double']);
+    this.SteamAPI_ISteamUserStats_GetStatInt32 = lib.func('SteamAPI_ISteamUserStats_GetStatInt32', 'bool', ['void*', 'str', 'int32*']);
+    this.SteamAPI_ISteamUserStats_GetStatFloat = lib.func('SteamAPI_ISteamUserStats_GetStatFloat', 'bool', ['void*', 'str', 'float*']);
+    this.SteamAPI_ISteamUserStats_SetStatInt32 = lib.func('SteamAPI_ISteamUserStats_SetStatInt32', 'bool', ['void*', 'str', 'int32']);
+    this.SteamAPI_ISteamUserStats_SetStatFloat = lib.func('SteamAPI_ISteamUserStats_SetStatFloat', 'bool', ['void*', 'str', 'float']);
+    this.SteamAPI_ISteamUserStats_UpdateAvgRateStat = lib.func('SteamAPI_ISteamUserStats_UpdateAvgRateStat', 'bool', ['void*', 'str', 'float', 'double']);
     
     // Friend/user stats
-    this.SteamAPI_ISteamUserStats_GetUserStatInt32 = this.steamLib.func('SteamAPI_ISteamUserStats_GetUserStatInt32', 'bool', ['void*', 'uint64', 'str', 'int32*']);
-    this.SteamAPI_ISteamUserStats_GetUserStatFloat = this.steamLib.func('SteamAPI_ISteamUserStats_GetUserStatFloat', 'bool', ['void*', 'uint64', 'str', 'float*']);
+    this.SteamAPI_ISteamUserStats_GetUserStatInt32 = lib.func('SteamAPI_ISteamUserStats_GetUserStatInt32', 'bool', ['void*', 'uint64', 'str', 'int32*']);
+    this.SteamAPI_ISteamUserStats_GetUserStatFloat = lib.func('SteamAPI_ISteamUserStats_GetUserStatFloat', 'bool', ['void*', 'uint64', 'str', 'float*']);
     
     // Global stats
-    this.SteamAPI_ISteamUserStats_RequestGlobalStats = this.steamLib.func('SteamAPI_ISteamUserStats_RequestGlobalStats', 'uint64', ['void*', 'int']);
-    this.SteamAPI_ISteamUserStats_GetGlobalStatInt64 = this.steamLib.func('SteamAPI_ISteamUserStats_GetGlobalStatInt64', 'bool', ['void*', 'str', 'int64*']);
-    this.SteamAPI_ISteamUserStats_GetGlobalStatDouble = this.steamLib.func('SteamAPI_ISteamUserStats_GetGlobalStatDouble', 'bool', ['void*', 'str', 'double*']);
-    this.SteamAPI_ISteamUserStats_GetGlobalStatHistoryInt64 = this.steamLib.func('SteamAPI_ISteamUserStats_GetGlobalStatHistoryInt64', 'int32', ['void*', 'str', 'int64*', 'uint32']);
-    this.SteamAPI_ISteamUserStats_GetGlobalStatHistoryDouble = this.steamLib.func('SteamAPI_ISteamUserStats_GetGlobalStatHistoryDouble', 'int32', ['void*', 'str', 'double*', 'uint32']);
+    this.SteamAPI_ISteamUserStats_RequestGlobalStats = lib.func('SteamAPI_ISteamUserStats_RequestGlobalStats', 'uint64', ['void*', 'int']);
+    this.SteamAPI_ISteamUserStats_GetGlobalStatInt64 = lib.func('SteamAPI_ISteamUserStats_GetGlobalStatInt64', 'bool', ['void*', 'str', 'int64*']);
+    this.SteamAPI_ISteamUserStats_GetGlobalStatDouble = lib.func('SteamAPI_ISteamUserStats_GetGlobalStatDouble', 'bool', ['void*', 'str', 'double*']);
+    this.SteamAPI_ISteamUserStats_GetGlobalStatHistoryInt64 = lib.func('SteamAPI_ISteamUserStats_GetGlobalStatHistoryInt64', 'int32', ['void*', 'str', 'int64*', 'uint32']);
+    this.SteamAPI_ISteamUserStats_GetGlobalStatHistoryDouble = lib.func('SteamAPI_ISteamUserStats_GetGlobalStatHistoryDouble', 'int32', ['void*', 'str', 'double*', 'uint32']);
     
     // Player count
-    this.SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers = this.steamLib.func('SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers', 'uint64', ['void*']);
-    
-    // ========================================
-    // Leaderboard API Functions
-    // ========================================
+    this.SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers = lib.func('SteamAPI_ISteamUserStats_GetNumberOfCurrentPlayers', 'uint64', ['void*']);
     
     // Leaderboard find/create
-    this.SteamAPI_ISteamUserStats_FindOrCreateLeaderboard = this.steamLib.func('SteamAPI_ISteamUserStats_FindOrCreateLeaderboard', 'uint64', ['void*', 'str', 'int', 'int']);
-    this.SteamAPI_ISteamUserStats_FindLeaderboard = this.steamLib.func('SteamAPI_ISteamUserStats_FindLeaderboard', 'uint64', ['void*', 'str']);
+    this.SteamAPI_ISteamUserStats_FindOrCreateLeaderboard = lib.func('SteamAPI_ISteamUserStats_FindOrCreateLeaderboard', 'uint64', ['void*', 'str', 'int', 'int']);
+    this.SteamAPI_ISteamUserStats_FindLeaderboard = lib.func('SteamAPI_ISteamUserStats_FindLeaderboard', 'uint64', ['void*', 'str']);
     
     // Leaderboard info
-    this.SteamAPI_ISteamUserStats_GetLeaderboardName = this.steamLib.func('SteamAPI_ISteamUserStats_GetLeaderboardName', 'str', ['void*', 'uint64']);
-    this.SteamAPI_ISteamUserStats_GetLeaderboardEntryCount = this.steamLib.func('SteamAPI_ISteamUserStats_GetLeaderboardEntryCount', 'int', ['void*', 'uint64']);
-    this.SteamAPI_ISteamUserStats_GetLeaderboardSortMethod = this.steamLib.func('SteamAPI_ISteamUserStats_GetLeaderboardSortMethod', 'int', ['void*', 'uint64']);
-    this.SteamAPI_ISteamUserStats_GetLeaderboardDisplayType = this.steamLib.func('SteamAPI_ISteamUserStats_GetLeaderboardDisplayType', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamUserStats_GetLeaderboardName = lib.func('SteamAPI_ISteamUserStats_GetLeaderboardName', 'str', ['void*', 'uint64']);
+    this.SteamAPI_ISteamUserStats_GetLeaderboardEntryCount = lib.func('SteamAPI_ISteamUserStats_GetLeaderboardEntryCount', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamUserStats_GetLeaderboardSortMethod = lib.func('SteamAPI_ISteamUserStats_GetLeaderboardSortMethod', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamUserStats_GetLeaderboardDisplayType = lib.func('SteamAPI_ISteamUserStats_GetLeaderboardDisplayType', 'int', ['void*', 'uint64']);
     
     // Leaderboard entries
-    this.SteamAPI_ISteamUserStats_DownloadLeaderboardEntries = this.steamLib.func('SteamAPI_ISteamUserStats_DownloadLeaderboardEntries', 'uint64', ['void*', 'uint64', 'int', 'int', 'int']);
-    this.SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers = this.steamLib.func('SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers', 'uint64', ['void*', 'uint64', 'uint64*', 'int']);
-    this.SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry = this.steamLib.func('SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry', 'bool', ['void*', 'uint64', 'int', 'void*', 'int32*', 'int']);
+    this.SteamAPI_ISteamUserStats_DownloadLeaderboardEntries = lib.func('SteamAPI_ISteamUserStats_DownloadLeaderboardEntries', 'uint64', ['void*', 'uint64', 'int', 'int', 'int']);
+    this.SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers = lib.func('SteamAPI_ISteamUserStats_DownloadLeaderboardEntriesForUsers', 'uint64', ['void*', 'uint64', 'uint64*', 'int']);
+    this.SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry = lib.func('SteamAPI_ISteamUserStats_GetDownloadedLeaderboardEntry', 'bool', ['void*', 'uint64', 'int', 'void*', 'int32*', 'int']);
     
     // Leaderboard upload
-    this.SteamAPI_ISteamUserStats_UploadLeaderboardScore = this.steamLib.func('SteamAPI_ISteamUserStats_UploadLeaderboardScore', 'uint64', ['void*', 'uint64', 'int', 'int32', 'int32*', 'int']);
-    this.SteamAPI_ISteamUserStats_AttachLeaderboardUGC = this.steamLib.func('SteamAPI_ISteamUserStats_AttachLeaderboardUGC', 'uint64', ['void*', 'uint64', 'uint64']);
-    
-    // ========================================
-    // ISteamUtils Functions
-    // ========================================
-    
+    this.SteamAPI_ISteamUserStats_UploadLeaderboardScore = lib.func('SteamAPI_ISteamUserStats_UploadLeaderboardScore', 'uint64', ['void*', 'uint64', 'int', 'int32', 'int32*', 'int']);
+    this.SteamAPI_ISteamUserStats_AttachLeaderboardUGC = lib.func('SteamAPI_ISteamUserStats_AttachLeaderboardUGC', 'uint64', ['void*', 'uint64', 'uint64']);
+  }
+
+  /**
+   * ISteamUtils functions
+   */
+  private bindUtilsFunctions(lib: koffi.IKoffiLib): void {
     // API call result checking
-    this.SteamAPI_ISteamUtils_IsAPICallCompleted = this.steamLib.func('SteamAPI_ISteamUtils_IsAPICallCompleted', 'bool', ['void*', 'uint64', 'bool*']);
-    this.SteamAPI_ISteamUtils_GetAPICallResult = this.steamLib.func('SteamAPI_ISteamUtils_GetAPICallResult', 'bool', ['void*', 'uint64', 'void*', 'int', 'int', 'bool*']);
-    this.SteamAPI_ISteamUtils_GetAPICallFailureReason = this.steamLib.func('SteamAPI_ISteamUtils_GetAPICallFailureReason', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamUtils_IsAPICallCompleted = lib.func('SteamAPI_ISteamUtils_IsAPICallCompleted', 'bool', ['void*', 'uint64', 'bool*']);
+    this.SteamAPI_ISteamUtils_GetAPICallResult = lib.func('SteamAPI_ISteamUtils_GetAPICallResult', 'bool', ['void*', 'uint64', 'void*', 'int', 'int', 'bool*']);
+    this.SteamAPI_ISteamUtils_GetAPICallFailureReason = lib.func('SteamAPI_ISteamUtils_GetAPICallFailureReason', 'int', ['void*', 'uint64']);
     
     // System information
-    this.SteamAPI_ISteamUtils_GetIPCountry = this.steamLib.func('SteamAPI_ISteamUtils_GetIPCountry', 'str', ['void*']);
-    this.SteamAPI_ISteamUtils_GetCurrentBatteryPower = this.steamLib.func('SteamAPI_ISteamUtils_GetCurrentBatteryPower', 'uint8', ['void*']);
-    this.SteamAPI_ISteamUtils_GetAppID = this.steamLib.func('SteamAPI_ISteamUtils_GetAppID', 'uint32', ['void*']);
-    this.SteamAPI_ISteamUtils_GetSecondsSinceAppActive = this.steamLib.func('SteamAPI_ISteamUtils_GetSecondsSinceAppActive', 'uint32', ['void*']);
-    this.SteamAPI_ISteamUtils_GetSecondsSinceComputerActive = this.steamLib.func('SteamAPI_ISteamUtils_GetSecondsSinceComputerActive', 'uint32', ['void*']);
-    this.SteamAPI_ISteamUtils_GetServerRealTime = this.steamLib.func('SteamAPI_ISteamUtils_GetServerRealTime', 'uint32', ['void*']);
-    this.SteamAPI_ISteamUtils_GetSteamUILanguage = this.steamLib.func('SteamAPI_ISteamUtils_GetSteamUILanguage', 'str', ['void*']);
-    this.SteamAPI_ISteamUtils_GetConnectedUniverse = this.steamLib.func('SteamAPI_ISteamUtils_GetConnectedUniverse', 'int', ['void*']);
+    this.SteamAPI_ISteamUtils_GetIPCountry = lib.func('SteamAPI_ISteamUtils_GetIPCountry', 'str', ['void*']);
+    this.SteamAPI_ISteamUtils_GetCurrentBatteryPower = lib.func('SteamAPI_ISteamUtils_GetCurrentBatteryPower', 'uint8', ['void*']);
+    this.SteamAPI_ISteamUtils_GetAppID = lib.func('SteamAPI_ISteamUtils_GetAppID', 'uint32', ['void*']);
+    this.SteamAPI_ISteamUtils_GetSecondsSinceAppActive = lib.func('SteamAPI_ISteamUtils_GetSecondsSinceAppActive', 'uint32', ['void*']);
+    this.SteamAPI_ISteamUtils_GetSecondsSinceComputerActive = lib.func('SteamAPI_ISteamUtils_GetSecondsSinceComputerActive', 'uint32', ['void*']);
+    this.SteamAPI_ISteamUtils_GetServerRealTime = lib.func('SteamAPI_ISteamUtils_GetServerRealTime', 'uint32', ['void*']);
+    this.SteamAPI_ISteamUtils_GetSteamUILanguage = lib.func('SteamAPI_ISteamUtils_GetSteamUILanguage', 'str', ['void*']);
+    this.SteamAPI_ISteamUtils_GetConnectedUniverse = lib.func('SteamAPI_ISteamUtils_GetConnectedUniverse', 'int', ['void*']);
     
     // Steam Deck / Device detection
-    this.SteamAPI_ISteamUtils_IsSteamRunningOnSteamDeck = this.steamLib.func('SteamAPI_ISteamUtils_IsSteamRunningOnSteamDeck', 'bool', ['void*']);
-    this.SteamAPI_ISteamUtils_IsSteamInBigPictureMode = this.steamLib.func('SteamAPI_ISteamUtils_IsSteamInBigPictureMode', 'bool', ['void*']);
-    this.SteamAPI_ISteamUtils_IsVRHeadsetStreamingEnabled = this.steamLib.func('SteamAPI_ISteamUtils_IsVRHeadsetStreamingEnabled', 'bool', ['void*']);
-    this.SteamAPI_ISteamUtils_SetVRHeadsetStreamingEnabled = this.steamLib.func('SteamAPI_ISteamUtils_SetVRHeadsetStreamingEnabled', 'void', ['void*', 'bool']);
-    this.SteamAPI_ISteamUtils_IsSteamChinaLauncher = this.steamLib.func('SteamAPI_ISteamUtils_IsSteamChinaLauncher', 'bool', ['void*']);
+    this.SteamAPI_ISteamUtils_IsSteamRunningOnSteamDeck = lib.func('SteamAPI_ISteamUtils_IsSteamRunningOnSteamDeck', 'bool', ['void*']);
+    this.SteamAPI_ISteamUtils_IsSteamInBigPictureMode = lib.func('SteamAPI_ISteamUtils_IsSteamInBigPictureMode', 'bool', ['void*']);
+    this.SteamAPI_ISteamUtils_IsVRHeadsetStreamingEnabled = lib.func('SteamAPI_ISteamUtils_IsVRHeadsetStreamingEnabled', 'bool', ['void*']);
+    this.SteamAPI_ISteamUtils_SetVRHeadsetStreamingEnabled = lib.func('SteamAPI_ISteamUtils_SetVRHeadsetStreamingEnabled', 'void', ['void*', 'bool']);
+    this.SteamAPI_ISteamUtils_IsSteamChinaLauncher = lib.func('SteamAPI_ISteamUtils_IsSteamChinaLauncher', 'bool', ['void*']);
     
     // Overlay notifications
-    this.SteamAPI_ISteamUtils_SetOverlayNotificationPosition = this.steamLib.func('SteamAPI_ISteamUtils_SetOverlayNotificationPosition', 'void', ['void*', 'int']);
-    this.SteamAPI_ISteamUtils_SetOverlayNotificationInset = this.steamLib.func('SteamAPI_ISteamUtils_SetOverlayNotificationInset', 'void', ['void*', 'int', 'int']);
-    this.SteamAPI_ISteamUtils_BOverlayNeedsPresent = this.steamLib.func('SteamAPI_ISteamUtils_BOverlayNeedsPresent', 'bool', ['void*']);
-    this.SteamAPI_ISteamUtils_IsOverlayEnabled = this.steamLib.func('SteamAPI_ISteamUtils_IsOverlayEnabled', 'bool', ['void*']);
+    this.SteamAPI_ISteamUtils_SetOverlayNotificationPosition = lib.func('SteamAPI_ISteamUtils_SetOverlayNotificationPosition', 'void', ['void*', 'int']);
+    this.SteamAPI_ISteamUtils_SetOverlayNotificationInset = lib.func('SteamAPI_ISteamUtils_SetOverlayNotificationInset', 'void', ['void*', 'int', 'int']);
+    this.SteamAPI_ISteamUtils_BOverlayNeedsPresent = lib.func('SteamAPI_ISteamUtils_BOverlayNeedsPresent', 'bool', ['void*']);
+    this.SteamAPI_ISteamUtils_IsOverlayEnabled = lib.func('SteamAPI_ISteamUtils_IsOverlayEnabled', 'bool', ['void*']);
     
     // Image loading
-    this.SteamAPI_ISteamUtils_GetImageSize = this.steamLib.func('SteamAPI_ISteamUtils_GetImageSize', 'bool', ['void*', 'int', 'uint32*', 'uint32*']);
-    this.SteamAPI_ISteamUtils_GetImageRGBA = this.steamLib.func('SteamAPI_ISteamUtils_GetImageRGBA', 'bool', ['void*', 'int', 'uint8*', 'int']);
+    this.SteamAPI_ISteamUtils_GetImageSize = lib.func('SteamAPI_ISteamUtils_GetImageSize', 'bool', ['void*', 'int', 'uint32*', 'uint32*']);
+    this.SteamAPI_ISteamUtils_GetImageRGBA = lib.func('SteamAPI_ISteamUtils_GetImageRGBA', 'bool', ['void*', 'int', 'uint8*', 'int']);
     
     // Gamepad text input
-    this.SteamAPI_ISteamUtils_ShowGamepadTextInput = this.steamLib.func('SteamAPI_ISteamUtils_ShowGamepadTextInput', 'bool', ['void*', 'int', 'int', 'str', 'uint32', 'str']);
-    this.SteamAPI_ISteamUtils_GetEnteredGamepadTextLength = this.steamLib.func('SteamAPI_ISteamUtils_GetEnteredGamepadTextLength', 'uint32', ['void*']);
-    this.SteamAPI_ISteamUtils_GetEnteredGamepadTextInput = this.steamLib.func('SteamAPI_ISteamUtils_GetEnteredGamepadTextInput', 'bool', ['void*', 'str', 'uint32']);
-    this.SteamAPI_ISteamUtils_ShowFloatingGamepadTextInput = this.steamLib.func('SteamAPI_ISteamUtils_ShowFloatingGamepadTextInput', 'bool', ['void*', 'int', 'int', 'int', 'int', 'int']);
-    this.SteamAPI_ISteamUtils_DismissFloatingGamepadTextInput = this.steamLib.func('SteamAPI_ISteamUtils_DismissFloatingGamepadTextInput', 'bool', ['void*']);
+    this.SteamAPI_ISteamUtils_ShowGamepadTextInput = lib.func('SteamAPI_ISteamUtils_ShowGamepadTextInput', 'bool', ['void*', 'int', 'int', 'str', 'uint32', 'str']);
+    this.SteamAPI_ISteamUtils_GetEnteredGamepadTextLength = lib.func('SteamAPI_ISteamUtils_GetEnteredGamepadTextLength', 'uint32', ['void*']);
+    this.SteamAPI_ISteamUtils_GetEnteredGamepadTextInput = lib.func('SteamAPI_ISteamUtils_GetEnteredGamepadTextInput', 'bool', ['void*', 'str', 'uint32']);
+    this.SteamAPI_ISteamUtils_ShowFloatingGamepadTextInput = lib.func('SteamAPI_ISteamUtils_ShowFloatingGamepadTextInput', 'bool', ['void*', 'int', 'int', 'int', 'int', 'int']);
+    this.SteamAPI_ISteamUtils_DismissFloatingGamepadTextInput = lib.func('SteamAPI_ISteamUtils_DismissFloatingGamepadTextInput', 'bool', ['void*']);
     
     // Misc utilities
-    this.SteamAPI_ISteamUtils_GetIPCCallCount = this.steamLib.func('SteamAPI_ISteamUtils_GetIPCCallCount', 'uint32', ['void*']);
-    this.SteamAPI_ISteamUtils_StartVRDashboard = this.steamLib.func('SteamAPI_ISteamUtils_StartVRDashboard', 'void', ['void*']);
+    this.SteamAPI_ISteamUtils_GetIPCCallCount = lib.func('SteamAPI_ISteamUtils_GetIPCCallCount', 'uint32', ['void*']);
+    this.SteamAPI_ISteamUtils_StartVRDashboard = lib.func('SteamAPI_ISteamUtils_StartVRDashboard', 'void', ['void*']);
     
     // Text filtering
-    this.SteamAPI_ISteamUtils_FilterText = this.steamLib.func('SteamAPI_ISteamUtils_FilterText', 'int', ['void*', 'int', 'uint64', 'str', 'str', 'uint32']);
-    this.SteamAPI_ISteamUtils_InitFilterText = this.steamLib.func('SteamAPI_ISteamUtils_InitFilterText', 'bool', ['void*', 'uint32']);
-    
-    // ========================================
-    // ISteamNetworkingUtils Functions
-    // ========================================
-    
-    // Interface accessor
-    this.SteamAPI_SteamNetworkingUtils_SteamAPI_v004 = this.steamLib.func('SteamAPI_SteamNetworkingUtils_SteamAPI_v004', 'void*', []);
-    
+    this.SteamAPI_ISteamUtils_FilterText = lib.func('SteamAPI_ISteamUtils_FilterText', 'int', ['void*', 'int', 'uint64', 'str', 'str', 'uint32']);
+    this.SteamAPI_ISteamUtils_InitFilterText = lib.func('SteamAPI_ISteamUtils_InitFilterText', 'bool', ['void*', 'uint32']);
+  }
+
+  /**
+   * ISteamNetworkingUtils functions
+   */
+  private bindNetworkingUtilsFunctions(lib: koffi.IKoffiLib): void {
     // Relay network access
-    this.SteamAPI_ISteamNetworkingUtils_InitRelayNetworkAccess = this.steamLib.func('SteamAPI_ISteamNetworkingUtils_InitRelayNetworkAccess', 'void', ['void*']);
-    this.SteamAPI_ISteamNetworkingUtils_GetRelayNetworkStatus = this.steamLib.func('SteamAPI_ISteamNetworkingUtils_GetRelayNetworkStatus', 'int', ['void*', 'void*']);
+    this.SteamAPI_ISteamNetworkingUtils_InitRelayNetworkAccess = lib.func('SteamAPI_ISteamNetworkingUtils_InitRelayNetworkAccess', 'void', ['void*']);
+    this.SteamAPI_ISteamNetworkingUtils_GetRelayNetworkStatus = lib.func('SteamAPI_ISteamNetworkingUtils_GetRelayNetworkStatus', 'int', ['void*', 'void*']);
     
     // Ping location - SteamNetworkPingLocation_t is 512 bytes
-    this.SteamAPI_ISteamNetworkingUtils_GetLocalPingLocation = this.steamLib.func('SteamAPI_ISteamNetworkingUtils_GetLocalPingLocation', 'float', ['void*', 'void*']);
-    this.SteamAPI_ISteamNetworkingUtils_EstimatePingTimeBetweenTwoLocations = this.steamLib.func('SteamAPI_ISteamNetworkingUtils_EstimatePingTimeBetweenTwoLocations', 'int', ['void*', 'void*', 'void*']);
-    this.SteamAPI_ISteamNetworkingUtils_EstimatePingTimeFromLocalHost = this.steamLib.func('SteamAPI_ISteamNetworkingUtils_EstimatePingTimeFromLocalHost', 'int', ['void*', 'void*']);
-    this.SteamAPI_ISteamNetworkingUtils_ConvertPingLocationToString = this.steamLib.func('SteamAPI_ISteamNetworkingUtils_ConvertPingLocationToString', 'void', ['void*', 'void*', 'str', 'int']);
-    this.SteamAPI_ISteamNetworkingUtils_ParsePingLocationString = this.steamLib.func('SteamAPI_ISteamNetworkingUtils_ParsePingLocationString', 'bool', ['void*', 'str', 'void*']);
-    this.SteamAPI_ISteamNetworkingUtils_CheckPingDataUpToDate = this.steamLib.func('SteamAPI_ISteamNetworkingUtils_CheckPingDataUpToDate', 'bool', ['void*', 'float']);
+    this.SteamAPI_ISteamNetworkingUtils_GetLocalPingLocation = lib.func('SteamAPI_ISteamNetworkingUtils_GetLocalPingLocation', 'float', ['void*', 'void*']);
+    this.SteamAPI_ISteamNetworkingUtils_EstimatePingTimeBetweenTwoLocations = lib.func('SteamAPI_ISteamNetworkingUtils_EstimatePingTimeBetweenTwoLocations', 'int', ['void*', 'void*', 'void*']);
+    this.SteamAPI_ISteamNetworkingUtils_EstimatePingTimeFromLocalHost = lib.func('SteamAPI_ISteamNetworkingUtils_EstimatePingTimeFromLocalHost', 'int', ['void*', 'void*']);
+    this.SteamAPI_ISteamNetworkingUtils_ConvertPingLocationToString = lib.func('SteamAPI_ISteamNetworkingUtils_ConvertPingLocationToString', 'void', ['void*', 'void*', 'str', 'int']);
+    this.SteamAPI_ISteamNetworkingUtils_ParsePingLocationString = lib.func('SteamAPI_ISteamNetworkingUtils_ParsePingLocationString', 'bool', ['void*', 'str', 'void*']);
+    this.SteamAPI_ISteamNetworkingUtils_CheckPingDataUpToDate = lib.func('SteamAPI_ISteamNetworkingUtils_CheckPingDataUpToDate', 'bool', ['void*', 'float']);
     
     // POP (Point of Presence) functions
-    this.SteamAPI_ISteamNetworkingUtils_GetPingToDataCenter = this.steamLib.func('SteamAPI_ISteamNetworkingUtils_GetPingToDataCenter', 'int', ['void*', 'uint32', 'uint32*']);
-    this.SteamAPI_ISteamNetworkingUtils_GetDirectPingToPOP = this.steamLib.func('SteamAPI_ISteamNetworkingUtils_GetDirectPingToPOP', 'int', ['void*', 'uint32']);
-    this.SteamAPI_ISteamNetworkingUtils_GetPOPCount = this.steamLib.func('SteamAPI_ISteamNetworkingUtils_GetPOPCount', 'int', ['void*']);
-    this.SteamAPI_ISteamNetworkingUtils_GetPOPList = this.steamLib.func('SteamAPI_ISteamNetworkingUtils_GetPOPList', 'int', ['void*', 'uint32*', 'int']);
+    this.SteamAPI_ISteamNetworkingUtils_GetPingToDataCenter = lib.func('SteamAPI_ISteamNetworkingUtils_GetPingToDataCenter', 'int', ['void*', 'uint32', 'uint32*']);
+    this.SteamAPI_ISteamNetworkingUtils_GetDirectPingToPOP = lib.func('SteamAPI_ISteamNetworkingUtils_GetDirectPingToPOP', 'int', ['void*', 'uint32']);
+    this.SteamAPI_ISteamNetworkingUtils_GetPOPCount = lib.func('SteamAPI_ISteamNetworkingUtils_GetPOPCount', 'int', ['void*']);
+    this.SteamAPI_ISteamNetworkingUtils_GetPOPList = lib.func('SteamAPI_ISteamNetworkingUtils_GetPOPList', 'int', ['void*', 'uint32*', 'int']);
     
     // Time functions
-    this.SteamAPI_ISteamNetworkingUtils_GetLocalTimestamp = this.steamLib.func('SteamAPI_ISteamNetworkingUtils_GetLocalTimestamp', 'int64', ['void*']);
+    this.SteamAPI_ISteamNetworkingUtils_GetLocalTimestamp = lib.func('SteamAPI_ISteamNetworkingUtils_GetLocalTimestamp', 'int64', ['void*']);
     
     // Debug output - uses callback function pointer
-    this.SteamAPI_ISteamNetworkingUtils_SetDebugOutputFunction = this.steamLib.func('SteamAPI_ISteamNetworkingUtils_SetDebugOutputFunction', 'void', ['void*', 'int', 'void*']);
+    this.SteamAPI_ISteamNetworkingUtils_SetDebugOutputFunction = lib.func('SteamAPI_ISteamNetworkingUtils_SetDebugOutputFunction', 'void', ['void*', 'int', 'void*']);
     
     // Global connection status callback
     // SetGlobalCallback_SteamNetConnectionStatusChanged(self, fnCallback) -> bool
     // fnCallback is FnSteamNetConnectionStatusChanged: void (*)(SteamNetConnectionStatusChangedCallback_t *)
-    this.SteamAPI_ISteamNetworkingUtils_SetGlobalCallback_SteamNetConnectionStatusChanged = this.steamLib.func(
+    this.SteamAPI_ISteamNetworkingUtils_SetGlobalCallback_SteamNetConnectionStatusChanged = lib.func(
       'SteamAPI_ISteamNetworkingUtils_SetGlobalCallback_SteamNetConnectionStatusChanged', 
       'bool', 
       ['void*', FnSteamNetConnectionStatusChangedPtr]
     );
-    
-    // ========================================
-    // ISteamNetworkingSockets Functions
-    // ========================================
-    
-    // Interface accessor
-    this.SteamAPI_SteamNetworkingSockets_SteamAPI_v012 = this.steamLib.func('SteamAPI_SteamNetworkingSockets_SteamAPI_v012', 'void*', []);
-    
+  }
+
+  /**
+   * ISteamNetworkingSockets functions
+   */
+  private bindNetworkingSocketsFunctions(lib: koffi.IKoffiLib): void {
     // P2P Listen/Connect
     // CreateListenSocketP2P(nLocalVirtualPort, nOptions, pOptions) -> HSteamListenSocket
-    this.SteamAPI_ISteamNetworkingSockets_CreateListenSocketP2P = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_CreateListenSocketP2P', 'uint32', ['void*', 'int', 'int', 'void*']);
+    this.SteamAPI_ISteamNetworkingSockets_CreateListenSocketP2P = lib.func('SteamAPI_ISteamNetworkingSockets_CreateListenSocketP2P', 'uint32', ['void*', 'int', 'int', 'void*']);
     // ConnectP2P(identityRemote, nRemoteVirtualPort, nOptions, pOptions) -> HSteamNetConnection
-    this.SteamAPI_ISteamNetworkingSockets_ConnectP2P = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_ConnectP2P', 'uint32', ['void*', 'void*', 'int', 'int', 'void*']);
+    this.SteamAPI_ISteamNetworkingSockets_ConnectP2P = lib.func('SteamAPI_ISteamNetworkingSockets_ConnectP2P', 'uint32', ['void*', 'void*', 'int', 'int', 'void*']);
     
     // Connection management
-    this.SteamAPI_ISteamNetworkingSockets_AcceptConnection = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_AcceptConnection', 'int', ['void*', 'uint32']);
-    this.SteamAPI_ISteamNetworkingSockets_CloseConnection = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_CloseConnection', 'bool', ['void*', 'uint32', 'int', 'str', 'bool']);
-    this.SteamAPI_ISteamNetworkingSockets_CloseListenSocket = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_CloseListenSocket', 'bool', ['void*', 'uint32']);
+    this.SteamAPI_ISteamNetworkingSockets_AcceptConnection = lib.func('SteamAPI_ISteamNetworkingSockets_AcceptConnection', 'int', ['void*', 'uint32']);
+    this.SteamAPI_ISteamNetworkingSockets_CloseConnection = lib.func('SteamAPI_ISteamNetworkingSockets_CloseConnection', 'bool', ['void*', 'uint32', 'int', 'str', 'bool']);
+    this.SteamAPI_ISteamNetworkingSockets_CloseListenSocket = lib.func('SteamAPI_ISteamNetworkingSockets_CloseListenSocket', 'bool', ['void*', 'uint32']);
     
     // Connection data
-    this.SteamAPI_ISteamNetworkingSockets_SetConnectionUserData = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_SetConnectionUserData', 'bool', ['void*', 'uint32', 'int64']);
-    this.SteamAPI_ISteamNetworkingSockets_GetConnectionUserData = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_GetConnectionUserData', 'int64', ['void*', 'uint32']);
-    this.SteamAPI_ISteamNetworkingSockets_SetConnectionName = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_SetConnectionName', 'void', ['void*', 'uint32', 'str']);
-    this.SteamAPI_ISteamNetworkingSockets_GetConnectionName = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_GetConnectionName', 'bool', ['void*', 'uint32', 'char*', 'int']);
+    this.SteamAPI_ISteamNetworkingSockets_SetConnectionUserData = lib.func('SteamAPI_ISteamNetworkingSockets_SetConnectionUserData', 'bool', ['void*', 'uint32', 'int64']);
+    this.SteamAPI_ISteamNetworkingSockets_GetConnectionUserData = lib.func('SteamAPI_ISteamNetworkingSockets_GetConnectionUserData', 'int64', ['void*', 'uint32']);
+    this.SteamAPI_ISteamNetworkingSockets_SetConnectionName = lib.func('SteamAPI_ISteamNetworkingSockets_SetConnectionName', 'void', ['void*', 'uint32', 'str']);
+    this.SteamAPI_ISteamNetworkingSockets_GetConnectionName = lib.func('SteamAPI_ISteamNetworkingSockets_GetConnectionName', 'bool', ['void*', 'uint32', 'char*', 'int']);
     
     // Messaging
     // SendMessageToConnection(hConn, pData, cbData, nSendFlags, pOutMessageNumber) -> EResult
-    this.SteamAPI_ISteamNetworkingSockets_SendMessageToConnection = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_SendMessageToConnection', 'int', ['void*', 'uint32', 'void*', 'uint32', 'int', 'int64*']);
-    this.SteamAPI_ISteamNetworkingSockets_FlushMessagesOnConnection = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_FlushMessagesOnConnection', 'int', ['void*', 'uint32']);
+    this.SteamAPI_ISteamNetworkingSockets_SendMessageToConnection = lib.func('SteamAPI_ISteamNetworkingSockets_SendMessageToConnection', 'int', ['void*', 'uint32', 'void*', 'uint32', 'int', 'int64*']);
+    this.SteamAPI_ISteamNetworkingSockets_FlushMessagesOnConnection = lib.func('SteamAPI_ISteamNetworkingSockets_FlushMessagesOnConnection', 'int', ['void*', 'uint32']);
     // ReceiveMessagesOnConnection(hConn, ppOutMessages, nMaxMessages) -> int
-    this.SteamAPI_ISteamNetworkingSockets_ReceiveMessagesOnConnection = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_ReceiveMessagesOnConnection', 'int', ['void*', 'uint32', 'void*', 'int']);
+    this.SteamAPI_ISteamNetworkingSockets_ReceiveMessagesOnConnection = lib.func('SteamAPI_ISteamNetworkingSockets_ReceiveMessagesOnConnection', 'int', ['void*', 'uint32', 'void*', 'int']);
     
     // Connection info
-    this.SteamAPI_ISteamNetworkingSockets_GetConnectionInfo = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_GetConnectionInfo', 'bool', ['void*', 'uint32', 'void*']);
-    this.SteamAPI_ISteamNetworkingSockets_GetConnectionRealTimeStatus = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_GetConnectionRealTimeStatus', 'int', ['void*', 'uint32', 'void*', 'int', 'void*']);
-    this.SteamAPI_ISteamNetworkingSockets_GetDetailedConnectionStatus = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_GetDetailedConnectionStatus', 'int', ['void*', 'uint32', 'char*', 'int']);
-    this.SteamAPI_ISteamNetworkingSockets_GetListenSocketAddress = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_GetListenSocketAddress', 'bool', ['void*', 'uint32', 'void*']);
+    this.SteamAPI_ISteamNetworkingSockets_GetConnectionInfo = lib.func('SteamAPI_ISteamNetworkingSockets_GetConnectionInfo', 'bool', ['void*', 'uint32', 'void*']);
+    this.SteamAPI_ISteamNetworkingSockets_GetConnectionRealTimeStatus = lib.func('SteamAPI_ISteamNetworkingSockets_GetConnectionRealTimeStatus', 'int', ['void*', 'uint32', 'void*', 'int', 'void*']);
+    this.SteamAPI_ISteamNetworkingSockets_GetDetailedConnectionStatus = lib.func('SteamAPI_ISteamNetworkingSockets_GetDetailedConnectionStatus', 'int', ['void*', 'uint32', 'char*', 'int']);
+    this.SteamAPI_ISteamNetworkingSockets_GetListenSocketAddress = lib.func('SteamAPI_ISteamNetworkingSockets_GetListenSocketAddress', 'bool', ['void*', 'uint32', 'void*']);
     
     // Poll groups
-    this.SteamAPI_ISteamNetworkingSockets_CreatePollGroup = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_CreatePollGroup', 'uint32', ['void*']);
-    this.SteamAPI_ISteamNetworkingSockets_DestroyPollGroup = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_DestroyPollGroup', 'bool', ['void*', 'uint32']);
-    this.SteamAPI_ISteamNetworkingSockets_SetConnectionPollGroup = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_SetConnectionPollGroup', 'bool', ['void*', 'uint32', 'uint32']);
-    this.SteamAPI_ISteamNetworkingSockets_ReceiveMessagesOnPollGroup = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_ReceiveMessagesOnPollGroup', 'int', ['void*', 'uint32', 'void*', 'int']);
+    this.SteamAPI_ISteamNetworkingSockets_CreatePollGroup = lib.func('SteamAPI_ISteamNetworkingSockets_CreatePollGroup', 'uint32', ['void*']);
+    this.SteamAPI_ISteamNetworkingSockets_DestroyPollGroup = lib.func('SteamAPI_ISteamNetworkingSockets_DestroyPollGroup', 'bool', ['void*', 'uint32']);
+    this.SteamAPI_ISteamNetworkingSockets_SetConnectionPollGroup = lib.func('SteamAPI_ISteamNetworkingSockets_SetConnectionPollGroup', 'bool', ['void*', 'uint32', 'uint32']);
+    this.SteamAPI_ISteamNetworkingSockets_ReceiveMessagesOnPollGroup = lib.func('SteamAPI_ISteamNetworkingSockets_ReceiveMessagesOnPollGroup', 'int', ['void*', 'uint32', 'void*', 'int']);
     
     // Identity
-    this.SteamAPI_ISteamNetworkingSockets_GetIdentity = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_GetIdentity', 'bool', ['void*', 'void*']);
+    this.SteamAPI_ISteamNetworkingSockets_GetIdentity = lib.func('SteamAPI_ISteamNetworkingSockets_GetIdentity', 'bool', ['void*', 'void*']);
     
     // Authentication
-    this.SteamAPI_ISteamNetworkingSockets_InitAuthentication = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_InitAuthentication', 'int', ['void*']);
-    this.SteamAPI_ISteamNetworkingSockets_GetAuthenticationStatus = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_GetAuthenticationStatus', 'int', ['void*', 'void*']);
+    this.SteamAPI_ISteamNetworkingSockets_InitAuthentication = lib.func('SteamAPI_ISteamNetworkingSockets_InitAuthentication', 'int', ['void*']);
+    this.SteamAPI_ISteamNetworkingSockets_GetAuthenticationStatus = lib.func('SteamAPI_ISteamNetworkingSockets_GetAuthenticationStatus', 'int', ['void*', 'void*']);
     
     // Callbacks
-    this.SteamAPI_ISteamNetworkingSockets_RunCallbacks = this.steamLib.func('SteamAPI_ISteamNetworkingSockets_RunCallbacks', 'void', ['void*']);
+    this.SteamAPI_ISteamNetworkingSockets_RunCallbacks = lib.func('SteamAPI_ISteamNetworkingSockets_RunCallbacks', 'void', ['void*']);
     
     // Message utilities
-    this.SteamAPI_SteamNetworkingMessage_t_Release = this.steamLib.func('SteamAPI_SteamNetworkingMessage_t_Release', 'void', ['void*']);
+    this.SteamAPI_SteamNetworkingMessage_t_Release = lib.func('SteamAPI_SteamNetworkingMessage_t_Release', 'void', ['void*']);
+  }
 
-    // ========================================
-    // ISteamFriends Functions
-    // ========================================
-    
-    // Interface accessor
-    this.SteamAPI_SteamFriends_v018 = this.steamLib.func('SteamAPI_SteamFriends_v018', 'void*', []);
-    
+  /**
+   * ISteamFriends functions
+   */
+  private bindFriendsFunctions(lib: koffi.IKoffiLib): void {
     // User info
-    this.SteamAPI_ISteamFriends_GetPersonaName = this.steamLib.func('SteamAPI_ISteamFriends_GetPersonaName', 'str', ['void*']);
-    this.SteamAPI_ISteamFriends_GetPersonaState = this.steamLib.func('SteamAPI_ISteamFriends_GetPersonaState', 'int', ['void*']);
+    this.SteamAPI_ISteamFriends_GetPersonaName = lib.func('SteamAPI_ISteamFriends_GetPersonaName', 'str', ['void*']);
+    this.SteamAPI_ISteamFriends_GetPersonaState = lib.func('SteamAPI_ISteamFriends_GetPersonaState', 'int', ['void*']);
     
     // Friends list
-    this.SteamAPI_ISteamFriends_GetFriendCount = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendCount', 'int', ['void*', 'int']);
-    this.SteamAPI_ISteamFriends_GetFriendByIndex = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendByIndex', 'uint64', ['void*', 'int', 'int']);
+    this.SteamAPI_ISteamFriends_GetFriendCount = lib.func('SteamAPI_ISteamFriends_GetFriendCount', 'int', ['void*', 'int']);
+    this.SteamAPI_ISteamFriends_GetFriendByIndex = lib.func('SteamAPI_ISteamFriends_GetFriendByIndex', 'uint64', ['void*', 'int', 'int']);
     
     // Friend info
-    this.SteamAPI_ISteamFriends_GetFriendPersonaName = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendPersonaName', 'str', ['void*', 'uint64']);
-    this.SteamAPI_ISteamFriends_GetFriendPersonaState = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendPersonaState', 'int', ['void*', 'uint64']);
-    this.SteamAPI_ISteamFriends_GetFriendRelationship = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendRelationship', 'int', ['void*', 'uint64']);
-    this.SteamAPI_ISteamFriends_GetFriendSteamLevel = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendSteamLevel', 'int', ['void*', 'uint64']);
-    this.SteamAPI_ISteamFriends_GetFriendGamePlayed = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendGamePlayed', 'bool', ['void*', 'uint64', 'void*']);
+    this.SteamAPI_ISteamFriends_GetFriendPersonaName = lib.func('SteamAPI_ISteamFriends_GetFriendPersonaName', 'str', ['void*', 'uint64']);
+    this.SteamAPI_ISteamFriends_GetFriendPersonaState = lib.func('SteamAPI_ISteamFriends_GetFriendPersonaState', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamFriends_GetFriendRelationship = lib.func('SteamAPI_ISteamFriends_GetFriendRelationship', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamFriends_GetFriendSteamLevel = lib.func('SteamAPI_ISteamFriends_GetFriendSteamLevel', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamFriends_GetFriendGamePlayed = lib.func('SteamAPI_ISteamFriends_GetFriendGamePlayed', 'bool', ['void*', 'uint64', 'void*']);
     
     // Rich Presence
-    this.SteamAPI_ISteamFriends_SetRichPresence = this.steamLib.func('SteamAPI_ISteamFriends_SetRichPresence', 'bool', ['void*', 'str', 'str']);
-    this.SteamAPI_ISteamFriends_ClearRichPresence = this.steamLib.func('SteamAPI_ISteamFriends_ClearRichPresence', 'void', ['void*']);
-    this.SteamAPI_ISteamFriends_GetFriendRichPresence = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendRichPresence', 'str', ['void*', 'uint64', 'str']);
-    this.SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount', 'int', ['void*', 'uint64']);
-    this.SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex', 'str', ['void*', 'uint64', 'int']);
-    this.SteamAPI_ISteamFriends_RequestFriendRichPresence = this.steamLib.func('SteamAPI_ISteamFriends_RequestFriendRichPresence', 'void', ['void*', 'uint64']);
+    this.SteamAPI_ISteamFriends_SetRichPresence = lib.func('SteamAPI_ISteamFriends_SetRichPresence', 'bool', ['void*', 'str', 'str']);
+    this.SteamAPI_ISteamFriends_ClearRichPresence = lib.func('SteamAPI_ISteamFriends_ClearRichPresence', 'void', ['void*']);
+    this.SteamAPI_ISteamFriends_GetFriendRichPresence = lib.func('SteamAPI_ISteamFriends_GetFriendRichPresence', 'str', ['void*', 'uint64', 'str']);
+    this.SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount = lib.func('SteamAPI_ISteamFriends_GetFriendRichPresenceKeyCount', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex = lib.func('SteamAPI_ISteamFriends_GetFriendRichPresenceKeyByIndex', 'str', ['void*', 'uint64', 'int']);
+    this.SteamAPI_ISteamFriends_RequestFriendRichPresence = lib.func('SteamAPI_ISteamFriends_RequestFriendRichPresence', 'void', ['void*', 'uint64']);
     
     // Overlay
-    this.SteamAPI_ISteamFriends_ActivateGameOverlay = this.steamLib.func('SteamAPI_ISteamFriends_ActivateGameOverlay', 'void', ['void*', 'str']);
-    this.SteamAPI_ISteamFriends_ActivateGameOverlayToUser = this.steamLib.func('SteamAPI_ISteamFriends_ActivateGameOverlayToUser', 'void', ['void*', 'str', 'uint64']);
-    this.SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage = this.steamLib.func('SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage', 'void', ['void*', 'str', 'int']);
-    this.SteamAPI_ISteamFriends_ActivateGameOverlayToStore = this.steamLib.func('SteamAPI_ISteamFriends_ActivateGameOverlayToStore', 'void', ['void*', 'uint32', 'int']);
-    this.SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog = this.steamLib.func('SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog', 'void', ['void*', 'uint64']);
-    this.SteamAPI_ISteamFriends_ActivateGameOverlayRemotePlayTogetherInviteDialog = this.steamLib.func('SteamAPI_ISteamFriends_ActivateGameOverlayRemotePlayTogetherInviteDialog', 'void', ['void*', 'uint64']);
-    this.SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialogConnectString = this.steamLib.func('SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialogConnectString', 'void', ['void*', 'str']);
+    this.SteamAPI_ISteamFriends_ActivateGameOverlay = lib.func('SteamAPI_ISteamFriends_ActivateGameOverlay', 'void', ['void*', 'str']);
+    this.SteamAPI_ISteamFriends_ActivateGameOverlayToUser = lib.func('SteamAPI_ISteamFriends_ActivateGameOverlayToUser', 'void', ['void*', 'str', 'uint64']);
+    this.SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage = lib.func('SteamAPI_ISteamFriends_ActivateGameOverlayToWebPage', 'void', ['void*', 'str', 'int']);
+    this.SteamAPI_ISteamFriends_ActivateGameOverlayToStore = lib.func('SteamAPI_ISteamFriends_ActivateGameOverlayToStore', 'void', ['void*', 'uint32', 'int']);
+    this.SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog = lib.func('SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialog', 'void', ['void*', 'uint64']);
+    this.SteamAPI_ISteamFriends_ActivateGameOverlayRemotePlayTogetherInviteDialog = lib.func('SteamAPI_ISteamFriends_ActivateGameOverlayRemotePlayTogetherInviteDialog', 'void', ['void*', 'uint64']);
+    this.SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialogConnectString = lib.func('SteamAPI_ISteamFriends_ActivateGameOverlayInviteDialogConnectString', 'void', ['void*', 'str']);
     
     // Avatars
-    this.SteamAPI_ISteamFriends_GetSmallFriendAvatar = this.steamLib.func('SteamAPI_ISteamFriends_GetSmallFriendAvatar', 'int', ['void*', 'uint64']);
-    this.SteamAPI_ISteamFriends_GetMediumFriendAvatar = this.steamLib.func('SteamAPI_ISteamFriends_GetMediumFriendAvatar', 'int', ['void*', 'uint64']);
-    this.SteamAPI_ISteamFriends_GetLargeFriendAvatar = this.steamLib.func('SteamAPI_ISteamFriends_GetLargeFriendAvatar', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamFriends_GetSmallFriendAvatar = lib.func('SteamAPI_ISteamFriends_GetSmallFriendAvatar', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamFriends_GetMediumFriendAvatar = lib.func('SteamAPI_ISteamFriends_GetMediumFriendAvatar', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamFriends_GetLargeFriendAvatar = lib.func('SteamAPI_ISteamFriends_GetLargeFriendAvatar', 'int', ['void*', 'uint64']);
     
     // Friend Groups
-    this.SteamAPI_ISteamFriends_GetFriendsGroupCount = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendsGroupCount', 'int', ['void*']);
-    this.SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex', 'int16', ['void*', 'int']);
-    this.SteamAPI_ISteamFriends_GetFriendsGroupName = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendsGroupName', 'str', ['void*', 'int16']);
-    this.SteamAPI_ISteamFriends_GetFriendsGroupMembersCount = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendsGroupMembersCount', 'int', ['void*', 'int16']);
-    this.SteamAPI_ISteamFriends_GetFriendsGroupMembersList = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendsGroupMembersList', 'void', ['void*', 'int16', 'uint64*', 'int']);
+    this.SteamAPI_ISteamFriends_GetFriendsGroupCount = lib.func('SteamAPI_ISteamFriends_GetFriendsGroupCount', 'int', ['void*']);
+    this.SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex = lib.func('SteamAPI_ISteamFriends_GetFriendsGroupIDByIndex', 'int16', ['void*', 'int']);
+    this.SteamAPI_ISteamFriends_GetFriendsGroupName = lib.func('SteamAPI_ISteamFriends_GetFriendsGroupName', 'str', ['void*', 'int16']);
+    this.SteamAPI_ISteamFriends_GetFriendsGroupMembersCount = lib.func('SteamAPI_ISteamFriends_GetFriendsGroupMembersCount', 'int', ['void*', 'int16']);
+    this.SteamAPI_ISteamFriends_GetFriendsGroupMembersList = lib.func('SteamAPI_ISteamFriends_GetFriendsGroupMembersList', 'void', ['void*', 'int16', 'uint64*', 'int']);
     
     // Coplay (Recently Played With)
-    this.SteamAPI_ISteamFriends_GetCoplayFriendCount = this.steamLib.func('SteamAPI_ISteamFriends_GetCoplayFriendCount', 'int', ['void*']);
-    this.SteamAPI_ISteamFriends_GetCoplayFriend = this.steamLib.func('SteamAPI_ISteamFriends_GetCoplayFriend', 'uint64', ['void*', 'int']);
-    this.SteamAPI_ISteamFriends_GetFriendCoplayTime = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendCoplayTime', 'int', ['void*', 'uint64']);
-    this.SteamAPI_ISteamFriends_GetFriendCoplayGame = this.steamLib.func('SteamAPI_ISteamFriends_GetFriendCoplayGame', 'uint32', ['void*', 'uint64']);
-    
-    // ========================================
-    // ISteamRemoteStorage Functions
-    // ========================================
-    
-    // Interface accessor
-    this.SteamAPI_SteamRemoteStorage_v016 = this.steamLib.func('SteamAPI_SteamRemoteStorage_v016', 'void*', []);
-    
+    this.SteamAPI_ISteamFriends_GetCoplayFriendCount = lib.func('SteamAPI_ISteamFriends_GetCoplayFriendCount', 'int', ['void*']);
+    this.SteamAPI_ISteamFriends_GetCoplayFriend = lib.func('SteamAPI_ISteamFriends_GetCoplayFriend', 'uint64', ['void*', 'int']);
+    this.SteamAPI_ISteamFriends_GetFriendCoplayTime = lib.func('SteamAPI_ISteamFriends_GetFriendCoplayTime', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamFriends_GetFriendCoplayGame = lib.func('SteamAPI_ISteamFriends_GetFriendCoplayGame', 'uint32', ['void*', 'uint64']);
+  }
+
+  /**
+   * ISteamRemoteStorage functions
+   */
+  private bindRemoteStorageFunctions(lib: koffi.IKoffiLib): void {
     // File operations
-    this.SteamAPI_ISteamRemoteStorage_FileWrite = this.steamLib.func('SteamAPI_ISteamRemoteStorage_FileWrite', 'bool', ['void*', 'str', 'void*', 'int32']);
-    this.SteamAPI_ISteamRemoteStorage_FileRead = this.steamLib.func('SteamAPI_ISteamRemoteStorage_FileRead', 'int32', ['void*', 'str', 'void*', 'int32']);
-    this.SteamAPI_ISteamRemoteStorage_FileExists = this.steamLib.func('SteamAPI_ISteamRemoteStorage_FileExists', 'bool', ['void*', 'str']);
-    this.SteamAPI_ISteamRemoteStorage_FileDelete = this.steamLib.func('SteamAPI_ISteamRemoteStorage_FileDelete', 'bool', ['void*', 'str']);
-    this.SteamAPI_ISteamRemoteStorage_GetFileSize = this.steamLib.func('SteamAPI_ISteamRemoteStorage_GetFileSize', 'int32', ['void*', 'str']);
-    this.SteamAPI_ISteamRemoteStorage_GetFileTimestamp = this.steamLib.func('SteamAPI_ISteamRemoteStorage_GetFileTimestamp', 'int64', ['void*', 'str']);
-    this.SteamAPI_ISteamRemoteStorage_FilePersisted = this.steamLib.func('SteamAPI_ISteamRemoteStorage_FilePersisted', 'bool', ['void*', 'str']);
+    this.SteamAPI_ISteamRemoteStorage_FileWrite = lib.func('SteamAPI_ISteamRemoteStorage_FileWrite', 'bool', ['void*', 'str', 'void*', 'int32']);
+    this.SteamAPI_ISteamRemoteStorage_FileRead = lib.func('SteamAPI_ISteamRemoteStorage_FileRead', 'int32', ['void*', 'str', 'void*', 'int32']);
+    this.SteamAPI_ISteamRemoteStorage_FileExists = lib.func('SteamAPI_ISteamRemoteStorage_FileExists', 'bool', ['void*', 'str']);
+    this.SteamAPI_ISteamRemoteStorage_FileDelete = lib.func('SteamAPI_ISteamRemoteStorage_FileDelete', 'bool', ['void*', 'str']);
+    this.SteamAPI_ISteamRemoteStorage_GetFileSize = lib.func('SteamAPI_ISteamRemoteStorage_GetFileSize', 'int32', ['void*', 'str']);
+    this.SteamAPI_ISteamRemoteStorage_GetFileTimestamp = lib.func('SteamAPI_ISteamRemoteStorage_GetFileTimestamp', 'int64', ['void*', 'str']);
+    this.SteamAPI_ISteamRemoteStorage_FilePersisted = lib.func('SteamAPI_ISteamRemoteStorage_FilePersisted', 'bool', ['void*', 'str']);
     
     // File iteration
-    this.SteamAPI_ISteamRemoteStorage_GetFileCount = this.steamLib.func('SteamAPI_ISteamRemoteStorage_GetFileCount', 'int32', ['void*']);
-    this.SteamAPI_ISteamRemoteStorage_GetFileNameAndSize = this.steamLib.func('SteamAPI_ISteamRemoteStorage_GetFileNameAndSize', 'str', ['void*', 'int32', 'int32*']);
+    this.SteamAPI_ISteamRemoteStorage_GetFileCount = lib.func('SteamAPI_ISteamRemoteStorage_GetFileCount', 'int32', ['void*']);
+    this.SteamAPI_ISteamRemoteStorage_GetFileNameAndSize = lib.func('SteamAPI_ISteamRemoteStorage_GetFileNameAndSize', 'str', ['void*', 'int32', 'int32*']);
     
     // Quota and settings
-    this.SteamAPI_ISteamRemoteStorage_GetQuota = this.steamLib.func('SteamAPI_ISteamRemoteStorage_GetQuota', 'bool', ['void*', 'uint64*', 'uint64*']);
-    this.SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount = this.steamLib.func('SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount', 'bool', ['void*']);
-    this.SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp = this.steamLib.func('SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp', 'bool', ['void*']);
-    this.SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp = this.steamLib.func('SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp', 'void', ['void*', 'bool']);
+    this.SteamAPI_ISteamRemoteStorage_GetQuota = lib.func('SteamAPI_ISteamRemoteStorage_GetQuota', 'bool', ['void*', 'uint64*', 'uint64*']);
+    this.SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount = lib.func('SteamAPI_ISteamRemoteStorage_IsCloudEnabledForAccount', 'bool', ['void*']);
+    this.SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp = lib.func('SteamAPI_ISteamRemoteStorage_IsCloudEnabledForApp', 'bool', ['void*']);
+    this.SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp = lib.func('SteamAPI_ISteamRemoteStorage_SetCloudEnabledForApp', 'void', ['void*', 'bool']);
 
     // Batch operations
-    this.SteamAPI_ISteamRemoteStorage_BeginFileWriteBatch = this.steamLib.func('SteamAPI_ISteamRemoteStorage_BeginFileWriteBatch', 'bool', ['void*']);
-    this.SteamAPI_ISteamRemoteStorage_EndFileWriteBatch = this.steamLib.func('SteamAPI_ISteamRemoteStorage_EndFileWriteBatch', 'bool', ['void*']);
-    
-    // ========================================
-    // ISteamUGC (Workshop) Functions
-    // ========================================
-    
-    // Interface accessor
-    this.SteamAPI_SteamUGC_v021 = this.steamLib.func('SteamAPI_SteamUGC_v021', 'void*', []);
-    
+    this.SteamAPI_ISteamRemoteStorage_BeginFileWriteBatch = lib.func('SteamAPI_ISteamRemoteStorage_BeginFileWriteBatch', 'bool', ['void*']);
+    this.SteamAPI_ISteamRemoteStorage_EndFileWriteBatch = lib.func('SteamAPI_ISteamRemoteStorage_EndFileWriteBatch', 'bool', ['void*']);
+    
+    // Async reads and write streams
+    // FileReadAsync(pchFile, nOffset, cubToRead) -> SteamAPICall_t
+    this.SteamAPI_ISteamRemoteStorage_FileReadAsync = lib.func('SteamAPI_ISteamRemoteStorage_FileReadAsync', 'uint64', ['void*', 'str', 'uint32', 'uint32']);
+    // FileReadAsyncComplete(hReadCall, pvBuffer, cubToRead) -> bool
+    this.SteamAPI_ISteamRemoteStorage_FileReadAsyncComplete = lib.func('SteamAPI_ISteamRemoteStorage_FileReadAsyncComplete', 'bool', ['void*', 'uint64', 'void*', 'uint32']);
+    // FileWriteStreamOpen(pchFile) -> UGCFileWriteStreamHandle_t
+    this.SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen = lib.func('SteamAPI_ISteamRemoteStorage_FileWriteStreamOpen', 'uint64', ['void*', 'str']);
+    this.SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk = lib.func('SteamAPI_ISteamRemoteStorage_FileWriteStreamWriteChunk', 'bool', ['void*', 'uint64', 'void*', 'int32']);
+    this.SteamAPI_ISteamRemoteStorage_FileWriteStreamClose = lib.func('SteamAPI_ISteamRemoteStorage_FileWriteStreamClose', 'bool', ['void*', 'uint64']);
+    this.SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel = lib.func('SteamAPI_ISteamRemoteStorage_FileWriteStreamCancel', 'bool', ['void*', 'uint64']);
+  }
+
+  /**
+   * ISteamUGC (Workshop) functions
+   */
+  private bindUgcFunctions(lib: koffi.IKoffiLib): void {
     // Query operations
-    this.SteamAPI_ISteamUGC_CreateQueryUserUGCRequest = this.steamLib.func('SteamAPI_ISteamUGC_CreateQueryUserUGCRequest', 'uint64', ['void*', 'uint32', 'int', 'int', 'int', 'uint32', 'uint32', 'uint32']);
-    this.SteamAPI_ISteamUGC_CreateQueryAllUGCRequestPage = this.steamLib.func('SteamAPI_ISteamUGC_CreateQueryAllUGCRequestPage', 'uint64', ['void*', 'int', 'int', 'uint32', 'uint32', 'uint32']);
-    this.SteamAPI_ISteamUGC_SendQueryUGCRequest = this.steamLib.func('SteamAPI_ISteamUGC_SendQueryUGCRequest', 'uint64', ['void*', 'uint64']);
-    this.SteamAPI_ISteamUGC_GetQueryUGCResult = this.steamLib.func('SteamAPI_ISteamUGC_GetQueryUGCResult', 'bool', ['void*', 'uint64', 'uint32', 'void*']);
-    this.SteamAPI_ISteamUGC_GetQueryUGCNumTags = this.steamLib.func('SteamAPI_ISteamUGC_GetQueryUGCNumTags', 'uint32', ['void*', 'uint64', 'uint32']);
-    this.SteamAPI_ISteamUGC_GetQueryUGCTag = this.steamLib.func('SteamAPI_ISteamUGC_GetQueryUGCTag', 'bool', ['void*', 'uint64', 'uint32', 'uint32', 'str', 'uint32']);
-    this.SteamAPI_ISteamUGC_GetQueryUGCTagDisplayName = this.steamLib.func('SteamAPI_ISteamUGC_GetQueryUGCTagDisplayName', 'bool', ['void*', 'uint64', 'uint32', 'uint32', 'str', 'uint32']);
-    this.SteamAPI_ISteamUGC_GetQueryUGCPreviewURL = this.steamLib.func('SteamAPI_ISteamUGC_GetQueryUGCPreviewURL', 'bool', ['void*', 'uint64', 'uint32', 'str', 'uint32']);
-    this.SteamAPI_ISteamUGC_GetQueryUGCMetadata = this.steamLib.func('SteamAPI_ISteamUGC_GetQueryUGCMetadata', 'bool', ['void*', 'uint64', 'uint32', 'str', 'uint32']);
-    this.SteamAPI_ISteamUGC_GetQueryUGCChildren = this.steamLib.func('SteamAPI_ISteamUGC_GetQueryUGCChildren', 'bool', ['void*', 'uint64', 'uint32', 'uint64*', 'uint32']);
-    this.SteamAPI_ISteamUGC_SetReturnPlaytimeStats = this.steamLib.func('SteamAPI_ISteamUGC_SetReturnPlaytimeStats', 'bool', ['void*', 'uint64', 'uint32']);
-    this.SteamAPI_ISteamUGC_ReleaseQueryUGCRequest = this.steamLib.func('SteamAPI_ISteamUGC_ReleaseQueryUGCRequest', 'bool', ['void*', 'uint64']);
+    this.SteamAPI_ISteamUGC_CreateQueryUserUGCRequest = lib.func('SteamAPI_ISteamUGC_CreateQueryUserUGCRequest', 'uint64', ['void*', 'uint32', 'int', 'int', 'int', 'uint32', 'uint32', 'uint32']);
+    this.SteamAPI_ISteamUGC_CreateQueryAllUGCRequestPage = lib.func('SteamAPI_ISteamUGC_CreateQueryAllUGCRequestPage', 'uint64', ['void*', 'int', 'int', 'uint32', 'uint32', 'uint32']);
+    this.SteamAPI_ISteamUGC_SendQueryUGCRequest = lib.func('SteamAPI_ISteamUGC_SendQueryUGCRequest', 'uint64', ['void*', 'uint64']);
+    this.SteamAPI_ISteamUGC_GetQueryUGCResult = lib.func('SteamAPI_ISteamUGC_GetQueryUGCResult', 'bool', ['void*', 'uint64', 'uint32', 'void*']);
+    this.SteamAPI_ISteamUGC_GetQueryUGCNumTags = lib.func('SteamAPI_ISteamUGC_GetQueryUGCNumTags', 'uint32', ['void*', 'uint64', 'uint32']);
+    this.SteamAPI_ISteamUGC_GetQueryUGCTag = lib.func('SteamAPI_ISteamUGC_GetQueryUGCTag', 'bool', ['void*', 'uint64', 'uint32', 'uint32', 'str', 'uint32']);
+    this.SteamAPI_ISteamUGC_GetQueryUGCTagDisplayName = lib.func('SteamAPI_ISteamUGC_GetQueryUGCTagDisplayName', 'bool', ['void*', 'uint64', 'uint32', 'uint32', 'str', 'uint32']);
+    this.SteamAPI_ISteamUGC_GetQueryUGCPreviewURL = lib.func('SteamAPI_ISteamUGC_GetQueryUGCPreviewURL', 'bool', ['void*', 'uint64', 'uint32', 'str', 'uint32']);
+    this.SteamAPI_ISteamUGC_GetQueryUGCMetadata = lib.func('SteamAPI_ISteamUGC_GetQueryUGCMetadata', 'bool', ['void*', 'uint64', 'uint32', 'str', 'uint32']);
+    this.SteamAPI_ISteamUGC_GetQueryUGCChildren = lib.func('SteamAPI_ISteamUGC_GetQueryUGCChildren', 'bool', ['void*', 'uint64', 'uint32', 'uint64*', 'uint32']);
+    this.SteamAPI_ISteamUGC_SetReturnPlaytimeStats = lib.func('SteamAPI_ISteamUGC_SetReturnPlaytimeStats', 'bool', ['void*', 'uint64', 'uint32']);
+    this.SteamAPI_ISteamUGC_ReleaseQueryUGCRequest = lib.func('SteamAPI_ISteamUGC_ReleaseQueryUGCRequest', 'bool', ['void*', 'uint64']);
     
     // Query options
-    this.SteamAPI_ISteamUGC_SetSearchText = this.steamLib.func('SteamAPI_ISteamUGC_SetSearchText', 'bool', ['void*', 'uint64', 'string']);
+    this.SteamAPI_ISteamUGC_SetSearchText = lib.func('SteamAPI_ISteamUGC_SetSearchText', 'bool', ['void*', 'uint64', 'string']);
     
     // Subscription operations
-    this.SteamAPI_ISteamUGC_SubscribeItem = this.steamLib.func('SteamAPI_ISteamUGC_SubscribeItem', 'uint64', ['void*', 'uint64']);
-    this.SteamAPI_ISteamUGC_UnsubscribeItem = this.steamLib.func('SteamAPI_ISteamUGC_UnsubscribeItem', 'uint64', ['void*', 'uint64']);
-    this.SteamAPI_ISteamUGC_GetNumSubscribedItems = this.steamLib.func('SteamAPI_ISteamUGC_GetNumSubscribedItems', 'uint32', ['void*']);
-    this.SteamAPI_ISteamUGC_GetSubscribedItems = this.steamLib.func('SteamAPI_ISteamUGC_GetSubscribedItems', 'uint32', ['void*', 'uint64*', 'uint32']);
+    this.SteamAPI_ISteamUGC_SubscribeItem = lib.func('SteamAPI_ISteamUGC_SubscribeItem', 'uint64', ['void*', 'uint64']);
+    this.SteamAPI_ISteamUGC_UnsubscribeItem = lib.func('SteamAPI_ISteamUGC_UnsubscribeItem', 'uint64', ['void*', 'uint64']);
+    this.SteamAPI_ISteamUGC_GetNumSubscribedItems = lib.func('SteamAPI_ISteamUGC_GetNumSubscribedItems', 'uint32', ['void*']);
+    this.SteamAPI_ISteamUGC_GetSubscribedItems = lib.func('SteamAPI_ISteamUGC_GetSubscribedItems', 'uint32', ['void*', 'uint64*', 'uint32']);
     
     // Item state and info
-    this.SteamAPI_ISteamUGC_GetItemState = this.steamLib.func('SteamAPI_ISteamUGC_GetItemState', 'uint32', ['void*', 'uint64']);
-    this.SteamAPI_ISteamUGC_GetItemInstallInfo = this.steamLib.func('SteamAPI_ISteamUGC_GetItemInstallInfo', 'bool', ['void*', 'uint64', 'uint64*', 'str', 'uint32', 'uint32*']);
-    this.SteamAPI_ISteamUGC_GetItemDownloadInfo = this.steamLib.func('SteamAPI_ISteamUGC_GetItemDownloadInfo', 'bool', ['void*', 'uint64', 'uint64*', 'uint64*']);
-    this.SteamAPI_ISteamUGC_DownloadItem = this.steamLib.func('SteamAPI_ISteamUGC_DownloadItem', 'bool', ['void*', 'uint64', 'bool']);
+    this.SteamAPI_ISteamUGC_GetItemState = lib.func('SteamAPI_ISteamUGC_GetItemState', 'uint32', ['void*', 'uint64']);
+    this.SteamAPI_ISteamUGC_GetItemInstallInfo = lib.func('SteamAPI_ISteamUGC_GetItemInstallInfo', 'bool', ['void*', 'uint64', 'uint64*', 'str', 'uint32', 'uint32*']);
+    this.SteamAPI_ISteamUGC_GetItemDownloadInfo = lib.func('SteamAPI_ISteamUGC_GetItemDownloadInfo', 'bool', ['void*', 'uint64', 'uint64*', 'uint64*']);
+    this.SteamAPI_ISteamUGC_DownloadItem = lib.func('SteamAPI_ISteamUGC_DownloadItem', 'bool', ['void*', 'uint64', 'bool']);
     
     // Creation and update
-    this.SteamAPI_ISteamUGC_CreateItem = this.steamLib.func('SteamAPI_ISteamUGC_CreateItem', 'uint64', ['void*', 'uint32', 'int']);
-    this.SteamAPI_ISteamUGC_StartItemUpdate = this.steamLib.func('SteamAPI_ISteamUGC_StartItemUpdate', 'uint64', ['void*', 'uint32', 'uint64']);
-    this.SteamAPI_ISteamUGC_SetItemTitle = this.steamLib.func('SteamAPI_ISteamUGC_SetItemTitle', 'bool', ['void*', 'uint64', 'str']);
-    this.SteamAPI_ISteamUGC_SetItemDescription = this.steamLib.func('SteamAPI_ISteamUGC_SetItemDescription', 'bool', ['void*', 'uint64', 'str']);
-    this.SteamAPI_ISteamUGC_SetItemVisibility = this.steamLib.func('SteamAPI_ISteamUGC_SetItemVisibility', 'bool', ['void*', 'uint64', 'int']);
+    this.SteamAPI_ISteamUGC_CreateItem = lib.func('SteamAPI_ISteamUGC_CreateItem', 'uint64', ['void*', 'uint32', 'int']);
+    this.SteamAPI_ISteamUGC_StartItemUpdate = lib.func('SteamAPI_ISteamUGC_StartItemUpdate', 'uint64', ['void*', 'uint32', 'uint64']);
+    this.SteamAPI_ISteamUGC_SetItemTitle = lib.func('SteamAPI_ISteamUGC_SetItemTitle', 'bool', ['void*', 'uint64', 'str']);
+    this.SteamAPI_ISteamUGC_SetItemDescription = lib.func('SteamAPI_ISteamUGC_SetItemDescription', 'bool', ['void*', 'uint64', 'str']);
+    this.SteamAPI_ISteamUGC_SetItemVisibility = lib.func('SteamAPI_ISteamUGC_SetItemVisibility', 'bool', ['void*', 'uint64', 'int']);
     // SteamParamStringArray_t* is passed as a raw void* (manually built buffer)
-    this.SteamAPI_ISteamUGC_SetItemTags = this.steamLib.func('SteamAPI_ISteamUGC_SetItemTags', 'bool', ['void*', 'uint64', 'void*', 'bool']);
-    this.SteamAPI_ISteamUGC_SetItemContent = this.steamLib.func('SteamAPI_ISteamUGC_SetItemContent', 'bool', ['void*', 'uint64', 'str']);
-    this.SteamAPI_ISteamUGC_SetItemPreview = this.steamLib.func('SteamAPI_ISteamUGC_SetItemPreview', 'bool', ['void*', 'uint64', 'str']);
-    this.SteamAPI_ISteamUGC_AddContentDescriptor = this.steamLib.func('SteamAPI_ISteamUGC_AddContentDescriptor', 'bool', ['void*', 'uint64', 'int']);
-    this.SteamAPI_ISteamUGC_RemoveContentDescriptor = this.steamLib.func('SteamAPI_ISteamUGC_RemoveContentDescriptor', 'bool', ['void*', 'uint64', 'int']);
-    this.SteamAPI_ISteamUGC_GetQueryUGCContentDescriptors = this.steamLib.func('SteamAPI_ISteamUGC_GetQueryUGCContentDescriptors', 'uint32', ['void*', 'uint64', 'uint32', 'int32*', 'uint32']);
-    this.SteamAPI_ISteamUGC_GetUserContentDescriptorPreferences = this.steamLib.func('SteamAPI_ISteamUGC_GetUserContentDescriptorPreferences', 'uint32', ['void*', 'int32*', 'uint32']);
-    this.SteamAPI_ISteamUGC_SubmitItemUpdate = this.steamLib.func('SteamAPI_ISteamUGC_SubmitItemUpdate', 'uint64', ['void*', 'uint64', 'str']);
-    this.SteamAPI_ISteamUGC_GetItemUpdateProgress = this.steamLib.func('SteamAPI_ISteamUGC_GetItemUpdateProgress', 'int', ['void*', 'uint64', 'uint64*', 'uint64*']);
+    this.SteamAPI_ISteamUGC_SetItemTags = lib.func('SteamAPI_ISteamUGC_SetItemTags', 'bool', ['void*', 'uint64', 'void*', 'bool']);
+    this.SteamAPI_ISteamUGC_SetItemContent = lib.func('SteamAPI_ISteamUGC_SetItemContent', 'bool', ['void*', 'uint64', 'str']);
+    this.SteamAPI_ISteamUGC_SetItemPreview = lib.func('SteamAPI_ISteamUGC_SetItemPreview', 'bool', ['void*', 'uint64', 'str']);
+    this.SteamAPI_ISteamUGC_AddContentDescriptor = lib.func('SteamAPI_ISteamUGC_AddContentDescriptor', 'bool', ['void*', 'uint64', 'int']);
+    this.SteamAPI_ISteamUGC_RemoveContentDescriptor = lib.func('SteamAPI_ISteamUGC_RemoveContentDescriptor', 'bool', ['void*', 'uint64', 'int']);
+    this.SteamAPI_ISteamUGC_GetQueryUGCContentDescriptors = lib.func('SteamAPI_ISteamUGC_GetQueryUGCContentDescriptors', 'uint32', ['void*', 'uint64', 'uint32', 'int32*', 'uint32']);
+    this.SteamAPI_ISteamUGC_GetUserContentDescriptorPreferences = lib.func('SteamAPI_ISteamUGC_GetUserContentDescriptorPreferences', 'uint32', ['void*', 'int32*', 'uint32']);
+    this.SteamAPI_ISteamUGC_SubmitItemUpdate = lib.func('SteamAPI_ISteamUGC_SubmitItemUpdate', 'uint64', ['void*', 'uint64', 'str']);
+    this.SteamAPI_ISteamUGC_GetItemUpdateProgress = lib.func('SteamAPI_ISteamUGC_GetItemUpdateProgress', 'int', ['void*', 'uint64', 'uint64*', 'uint64*']);
     
     // Voting and favorites
-    this.SteamAPI_ISteamUGC_SetUserItemVote = this.steamLib.func('SteamAPI_ISteamUGC_SetUserItemVote', 'uint64', ['void*', 'uint64', 'bool']);
-    this.SteamAPI_ISteamUGC_GetUserItemVote = this.steamLib.func('SteamAPI_ISteamUGC_GetUserItemVote', 'uint64', ['void*', 'uint64']);
-    this.SteamAPI_ISteamUGC_AddItemToFavorites = this.steamLib.func('SteamAPI_ISteamUGC_AddItemToFavorites', 'uint64', ['void*', 'uint32', 'uint64']);
-    this.SteamAPI_ISteamUGC_RemoveItemFromFavorites = this.steamLib.func('SteamAPI_ISteamUGC_RemoveItemFromFavorites', 'uint64', ['void*', 'uint32', 'uint64']);
+    this.SteamAPI_ISteamUGC_SetUserItemVote = lib.func('SteamAPI_ISteamUGC_SetUserItemVote', 'uint64', ['void*', 'uint64', 'bool']);
+    this.SteamAPI_ISteamUGC_GetUserItemVote = lib.func('SteamAPI_ISteamUGC_GetUserItemVote', 'uint64', ['void*', 'uint64']);
+    this.SteamAPI_ISteamUGC_AddItemToFavorites = lib.func('SteamAPI_ISteamUGC_AddItemToFavorites', 'uint64', ['void*', 'uint32', 'uint64']);
+    this.SteamAPI_ISteamUGC_RemoveItemFromFavorites = lib.func('SteamAPI_ISteamUGC_RemoveItemFromFavorites', 'uint64', ['void*', 'uint32', 'uint64']);
     
     // Deletion
-    this.SteamAPI_ISteamUGC_DeleteItem = this.steamLib.func('SteamAPI_ISteamUGC_DeleteItem', 'uint64', ['void*', 'uint64']);
-    
-    // ========================================
-    // ISteamInput Functions
-    // ========================================
-    
-    // Interface accessor
-    this.SteamAPI_SteamInput_v006 = this.steamLib.func('SteamAPI_SteamInput_v006', 'void*', []);
-    
+    this.SteamAPI_ISteamUGC_DeleteItem = lib.func('SteamAPI_ISteamUGC_DeleteItem', 'uint64', ['void*', 'uint64']);
+  }
+
+  /**
+   * ISteamInput functions
+   */
+  private bindInputFunctions(lib: koffi.IKoffiLib): void {
     // Initialization
-    this.SteamAPI_ISteamInput_Init = this.steamLib.func('SteamAPI_ISteamInput_Init', 'bool', ['void*', 'bool']);
-    this.SteamAPI_ISteamInput_Shutdown = this.steamLib.func('SteamAPI_ISteamInput_Shutdown', 'bool', ['void*']);
-    this.SteamAPI_ISteamInput_SetInputActionManifestFilePath = this.steamLib.func('SteamAPI_ISteamInput_SetInputActionManifestFilePath', 'bool', ['void*', 'str']);
-    this.SteamAPI_ISteamInput_RunFrame = this.steamLib.func('SteamAPI_ISteamInput_RunFrame', 'void', ['void*', 'bool']);
-    this.SteamAPI_ISteamInput_BWaitForData = this.steamLib.func('SteamAPI_ISteamInput_BWaitForData', 'bool', ['void*', 'bool', 'uint32']);
-    this.SteamAPI_ISteamInput_BNewDataAvailable = this.steamLib.func('SteamAPI_ISteamInput_BNewDataAvailable', 'bool', ['void*']);
+    this.SteamAPI_ISteamInput_Init = lib.func('SteamAPI_ISteamInput_Init', 'bool', ['void*', 'bool']);
+    this.SteamAPI_ISteamInput_Shutdown = lib.func('SteamAPI_ISteamInput_Shutdown', 'bool', ['void*']);
+    this.SteamAPI_ISteamInput_SetInputActionManifestFilePath = lib.func('SteamAPI_ISteamInput_SetInputActionManifestFilePath', 'bool', ['void*', 'str']);
+    this.SteamAPI_ISteamInput_RunFrame = lib.func('SteamAPI_ISteamInput_RunFrame', 'void', ['void*', 'bool']);
+    this.SteamAPI_ISteamInput_BWaitForData = lib.func('SteamAPI_ISteamInput_BWaitForData', 'bool', ['void*', 'bool', 'uint32']);
+    this.SteamAPI_ISteamInput_BNewDataAvailable = lib.func('SteamAPI_ISteamInput_BNewDataAvailable', 'bool', ['void*']);
     
     // Controller enumeration
-    this.SteamAPI_ISteamInput_GetConnectedControllers = this.steamLib.func('SteamAPI_ISteamInput_GetConnectedControllers', 'int', ['void*', 'uint64*']);
-    this.SteamAPI_ISteamInput_EnableDeviceCallbacks = this.steamLib.func('SteamAPI_ISteamInput_EnableDeviceCallbacks', 'void', ['void*']);
-    this.SteamAPI_ISteamInput_EnableActionEventCallbacks = this.steamLib.func('SteamAPI_ISteamInput_EnableActionEventCallbacks', 'void', ['void*', 'void*']);
-    this.SteamAPI_ISteamInput_GetInputTypeForHandle = this.steamLib.func('SteamAPI_ISteamInput_GetInputTypeForHandle', 'int', ['void*', 'uint64']);
-    this.SteamAPI_ISteamInput_GetControllerForGamepadIndex = this.steamLib.func('SteamAPI_ISteamInput_GetControllerForGamepadIndex', 'uint64', ['void*', 'int']);
-    this.SteamAPI_ISteamInput_GetGamepadIndexForController = this.steamLib.func('SteamAPI_ISteamInput_GetGamepadIndexForController', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamInput_GetConnectedControllers = lib.func('SteamAPI_ISteamInput_GetConnectedControllers', 'int', ['void*', 'uint64*']);
+    this.SteamAPI_ISteamInput_EnableDeviceCallbacks = lib.func('SteamAPI_ISteamInput_EnableDeviceCallbacks', 'void', ['void*']);
+    this.SteamAPI_ISteamInput_EnableActionEventCallbacks = lib.func('SteamAPI_ISteamInput_EnableActionEventCallbacks', 'void', ['void*', 'void*']);
+    this.SteamAPI_ISteamInput_GetInputTypeForHandle = lib.func('SteamAPI_ISteamInput_GetInputTypeForHandle', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamInput_GetControllerForGamepadIndex = lib.func('SteamAPI_ISteamInput_GetControllerForGamepadIndex', 'uint64', ['void*', 'int']);
+    this.SteamAPI_ISteamInput_GetGamepadIndexForController = lib.func('SteamAPI_ISteamInput_GetGamepadIndexForController', 'int', ['void*', 'uint64']);
     
     // Action sets
-    this.SteamAPI_ISteamInput_GetActionSetHandle = this.steamLib.func('SteamAPI_ISteamInput_GetActionSetHandle', 'uint64', ['void*', 'str']);
-    this.SteamAPI_ISteamInput_ActivateActionSet = this.steamLib.func('SteamAPI_ISteamInput_ActivateActionSet', 'void', ['void*', 'uint64', 'uint64']);
-    this.SteamAPI_ISteamInput_GetCurrentActionSet = this.steamLib.func('SteamAPI_ISteamInput_GetCurrentActionSet', 'uint64', ['void*', 'uint64']);
-    this.SteamAPI_ISteamInput_ActivateActionSetLayer = this.steamLib.func('SteamAPI_ISteamInput_ActivateActionSetLayer', 'void', ['void*', 'uint64', 'uint64']);
-    this.SteamAPI_ISteamInput_DeactivateActionSetLayer = this.steamLib.func('SteamAPI_ISteamInput_DeactivateActionSetLayer', 'void', ['void*', 'uint64', 'uint64']);
-    this.SteamAPI_ISteamInput_DeactivateAllActionSetLayers = this.steamLib.func('SteamAPI_ISteamInput_DeactivateAllActionSetLayers', 'void', ['void*', 'uint64']);
-    this.SteamAPI_ISteamInput_GetActiveActionSetLayers = this.steamLib.func('SteamAPI_ISteamInput_GetActiveActionSetLayers', 'int', ['void*', 'uint64', 'uint64*']);
+    this.SteamAPI_ISteamInput_GetActionSetHandle = lib.func('SteamAPI_ISteamInput_GetActionSetHandle', 'uint64', ['void*', 'str']);
+    this.SteamAPI_ISteamInput_ActivateActionSet = lib.func('SteamAPI_ISteamInput_ActivateActionSet', 'void', ['void*', 'uint64', 'uint64']);
+    this.SteamAPI_ISteamInput_GetCurrentActionSet = lib.func('SteamAPI_ISteamInput_GetCurrentActionSet', 'uint64', ['void*', 'uint64']);
+    this.SteamAPI_ISteamInput_ActivateActionSetLayer = lib.func('SteamAPI_ISteamInput_ActivateActionSetLayer', 'void', ['void*', 'uint64', 'uint64']);
+    this.SteamAPI_ISteamInput_DeactivateActionSetLayer = lib.func('SteamAPI_ISteamInput_DeactivateActionSetLayer', 'void', ['void*', 'uint64', 'uint64']);
+    this.SteamAPI_ISteamInput_DeactivateAllActionSetLayers = lib.func('SteamAPI_ISteamInput_DeactivateAllActionSetLayers', 'void', ['void*', 'uint64']);
+    this.SteamAPI_ISteamInput_GetActiveActionSetLayers = lib.func('SteamAPI_ISteamInput_GetActiveActionSetLayers', 'int', ['void*', 'uint64', 'uint64*']);
     
     // Digital actions
-    this.SteamAPI_ISteamInput_GetDigitalActionHandle = this.steamLib.func('SteamAPI_ISteamInput_GetDigitalActionHandle', 'uint64', ['void*', 'str']);
-    this.SteamAPI_ISteamInput_GetDigitalActionData = this.steamLib.func('SteamAPI_ISteamInput_GetDigitalActionData', InputDigitalActionData_t, ['void*', 'uint64', 'uint64']);
-    this.SteamAPI_ISteamInput_GetDigitalActionOrigins = this.steamLib.func('SteamAPI_ISteamInput_GetDigitalActionOrigins', 'int', ['void*', 'uint64', 'uint64', 'uint64', 'int*']);
-    this.SteamAPI_ISteamInput_GetStringForDigitalActionName = this.steamLib.func('SteamAPI_ISteamInput_GetStringForDigitalActionName', 'str', ['void*', 'uint64']);
+    this.SteamAPI_ISteamInput_GetDigitalActionHandle = lib.func('SteamAPI_ISteamInput_GetDigitalActionHandle', 'uint64', ['void*', 'str']);
+    this.SteamAPI_ISteamInput_GetDigitalActionData = lib.func('SteamAPI_ISteamInput_GetDigitalActionData', InputDigitalActionData_t, ['void*', 'uint64', 'uint64']);
+    this.SteamAPI_ISteamInput_GetDigitalActionOrigins = lib.func('SteamAPI_ISteamInput_GetDigitalActionOrigins', 'int', ['void*', 'uint64', 'uint64', 'uint64', 'int*']);
+    this.SteamAPI_ISteamInput_GetStringForDigitalActionName = lib.func('SteamAPI_ISteamInput_GetStringForDigitalActionName', 'str', ['void*', 'uint64']);
     
     // Analog actions
-    this.SteamAPI_ISteamInput_GetAnalogActionHandle = this.steamLib.func('SteamAPI_ISteamInput_GetAnalogActionHandle', 'uint64', ['void*', 'str']);
-    this.SteamAPI_ISteamInput_GetAnalogActionData = this.steamLib.func('SteamAPI_ISteamInput_GetAnalogActionData', InputAnalogActionData_t, ['void*', 'uint64', 'uint64']);
-    this.SteamAPI_ISteamInput_GetAnalogActionOrigins = this.steamLib.func('SteamAPI_ISteamInput_GetAnalogActionOrigins', 'int', ['void*', 'uint64', 'uint64', 'uint64', 'int*']);
-    this.SteamAPI_ISteamInput_GetStringForAnalogActionName = this.steamLib.func('SteamAPI_ISteamInput_GetStringForAnalogActionName', 'str', ['void*', 'uint64']);
-    this.SteamAPI_ISteamInput_StopAnalogActionMomentum = this.steamLib.func('SteamAPI_ISteamInput_StopAnalogActionMomentum', 'void', ['void*', 'uint64', 'uint64']);
+    this.SteamAPI_ISteamInput_GetAnalogActionHandle = lib.func('SteamAPI_ISteamInput_GetAnalogActionHandle', 'uint64', ['void*', 'str']);
+    this.SteamAPI_ISteamInput_GetAnalogActionData = lib.func('SteamAPI_ISteamInput_GetAnalogActionData', InputAnalogActionData_t, ['void*', 'uint64', 'uint64']);
+    this.SteamAPI_ISteamInput_GetAnalogActionOrigins = lib.func('SteamAPI_ISteamInput_GetAnalogActionOrigins', 'int', ['void*', 'uint64', 'uint64', 'uint64', 'int*']);
+    this.SteamAPI_ISteamInput_GetStringForAnalogActionName = lib.func('SteamAPI_ISteamInput_GetStringForAnalogActionName', 'str', ['void*', 'uint64']);
+    this.SteamAPI_ISteamInput_StopAnalogActionMomentum = lib.func('SteamAPI_ISteamInput_StopAnalogActionMomentum', 'void', ['void*', 'uint64', 'uint64']);
     
     // Motion data
-    this.SteamAPI_ISteamInput_GetMotionData = this.steamLib.func('SteamAPI_ISteamInput_GetMotionData', InputMotionData_t, ['void*', 'uint64']);
+    this.SteamAPI_ISteamInput_GetMotionData = lib.func('SteamAPI_ISteamInput_GetMotionData', InputMotionData_t, ['void*', 'uint64']);
     
     // Haptics and rumble
-    this.SteamAPI_ISteamInput_TriggerVibration = this.steamLib.func('SteamAPI_ISteamInput_TriggerVibration', 'void', ['void*', 'uint64', 'uint16', 'uint16']);
-    this.SteamAPI_ISteamInput_TriggerVibrationExtended = this.steamLib.func('SteamAPI_ISteamInput_TriggerVibrationExtended', 'void', ['void*', 'uint64', 'uint16', 'uint16', 'uint16', 'uint16']);
-    this.SteamAPI_ISteamInput_TriggerSimpleHapticEvent = this.steamLib.func('SteamAPI_ISteamInput_TriggerSimpleHapticEvent', 'void', ['void*', 'uint64', 'int', 'uint8', 'int8', 'uint8', 'int8']);
-    this.SteamAPI_ISteamInput_SetLEDColor = this.steamLib.func('SteamAPI_ISteamInput_SetLEDColor', 'void', ['void*', 'uint64', 'uint8', 'uint8', 'uint8', 'uint32']);
-    this.SteamAPI_ISteamInput_Legacy_TriggerHapticPulse = this.steamLib.func('SteamAPI_ISteamInput_Legacy_TriggerHapticPulse', 'void', ['void*', 'uint64', 'int', 'uint16']);
-    this.SteamAPI_ISteamInput_Legacy_TriggerRepeatedHapticPulse = this.steamLib.func('SteamAPI_ISteamInput_Legacy_TriggerRepeatedHapticPulse', 'void', ['void*', 'uint64', 'int', 'uint16', 'uint16', 'uint16', 'uint32']);
+    this.SteamAPI_ISteamInput_TriggerVibration = lib.func('SteamAPI_ISteamInput_TriggerVibration', 'void', ['void*', 'uint64', 'uint16', 'uint16']);
+    this.SteamAPI_ISteamInput_TriggerVibrationExtended = lib.func('SteamAPI_ISteamInput_TriggerVibrationExtended', 'void', ['void*', 'uint64', 'uint16', 'uint16', 'uint16', 'uint16']);
+    this.SteamAPI_ISteamInput_TriggerSimpleHapticEvent = lib.func('SteamAPI_ISteamInput_TriggerSimpleHapticEvent', 'void', ['void*', 'uint64', 'int', 'uint8', 'int8', 'uint8', 'int8']);
+    this.SteamAPI_ISteamInput_SetLEDColor = lib.func('SteamAPI_ISteamInput_SetLEDColor', 'void', ['void*', 'uint64', 'uint8', 'uint8', 'uint8', 'uint32']);
+    this.SteamAPI_ISteamInput_Legacy_TriggerHapticPulse = lib.func('SteamAPI_ISteamInput_Legacy_TriggerHapticPulse', 'void', ['void*', 'uint64', 'int', 'uint16']);
+    this.SteamAPI_ISteamInput_Legacy_TriggerRepeatedHapticPulse = lib.func('SteamAPI_ISteamInput_Legacy_TriggerRepeatedHapticPulse', 'void', ['void*', 'uint64', 'int', 'uint16', 'uint16', 'uint16', 'uint32']);
     
     // Glyphs and strings
-    this.SteamAPI_ISteamInput_GetGlyphPNGForActionOrigin = this.steamLib.func('SteamAPI_ISteamInput_GetGlyphPNGForActionOrigin', 'str', ['void*', 'int', 'int', 'uint32']);
-    this.SteamAPI_ISteamInput_GetGlyphSVGForActionOrigin = this.steamLib.func('SteamAPI_ISteamInput_GetGlyphSVGForActionOrigin', 'str', ['void*', 'int', 'uint32']);
-    this.SteamAPI_ISteamInput_GetGlyphForActionOrigin_Legacy = this.steamLib.func('SteamAPI_ISteamInput_GetGlyphForActionOrigin_Legacy', 'str', ['void*', 'int']);
-    this.SteamAPI_ISteamInput_GetStringForActionOrigin = this.steamLib.func('SteamAPI_ISteamInput_GetStringForActionOrigin', 'str', ['void*', 'int']);
-    this.SteamAPI_ISteamInput_GetStringForXboxOrigin = this.steamLib.func('SteamAPI_ISteamInput_GetStringForXboxOrigin', 'str', ['void*', 'int']);
-    this.SteamAPI_ISteamInput_GetGlyphForXboxOrigin = this.steamLib.func('SteamAPI_ISteamInput_GetGlyphForXboxOrigin', 'str', ['void*', 'int']);
-    this.SteamAPI_ISteamInput_GetActionOriginFromXboxOrigin = this.steamLib.func('SteamAPI_ISteamInput_GetActionOriginFromXboxOrigin', 'int', ['void*', 'uint64', 'int']);
-    this.SteamAPI_ISteamInput_TranslateActionOrigin = this.steamLib.func('SteamAPI_ISteamInput_TranslateActionOrigin', 'int', ['void*', 'int', 'int']);
+    this.SteamAPI_ISteamInput_GetGlyphPNGForActionOrigin = lib.func('SteamAPI_ISteamInput_GetGlyphPNGForActionOrigin', 'str', ['void*', 'int', 'int', 'uint32']);
+    this.SteamAPI_ISteamInput_GetGlyphSVGForActionOrigin = lib.func('SteamAPI_ISteamInput_GetGlyphSVGForActionOrigin', 'str', ['void*', 'int', 'uint32']);
+    this.SteamAPI_ISteamInput_GetGlyphForActionOrigin_Legacy = lib.func('SteamAPI_ISteamInput_GetGlyphForActionOrigin_Legacy', 'str', ['void*', 'int']);
+    this.SteamAPI_ISteamInput_GetStringForActionOrigin = lib.func('SteamAPI_ISteamInput_GetStringForActionOrigin', 'str', ['void*', 'int']);
+    this.SteamAPI_ISteamInput_GetStringForXboxOrigin = lib.func('SteamAPI_ISteamInput_GetStringForXboxOrigin', 'str', ['void*', 'int']);
+    this.SteamAPI_ISteamInput_GetGlyphForXboxOrigin = lib.func('SteamAPI_ISteamInput_GetGlyphForXboxOrigin', 'str', ['void*', 'int']);
+    this.SteamAPI_ISteamInput_GetActionOriginFromXboxOrigin = lib.func('SteamAPI_ISteamInput_GetActionOriginFromXboxOrigin', 'int', ['void*', 'uint64', 'int']);
+    this.SteamAPI_ISteamInput_TranslateActionOrigin = lib.func('SteamAPI_ISteamInput_TranslateActionOrigin', 'int', ['void*', 'int', 'int']);
     
     // Utility
-    this.SteamAPI_ISteamInput_ShowBindingPanel = this.steamLib.func('SteamAPI_ISteamInput_ShowBindingPanel', 'bool', ['void*', 'uint64']);
-    this.SteamAPI_ISteamInput_GetDeviceBindingRevision = this.steamLib.func('SteamAPI_ISteamInput_GetDeviceBindingRevision', 'bool', ['void*', 'uint64', 'int*', 'int*']);
-    this.SteamAPI_ISteamInput_GetRemotePlaySessionID = this.steamLib.func('SteamAPI_ISteamInput_GetRemotePlaySessionID', 'uint32', ['void*', 'uint64']);
-    this.SteamAPI_ISteamInput_GetSessionInputConfigurationSettings = this.steamLib.func('SteamAPI_ISteamInput_GetSessionInputConfigurationSettings', 'uint16', ['void*']);
-    
-    // ========================================
-    // ISteamScreenshots Functions
-    // ========================================
-    
-    // Interface accessor
-    this.SteamAPI_SteamScreenshots_v003 = this.steamLib.func('SteamAPI_SteamScreenshots_v003', 'void*', []);
-    
+    this.SteamAPI_ISteamInput_ShowBindingPanel = lib.func('SteamAPI_ISteamInput_ShowBindingPanel', 'bool', ['void*', 'uint64']);
+    this.SteamAPI_ISteamInput_GetDeviceBindingRevision = lib.func('SteamAPI_ISteamInput_GetDeviceBindingRevision', 'bool', ['void*', 'uint64', 'int*', 'int*']);
+    this.SteamAPI_ISteamInput_GetRemotePlaySessionID = lib.func('SteamAPI_ISteamInput_GetRemotePlaySessionID', 'uint32', ['void*', 'uint64']);
+    this.SteamAPI_ISteamInput_GetSessionInputConfigurationSettings = lib.func('SteamAPI_ISteamInput_GetSessionInputConfigurationSettings', 'uint16', ['void*']);
+  }
+
+  /**
+   * ISteamScreenshots functions
+   */
+  private bindScreenshotsFunctions(lib: koffi.IKoffiLib): void {
     // Screenshot capture
-    this.SteamAPI_ISteamScreenshots_WriteScreenshot = this.steamLib.func('SteamAPI_ISteamScreenshots_WriteScreenshot', 'uint32', ['void*', 'void*', 'uint32', 'int', 'int']);
-    this.SteamAPI_ISteamScreenshots_AddScreenshotToLibrary = this.steamLib.func('SteamAPI_ISteamScreenshots_AddScreenshotToLibrary', 'uint32', ['void*', 'str', 'str', 'int', 'int']);
-    this.SteamAPI_ISteamScreenshots_TriggerScreenshot = this.steamLib.func('SteamAPI_ISteamScreenshots_TriggerScreenshot', 'void', ['void*']);
-    this.SteamAPI_ISteamScreenshots_HookScreenshots = this.steamLib.func('SteamAPI_ISteamScreenshots_HookScreenshots', 'void', ['void*', 'bool']);
-    this.SteamAPI_ISteamScreenshots_IsScreenshotsHooked = this.steamLib.func('SteamAPI_ISteamScreenshots_IsScreenshotsHooked', 'bool', ['void*']);
+    this.SteamAPI_ISteamScreenshots_WriteScreenshot = lib.func('SteamAPI_ISteamScreenshots_WriteScreenshot', 'uint32', ['void*', 'void*', 'uint32', 'int', 'int']);
+    this.SteamAPI_ISteamScreenshots_AddScreenshotToLibrary = lib.func('SteamAPI_ISteamScreenshots_AddScreenshotToLibrary', 'uint32', ['void*', 'str', 'str', 'int', 'int']);
+    this.SteamAPI_ISteamScreenshots_TriggerScreenshot = lib.func('SteamAPI_ISteamScreenshots_TriggerScreenshot', 'void', ['void*']);
+    this.SteamAPI_ISteamScreenshots_HookScreenshots = lib.func('SteamAPI_ISteamScreenshots_HookScreenshots', 'void', ['void*', 'bool']);
+    this.SteamAPI_ISteamScreenshots_IsScreenshotsHooked = lib.func('SteamAPI_ISteamScreenshots_IsScreenshotsHooked', 'bool', ['void*']);
     
     // Screenshot tagging
-    this.SteamAPI_ISteamScreenshots_SetLocation = this.steamLib.func('SteamAPI_ISteamScreenshots_SetLocation', 'bool', ['void*', 'uint32', 'str']);
-    this.SteamAPI_ISteamScreenshots_TagUser = this.steamLib.func('SteamAPI_ISteamScreenshots_TagUser', 'bool', ['void*', 'uint32', 'uint64']);
-    this.SteamAPI_ISteamScreenshots_TagPublishedFile = this.steamLib.func('SteamAPI_ISteamScreenshots_TagPublishedFile', 'bool', ['void*', 'uint32', 'uint64']);
+    this.SteamAPI_ISteamScreenshots_SetLocation = lib.func('SteamAPI_ISteamScreenshots_SetLocation', 'bool', ['void*', 'uint32', 'str']);
+    this.SteamAPI_ISteamScreenshots_TagUser = lib.func('SteamAPI_ISteamScreenshots_TagUser', 'bool', ['void*', 'uint32', 'uint64']);
+    this.SteamAPI_ISteamScreenshots_TagPublishedFile = lib.func('SteamAPI_ISteamScreenshots_TagPublishedFile', 'bool', ['void*', 'uint32', 'uint64']);
     
     // VR screenshots
-    this.SteamAPI_ISteamScreenshots_AddVRScreenshotToLibrary = this.steamLib.func('SteamAPI_ISteamScreenshots_AddVRScreenshotToLibrary', 'uint32', ['void*', 'int', 'str', 'str']);
-    
-    // ========================================
-    // ISteamApps Functions (DLC & App Ownership)
-    // ========================================
-    
-    // Interface accessor
-    this.SteamAPI_SteamApps_v009 = this.steamLib.func('SteamAPI_SteamApps_v009', 'void*', []);
-    
+    this.SteamAPI_ISteamScreenshots_AddVRScreenshotToLibrary = lib.func('SteamAPI_ISteamScreenshots_AddVRScreenshotToLibrary', 'uint32', ['void*', 'int', 'str', 'str']);
+  }
+
+  /**
+   * ISteamApps functions (DLC & App Ownership)
+   */
+  private bindAppsFunctions(lib: koffi.IKoffiLib): void {
     // Ownership checks
-    this.SteamAPI_ISteamApps_BIsSubscribed = this.steamLib.func('SteamAPI_ISteamApps_BIsSubscribed', 'bool', ['void*']);
-    this.SteamAPI_ISteamApps_BIsLowViolence = this.steamLib.func('SteamAPI_ISteamApps_BIsLowViolence', 'bool', ['void*']);
-    this.SteamAPI_ISteamApps_BIsCybercafe = this.steamLib.func('SteamAPI_ISteamApps_BIsCybercafe', 'bool', ['void*']);
-    this.SteamAPI_ISteamApps_BIsVACBanned = this.steamLib.func('SteamAPI_ISteamApps_BIsVACBanned', 'bool', ['void*']);
-    this.SteamAPI_ISteamApps_BIsSubscribedApp = this.steamLib.func('SteamAPI_ISteamApps_BIsSubscribedApp', 'bool', ['void*', 'uint32']);
-    this.SteamAPI_ISteamApps_BIsAppInstalled = this.steamLib.func('SteamAPI_ISteamApps_BIsAppInstalled', 'bool', ['void*', 'uint32']);
-    this.SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend = this.steamLib.func('SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend', 'bool', ['void*']);
-    this.SteamAPI_ISteamApps_BIsSubscribedFromFamilySharing = this.steamLib.func('SteamAPI_ISteamApps_BIsSubscribedFromFamilySharing', 'bool', ['void*']);
-    this.SteamAPI_ISteamApps_BIsTimedTrial = this.steamLib.func('SteamAPI_ISteamApps_BIsTimedTrial', 'bool', ['void*', 'uint32*', 'uint32*']);
+    this.SteamAPI_ISteamApps_BIsSubscribed = lib.func('SteamAPI_ISteamApps_BIsSubscribed', 'bool', ['void*']);
+    this.SteamAPI_ISteamApps_BIsLowViolence = lib.func('SteamAPI_ISteamApps_BIsLowViolence', 'bool', ['void*']);
+    this.SteamAPI_ISteamApps_BIsCybercafe = lib.func('SteamAPI_ISteamApps_BIsCybercafe', 'bool', ['void*']);
+    this.SteamAPI_ISteamApps_BIsVACBanned = lib.func('SteamAPI_ISteamApps_BIsVACBanned', 'bool', ['void*']);
+    this.SteamAPI_ISteamApps_BIsSubscribedApp = lib.func('SteamAPI_ISteamApps_BIsSubscribedApp', 'bool', ['void*', 'uint32']);
+    this.SteamAPI_ISteamApps_BIsAppInstalled = lib.func('SteamAPI_ISteamApps_BIsAppInstalled', 'bool', ['void*', 'uint32']);
+    this.SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend = lib.func('SteamAPI_ISteamApps_BIsSubscribedFromFreeWeekend', 'bool', ['void*']);
+    this.SteamAPI_ISteamApps_BIsSubscribedFromFamilySharing = lib.func('SteamAPI_ISteamApps_BIsSubscribedFromFamilySharing', 'bool', ['void*']);
+    this.SteamAPI_ISteamApps_BIsTimedTrial = lib.func('SteamAPI_ISteamApps_BIsTimedTrial', 'bool', ['void*', 'uint32*', 'uint32*']);
     
     // DLC functions
-    this.SteamAPI_ISteamApps_BIsDlcInstalled = this.steamLib.func('SteamAPI_ISteamApps_BIsDlcInstalled', 'bool', ['void*', 'uint32']);
-    this.SteamAPI_ISteamApps_GetDLCCount = this.steamLib.func('SteamAPI_ISteamApps_GetDLCCount', 'int', ['void*']);
-    this.SteamAPI_ISteamApps_BGetDLCDataByIndex = this.steamLib.func('SteamAPI_ISteamApps_BGetDLCDataByIndex', 'bool', ['void*', 'int', 'uint32*', 'bool*', 'char*', 'int']);
-    this.SteamAPI_ISteamApps_InstallDLC = this.steamLib.func('SteamAPI_ISteamApps_InstallDLC', 'void', ['void*', 'uint32']);
-    this.SteamAPI_ISteamApps_UninstallDLC = this.steamLib.func('SteamAPI_ISteamApps_UninstallDLC', 'void', ['void*', 'uint32']);
-    this.SteamAPI_ISteamApps_GetDlcDownloadProgress = this.steamLib.func('SteamAPI_ISteamApps_GetDlcDownloadProgress', 'bool', ['void*', 'uint32', 'uint64*', 'uint64*']);
-    this.SteamAPI_ISteamApps_SetDlcContext = this.steamLib.func('SteamAPI_ISteamApps_SetDlcContext', 'bool', ['void*', 'uint32']);
+    this.SteamAPI_ISteamApps_BIsDlcInstalled = lib.func('SteamAPI_ISteamApps_BIsDlcInstalled', 'bool', ['void*', 'uint32']);
+    this.SteamAPI_ISteamApps_GetDLCCount = lib.func('SteamAPI_ISteamApps_GetDLCCount', 'int', ['void*']);
+    this.SteamAPI_ISteamApps_BGetDLCDataByIndex = lib.func('SteamAPI_ISteamApps_BGetDLCDataByIndex', 'bool', ['void*', 'int', 'uint32*', 'bool*', 'char*', 'int']);
+    this.SteamAPI_ISteamApps_InstallDLC = lib.func('SteamAPI_ISteamApps_InstallDLC', 'void', ['void*', 'uint32']);
+    this.SteamAPI_ISteamApps_UninstallDLC = lib.func('SteamAPI_ISteamApps_UninstallDLC', 'void', ['void*', 'uint32']);
+    this.SteamAPI_ISteamApps_GetDlcDownloadProgress = lib.func('SteamAPI_ISteamApps_GetDlcDownloadProgress', 'bool', ['void*', 'uint32', 'uint64*', 'uint64*']);
+    this.SteamAPI_ISteamApps_SetDlcContext = lib.func('SteamAPI_ISteamApps_SetDlcContext', 'bool', ['void*', 'uint32']);
     
     // App info
-    this.SteamAPI_ISteamApps_GetCurrentGameLanguage = this.steamLib.func('SteamAPI_ISteamApps_GetCurrentGameLanguage', 'str', ['void*']);
-    this.SteamAPI_ISteamApps_GetAvailableGameLanguages = this.steamLib.func('SteamAPI_ISteamApps_GetAvailableGameLanguages', 'str', ['void*']);
-    this.SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime = this.steamLib.func('SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime', 'uint32', ['void*', 'uint32']);
-    this.SteamAPI_ISteamApps_GetAppInstallDir = this.steamLib.func('SteamAPI_ISteamApps_GetAppInstallDir', 'uint32', ['void*', 'uint32', 'char*', 'uint32']);
-    this.SteamAPI_ISteamApps_GetAppOwner = this.steamLib.func('SteamAPI_ISteamApps_GetAppOwner', 'uint64', ['void*']);
-    this.SteamAPI_ISteamApps_GetAppBuildId = this.steamLib.func('SteamAPI_ISteamApps_GetAppBuildId', 'int', ['void*']);
-    this.SteamAPI_ISteamApps_GetInstalledDepots = this.steamLib.func('SteamAPI_ISteamApps_GetInstalledDepots', 'uint32', ['void*', 'uint32', 'uint32*', 'uint32']);
+    this.SteamAPI_ISteamApps_GetCurrentGameLanguage = lib.func('SteamAPI_ISteamApps_GetCurrentGameLanguage', 'str', ['void*']);
+    this.SteamAPI_ISteamApps_GetAvailableGameLanguages = lib.func('SteamAPI_ISteamApps_GetAvailableGameLanguages', 'str', ['void*']);
+    this.SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime = lib.func('SteamAPI_ISteamApps_GetEarliestPurchaseUnixTime', 'uint32', ['void*', 'uint32']);
+    this.SteamAPI_ISteamApps_GetAppInstallDir = lib.func('SteamAPI_ISteamApps_GetAppInstallDir', 'uint32', ['void*', 'uint32', 'char*', 'uint32']);
+    this.SteamAPI_ISteamApps_GetAppOwner = lib.func('SteamAPI_ISteamApps_GetAppOwner', 'uint64', ['void*']);
+    this.SteamAPI_ISteamApps_GetAppBuildId = lib.func('SteamAPI_ISteamApps_GetAppBuildId', 'int', ['void*']);
+    this.SteamAPI_ISteamApps_GetInstalledDepots = lib.func('SteamAPI_ISteamApps_GetInstalledDepots', 'uint32', ['void*', 'uint32', 'uint32*', 'uint32']);
     
     // Beta branches
-    this.SteamAPI_ISteamApps_GetCurrentBetaName = this.steamLib.func('SteamAPI_ISteamApps_GetCurrentBetaName', 'bool', ['void*', 'char*', 'int']);
-    this.SteamAPI_ISteamApps_GetNumBetas = this.steamLib.func('SteamAPI_ISteamApps_GetNumBetas', 'int', ['void*', 'int*', 'int*']);
-    this.SteamAPI_ISteamApps_GetBetaInfo = this.steamLib.func('SteamAPI_ISteamApps_GetBetaInfo', 'bool', ['void*', 'int', 'uint32*', 'uint32*', 'char*', 'int', 'char*', 'int', 'uint32*']);
-    this.SteamAPI_ISteamApps_SetActiveBeta = this.steamLib.func('SteamAPI_ISteamApps_SetActiveBeta', 'bool', ['void*', 'str']);
+    this.SteamAPI_ISteamApps_GetCurrentBetaName = lib.func('SteamAPI_ISteamApps_GetCurrentBetaName', 'bool', ['void*', 'char*', 'int']);
+    this.SteamAPI_ISteamApps_GetNumBetas = lib.func('SteamAPI_ISteamApps_GetNumBetas', 'int', ['void*', 'int*', 'int*']);
+    this.SteamAPI_ISteamApps_GetBetaInfo = lib.func('SteamAPI_ISteamApps_GetBetaInfo', 'bool', ['void*', 'int', 'uint32*', 'uint32*', 'char*', 'int', 'char*', 'int', 'uint32*']);
+    this.SteamAPI_ISteamApps_SetActiveBeta = lib.func('SteamAPI_ISteamApps_SetActiveBeta', 'bool', ['void*', 'str']);
     
     // Launch parameters
-    this.SteamAPI_ISteamApps_GetLaunchQueryParam = this.steamLib.func('SteamAPI_ISteamApps_GetLaunchQueryParam', 'str', ['void*', 'str']);
-    this.SteamAPI_ISteamApps_GetLaunchCommandLine = this.steamLib.func('SteamAPI_ISteamApps_GetLaunchCommandLine', 'int', ['void*', 'char*', 'int']);
+    this.SteamAPI_ISteamApps_GetLaunchQueryParam = lib.func('SteamAPI_ISteamApps_GetLaunchQueryParam', 'str', ['void*', 'str']);
+    this.SteamAPI_ISteamApps_GetLaunchCommandLine = lib.func('SteamAPI_ISteamApps_GetLaunchCommandLine', 'int', ['void*', 'char*', 'int']);
     
     // Misc
-    this.SteamAPI_ISteamApps_MarkContentCorrupt = this.steamLib.func('SteamAPI_ISteamApps_MarkContentCorrupt', 'bool', ['void*', 'bool']);
-    this.SteamAPI_ISteamApps_GetFileDetails = this.steamLib.func('SteamAPI_ISteamApps_GetFileDetails', 'uint64', ['void*', 'str']);
-    
-    // ========================================
-    // ISteamMatchmaking Functions (Lobbies)
-    // ========================================
-    
-    // Interface accessor
-    this.SteamAPI_SteamMatchmaking_v009 = this.steamLib.func('SteamAPI_SteamMatchmaking_v009', 'void*', []);
-    
+    this.SteamAPI_ISteamApps_MarkContentCorrupt = lib.func('SteamAPI_ISteamApps_MarkContentCorrupt', 'bool', ['void*', 'bool']);
+    this.SteamAPI_ISteamApps_GetFileDetails = lib.func('SteamAPI_ISteamApps_GetFileDetails', 'uint64', ['void*', 'str']);
+  }
+
+  /**
+   * ISteamMatchmaking functions (Lobbies)
+   */
+  private bindMatchmakingFunctions(lib: koffi.IKoffiLib): void {
     // Favorite servers
-    this.SteamAPI_ISteamMatchmaking_GetFavoriteGameCount = this.steamLib.func('SteamAPI_ISteamMatchmaking_GetFavoriteGameCount', 'int', ['void*']);
-    this.SteamAPI_ISteamMatchmaking_GetFavoriteGame = this.steamLib.func('SteamAPI_ISteamMatchmaking_GetFavoriteGame', 'bool', ['void*', 'int', 'uint32*', 'uint32*', 'uint16*', 'uint16*', 'uint32*', 'uint32*']);
-    this.SteamAPI_ISteamMatchmaking_AddFavoriteGame = this.steamLib.func('SteamAPI_ISteamMatchmaking_AddFavoriteGame', 'int', ['void*', 'uint32', 'uint32', 'uint16', 'uint16', 'uint32', 'uint32']);
-    this.SteamAPI_ISteamMatchmaking_RemoveFavoriteGame = this.steamLib.func('SteamAPI_ISteamMatchmaking_RemoveFavoriteGame', 'bool', ['void*', 'uint32', 'uint32', 'uint16', 'uint16', 'uint32']);
+    this.SteamAPI_ISteamMatchmaking_GetFavoriteGameCount = lib.func('SteamAPI_ISteamMatchmaking_GetFavoriteGameCount', 'int', ['void*']);
+    this.SteamAPI_ISteamMatchmaking_GetFavoriteGame = lib.func('SteamAPI_ISteamMatchmaking_GetFavoriteGame', 'bool', ['void*', 'int', 'uint32*', 'uint32*', 'uint16*', 'uint16*', 'uint32*', 'uint32*']);
+    this.SteamAPI_ISteamMatchmaking_AddFavoriteGame = lib.func('SteamAPI_ISteamMatchmaking_AddFavoriteGame', 'int', ['void*', 'uint32', 'uint32', 'uint16', 'uint16', 'uint32', 'uint32']);
+    this.SteamAPI_ISteamMatchmaking_RemoveFavoriteGame = lib.func('SteamAPI_ISteamMatchmaking_RemoveFavoriteGame', 'bool', ['void*', 'uint32', 'uint32', 'uint16', 'uint16', 'uint32']);
     
     // Lobby list requests
-    this.SteamAPI_ISteamMatchmaking_RequestLobbyList = this.steamLib.func('SteamAPI_ISteamMatchmaking_RequestLobbyList', 'uint64', ['void*']);
-    this.SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter = this.steamLib.func('SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter', 'void', ['void*', 'str', 'str', 'int']);
-    this.SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter = this.steamLib.func('SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter', 'void', ['void*', 'str', 'int', 'int']);
-    this.SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter = this.steamLib.func('SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter', 'void', ['void*', 'str', 'int']);
-    this.SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable = this.steamLib.func('SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable', 'void', ['void*', 'int']);
-    this.SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter = this.steamLib.func('SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter', 'void', ['void*', 'int']);
-    this.SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter = this.steamLib.func('SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter', 'void', ['void*', 'int']);
-    this.SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter = this.steamLib.func('SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter', 'void', ['void*', 'uint64']);
-    this.SteamAPI_ISteamMatchmaking_GetLobbyByIndex = this.steamLib.func('SteamAPI_ISteamMatchmaking_GetLobbyByIndex', 'uint64', ['void*', 'int']);
+    this.SteamAPI_ISteamMatchmaking_RequestLobbyList = lib.func('SteamAPI_ISteamMatchmaking_RequestLobbyList', 'uint64', ['void*']);
+    this.SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter = lib.func('SteamAPI_ISteamMatchmaking_AddRequestLobbyListStringFilter', 'void', ['void*', 'str', 'str', 'int']);
+    this.SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter = lib.func('SteamAPI_ISteamMatchmaking_AddRequestLobbyListNumericalFilter', 'void', ['void*', 'str', 'int', 'int']);
+    this.SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter = lib.func('SteamAPI_ISteamMatchmaking_AddRequestLobbyListNearValueFilter', 'void', ['void*', 'str', 'int']);
+    this.SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable = lib.func('SteamAPI_ISteamMatchmaking_AddRequestLobbyListFilterSlotsAvailable', 'void', ['void*', 'int']);
+    this.SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter = lib.func('SteamAPI_ISteamMatchmaking_AddRequestLobbyListDistanceFilter', 'void', ['void*', 'int']);
+    this.SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter = lib.func('SteamAPI_ISteamMatchmaking_AddRequestLobbyListResultCountFilter', 'void', ['void*', 'int']);
+    this.SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter = lib.func('SteamAPI_ISteamMatchmaking_AddRequestLobbyListCompatibleMembersFilter', 'void', ['void*', 'uint64']);
+    this.SteamAPI_ISteamMatchmaking_GetLobbyByIndex = lib.func('SteamAPI_ISteamMatchmaking_GetLobbyByIndex', 'uint64', ['void*', 'int']);
     
     // Lobby creation and joining
-    this.SteamAPI_ISteamMatchmaking_CreateLobby = this.steamLib.func('SteamAPI_ISteamMatchmaking_CreateLobby', 'uint64', ['void*', 'int', 'int']);
-    this.SteamAPI_ISteamMatchmaking_JoinLobby = this.steamLib.func('SteamAPI_ISteamMatchmaking_JoinLobby', 'uint64', ['void*', 'uint64']);
-    this.SteamAPI_ISteamMatchmaking_LeaveLobby = this.steamLib.func('SteamAPI_ISteamMatchmaking_LeaveLobby', 'void', ['void*', 'uint64']);
-    this.SteamAPI_ISteamMatchmaking_InviteUserToLobby = this.steamLib.func('SteamAPI_ISteamMatchmaking_InviteUserToLobby', 'bool', ['void*', 'uint64', 'uint64']);
+    this.SteamAPI_ISteamMatchmaking_CreateLobby = lib.func('SteamAPI_ISteamMatchmaking_CreateLobby', 'uint64', ['void*', 'int', 'int']);
+    this.SteamAPI_ISteamMatchmaking_JoinLobby = lib.func('SteamAPI_ISteamMatchmaking_JoinLobby', 'uint64', ['void*', 'uint64']);
+    this.SteamAPI_ISteamMatchmaking_LeaveLobby = lib.func('SteamAPI_ISteamMatchmaking_LeaveLobby', 'void', ['void*', 'uint64']);
+    this.SteamAPI_ISteamMatchmaking_InviteUserToLobby = lib.func('SteamAPI_ISteamMatchmaking_InviteUserToLobby', 'bool', ['void*', 'uint64', 'uint64']);
     
     // Lobby members
-    this.SteamAPI_ISteamMatchmaking_GetNumLobbyMembers = this.steamLib.func('SteamAPI_ISteamMatchmaking_GetNumLobbyMembers', 'int', ['void*', 'uint64']);
-    this.SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex = this.steamLib.func('SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex', 'uint64', ['void*', 'uint64', 'int']);
+    this.SteamAPI_ISteamMatchmaking_GetNumLobbyMembers = lib.func('SteamAPI_ISteamMatchmaking_GetNumLobbyMembers', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex = lib.func('SteamAPI_ISteamMatchmaking_GetLobbyMemberByIndex', 'uint64', ['void*', 'uint64', 'int']);
     
     // Lobby data
-    this.SteamAPI_ISteamMatchmaking_GetLobbyData = this.steamLib.func('SteamAPI_ISteamMatchmaking_GetLobbyData', 'str', ['void*', 'uint64', 'str']);
-    this.SteamAPI_ISteamMatchmaking_SetLobbyData = this.steamLib.func('SteamAPI_ISteamMatchmaking_SetLobbyData', 'bool', ['void*', 'uint64', 'str', 'str']);
-    this.SteamAPI_ISteamMatchmaking_GetLobbyDataCount = this.steamLib.func('SteamAPI_ISteamMatchmaking_GetLobbyDataCount', 'int', ['void*', 'uint64']);
-    this.SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex = this.steamLib.func('SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex', 'bool', ['void*', 'uint64', 'int', 'char*', 'int', 'char*', 'int']);
-    this.SteamAPI_ISteamMatchmaking_DeleteLobbyData = this.steamLib.func('SteamAPI_ISteamMatchmaking_DeleteLobbyData', 'bool', ['void*', 'uint64', 'str']);
+    this.SteamAPI_ISteamMatchmaking_GetLobbyData = lib.func('SteamAPI_ISteamMatchmaking_GetLobbyData', 'str', ['void*', 'uint64', 'str']);
+    this.SteamAPI_ISteamMatchmaking_SetLobbyData = lib.func('SteamAPI_ISteamMatchmaking_SetLobbyData', 'bool', ['void*', 'uint64', 'str', 'str']);
+    this.SteamAPI_ISteamMatchmaking_GetLobbyDataCount = lib.func('SteamAPI_ISteamMatchmaking_GetLobbyDataCount', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex = lib.func('SteamAPI_ISteamMatchmaking_GetLobbyDataByIndex', 'bool', ['void*', 'uint64', 'int', 'char*', 'int', 'char*', 'int']);
+    this.SteamAPI_ISteamMatchmaking_DeleteLobbyData = lib.func('SteamAPI_ISteamMatchmaking_DeleteLobbyData', 'bool', ['void*', 'uint64', 'str']);
     
     // Lobby member data
-    this.SteamAPI_ISteamMatchmaking_GetLobbyMemberData = this.steamLib.func('SteamAPI_ISteamMatchmaking_GetLobbyMemberData', 'str', ['void*', 'uint64', 'uint64', 'str']);
-    this.SteamAPI_ISteamMatchmaking_SetLobbyMemberData = this.steamLib.func('SteamAPI_ISteamMatchmaking_SetLobbyMemberData', 'void', ['void*', 'uint64', 'str', 'str']);
+    this.SteamAPI_ISteamMatchmaking_GetLobbyMemberData = lib.func('SteamAPI_ISteamMatchmaking_GetLobbyMemberData', 'str', ['void*', 'uint64', 'uint64', 'str']);
+    this.SteamAPI_ISteamMatchmaking_SetLobbyMemberData = lib.func('SteamAPI_ISteamMatchmaking_SetLobbyMemberData', 'void', ['void*', 'uint64', 'str', 'str']);
     
     // Lobby chat
-    this.SteamAPI_ISteamMatchmaking_SendLobbyChatMsg = this.steamLib.func('SteamAPI_ISteamMatchmaking_SendLobbyChatMsg', 'bool', ['void*', 'uint64', 'void*', 'int']);
-    this.SteamAPI_ISteamMatchmaking_GetLobbyChatEntry = this.steamLib.func('SteamAPI_ISteamMatchmaking_GetLobbyChatEntry', 'int', ['void*', 'uint64', 'int', 'uint64*', 'void*', 'int', 'int*']);
+    this.SteamAPI_ISteamMatchmaking_SendLobbyChatMsg = lib.func('SteamAPI_ISteamMatchmaking_SendLobbyChatMsg', 'bool', ['void*', 'uint64', 'void*', 'int']);
+    this.SteamAPI_ISteamMatchmaking_GetLobbyChatEntry = lib.func('SteamAPI_ISteamMatchmaking_GetLobbyChatEntry', 'int', ['void*', 'uint64', 'int', 'uint64*', 'void*', 'int', 'int*']);
     
     // Lobby metadata request
-    this.SteamAPI_ISteamMatchmaking_RequestLobbyData = this.steamLib.func('SteamAPI_ISteamMatchmaking_RequestLobbyData', 'bool', ['void*', 'uint64']);
+    this.SteamAPI_ISteamMatchmaking_RequestLobbyData = lib.func('SteamAPI_ISteamMatchmaking_RequestLobbyData', 'bool', ['void*', 'uint64']);
     
     // Lobby game server
-    this.SteamAPI_ISteamMatchmaking_SetLobbyGameServer = this.steamLib.func('SteamAPI_ISteamMatchmaking_SetLobbyGameServer', 'void', ['void*', 'uint64', 'uint32', 'uint16', 'uint64']);
-    this.SteamAPI_ISteamMatchmaking_GetLobbyGameServer = this.steamLib.func('SteamAPI_ISteamMatchmaking_GetLobbyGameServer', 'bool', ['void*', 'uint64', 'uint32*', 'uint16*', 'uint64*']);
+    this.SteamAPI_ISteamMatchmaking_SetLobbyGameServer = lib.func('SteamAPI_ISteamMatchmaking_SetLobbyGameServer', 'void', ['void*', 'uint64', 'uint32', 'uint16', 'uint64']);
+    this.SteamAPI_ISteamMatchmaking_GetLobbyGameServer = lib.func('SteamAPI_ISteamMatchmaking_GetLobbyGameServer', 'bool', ['void*', 'uint64', 'uint32*', 'uint16*', 'uint64*']);
     
     // Lobby settings
-    this.SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit = this.steamLib.func('SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit', 'bool', ['void*', 'uint64', 'int']);
-    this.SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit = this.steamLib.func('SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit', 'int', ['void*', 'uint64']);
-    this.SteamAPI_ISteamMatchmaking_SetLobbyType = this.steamLib.func('SteamAPI_ISteamMatchmaking_SetLobbyType', 'bool', ['void*', 'uint64', 'int']);
-    this.SteamAPI_ISteamMatchmaking_SetLobbyJoinable = this.steamLib.func('SteamAPI_ISteamMatchmaking_SetLobbyJoinable', 'bool', ['void*', 'uint64', 'bool']);
-    this.SteamAPI_ISteamMatchmaking_GetLobbyOwner = this.steamLib.func('SteamAPI_ISteamMatchmaking_GetLobbyOwner', 'uint64', ['void*', 'uint64']);
-    this.SteamAPI_ISteamMatchmaking_SetLobbyOwner = this.steamLib.func('SteamAPI_ISteamMatchmaking_SetLobbyOwner', 'bool', ['void*', 'uint64', 'uint64']);
-    this.SteamAPI_ISteamMatchmaking_SetLinkedLobby = this.steamLib.func('SteamAPI_ISteamMatchmaking_SetLinkedLobby', 'bool', ['void*', 'uint64', 'uint64']);
-    
-    // ========================================
-    // ISteamUser Authentication Functions
-    // ========================================
+    this.SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit = lib.func('SteamAPI_ISteamMatchmaking_SetLobbyMemberLimit', 'bool', ['void*', 'uint64', 'int']);
+    this.SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit = lib.func('SteamAPI_ISteamMatchmaking_GetLobbyMemberLimit', 'int', ['void*', 'uint64']);
+    this.SteamAPI_ISteamMatchmaking_SetLobbyType = lib.func('SteamAPI_ISteamMatchmaking_SetLobbyType', 'bool', ['void*', 'uint64', 'int']);
+    this.SteamAPI_ISteamMatchmaking_SetLobbyJoinable = lib.func('SteamAPI_ISteamMatchmaking_SetLobbyJoinable', 'bool', ['void*', 'uint64', 'bool']);
+    this.SteamAPI_ISteamMatchmaking_GetLobbyOwner = lib.func('SteamAPI_ISteamMatchmaking_GetLobbyOwner', 'uint64', ['void*', 'uint64']);
+    this.SteamAPI_ISteamMatchmaking_SetLobbyOwner = lib.func('SteamAPI_ISteamMatchmaking_SetLobbyOwner', 'bool', ['void*', 'uint64', 'uint64']);
+    this.SteamAPI_ISteamMatchmaking_SetLinkedLobby = lib.func('SteamAPI_ISteamMatchmaking_SetLinkedLobby', 'bool', ['void*', 'uint64', 'uint64']);
+  }
+
+  /**
+   * ISteamUser functions (identity, authentication, voice)
+   */
+  private bindUserFunctions(lib: koffi.IKoffiLib): void {
+    this.SteamAPI_ISteamUser_GetSteamID = lib.func('SteamAPI_ISteamUser_GetSteamID', 'uint64', ['void*']);
     
     // Login state
-    this.SteamAPI_ISteamUser_BLoggedOn = this.steamLib.func('SteamAPI_ISteamUser_BLoggedOn', 'bool', ['void*']);
+    this.SteamAPI_ISteamUser_BLoggedOn = lib.func('SteamAPI_ISteamUser_BLoggedOn', 'bool', ['void*']);
     
     // Auth session tickets
     // GetAuthSessionTicket(pTicket, cbMaxTicket, pcbTicket, pSteamNetworkingIdentity) -> HAuthTicket
-    this.SteamAPI_ISteamUser_GetAuthSessionTicket = this.steamLib.func('SteamAPI_ISteamUser_GetAuthSessionTicket', 'uint32', ['void*', 'void*', 'int', 'uint32*', 'void*']);
+    this.SteamAPI_ISteamUser_GetAuthSessionTicket = lib.func('SteamAPI_ISteamUser_GetAuthSessionTicket', 'uint32', ['void*', 'void*', 'int', 'uint32*', 'void*']);
     // GetAuthTicketForWebApi(pchIdentity) -> HAuthTicket
-    this.SteamAPI_ISteamUser_GetAuthTicketForWebApi = this.steamLib.func('SteamAPI_ISteamUser_GetAuthTicketForWebApi', 'uint32', ['void*', 'str']);
+    this.SteamAPI_ISteamUser_GetAuthTicketForWebApi = lib.func('SteamAPI_ISteamUser_GetAuthTicketForWebApi', 'uint32', ['void*', 'str']);
     // BeginAuthSession(pAuthTicket, cbAuthTicket, steamID) -> EBeginAuthSessionResult
-    this.SteamAPI_ISteamUser_BeginAuthSession = this.steamLib.func('SteamAPI_ISteamUser_BeginAuthSession', 'int', ['void*', 'void*', 'int', 'uint64']);
+    this.SteamAPI_ISteamUser_BeginAuthSession = lib.func('SteamAPI_ISteamUser_BeginAuthSession', 'int', ['void*', 'void*', 'int', 'uint64']);
     // EndAuthSession(steamID) -> void
-    this.SteamAPI_ISteamUser_EndAuthSession = this.steamLib.func('SteamAPI_ISteamUser_EndAuthSession', 'void', ['void*', 'uint64']);
+    this.SteamAPI_ISteamUser_EndAuthSession = lib.func('SteamAPI_ISteamUser_EndAuthSession', 'void', ['void*', 'uint64']);
     // CancelAuthTicket(hAuthTicket) -> void
-    this.SteamAPI_ISteamUser_CancelAuthTicket = this.steamLib.func('SteamAPI_ISteamUser_CancelAuthTicket', 'void', ['void*', 'uint32']);
+    this.SteamAPI_ISteamUser_CancelAuthTicket = lib.func('SteamAPI_ISteamUser_CancelAuthTicket', 'void', ['void*', 'uint32']);
     // UserHasLicenseForApp(steamID, appID) -> EUserHasLicenseForAppResult
-    this.SteamAPI_ISteamUser_UserHasLicenseForApp = this.steamLib.func('SteamAPI_ISteamUser_UserHasLicenseForApp', 'int', ['void*', 'uint64', 'uint32']);
+    this.SteamAPI_ISteamUser_UserHasLicenseForApp = lib.func('SteamAPI_ISteamUser_UserHasLicenseForApp', 'int', ['void*', 'uint64', 'uint32']);
     
     // Encrypted app tickets
     // RequestEncryptedAppTicket(pDataToInclude, cbDataToInclude) -> SteamAPICall_t
-    this.SteamAPI_ISteamUser_RequestEncryptedAppTicket = this.steamLib.func('SteamAPI_ISteamUser_RequestEncryptedAppTicket', 'uint64', ['void*', 'void*', 'int']);
+    this.SteamAPI_ISteamUser_RequestEncryptedAppTicket = lib.func('SteamAPI_ISteamUser_RequestEncryptedAppTicket', 'uint64', ['void*', 'void*', 'int']);
     // GetEncryptedAppTicket(pTicket, cbMaxTicket, pcbTicket) -> bool
-    this.SteamAPI_ISteamUser_GetEncryptedAppTicket = this.steamLib.func('SteamAPI_ISteamUser_GetEncryptedAppTicket', 'bool', ['void*', 'void*', 'int', 'uint32*']);
+    this.SteamAPI_ISteamUser_GetEncryptedAppTicket = lib.func('SteamAPI_ISteamUser_GetEncryptedAppTicket', 'bool', ['void*', 'void*', 'int', 'uint32*']);
     
     // Security and account info
-    this.SteamAPI_ISteamUser_BIsPhoneVerified = this.steamLib.func('SteamAPI_ISteamUser_BIsPhoneVerified', 'bool', ['void*']);
-    this.SteamAPI_ISteamUser_BIsTwoFactorEnabled = this.steamLib.func('SteamAPI_ISteamUser_BIsTwoFactorEnabled', 'bool', ['void*']);
-    this.SteamAPI_ISteamUser_BIsPhoneIdentifying = this.steamLib.func('SteamAPI_ISteamUser_BIsPhoneIdentifying', 'bool', ['void*']);
-    this.SteamAPI_ISteamUser_BIsPhoneRequiringVerification = this.steamLib.func('SteamAPI_ISteamUser_BIsPhoneRequiringVerification', 'bool', ['void*']);
-    this.SteamAPI_ISteamUser_BIsBehindNAT = this.steamLib.func('SteamAPI_ISteamUser_BIsBehindNAT', 'bool', ['void*']);
+    this.SteamAPI_ISteamUser_BIsPhoneVerified = lib.func('SteamAPI_ISteamUser_BIsPhoneVerified', 'bool', ['void*']);
+    this.SteamAPI_ISteamUser_BIsTwoFactorEnabled = lib.func('SteamAPI_ISteamUser_BIsTwoFactorEnabled', 'bool', ['void*']);
+    this.SteamAPI_ISteamUser_BIsPhoneIdentifying = lib.func('SteamAPI_ISteamUser_BIsPhoneIdentifying', 'bool', ['void*']);
+    this.SteamAPI_ISteamUser_BIsPhoneRequiringVerification = lib.func('SteamAPI_ISteamUser_BIsPhoneRequiringVerification', 'bool', ['void*']);
+    this.SteamAPI_ISteamUser_BIsBehindNAT = lib.func('SteamAPI_ISteamUser_BIsBehindNAT', 'bool', ['void*']);
     
     // User info
-    this.SteamAPI_ISteamUser_GetPlayerSteamLevel = this.steamLib.func('SteamAPI_ISteamUser_GetPlayerSteamLevel', 'int', ['void*']);
-    this.SteamAPI_ISteamUser_GetGameBadgeLevel = this.steamLib.func('SteamAPI_ISteamUser_GetGameBadgeLevel', 'int', ['void*', 'int', 'bool']);
-    this.SteamAPI_ISteamUser_GetUserDataFolder = this.steamLib.func('SteamAPI_ISteamUser_GetUserDataFolder', 'bool', ['void*', 'char*', 'int']);
+    this.SteamAPI_ISteamUser_GetPlayerSteamLevel = lib.func('SteamAPI_ISteamUser_GetPlayerSteamLevel', 'int', ['void*']);
+    this.SteamAPI_ISteamUser_GetGameBadgeLevel = lib.func('SteamAPI_ISteamUser_GetGameBadgeLevel', 'int', ['void*', 'int', 'bool']);
+    this.SteamAPI_ISteamUser_GetUserDataFolder = lib.func('SteamAPI_ISteamUser_GetUserDataFolder', 'bool', ['void*', 'char*', 'int']);
     
     // Market and duration control
-    this.SteamAPI_ISteamUser_GetMarketEligibility = this.steamLib.func('SteamAPI_ISteamUser_GetMarketEligibility', 'uint64', ['void*']);
-    this.SteamAPI_ISteamUser_GetDurationControl = this.steamLib.func('SteamAPI_ISteamUser_GetDurationControl', 'uint64', ['void*']);
-    this.SteamAPI_ISteamUser_BSetDurationControlOnlineState = this.steamLib.func('SteamAPI_ISteamUser_BSetDurationControlOnlineState', 'bool', ['void*', 'int']);
+    this.SteamAPI_ISteamUser_GetMarketEligibility = lib.func('SteamAPI_ISteamUser_GetMarketEligibility', 'uint64', ['void*']);
+    this.SteamAPI_ISteamUser_GetDurationControl = lib.func('SteamAPI_ISteamUser_GetDurationControl', 'uint64', ['void*']);
+    this.SteamAPI_ISteamUser_BSetDurationControlOnlineState = lib.func('SteamAPI_ISteamUser_BSetDurationControlOnlineState', 'bool', ['void*', 'int']);
     
     // Advertising game
-    this.SteamAPI_ISteamUser_AdvertiseGame = this.steamLib.func('SteamAPI_ISteamUser_AdvertiseGame', 'void', ['void*', 'uint64', 'uint32', 'uint16']);
+    this.SteamAPI_ISteamUser_AdvertiseGame = lib.func('SteamAPI_ISteamUser_AdvertiseGame', 'void', ['void*', 'uint64', 'uint32', 'uint16']);
     
     // Store auth URL
-    this.SteamAPI_ISteamUser_RequestStoreAuthURL = this.steamLib.func('SteamAPI_ISteamUser_RequestStoreAuthURL', 'uint64', ['void*', 'str']);
+    this.SteamAPI_ISteamUser_RequestStoreAuthURL = lib.func('SteamAPI_ISteamUser_RequestStoreAuthURL', 'uint64', ['void*', 'str']);
     
     // Voice recording
-    this.SteamAPI_ISteamUser_StartVoiceRecording = this.steamLib.func('SteamAPI_ISteamUser_StartVoiceRecording', 'void', ['void*']);
-    this.SteamAPI_ISteamUser_StopVoiceRecording = this.steamLib.func('SteamAPI_ISteamUser_StopVoiceRecording', 'void', ['void*']);
-    this.SteamAPI_ISteamUser_GetAvailableVoice = this.steamLib.func('SteamAPI_ISteamUser_GetAvailableVoice', 'int', ['void*', 'uint32*', 'uint32*', 'uint32']);
-    this.SteamAPI_ISteamUser_GetVoice = this.steamLib.func('SteamAPI_ISteamUser_GetVoice', 'int', ['void*', 'bool', 'void*', 'uint32', 'uint32*', 'bool', 'void*', 'uint32', 'uint32*', 'uint32']);
-    this.SteamAPI_ISteamUser_DecompressVoice = this.steamLib.func('SteamAPI_ISteamUser_DecompressVoice', 'int', ['void*', 'void*', 'uint32', 'void*', 'uint32', 'uint32*', 'uint32']);
-    this.SteamAPI_ISteamUser_GetVoiceOptimalSampleRate = this.steamLib.func('SteamAPI_ISteamUser_GetVoiceOptimalSampleRate', 'uint32', ['void*']);
+    this.SteamAPI_ISteamUser_StartVoiceRecording = lib.func('SteamAPI_ISteamUser_StartVoiceRecording', 'void', ['void*']);
+    this.SteamAPI_ISteamUser_StopVoiceRecording = lib.func('SteamAPI_ISteamUser_StopVoiceRecording', 'void', ['void*']);
+    this.SteamAPI_ISteamUser_GetAvailableVoice = lib.func('SteamAPI_ISteamUser_GetAvailableVoice', 'int', ['void*', 'uint32*', 'uint32*', 'uint32']);
+    this.SteamAPI_ISteamUser_GetVoice = lib.func('SteamAPI_ISteamUser_GetVoice', 'int', ['void*', 'bool', 'void*', 'uint32', 'uint32*', 'bool', 'void*', 'uint32', 'uint32*', 'uint32']);
+    this.SteamAPI_ISteamUser_DecompressVoice = lib.func('SteamAPI_ISteamUser_DecompressVoice', 'int', ['void*', 'void*', 'uint32', 'void*', 'uint32', 'uint32*', 'uint32']);
+    this.SteamAPI_ISteamUser_GetVoiceOptimalSampleRate = lib.func('SteamAPI_ISteamUser_GetVoiceOptimalSampleRate', 'uint32', ['void*']);
   }
 
   /**
@@ -1515,6 +1644,12 @@ export class SteamLibraryLoader {
         SteamLogger.warn('[Steamworks] Failed to unload native library:', e);
       } finally {
         this.steamLib = null;
+        this.libraryPath = null;
+        // Drop accessors of groups never used; they would bind against the unloaded library
+        for (const names of this.pendingGroups.values()) {
+          for (const name of names) delete (this as any)[name];
+        }
+        this.pendingGroups.clear();
       }
     }
   }
@@ -1525,4 +1660,18 @@ export class SteamLibraryLoader {
   getLibrary(): koffi.IKoffiLib | null {
     return this.steamLib;
   }
+
+  /**
+   * Get the path of the loaded Steam library, for native code that binds to it
+   */
+  getLibraryPath(): string | null {
+    return this.libraryPath;
+  }
+
+  /**
+   * Library load time and per-group binding times so far, in milliseconds
+   */
+  getStartupTimings(): { libraryLoadMs: number; bindingMs: Record<string, number> } {
+    return { libraryLoadMs: this.startupTimings.libraryLoadMs, bindingMs: { ...this.startupTimings.bindingMs } };
+  }
 }
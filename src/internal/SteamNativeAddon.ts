@@ -0,0 +1,256 @@
+import { SteamLogger } from "./SteamLogger";
+import {
+  NetworkMessage,
+  NetworkMessageBatch,
+  NetworkSendRecord,
+  ESteamNetworkingIdentityType,
+  NETWORK_SEND_RECORD_SIZE,
+} from "../types";
+
+/**
+ * Native fast paths for hot Steamworks calls (native/steam-native.cpp)
+ *
+ * The addon binds to the same steam_api library koffi loaded and runs per-tick
+ * loops in C++. It's optional: when it isn't built for this platform, callers
+ * fall back to their koffi implementation.
+ */
+export interface SteamNativeModule {
+  /** Bind to the loaded steam_api library; false if an export is missing */
+  init(libraryPath: string): boolean;
+  /** Drain messages into holder.buffer (grown as needed); returns the count */
+  receiveMessages(handle: number, isPollGroup: boolean, maxMessages: number, holder: MessageArenaHolder): number;
+  /** Send one message per packed record via SendMessages; returns per-message results */
+  sendBatch(records: Buffer, payload: Buffer, results?: BigInt64Array): BigInt64Array;
+  /** Switch to manual dispatch and pump it on a native thread; false if unsupported */
+  startCallbackPump(onEvents: (events: CallbackPumpEvent[]) => void, intervalMs: number, pumpNetworking: boolean): boolean;
+  /** Stop the pump thread (Steam stays in manual-dispatch mode) */
+  stopCallbackPump(): void;
+  /** Pump state and events dropped because the queue was full */
+  getCallbackPumpStats(): { running: boolean; droppedEvents: number };
+  /** Read every (controller, action) pair into the snapshot arrays; returns the controllers read */
+  snapshotActionState(
+    inputHandles: BigUint64Array,
+    digitalActions: BigUint64Array,
+    analogActions: BigUint64Array,
+    digitalOut: Uint8Array,
+    analogOut: Float32Array
+  ): number;
+  /** Read each stat into valuesOut (found[i] = 1 when Steam has it); returns the count found */
+  getStats(names: string[], isFloat: boolean, valuesOut: Float64Array, foundOut: Uint8Array): number;
+  /** Set each stat without storing (setOut[i] = 1 when accepted); returns the count set */
+  setStats(names: string[], isFloat: boolean, values: Float64Array, setOut: Uint8Array): number;
+}
+
+/** Broadcast callback (kind 0) or completed SteamAPICall_t (kind 1) delivered by the pump */
+export interface CallbackPumpEvent {
+  kind: 0 | 1;
+  callbackId: number;
+  /** Set for call results */
+  callHandle?: bigint;
+  /** Set for call results */
+  ioFailure?: boolean;
+  /** Copy of the callback struct */
+  data: Buffer;
+}
+
+/** Owner of a reusable arena Buffer; native code swaps in a larger one when needed */
+export interface MessageArenaHolder {
+  buffer: Buffer;
+}
+
+// Arena layout — must match native/steam-native.cpp
+// [ header (16 bytes): count u32, payload offset u32 ] [ count × 64-byte entries ] [ payloads ]
+const ARENA_HEADER_BYTES = 16;
+const ARENA_ENTRY_BYTES = 64;
+const ENTRY_DATA_OFFSET = 0;
+const ENTRY_SIZE = 4;
+const ENTRY_CONNECTION = 8;
+const ENTRY_CHANNEL = 12;
+const ENTRY_FLAGS = 16;
+const ENTRY_LANE = 20;
+const ENTRY_IDENTITY_TYPE = 24;
+const ENTRY_STEAM_ID = 32;
+const ENTRY_CONN_USER_DATA = 40;
+const ENTRY_TIME_RECEIVED = 48;
+const ENTRY_MESSAGE_NUMBER = 56;
+
+let nativeModule: SteamNativeModule | null = null;
+let boundLibraryPath: string | null = null;
+let loadAttempted = false;
+
+/**
+ * Load the native addon and bind it to the given steam_api library.
+ * Returns null if the addon isn't available or couldn't bind.
+ */
+export function loadSteamNativeAddon(libraryPath: string | null): SteamNativeModule | null {
+  if (!libraryPath) return null;
+  if (nativeModule && boundLibraryPath === libraryPath) return nativeModule;
+
+  if (!loadAttempted) {
+    loadAttempted = true;
+    const prebuildPath = `../../prebuilds/${process.platform}-${process.arch}/steam-native.node`;
+    const localBuildPath = "../../native/build/Release/steam-native.node";
+
+    for (const modulePath of [localBuildPath, prebuildPath]) {
+      try {
+        nativeModule = require(modulePath);
+        SteamLogger.debug(`[Steamworks] Loaded native addon from ${modulePath}`);
+        break;
+      } catch (e) {
+        SteamLogger.debug(`[Steamworks] Native addon not loaded from ${modulePath}: ${e}`);
+      }
+    }
+  }
+
+  if (!nativeModule) return null;
+
+  if (!nativeModule.init(libraryPath)) {
+    SteamLogger.debug("[Steamworks] Native addon could not bind to the Steam library, using koffi");
+    return null;
+  }
+  boundLibraryPath = libraryPath;
+  return nativeModule;
+}
+
+/**
+ * Zero-copy view over a message arena filled by the native addon
+ */
+export class MessageArenaBatch implements NetworkMessageBatch {
+  readonly count: number;
+  readonly buffer: Buffer;
+
+  constructor(buffer: Buffer, count: number) {
+    this.buffer = buffer;
+    this.count = count;
+  }
+
+  private entry(index: number): number {
+    return ARENA_HEADER_BYTES + index * ARENA_ENTRY_BYTES;
+  }
+
+  data(index: number): Buffer {
+    const entry = this.entry(index);
+    const offset = this.buffer.readUInt32LE(entry + ENTRY_DATA_OFFSET);
+    return this.buffer.subarray(offset, offset + this.buffer.readInt32LE(entry + ENTRY_SIZE));
+  }
+
+  size(index: number): number {
+    return this.buffer.readInt32LE(this.entry(index) + ENTRY_SIZE);
+  }
+
+  connection(index: number): number {
+    return this.buffer.readUInt32LE(this.entry(index) + ENTRY_CONNECTION);
+  }
+
+  channel(index: number): number {
+    return this.buffer.readInt32LE(this.entry(index) + ENTRY_CHANNEL);
+  }
+
+  flags(index: number): number {
+    return this.buffer.readInt32LE(this.entry(index) + ENTRY_FLAGS);
+  }
+
+  lane(index: number): number {
+    return this.buffer.readUInt16LE(this.entry(index) + ENTRY_LANE);
+  }
+
+  steamId(index: number): bigint {
+    return this.buffer.readBigUInt64LE(this.entry(index) + ENTRY_STEAM_ID);
+  }
+
+  connectionUserData(index: number): bigint {
+    return this.buffer.readBigInt64LE(this.entry(index) + ENTRY_CONN_USER_DATA);
+  }
+
+  timeReceived(index: number): bigint {
+    return this.buffer.readBigInt64LE(this.entry(index) + ENTRY_TIME_RECEIVED);
+  }
+
+  messageNumber(index: number): bigint {
+    return this.buffer.readBigInt64LE(this.entry(index) + ENTRY_MESSAGE_NUMBER);
+  }
+
+  /**
+   * Copy message `index` out into a standalone NetworkMessage
+   */
+  toNetworkMessage(index: number): NetworkMessage {
+    const isSteamID =
+      this.buffer.readInt32LE(this.entry(index) + ENTRY_IDENTITY_TYPE) === ESteamNetworkingIdentityType.SteamID;
+    return {
+      data: Buffer.from(this.data(index)),
+      size: this.size(index),
+      connection: this.connection(index),
+      identityPeer: isSteamID ? this.steamId(index).toString() : "",
+      connectionUserData: this.connectionUserData(index),
+      timeReceived: this.timeReceived(index),
+      messageNumber: this.messageNumber(index),
+      channel: this.channel(index),
+      flags: this.flags(index),
+    };
+  }
+}
+
+/**
+ * Pack already-parsed messages into the arena layout, so the koffi fallback can
+ * hand out the same batch view as the native path
+ */
+export function packNetworkMessages(messages: NetworkMessage[], holder: MessageArenaHolder): MessageArenaBatch {
+  const payloadOffset = ARENA_HEADER_BYTES + messages.length * ARENA_ENTRY_BYTES;
+  let required = payloadOffset;
+  for (const msg of messages) required += (msg.size + 7) & ~7;
+
+  if (holder.buffer.length < required) {
+    let grown = holder.buffer.length || 64 * 1024;
+    while (grown < required) grown *= 2;
+    holder.buffer = Buffer.alloc(grown);
+  }
+
+  const buffer = holder.buffer;
+  buffer.writeUInt32LE(messages.length, 0);
+  buffer.writeUInt32LE(payloadOffset, 4);
+
+  let offset = payloadOffset;
+  messages.forEach((msg, i) => {
+    const entry = ARENA_HEADER_BYTES + i * ARENA_ENTRY_BYTES;
+    buffer.fill(0, entry, entry + ARENA_ENTRY_BYTES);
+    buffer.writeUInt32LE(offset, entry + ENTRY_DATA_OFFSET);
+    buffer.writeInt32LE(msg.size, entry + ENTRY_SIZE);
+    buffer.writeUInt32LE(msg.connection, entry + ENTRY_CONNECTION);
+    buffer.writeInt32LE(msg.channel, entry + ENTRY_CHANNEL);
+    buffer.writeInt32LE(msg.flags, entry + ENTRY_FLAGS);
+    if (msg.identityPeer) {
+      buffer.writeInt32LE(ESteamNetworkingIdentityType.SteamID, entry + ENTRY_IDENTITY_TYPE);
+      buffer.writeBigUInt64LE(BigInt(msg.identityPeer), entry + ENTRY_STEAM_ID);
+    }
+    buffer.writeBigInt64LE(msg.connectionUserData, entry + ENTRY_CONN_USER_DATA);
+    buffer.writeBigInt64LE(msg.timeReceived, entry + ENTRY_TIME_RECEIVED);
+    buffer.writeBigInt64LE(msg.messageNumber, entry + ENTRY_MESSAGE_NUMBER);
+    msg.data.copy(buffer, offset);
+    offset += (msg.size + 7) & ~7;
+  });
+
+  return new MessageArenaBatch(buffer, messages.length);
+}
+
+/**
+ * Pack send records into the 20-byte layout sendBatch takes, reusing holder.buffer
+ * when it is large enough. Returns a view of exactly `records.length` records.
+ */
+export function packSendRecords(records: NetworkSendRecord[], holder: MessageArenaHolder): Buffer {
+  const required = records.length * NETWORK_SEND_RECORD_SIZE;
+  if (holder.buffer.length < required) {
+    holder.buffer = Buffer.alloc(Math.max(required, 64 * NETWORK_SEND_RECORD_SIZE));
+  }
+
+  const buffer = holder.buffer;
+  records.forEach((record, i) => {
+    const offset = i * NETWORK_SEND_RECORD_SIZE;
+    buffer.writeUInt32LE(record.connection, offset);
+    buffer.writeInt32LE(record.flags, offset + 4);
+    buffer.writeUInt16LE(record.lane ?? 0, offset + 8);
+    buffer.writeUInt16LE(0, offset + 10);
+    buffer.writeUInt32LE(record.offset, offset + 12);
+    buffer.writeUInt32LE(record.length, offset + 16);
+  });
+  return buffer.subarray(0, required);
+}
@@ -3,6 +3,16 @@ import { SteamLibraryLoader, FnSteamNetConnectionStatusChangedPtr } from './Stea
 import { SteamAPICore } from './SteamAPICore';
 import { SteamCallbackPoller } from './SteamCallbackPoller';
 import { SteamLogger } from './SteamLogger';
+import { SteamScratch } from './SteamScratch';
+import { K_I_STEAM_NET_CONNECTION_STATUS_CHANGED, SteamNetConnectionStatusChangedCallbackType } from './callbackTypes';
+import {
+  SteamNativeModule,
+  MessageArenaBatch,
+  MessageArenaHolder,
+  loadSteamNativeAddon,
+  packNetworkMessages,
+  packSendRecords,
+} from './SteamNativeAddon';
 import {
   HSteamListenSocket,
   HSteamNetConnection,
@@ -16,6 +26,9 @@ import {
   ConnectionInfo,
   ConnectionRealTimeStatus,
   NetworkMessage,
+  NetworkMessageBatch,
+  NetworkSendRecord,
+  NETWORK_SEND_RECORD_SIZE,
   SendMessageResult,
   P2PConnectionRequest,
   ConnectionStateChange,
@@ -30,6 +43,10 @@ import {
 // This is necessary because native callbacks can't capture JS closures
 let globalCallbackManager: SteamNetworkingSocketsManager | null = null;
 
+// SteamNetworkingMessage_t header as read by parseNetworkMessage (216 bytes on 64-bit),
+// built once instead of on every received message
+const MESSAGE_HEADER_TYPE = koffi.array('uint8', 216);
+
 /**
  * Callback handler for connection state changes
  */
@@ -100,12 +117,22 @@ export class SteamNetworkingSocketsManager {
   private connectionStatusCallback: any = null;
   private callbackRegistered: boolean = false;
 
+  // Native batched receive (undefined until first use, null if unavailable)
+  private nativeAddon: SteamNativeModule | null | undefined = undefined;
+  private messageArena: MessageArenaHolder = { buffer: Buffer.alloc(0) };
+  private sendRecords: MessageArenaHolder = { buffer: Buffer.alloc(0) };
+
   constructor(libraryLoader: SteamLibraryLoader, apiCore: SteamAPICore) {
     this.libraryLoader = libraryLoader;
     this.apiCore = apiCore;
     
     // Set global reference for native callback
     globalCallbackManager = this;
+
+    // With the native callback pump, status changes arrive as pumped callbacks
+    apiCore.getCallbackPump().onCallback(K_I_STEAM_NET_CONNECTION_STATUS_CHANGED, (data) =>
+      this.applyConnectionStatusChanged(SteamCallbackPoller.parseConnectionStatusChangedBuffer(data))
+    );
     
     // Note: Don't register callback in constructor since Steam may not be initialized yet
     // The callback will be registered lazily when needed
@@ -129,6 +156,12 @@ export class SteamNetworkingSocketsManager {
   private registerGlobalCallback(): void {
     if (this.callbackRegistered) return;
 
+    // The pump installs its own native callback on its thread
+    if (this.apiCore.getCallbackPump().isPumpingNetworking()) {
+      this.callbackRegistered = true;
+      return;
+    }
+
     try {
       // Create the callback function that will be called from native code
       // The callback receives a pointer to SteamNetConnectionStatusChangedCallback_t
@@ -176,9 +209,16 @@ export class SteamNetworkingSocketsManager {
       return;
     }
 
+    // Use centralized parser from SteamCallbackPoller
+    this.applyConnectionStatusChanged(SteamCallbackPoller.parseConnectionStatusChangedCallback(infoPtr));
+  }
+
+  /**
+   * Track and dispatch a parsed connection status change, from either the
+   * koffi callback or the native callback pump
+   */
+  private applyConnectionStatusChanged(parsed: SteamNetConnectionStatusChangedCallbackType | null): void {
     try {
-      // Use centralized parser from SteamCallbackPoller
-      const parsed = SteamCallbackPoller.parseConnectionStatusChangedCallback(infoPtr);
       if (!parsed) return;
 
       const connection = parsed.m_hConn as HSteamNetConnection;
@@ -557,6 +597,64 @@ export class SteamNetworkingSocketsManager {
     return this.sendMessage(connection, data, k_nSteamNetworkingSend_Unreliable);
   }
 
+  /**
+   * Send many messages in one call
+   * 
+   * Each record sends a slice of `payload` to a connection. With the native
+   * addon the messages are built with `AllocateMessage` and handed to
+   * `SendMessages` in a single FFI call; the payload is copied once and shared
+   * by every message pointing into it, so broadcasting one snapshot to 32 peers
+   * costs one crossing and one copy. Falls back to one `SendMessageToConnection`
+   * per record when the addon isn't available.
+   * 
+   * @param records - Records as objects, or pre-packed in a Buffer of
+   *                  `NETWORK_SEND_RECORD_SIZE`-byte records
+   * @param payload - Bytes the records point into
+   * @param results - Optional BigInt64Array to reuse for the results
+   * @returns One entry per record: the message number (> 0) on success, or the
+   *          negated EResult on failure
+   * 
+   * @example
+   * ```typescript
+   * // Fan one snapshot out to every peer
+   * const records = peers.map(connection => ({
+   *   connection, flags: k_nSteamNetworkingSend_Unreliable, offset: 0, length: snapshot.length
+   * }));
+   * const results = steam.networkingSockets.sendBatch(records, snapshot);
+   * ```
+   */
+  sendBatch(
+    records: NetworkSendRecord[] | Buffer,
+    payload: Buffer,
+    results?: BigInt64Array
+  ): BigInt64Array {
+    const packed = Buffer.isBuffer(records) ? records : packSendRecords(records, this.sendRecords);
+
+    const addon = this.getNativeAddon();
+    if (addon) {
+      return addon.sendBatch(packed, payload, results);
+    }
+
+    const count = Math.floor(packed.length / NETWORK_SEND_RECORD_SIZE);
+    const out = results && results.length >= count ? results : new BigInt64Array(count);
+    for (let i = 0; i < count; i++) {
+      const record = i * NETWORK_SEND_RECORD_SIZE;
+      const offset = packed.readUInt32LE(record + 12);
+      const length = packed.readUInt32LE(record + 16);
+      if (offset + length > payload.length) {
+        out[i] = -BigInt(EResult.InvalidParam);
+        continue;
+      }
+      const sent = this.sendMessage(
+        packed.readUInt32LE(record),
+        payload.subarray(offset, offset + length),
+        packed.readInt32LE(record + 4)
+      );
+      out[i] = sent.success ? sent.messageNumber : -BigInt(sent.result);
+    }
+    return out;
+  }
+
   /**
    * Flush pending messages on a connection
    * 
@@ -594,30 +692,60 @@ export class SteamNetworkingSocketsManager {
    * ```
    */
   receiveMessages(connection: HSteamNetConnection, maxMessages: number = 16): NetworkMessage[] {
+    return this.receive(connection, false, maxMessages);
+  }
+
+  /**
+   * Get the native addon, loading it on first use
+   */
+  private getNativeAddon(): SteamNativeModule | null {
+    if (this.nativeAddon === undefined) {
+      this.nativeAddon = loadSteamNativeAddon(this.libraryLoader.getLibraryPath());
+      SteamLogger.debug(`[Steamworks] Message receive path: ${this.nativeAddon ? 'native batch' : 'koffi'}`);
+    }
+    return this.nativeAddon;
+  }
+
+  /**
+   * Receive from a connection or poll group as standalone NetworkMessage objects
+   */
+  private receive(handle: number, isPollGroup: boolean, maxMessages: number): NetworkMessage[] {
+    const addon = this.getNativeAddon();
+    if (!addon) {
+      return this.receiveWithKoffi(handle, isPollGroup, maxMessages);
+    }
+
+    const count = addon.receiveMessages(handle, isPollGroup, maxMessages, this.messageArena);
+    const batch = new MessageArenaBatch(this.messageArena.buffer, count);
+    const messages: NetworkMessage[] = new Array(count);
+    for (let i = 0; i < count; i++) {
+      messages[i] = batch.toNetworkMessage(i);
+    }
+    return messages;
+  }
+
+  /**
+   * Receive through koffi: one FFI call for the pointer array, then a decode and
+   * release per message
+   */
+  private receiveWithKoffi(handle: number, isPollGroup: boolean, maxMessages: number): NetworkMessage[] {
     const iface = this.getInterface();
     
-    // Allocate array of pointers to receive message pointers
-    // Use void* array - koffi will fill with native pointers
-    const messagePtrs = koffi.alloc('void*', maxMessages);
+    // Shared pointer array - Steam fills it with native message pointers
+    const messagePtrs = SteamScratch.pointers(maxMessages);
     
-    const numMessages = this.libraryLoader.SteamAPI_ISteamNetworkingSockets_ReceiveMessagesOnConnection(
-      iface,
-      connection,
-      messagePtrs,
-      maxMessages
-    );
+    const numMessages = isPollGroup
+      ? this.libraryLoader.SteamAPI_ISteamNetworkingSockets_ReceiveMessagesOnPollGroup(iface, handle, messagePtrs, maxMessages)
+      : this.libraryLoader.SteamAPI_ISteamNetworkingSockets_ReceiveMessagesOnConnection(iface, handle, messagePtrs, maxMessages);
     
     if (numMessages <= 0) {
       return [];
     }
     
-    // Decode the array of pointers
-    const ptrArray = koffi.decode(messagePtrs, koffi.array('void*', numMessages));
-    
     const messages: NetworkMessage[] = [];
     
     for (let i = 0; i < numMessages; i++) {
-      const msgPtr = ptrArray[i];
+      const msgPtr = SteamScratch.pointerAt(messagePtrs, i);
       if (msgPtr) {
         const msg = this.parseNetworkMessage(msgPtr);
         if (msg) {
@@ -659,8 +787,7 @@ export class SteamNetworkingSocketsManager {
     
     try {
       // Read the message struct header
-      const HEADER_SIZE = 216;
-      const headerBytes = koffi.decode(msgPtr, koffi.array('uint8', HEADER_SIZE));
+      const headerBytes = koffi.decode(msgPtr, MESSAGE_HEADER_TYPE);
       const header = Buffer.from(headerBytes);
       
       // Parse header fields - offsets for 64-bit with natural alignment
@@ -783,38 +910,39 @@ export class SteamNetworkingSocketsManager {
    * @returns Array of received messages (with connection info)
    */
   receiveMessagesOnPollGroup(pollGroup: HSteamNetPollGroup, maxMessages: number = 64): NetworkMessage[] {
-    const iface = this.getInterface();
-    
-    // Allocate array of pointers to receive message pointers
-    const messagePtrs = koffi.alloc('void*', maxMessages);
-    
-    const numMessages = this.libraryLoader.SteamAPI_ISteamNetworkingSockets_ReceiveMessagesOnPollGroup(
-      iface,
-      pollGroup,
-      messagePtrs,
-      maxMessages
-    );
-    
-    if (numMessages <= 0) {
-      return [];
-    }
-    
-    // Decode the array of pointers
-    const ptrArray = koffi.decode(messagePtrs, koffi.array('void*', numMessages));
-    
-    const messages: NetworkMessage[] = [];
-    
-    for (let i = 0; i < numMessages; i++) {
-      const msgPtr = ptrArray[i];
-      if (msgPtr) {
-        const msg = this.parseNetworkMessage(msgPtr);
-        if (msg) {
-          messages.push(msg);
-        }
-      }
+    return this.receive(pollGroup, true, maxMessages);
+  }
+
+  /**
+   * Receive messages from a poll group as one packed batch
+   * 
+   * The fast path for game loops: the native addon drains the poll group,
+   * copies headers and payloads into a reusable arena Buffer and releases the
+   * messages in one call, so there are no per-message FFI crossings or objects.
+   * Falls back to koffi (same batch view) when the addon isn't built.
+   * 
+   * The batch and its `data()` views are overwritten by the next receive call.
+   * 
+   * @param pollGroup - Handle to the poll group
+   * @param maxMessages - Maximum number of messages to receive (default 256)
+   * @returns Batch view over the received messages
+   * 
+   * @example
+   * ```typescript
+   * const batch = steam.networkingSockets.receiveMessageBatch(pollGroup);
+   * for (let i = 0; i < batch.count; i++) {
+   *   handlePacket(batch.connection(i), batch.data(i));
+   * }
+   * ```
+   */
+  receiveMessageBatch(pollGroup: HSteamNetPollGroup, maxMessages: number = 256): NetworkMessageBatch {
+    const addon = this.getNativeAddon();
+    if (!addon) {
+      return packNetworkMessages(this.receiveWithKoffi(pollGroup, true, maxMessages), this.messageArena);
     }
-    
-    return messages;
+
+    const count = addon.receiveMessages(pollGroup, true, maxMessages, this.messageArena);
+    return new MessageArenaBatch(this.messageArena.buffer, count);
   }
 
   // ============================================================================
@@ -1096,8 +1224,11 @@ export class SteamNetworkingSocketsManager {
     // Ensure callback is registered
     this.ensureCallbackRegistered();
     
-    const iface = this.getInterface();
-    this.libraryLoader.SteamAPI_ISteamNetworkingSockets_RunCallbacks(iface);
+    // Already run on the pump thread when the native callback pump is active
+    if (!this.apiCore.getCallbackPump().isPumpingNetworking()) {
+      const iface = this.getInterface();
+      this.libraryLoader.SteamAPI_ISteamNetworkingSockets_RunCallbacks(iface);
+    }
     
     // Also poll all active connections for state changes as fallback
     // This catches any changes for connections we're already tracking
@@ -1239,8 +1370,8 @@ export class SteamNetworkingSocketsManager {
       this.destroyPollGroup(group);
     }
     
-    // Unregister the global callback
-    if (this.callbackRegistered) {
+    // Unregister the global callback (the pump's native one is removed when it stops)
+    if (this.callbackRegistered && !this.apiCore.getCallbackPump().isPumpingNetworking()) {
       try {
         const utils = this.libraryLoader.SteamAPI_SteamNetworkingUtils_SteamAPI_v004();
         if (utils) {
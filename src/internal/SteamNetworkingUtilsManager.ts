@@ -2,6 +2,7 @@ import * as koffi from 'koffi';
 import { SteamLibraryLoader } from './SteamLibraryLoader';
 import { SteamAPICore } from './SteamAPICore';
 import { SteamLogger } from './SteamLogger';
+import { SteamScratch } from './SteamScratch';
 import {
   ESteamNetworkingAvailability,
   ESteamNetworkingSocketsDebugOutputType,
@@ -530,12 +531,12 @@ export class SteamNetworkingUtilsManager {
         const popId = popIdArray[i];
         
         // Get ping to this data center
-        const viaRelayPopIdPtr = koffi.alloc('uint32', 1);
+        const viaRelayPopIdPtr = SteamScratch.slot();
         const pingViaRelay = this.libraryLoader.SteamAPI_ISteamNetworkingUtils_GetPingToDataCenter(
           utils, popId, viaRelayPopIdPtr
         ) as number;
         
-        const viaRelayPOP = koffi.decode(viaRelayPopIdPtr, 'uint32') as number;
+        const viaRelayPOP = viaRelayPopIdPtr.readUInt32LE(0);
         
         // Get direct ping to this POP
         const directPing = this.libraryLoader.SteamAPI_ISteamNetworkingUtils_GetDirectPingToPOP(
@@ -583,14 +584,14 @@ export class SteamNetworkingUtilsManager {
     if (!utils) return null;
     
     try {
-      const viaRelayPopIdPtr = koffi.alloc('uint32', 1);
+      const viaRelayPopIdPtr = SteamScratch.slot();
       const pingMs = this.libraryLoader.SteamAPI_ISteamNetworkingUtils_GetPingToDataCenter(
         utils, popId, viaRelayPopIdPtr
       ) as number;
       
       if (pingMs < 0) return null;
       
-      const viaRelayPOP = koffi.decode(viaRelayPopIdPtr, 'uint32') as number;
+      const viaRelayPOP = viaRelayPopIdPtr.readUInt32LE(0);
       return { pingMs, viaRelayPOP };
     } catch (error) {
       SteamLogger.error('[Steamworks] Failed to get ping to data center:', error);
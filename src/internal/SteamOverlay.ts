@@ -1,4 +1,12 @@
 import { SteamLogger } from "./SteamLogger";
+import { SteamOverlayTimings } from "./SteamOverlayTimings";
+import { SteamOverlayCaptureController } from "./SteamOverlayCaptureController";
+import {
+  ElectronOverlayOptions,
+  OverlayDirtyRect,
+  OverlayRenderStats,
+  OverlaySharedTextureInfo,
+} from "../types";
 
 /**
  * Steam Overlay Integration for Electron
@@ -40,6 +48,9 @@ export class SteamOverlay {
   private nativeModule: any = null;
   private isInitialized: boolean = false;
   private overlayWindow: any = null;
+  private overlayNeedsPresent: () => boolean = () => false;
+  private frameBuffer: Buffer | null = null;
+  private timings = new SteamOverlayTimings();
 
   constructor() {
     // Load native overlay module for the current platform
@@ -96,6 +107,17 @@ export class SteamOverlay {
     }
   }
 
+  /**
+   * Set the check used to keep presenting while the page is static
+   *
+   * The Steam overlay draws from inside our buffer swap, so when
+   * `ISteamUtils::BOverlayNeedsPresent()` reports true, unchanged frames are
+   * still presented and the capture loop doesn't back off.
+   */
+  setOverlayNeedsPresentCheck(check: () => boolean): void {
+    this.overlayNeedsPresent = check;
+  }
+
   /**
    * Set debug mode for native overlay logging
    * Call this when SteamLogger debug mode changes
@@ -144,11 +166,7 @@ export class SteamOverlay {
    */
   addElectronSteamOverlay(
     browserWindow: any,
-    options?: {
-      title?: string;
-      fps?: number;
-      vsync?: boolean;
-    },
+    options?: ElectronOverlayOptions,
   ): boolean {
     if (!this.isInitialized || !this.nativeModule) {
       SteamLogger.error(
@@ -166,27 +184,106 @@ export class SteamOverlay {
     }
 
     try {
-      // Get content bounds (excludes title bar) for overlay window
-      const contentBounds = browserWindow.getContentBounds();
-      const fps = options?.fps || 60;
-      const frameInterval = Math.floor(1000 / fps);
-
-      // Create overlay window matching Electron's content area (not full window)
-      const overlayWindowOptions = {
-        width: contentBounds.width,
-        height: contentBounds.height,
-        title: options?.title || "Electron Steam App",
-        fps: fps,
-        vsync: options?.vsync !== false,
-      };
+      this.overlayWindow = this.nativeModule.createOverlayWindow(
+        this.nativeWindowOptions(browserWindow, options),
+      );
+      return this.attachOverlay(browserWindow, options);
+    } catch (error) {
+      SteamLogger.error("[Steam Overlay] Error adding overlay:", error);
+      return false;
+    }
+  }
 
-      this.overlayWindow =
-        this.nativeModule.createOverlayWindow(overlayWindowOptions);
+  /**
+   * Add Steam overlay support to an Electron BrowserWindow without blocking
+   * the main process while the native window is set up
+   *
+   * @param browserWindow - The Electron BrowserWindow to add overlay support to
+   * @param options - Optional configuration for the overlay window
+   * @returns Resolves to true once the overlay is attached, false on failure
+   *
+   * @remarks
+   * Same as {@link addElectronSteamOverlay}, but the expensive part of the
+   * native setup — OpenGL context creation and shader compilation on Linux
+   * and Windows, the Metal device and pipeline on macOS — runs on a worker
+   * thread. Call it right after creating the BrowserWindow so the overlay is
+   * ready by the time the page has loaded. Falls back to the synchronous path
+   * when the native module has no asynchronous creation.
+   *
+   * @example
+   * ```typescript
+   * const win = new BrowserWindow({ width: 1280, height: 720 });
+   * const overlayReady = steam.addElectronSteamOverlayAsync(win);
+   * await win.loadFile('index.html');
+   * await overlayReady;
+   * ```
+   */
+  async addElectronSteamOverlayAsync(
+    browserWindow: any,
+    options?: ElectronOverlayOptions,
+  ): Promise<boolean> {
+    if (!this.nativeModule?.createOverlayWindowAsync) {
+      return this.addElectronSteamOverlay(browserWindow, options);
+    }
+    if (!this.isInitialized) {
+      SteamLogger.error(
+        "[Steam Overlay] Cannot add overlay: Native module not initialized",
+      );
+      return false;
+    }
 
-      if (!this.overlayWindow) {
-        SteamLogger.error("[Steam Overlay] Failed to create overlay window");
+    try {
+      const overlayWindow = await this.nativeModule.createOverlayWindowAsync(
+        this.nativeWindowOptions(browserWindow, options),
+      );
+      if (browserWindow.isDestroyed()) {
+        this.nativeModule.destroyOverlayWindow(overlayWindow);
         return false;
       }
+      this.overlayWindow = overlayWindow;
+      return this.attachOverlay(browserWindow, options);
+    } catch (error) {
+      SteamLogger.error("[Steam Overlay] Error adding overlay:", error);
+      return false;
+    }
+  }
+
+  /**
+   * Options for the native createOverlayWindow call
+   */
+  private nativeWindowOptions(browserWindow: any, options?: ElectronOverlayOptions) {
+    // Get content bounds (excludes title bar) for overlay window
+    const contentBounds = browserWindow.getContentBounds();
+
+    // Create overlay window matching Electron's content area (not full window)
+    return {
+      width: contentBounds.width,
+      height: contentBounds.height,
+      title: options?.title || "Electron Steam App",
+      fps: options?.fps || 60,
+      vsync: options?.vsync !== false,
+      pixelBuffers: options?.pixelBuffers !== false,
+      renderThread: options?.renderThread !== false,
+      shaderRenderer: options?.shaderRenderer !== false,
+      drawOnDemand: options?.drawOnDemand === true,
+      matchDisplayRefresh: options?.matchDisplayRefresh === true,
+      upscaleSharpness: options?.upscaleSharpness ?? 0.5,
+      compressedTextures: options?.compressedTextures === true,
+    };
+  }
+
+  /**
+   * Wire the freshly created native window up to the BrowserWindow: window
+   * properties, the capture loop and event handlers
+   */
+  private attachOverlay(browserWindow: any, options?: ElectronOverlayOptions): boolean {
+    if (!this.overlayWindow) {
+      SteamLogger.error("[Steam Overlay] Failed to create overlay window");
+      return false;
+    }
+
+    try {
+      const fps = options?.fps || 60;
 
       // On Linux: tag the Electron window with STEAM_GAME and wire up input forwarding
       if (process.platform === "linux") {
@@ -221,18 +318,58 @@ export class SteamOverlay {
       let captureActive = true;
       let frameCount = 0;
 
+      // Track overlay visibility to prevent duplicate show/hide calls.
+      // On Linux/Gamescope 'show'+'restore' fire together on restore, and
+      // 'hide'+'minimize' fire together on minimize — deduplication is critical.
+      // Capture pauses while the overlay is hidden: there is nothing to draw into.
+      let overlayVisible = false;
+
+      // Capture loop state: the pending timer and whether a capture is running,
+      // so resuming never starts a second loop
+      const controller = new SteamOverlayCaptureController(options);
+      let captureTimer: NodeJS.Timeout | null = null;
+      let captureInFlight = false;
+
+      const capturePaused = () => !overlayVisible || browserWindow.isMinimized();
+
       // Use capturePage() - more reliable than offscreen rendering
       const captureFrame = async () => {
-        if (!captureActive || !this.overlayWindow || !this.nativeModule) {
+        captureTimer = null;
+        if (!captureActive || !this.overlayWindow || !this.nativeModule || capturePaused()) {
           return;
         }
 
+        captureInFlight = true;
+        let needsPresent = false;
+        let changed = false;
+        const captureStart = performance.now();
+
         try {
-          const image = await browserWindow.webContents.capturePage();
-          const size = image.getSize();
+          needsPresent = this.overlayNeedsPresent();
+          const captured = await browserWindow.webContents.capturePage();
+          this.timings.capture.record(performance.now() - captureStart);
+          let image = captured;
+          let size = image.getSize();
 
           if (size.width > 0 && size.height > 0) {
-            const buffer = image.toBitmap();
+            // getBitmap() returns the image's own pixels without copying; the
+            // native side is done with them before renderFrame returns.
+            // toBitmap() would allocate and fill a new ~14 MB Buffer at 1440p.
+            // Below scale 1 the frame is downsampled first and the native
+            // renderer stretches it back over the window on the GPU.
+            const bitmapStart = performance.now();
+            const scale = controller.captureScale;
+            if (scale < 1) {
+              image = captured.resize({
+                width: Math.max(1, Math.round(size.width * scale)),
+                height: Math.max(1, Math.round(size.height * scale)),
+                quality: "good",
+              });
+              size = image.getSize();
+            }
+            const buffer =
+              typeof image.getBitmap === "function" ? image.getBitmap() : image.toBitmap();
+            this.timings.bitmap.record(performance.now() - bitmapStart);
             frameCount++;
 
             if (frameCount <= 3) {
@@ -241,28 +378,65 @@ export class SteamOverlay {
               );
             }
 
-            // Send frame to overlay window
-            this.nativeModule.renderFrame(
+            // Send frame to overlay window. Returns false when the native side
+            // found it identical to the previous frame and skipped the upload.
+            const nativeStart = performance.now();
+            changed = this.nativeModule.renderFrame(
               this.overlayWindow,
               buffer,
               size.width,
               size.height,
-            );
+              needsPresent,
+            ) !== false;
+            this.timings.native.record(performance.now() - nativeStart);
+          }
+
+          const now = performance.now();
+          if (controller.wantsFeedback(now)) {
+            const stats = this.getOverlayStats();
+            if (stats) {
+              const previousScale = controller.captureScale;
+              controller.onRendererStats(stats, now);
+              if (controller.captureScale !== previousScale) {
+                SteamLogger.debug(
+                  `[Steam Overlay] Capture scale ${previousScale} -> ${controller.captureScale} ` +
+                  `(upload ${stats.lastUploadMs.toFixed(2)} ms)`,
+                );
+              }
+            }
           }
         } catch (error) {
           if (frameCount === 0) {
             SteamLogger.debug(`[Steam Overlay] Capture error: ${error}`);
           }
         }
+        captureInFlight = false;
+
+        // Schedule next capture; a hidden overlay stops the loop until it is shown again
+        if (captureActive && !capturePaused()) {
+          const scheduledAt = performance.now();
+          const delay = controller.nextDelay(changed, needsPresent, scheduledAt - captureStart, scheduledAt);
+          captureTimer = setTimeout(captureFrame, delay);
+        }
+      };
 
-        // Schedule next capture
-        if (captureActive) {
-          setTimeout(captureFrame, frameInterval);
+      const resumeCapture = () => {
+        if (!captureActive || options?.autoCapture === false || captureInFlight) {
+          return;
         }
+        if (captureTimer) {
+          clearTimeout(captureTimer);
+        }
+        controller.reset();
+        captureFrame();
       };
 
-      SteamLogger.debug(`[Steam Overlay] Starting frame capture at ${fps} FPS`);
-      captureFrame();
+      const pauseCapture = () => {
+        if (captureTimer) {
+          clearTimeout(captureTimer);
+          captureTimer = null;
+        }
+      };
 
       // Function to sync overlay window frame with Electron's CONTENT area
       // Overlay window is borderless, so it only covers the content, not title bar
@@ -285,16 +459,12 @@ export class SteamOverlay {
         }
       };
 
-      // Track overlay visibility to prevent duplicate show/hide calls.
-      // On Linux/Gamescope 'show'+'restore' fire together on restore, and
-      // 'hide'+'minimize' fire together on minimize — deduplication is critical.
-      let overlayVisible = false;
-
       const showOverlay = (reason: string) => {
         if (this.overlayWindow && this.nativeModule && !overlayVisible) {
           this.nativeModule.showOverlayWindow(this.overlayWindow);
           overlayVisible = true;
           SteamLogger.debug(`[Steam Overlay] Overlay window shown (${reason})`);
+          resumeCapture();
         }
       };
 
@@ -302,6 +472,7 @@ export class SteamOverlay {
         if (this.overlayWindow && this.nativeModule && overlayVisible) {
           this.nativeModule.hideOverlayWindow(this.overlayWindow);
           overlayVisible = false;
+          pauseCapture();
           SteamLogger.debug(`[Steam Overlay] Overlay window hidden (${reason})`);
         }
       };
@@ -383,6 +554,7 @@ export class SteamOverlay {
       const cleanup = () => {
         SteamLogger.debug("[Steam Overlay] Cleaning up capture loop...");
         captureActive = false;
+        pauseCapture();
       };
 
       // Handle window close - hide immediately then stop capture
@@ -401,6 +573,13 @@ export class SteamOverlay {
         );
       }
 
+      if (options?.autoCapture === false) {
+        SteamLogger.debug("[Steam Overlay] Automatic capture disabled - frames are pushed by the app");
+      } else {
+        SteamLogger.debug(`[Steam Overlay] Starting frame capture at ${fps} FPS`);
+        captureFrame();
+      }
+
       // On Linux: do NOT call moveTop() — the GLX window must stay above Electron.
       // On other platforms focus + raise ensures Electron is on top.
       if (process.platform !== "linux") {
@@ -436,6 +615,8 @@ export class SteamOverlay {
       try {
         this.nativeModule.destroyOverlayWindow(this.overlayWindow);
         this.overlayWindow = null;
+        this.frameBuffer = null;
+        this.timings = new SteamOverlayTimings();
         SteamLogger.debug("[Steam Overlay] Overlay window destroyed");
       } catch (error) {
         SteamLogger.error(
@@ -446,6 +627,182 @@ export class SteamOverlay {
     }
   }
 
+  /**
+   * Push a frame to the overlay window
+   *
+   * @param buffer - Full-size BGRA bitmap (`NativeImage.toBitmap()` / `getBitmap()`)
+   * @param width - Frame width in pixels
+   * @param height - Frame height in pixels
+   * @param dirtyRects - Optional changed regions; when given, only these are
+   * uploaded and the rest of the texture keeps its previous contents
+   * @returns False if the frame was identical to the previous one and was
+   * skipped, or if no overlay window exists
+   *
+   * @remarks
+   * Use with `autoCapture: false` to drive the overlay from Electron's offscreen
+   * `paint` event, which reports the dirty region of every frame.
+   */
+  renderFrame(
+    buffer: Buffer,
+    width: number,
+    height: number,
+    dirtyRects?: OverlayDirtyRect[],
+  ): boolean {
+    if (!this.overlayWindow || !this.nativeModule) {
+      return false;
+    }
+
+    try {
+      const nativeStart = performance.now();
+      const changed =
+        dirtyRects && this.nativeModule.renderFrameRegions
+          ? this.nativeModule.renderFrameRegions(this.overlayWindow, buffer, width, height, dirtyRects)
+          : this.nativeModule.renderFrame(
+              this.overlayWindow,
+              buffer,
+              width,
+              height,
+              this.overlayNeedsPresent(),
+            );
+      this.timings.native.record(performance.now() - nativeStart);
+      return changed !== false;
+    } catch (error) {
+      SteamLogger.error("[Steam Overlay] Error rendering frame:", error);
+      return false;
+    }
+  }
+
+  /**
+   * Push a frame that lives in a shared GPU texture to the overlay window
+   *
+   * @param textureInfo - `texture.textureInfo` from Electron's offscreen
+   * `paint` event with `useSharedTexture` enabled
+   * @returns False if the texture couldn't be imported (unsupported format,
+   * platform or driver) — fall back to `renderFrame()` with a bitmap then
+   *
+   * @remarks
+   * The native side copies the texture on the GPU (Windows: D3D11 +
+   * WGL_NV_DX_interop, macOS: IOSurface-backed Metal texture) before
+   * returning, so the caller can `release()` it right away. On Linux linear
+   * dmabufs are imported into the overlay's GLX context through
+   * `GL_EXT_memory_object_fd` (Mesa drivers only) and drawn before returning;
+   * tiled ones return false.
+   */
+  renderSharedTexture(textureInfo: OverlaySharedTextureInfo): boolean {
+    if (!this.overlayWindow || !this.nativeModule?.importSharedTexture) {
+      return false;
+    }
+    if (textureInfo.pixelFormat !== "bgra") {
+      return false;
+    }
+
+    const { width, height } = textureInfo.codedSize;
+    let descriptor: object | null = null;
+    if (process.platform === "linux") {
+      const pixmap = textureInfo.handle?.nativePixmap;
+      const plane = pixmap ? pixmap.planes[0] : textureInfo.planes?.[0];
+      if (plane) {
+        descriptor = {
+          fd: plane.fd,
+          stride: plane.stride,
+          offset: plane.offset,
+          modifier: pixmap ? pixmap.modifier : (textureInfo.modifier ?? "0"),
+        };
+      }
+    } else {
+      const handle =
+        textureInfo.handle?.ioSurface ?? textureInfo.handle?.ntHandle ?? textureInfo.sharedTextureHandle;
+      if (handle) {
+        descriptor = { handle };
+      }
+    }
+    if (!descriptor) {
+      return false;
+    }
+
+    try {
+      const nativeStart = performance.now();
+      const imported = this.nativeModule.importSharedTexture(this.overlayWindow, descriptor, width, height) === true;
+      this.timings.native.record(performance.now() - nativeStart);
+      return imported;
+    } catch (error) {
+      SteamLogger.error("[Steam Overlay] Error importing shared texture:", error);
+      return false;
+    }
+  }
+
+  /**
+   * Get a persistent frame buffer to write BGRA frames into
+   *
+   * @param width - Frame width in pixels
+   * @param height - Frame height in pixels
+   * @returns A `width * height * 4` byte view of a page-aligned buffer, or null
+   * if the native module doesn't provide one
+   *
+   * @remarks
+   * The memory is a shared memory mapping (memfd/shm on Linux and macOS, a
+   * file mapping on Windows) exposed as an external ArrayBuffer. Runtimes that
+   * forbid external buffers get a regular ArrayBuffer instead. Either way it is
+   * allocated once and reused while frames fit, so producers can fill it and
+   * pass it to `renderFrame()` without allocating a Buffer per frame.
+   */
+  getFrameBuffer(width: number, height: number): Buffer | null {
+    if (!this.nativeModule?.createSharedFrameBuffer || width <= 0 || height <= 0) {
+      return null;
+    }
+
+    const byteLength = width * height * 4;
+    if (!this.frameBuffer || this.frameBuffer.length < byteLength) {
+      try {
+        const { buffer, shared } = this.nativeModule.createSharedFrameBuffer(width, height);
+        this.frameBuffer = Buffer.from(buffer as ArrayBuffer);
+        SteamLogger.debug(
+          `[Steam Overlay] Allocated ${width}x${height} frame buffer (${shared ? "shared memory" : "ArrayBuffer"})`,
+        );
+      } catch (error) {
+        SteamLogger.error("[Steam Overlay] Error allocating frame buffer:", error);
+        return null;
+      }
+    }
+    return this.frameBuffer.subarray(0, byteLength);
+  }
+
+  /**
+   * Get frame upload statistics and per-stage timings from the overlay pipeline
+   *
+   * @returns Upload statistics, or null if no overlay window exists or the
+   * native backend doesn't report them
+   *
+   * @remarks
+   * Compare `averageUploadMs` with `pixelBuffers: true` and `pixelBuffers: false`
+   * to measure the asynchronous upload path against synchronous uploads.
+   * `stages` combines the JS stages (capture, bitmap, native call) with the
+   * native ones (submit, upload, draw, swap, frame).
+   */
+  getOverlayStats(): OverlayRenderStats | null {
+    if (!this.overlayWindow || !this.nativeModule?.getOverlayStats) {
+      return null;
+    }
+    const stats: OverlayRenderStats | null = this.nativeModule.getOverlayStats(this.overlayWindow);
+    if (!stats) {
+      return null;
+    }
+    stats.stages = {
+      ...stats.stages,
+      capture: this.timings.capture.summary(),
+      bitmap: this.timings.bitmap.summary(),
+      native: this.timings.native.summary(),
+    };
+    if (stats.presentTiming) {
+      // The native side reports times relative to the call
+      const now = performance.now();
+      const timing = stats.presentTiming;
+      timing.lastVblankAt = timing.presentedFrames > 0 ? now - timing.msSinceVblank : 0;
+      timing.nextVblankAt = timing.msUntilVblank > 0 ? now + timing.msUntilVblank : 0;
+    }
+    return stats;
+  }
+
   /**
    * Check if Steam overlay is available on this system
    *
@@ -0,0 +1,253 @@
+import { ElectronOverlayOptions, OverlayRenderStats } from "../types";
+
+/** Identical frames in a row before the capture loop starts backing off */
+const IDLE_FRAME_THRESHOLD = 10;
+/** Slowest capture interval while the page is static, in milliseconds (minFps default) */
+const IDLE_MAX_FRAME_INTERVAL_MS = 200;
+/** How often the native renderer's stats are fed back, in milliseconds */
+const FEEDBACK_INTERVAL_MS = 250;
+/** Interval growth when the renderer dropped frames since the last feedback */
+const BACKPRESSURE_STEP = 1.25;
+/** Floor decay per feedback once frames stop being dropped */
+const BACKPRESSURE_RELEASE = 0.9;
+/** Reduced capture scale used by autoCaptureScale when captureScale isn't given */
+const DEFAULT_REDUCED_SCALE = 0.5;
+/** Smallest capture scale accepted */
+const MIN_CAPTURE_SCALE = 0.25;
+/** Feedbacks in a row with uploads over the frame budget before capture scales down */
+const SCALE_DOWN_FEEDBACKS = 2;
+/** Feedbacks in a row with full-size uploads projected under half the budget before scaling back up */
+const SCALE_UP_FEEDBACKS = 8;
+/** How far ahead of the vblank an aligned frame should reach the renderer, in milliseconds */
+const VBLANK_MARGIN_MS = 1;
+/** Weight of the newest sample in the moving average of the capture latency */
+const LATENCY_SMOOTHING = 0.2;
+
+/**
+ * SteamOverlayCaptureController
+ *
+ * Picks the delay before the next `capturePage()`:
+ * - Changed frames step the rate up towards `maxFps`, halving the interval
+ *   each time, so animations quickly reach full rate.
+ * - Once the page has been static for a while the interval doubles every
+ *   IDLE_FRAME_THRESHOLD identical frames, down to `minFps`.
+ * - Native feedback sets a floor: the interval never drops below the time the
+ *   renderer needs to present a frame, and grows while the render thread (or
+ *   on macOS the next draw) keeps dropping frames it couldn't present.
+ *
+ * The delay is measured from the start of the previous capture, so the time
+ * capturePage and the upload took counts against the interval.
+ *
+ * With present timing from the renderer, the delay is then nudged so the
+ * frame reaches the renderer just before a vblank (`alignToVblank`). Each
+ * capture snaps to the nearest vblank, so captures settle on a whole number
+ * of refreshes instead of beating against the display's rate.
+ *
+ * It also picks the scale frames are captured at. A fixed `captureScale` below
+ * 1 always applies; with `autoCaptureScale` capture starts at full resolution
+ * and drops to the reduced scale while uploads take longer than the frame
+ * budget, returning once full-size uploads would comfortably fit again.
+ */
+export class SteamOverlayCaptureController {
+  private readonly adaptive: boolean;
+  private readonly baseInterval: number;
+  private readonly minInterval: number;
+  private readonly idleMaxInterval: number;
+
+  private interval: number;
+  private unchangedFrames = 0;
+  private pressureFloor = 0;
+  private lastDroppedFrames: number | null = null;
+  private lastFeedbackAt = 0;
+
+  private readonly alignToVblank: boolean;
+  private vblankAt = 0;
+  private refreshMs = 0;
+  private rendererMs = 0;
+  private captureLatencyMs: number | null = null;
+
+  private readonly autoScale: boolean;
+  private readonly reducedScale: number;
+  private scale: number;
+  private lastUploadedFrames: number | null = null;
+  private lastUploadTotalMs = 0;
+  private overBudgetFeedbacks = 0;
+  private underBudgetFeedbacks = 0;
+
+  constructor(options?: ElectronOverlayOptions) {
+    const fps = options?.fps || 60;
+    this.adaptive = options?.adaptiveCapture !== false;
+    this.baseInterval = Math.floor(1000 / fps);
+
+    const maxFps = this.adaptive ? Math.max(fps, options?.maxFps ?? fps) : fps;
+    this.minInterval = Math.floor(1000 / maxFps);
+
+    const minFps = options?.minFps ?? 1000 / IDLE_MAX_FRAME_INTERVAL_MS;
+    this.idleMaxInterval = Math.max(this.baseInterval, Math.floor(1000 / Math.max(minFps, 0.1)));
+
+    this.interval = this.baseInterval;
+    this.alignToVblank = this.adaptive && options?.alignToVblank !== false;
+
+    const captureScale = Math.min(1, Math.max(MIN_CAPTURE_SCALE, options?.captureScale ?? 1));
+    this.autoScale = this.adaptive && options?.autoCaptureScale === true;
+    this.reducedScale = captureScale < 1 ? captureScale : DEFAULT_REDUCED_SCALE;
+    this.scale = this.autoScale ? 1 : captureScale;
+  }
+
+  /** Scale to capture the next frame at (1 = device resolution) */
+  get captureScale(): number {
+    return this.scale;
+  }
+
+  /**
+   * Start over at the configured rate, e.g. when capture resumes after the
+   * overlay was hidden: whatever was on screen before is stale by now
+   */
+  reset(): void {
+    this.interval = this.baseInterval;
+    this.unchangedFrames = 0;
+    this.pressureFloor = 0;
+    this.lastDroppedFrames = null;
+    this.lastFeedbackAt = 0;
+    this.lastUploadedFrames = null;
+  }
+
+  /**
+   * Delay before the next capture
+   *
+   * @param changed - Whether the native side uploaded the frame (false: identical, skipped)
+   * @param needsPresent - Whether the Steam overlay is drawing and needs presents
+   * @param elapsedMs - Time since the finished capture started
+   * @param now - Current time on the `performance.now()` timeline
+   */
+  nextDelay(changed: boolean, needsPresent: boolean, elapsedMs: number, now: number): number {
+    if (changed) {
+      this.unchangedFrames = 0;
+      if (this.adaptive) {
+        this.interval = Math.max(this.minInterval, this.interval / 2);
+      }
+    } else {
+      this.unchangedFrames++;
+      if (this.unchangedFrames === IDLE_FRAME_THRESHOLD) {
+        this.interval = this.baseInterval;
+      }
+    }
+
+    let target: number;
+    if (needsPresent || this.unchangedFrames < IDLE_FRAME_THRESHOLD) {
+      target = needsPresent ? Math.min(this.interval, this.baseInterval) : this.interval;
+    } else {
+      // Static page: back off
+      const doublings = Math.floor(this.unchangedFrames / IDLE_FRAME_THRESHOLD);
+      target = Math.min(this.baseInterval * Math.pow(2, doublings), this.idleMaxInterval);
+    }
+
+    if (!this.adaptive) {
+      return target;
+    }
+    target = Math.max(target, this.pressureFloor);
+    const delay = Math.max(0, target - elapsedMs);
+    return this.alignToVblank ? this.alignDelay(delay, elapsedMs, now) : delay;
+  }
+
+  /**
+   * Shift a capture delay so the frame arrives just before the nearest vblank
+   *
+   * The frame reaches the screen one capture latency after the capture starts:
+   * capturePage and the native submit (the elapsed time of the capture that
+   * just finished, smoothed), plus the upload and draw on the render thread.
+   */
+  private alignDelay(delay: number, elapsedMs: number, now: number): number {
+    this.captureLatencyMs = this.captureLatencyMs === null
+      ? elapsedMs
+      : this.captureLatencyMs + (elapsedMs - this.captureLatencyMs) * LATENCY_SMOOTHING;
+    if (this.refreshMs <= 0) {
+      return delay;
+    }
+
+    const refresh = this.refreshMs;
+    const arrival = now + delay + this.captureLatencyMs + this.rendererMs + VBLANK_MARGIN_MS;
+    const pastVblank = (((arrival - this.vblankAt) % refresh) + refresh) % refresh;
+    const shift = pastVblank < refresh / 2 ? -pastVblank : refresh - pastVblank;
+    return Math.max(0, delay + shift);
+  }
+
+  /**
+   * Whether it is time to feed the renderer's stats back
+   */
+  wantsFeedback(now: number): boolean {
+    return this.adaptive && now - this.lastFeedbackAt >= FEEDBACK_INTERVAL_MS;
+  }
+
+  /**
+   * Take the native renderer's view of the last few frames into account
+   */
+  onRendererStats(stats: OverlayRenderStats, now: number): void {
+    this.lastFeedbackAt = now;
+
+    // Typical time to get one frame onto the screen. Capturing faster than
+    // this only replaces frames in the mailbox before they are presented.
+    const frameMs = stats.stages?.frame?.p50 ?? stats.averageUploadMs;
+    let floor: number;
+
+    if (this.lastDroppedFrames !== null && stats.droppedFrames > this.lastDroppedFrames) {
+      floor = Math.max(frameMs, Math.max(this.pressureFloor, this.interval) * BACKPRESSURE_STEP);
+    } else {
+      floor = Math.max(frameMs, this.pressureFloor * BACKPRESSURE_RELEASE);
+    }
+    this.lastDroppedFrames = stats.droppedFrames;
+
+    this.pressureFloor = Math.min(floor, this.idleMaxInterval);
+
+    // Vblank grid to align to. Swap-based estimates follow whatever the present
+    // rate is without vsync, so only platform vblank clocks are used.
+    const timing = stats.presentTiming;
+    if (timing && timing.source !== "swap" && timing.source !== "none" && timing.nextVblankAt > 0) {
+      this.vblankAt = timing.nextVblankAt;
+      this.refreshMs = timing.refreshIntervalMs;
+      this.rendererMs = stats.renderThread
+        ? (stats.stages?.upload?.p50 ?? 0) + (stats.stages?.draw?.p50 ?? 0)
+        : 0;
+    } else {
+      this.refreshMs = 0;
+    }
+
+    if (this.autoScale) {
+      this.updateScale(stats);
+    }
+  }
+
+  /**
+   * Switch between full and reduced capture scale on the average upload time
+   * since the previous feedback
+   */
+  private updateScale(stats: OverlayRenderStats): void {
+    const totalMs = stats.averageUploadMs * stats.uploadedFrames;
+    const previousFrames = this.lastUploadedFrames;
+    const previousTotalMs = this.lastUploadTotalMs;
+    this.lastUploadedFrames = stats.uploadedFrames;
+    this.lastUploadTotalMs = totalMs;
+    if (previousFrames === null || stats.uploadedFrames <= previousFrames) return;
+
+    const uploadMs = (totalMs - previousTotalMs) / (stats.uploadedFrames - previousFrames);
+    // Upload time scales with the pixel count
+    const fullSizeMs = uploadMs / (this.scale * this.scale);
+
+    if (this.scale === 1 && uploadMs > this.baseInterval) {
+      this.underBudgetFeedbacks = 0;
+      if (++this.overBudgetFeedbacks >= SCALE_DOWN_FEEDBACKS) {
+        this.scale = this.reducedScale;
+        this.overBudgetFeedbacks = 0;
+      }
+    } else if (this.scale < 1 && fullSizeMs < this.baseInterval / 2) {
+      this.overBudgetFeedbacks = 0;
+      if (++this.underBudgetFeedbacks >= SCALE_UP_FEEDBACKS) {
+        this.scale = 1;
+        this.underBudgetFeedbacks = 0;
+      }
+    } else {
+      this.overBudgetFeedbacks = 0;
+      this.underBudgetFeedbacks = 0;
+    }
+  }
+}
@@ -0,0 +1,57 @@
+import { OverlayStageTiming } from "../types";
+
+/** Recent samples kept per stage — same window as native/frame-timing.h */
+const SAMPLE_COUNT = 512;
+
+/**
+ * Timing histogram for one JS-side overlay stage
+ *
+ * Mirrors the native StageHistogram: a ring of the most recent samples for
+ * percentiles, plus running totals over every sample.
+ */
+export class OverlayStageHistogram {
+  private samples = new Float64Array(SAMPLE_COUNT);
+  private next = 0;
+  private filled = 0;
+  private count = 0;
+  private last = 0;
+  private total = 0;
+
+  record(ms: number): void {
+    this.samples[this.next] = ms;
+    this.next = (this.next + 1) % SAMPLE_COUNT;
+    if (this.filled < SAMPLE_COUNT) this.filled++;
+    this.count++;
+    this.last = ms;
+    this.total += ms;
+  }
+
+  summary(): OverlayStageTiming {
+    if (this.filled === 0) {
+      return { count: 0, last: 0, average: 0, p50: 0, p95: 0, p99: 0 };
+    }
+    const sorted = this.samples.slice(0, this.filled).sort();
+    const at = (q: number) => sorted[Math.round(q * (this.filled - 1))];
+    return {
+      count: this.count,
+      last: this.last,
+      average: this.total / this.count,
+      p50: at(0.5),
+      p95: at(0.95),
+      p99: at(0.99),
+    };
+  }
+}
+
+/**
+ * Stages of the overlay pipeline that run in JS, before the frame reaches the
+ * native renderer
+ */
+export class SteamOverlayTimings {
+  /** `webContents.capturePage()`, from the call until the image resolves */
+  readonly capture = new OverlayStageHistogram();
+  /** `NativeImage.getBitmap()` / `toBitmap()` */
+  readonly bitmap = new OverlayStageHistogram();
+  /** The native renderFrame / renderFrameRegions / importSharedTexture call, N-API crossing included */
+  readonly native = new OverlayStageHistogram();
+}
@@ -0,0 +1,104 @@
+import * as koffi from 'koffi';
+
+/** Bytes per scalar slot: fits every scalar out-param (bool up to int64, double and pointers) */
+const SLOT_SIZE = 8;
+/** Scalar slots; converted calls take at most two at once (GetAchievementAndUnlockTime, GetDLCDataByIndex) */
+const SLOT_COUNT = 4;
+/** Pointer array length allocated up front; grows by doubling */
+const INITIAL_POINTER_COUNT = 64;
+
+const POINTER_SIZE = koffi.sizeof('void*');
+const MIN_SAFE = BigInt(Number.MIN_SAFE_INTEGER);
+const MAX_SAFE = BigInt(Number.MAX_SAFE_INTEGER);
+
+/**
+ * SteamScratch
+ *
+ * Shared out-parameter memory for koffi calls. Getters that are polled every
+ * frame (stats, achievements, ping estimates, message receives) used to
+ * `koffi.alloc()` fresh out-params on every call; they borrow preallocated
+ * memory from here instead, so a steady polling loop creates no garbage.
+ *
+ * - {@link slot} — 8-byte scalar out-params, read with the Buffer accessors
+ *   (`readInt32LE(0)`, `readFloatLE(0)`, ...) or {@link bool} / {@link int64}
+ * - {@link bytes} — fixed-size string and struct out-params, one per size
+ * - {@link pointers} — pointer arrays such as the message list of ReceiveMessages
+ *
+ * koffi passes a Buffer to a pointer parameter as the address of its memory,
+ * so these stand in for `koffi.alloc()` anywhere. JavaScript makes one native
+ * call at a time: memory borrowed here is free again once the caller has read
+ * it. Read it right after the call returns, never keep it across an await,
+ * and never hand it out to the caller.
+ */
+export class SteamScratch {
+  private static readonly memory = Buffer.alloc(SLOT_SIZE * SLOT_COUNT);
+  private static readonly slots: Buffer[] = Array.from({ length: SLOT_COUNT }, (_, i) =>
+    SteamScratch.memory.subarray(i * SLOT_SIZE, (i + 1) * SLOT_SIZE)
+  );
+  private static readonly sized = new Map<number, Buffer>();
+  private static pointerArray = Buffer.alloc(INITIAL_POINTER_COUNT * POINTER_SIZE);
+
+  /**
+   * Scalar out-param slot `index` (0-3), zeroed
+   *
+   * Calls with several out-params take one slot each.
+   */
+  static slot(index: number = 0): Buffer {
+    const slot = SteamScratch.slots[index];
+    slot.fill(0);
+    return slot;
+  }
+
+  /**
+   * Zeroed buffer of exactly `size` bytes, shared by every caller asking for
+   * that size. Meant for the fixed sizes of string and struct out-params.
+   */
+  static bytes(size: number): Buffer {
+    let buffer = SteamScratch.sized.get(size);
+    if (!buffer) {
+      buffer = Buffer.alloc(size);
+      SteamScratch.sized.set(size, buffer);
+      return buffer;
+    }
+    buffer.fill(0);
+    return buffer;
+  }
+
+  /**
+   * Room for at least `count` pointers; may be longer, so pass the count to
+   * the native call. Read entries with {@link pointerAt}.
+   */
+  static pointers(count: number): Buffer {
+    if (SteamScratch.pointerArray.length < count * POINTER_SIZE) {
+      let grown = SteamScratch.pointerArray.length / POINTER_SIZE;
+      while (grown < count) grown *= 2;
+      SteamScratch.pointerArray = Buffer.alloc(grown * POINTER_SIZE);
+    }
+    return SteamScratch.pointerArray;
+  }
+
+  /**
+   * Entry `index` of a pointer array filled by a native call, as a koffi
+   * pointer (null for NULL)
+   */
+  static pointerAt(array: Buffer, index: number): any {
+    return koffi.decode(array, index * POINTER_SIZE, 'void*');
+  }
+
+  /** C++ bool out-param */
+  static bool(slot: Buffer): boolean {
+    return slot.readUInt8(0) !== 0;
+  }
+
+  /** int64 out-param the way koffi decodes one: a number when it fits, a bigint beyond 2^53 */
+  static int64(slot: Buffer): number | bigint {
+    const value = slot.readBigInt64LE(0);
+    return value >= MIN_SAFE && value <= MAX_SAFE ? Number(value) : value;
+  }
+
+  /** uint64 out-param the way koffi decodes one: a number when it fits, a bigint beyond 2^53 */
+  static uint64(slot: Buffer): number | bigint {
+    const value = slot.readBigUInt64LE(0);
+    return value <= MAX_SAFE ? Number(value) : value;
+  }
+}
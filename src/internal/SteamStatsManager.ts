@@ -2,6 +2,9 @@ import * as koffi from 'koffi';
 import { SteamLibraryLoader } from './SteamLibraryLoader';
 import { SteamAPICore } from './SteamAPICore';
 import { SteamCallbackPoller } from './SteamCallbackPoller';
+import { SteamScratch } from './SteamScratch';
+import { SteamStatsStore } from './SteamStatsStore';
+import { SteamNativeModule, loadSteamNativeAddon } from './SteamNativeAddon';
 import { SteamStat, GlobalStat, GlobalStatHistory, UserStat, NumberOfCurrentPlayersType } from '../types';
 import { SteamLogger } from './SteamLogger';
 
@@ -17,6 +20,20 @@ const NumberOfCurrentPlayers_t = koffi.struct('NumberOfCurrentPlayers_t', {
 // Callback ID (k_iSteamUserStatsCallbacks = 1100)
 const k_iCallback_NumberOfCurrentPlayers = 1107;
 
+/** Largest finite float32 */
+const FLOAT32_MAX = 3.4028234663852886e38;
+
+/**
+ * Whether a value converts to the stat type without leaving its range;
+ * matches the check in native/steam-native.cpp setStats
+ */
+function statValueFits(value: number, type: 'int' | 'float'): boolean {
+  if (!Number.isFinite(value)) return false;
+  if (type === 'float') return Math.abs(value) <= FLOAT32_MAX;
+  const whole = Math.trunc(value);
+  return whole >= -2147483648 && whole <= 2147483647;
+}
+
 /**
  * SteamStatsManager
  * 
@@ -53,16 +70,32 @@ export class SteamStatsManager {
   /** Callback poller for retrieving async operation results */
   private callbackPoller: SteamCallbackPoller;
 
+  /** StoreStats write-behind, shared with the achievement manager */
+  private statsStore: SteamStatsStore;
+
+  /** Native addon for batched get/set; undefined until first looked up */
+  private nativeAddon: SteamNativeModule | null | undefined = undefined;
+
+  /** Reused value and per-stat result arrays for the native batch calls */
+  private batchValues = new Float64Array(0);
+  private batchFlags = new Uint8Array(0);
+
   /**
    * Creates a new SteamStatsManager instance
    * 
    * @param libraryLoader - The Steam library loader for FFI calls
    * @param apiCore - The Steam API core for lifecycle management
+   * @param statsStore - StoreStats write-behind shared with the achievement manager
    */
-  constructor(libraryLoader: SteamLibraryLoader, apiCore: SteamAPICore) {
+  constructor(
+    libraryLoader: SteamLibraryLoader,
+    apiCore: SteamAPICore,
+    statsStore: SteamStatsStore = new SteamStatsStore(libraryLoader, apiCore)
+  ) {
     this.libraryLoader = libraryLoader;
     this.apiCore = apiCore;
     this.callbackPoller = new SteamCallbackPoller(libraryLoader, apiCore);
+    this.statsStore = statsStore;
   }
 
   // ========================================
@@ -104,7 +137,7 @@ export class SteamStatsManager {
 
     try {
       const userStatsInterface = this.libraryLoader.SteamAPI_SteamUserStats_v013();
-      const valueOut = koffi.alloc('int32', 1);
+      const valueOut = SteamScratch.slot();
       
       const success = this.libraryLoader.SteamAPI_ISteamUserStats_GetStatInt32(
         userStatsInterface,
@@ -113,7 +146,7 @@ export class SteamStatsManager {
       );
 
       if (success) {
-        const value = koffi.decode(valueOut, 'int32');
+        const value = valueOut.readInt32LE(0);
         console.log(`[Steamworks] Got stat "${statName}": ${value}`);
         return {
           name: statName,
@@ -163,7 +196,7 @@ export class SteamStatsManager {
 
     try {
       const userStatsInterface = this.libraryLoader.SteamAPI_SteamUserStats_v013();
-      const valueOut = koffi.alloc('float', 1);
+      const valueOut = SteamScratch.slot();
       
       const success = this.libraryLoader.SteamAPI_ISteamUserStats_GetStatFloat(
         userStatsInterface,
@@ -172,7 +205,7 @@ export class SteamStatsManager {
       );
 
       if (success) {
-        const value = koffi.decode(valueOut, 'float');
+        const value = valueOut.readFloatLE(0);
         console.log(`[Steamworks] Got stat "${statName}": ${value}`);
         return {
           name: statName,
@@ -192,7 +225,7 @@ export class SteamStatsManager {
   /**
    * Set an integer stat value for the current user
    * 
-   * Updates a 32-bit integer stat value and immediately stores it to Steam servers.
+   * Updates a 32-bit integer stat value and stores it to Steam servers.
    * The new value will be visible in your Steam profile and can trigger achievements.
    * 
    * @param statName - Name of the stat to set (as defined in Steamworks Partner site)
@@ -210,8 +243,8 @@ export class SteamStatsManager {
    * ```
    * 
    * @remarks
-   * - Automatically calls StoreStats() to save to Steam servers
-   * - Runs callbacks to process the store operation
+   * - Stored to Steam servers right away, or on the next store interval
+   *   when {@link setStoreInterval} is set
    * - Can trigger stat-based achievements
    * - Use setStatFloat() for decimal values
    * 
@@ -236,12 +269,9 @@ export class SteamStatsManager {
       );
 
       if (success) {
-        // Store the stats to Steam servers
-        const stored = this.libraryLoader.SteamAPI_ISteamUserStats_StoreStats(userStatsInterface);
-        if (stored) {
+        // Store to Steam servers, now or on the store interval
+        if (this.statsStore.commit([statName])) {
           console.log(`[Steamworks] Set stat "${statName}" to ${value}`);
-          // Process callbacks
-          this.libraryLoader.SteamAPI_RunCallbacks();
           return true;
         } else {
           SteamLogger.warn(`[Steamworks] Failed to store stat: ${statName}`);
@@ -260,7 +290,7 @@ export class SteamStatsManager {
   /**
    * Set a float stat value for the current user
    * 
-   * Updates a floating-point stat value and immediately stores it to Steam servers.
+   * Updates a floating-point stat value and stores it to Steam servers.
    * Use this for stats requiring decimal precision.
    * 
    * @param statName - Name of the stat to set (as defined in Steamworks Partner site)
@@ -277,8 +307,8 @@ export class SteamStatsManager {
    * ```
    * 
    * @remarks
-   * - Automatically calls StoreStats() to save to Steam servers
-   * - Runs callbacks to process the store operation
+   * - Stored to Steam servers right away, or on the next store interval
+   *   when {@link setStoreInterval} is set
    * - Use setStatInt() for whole number values
    * 
    * Steamworks SDK Functions:
@@ -302,12 +332,9 @@ export class SteamStatsManager {
       );
 
       if (success) {
-        // Store the stats to Steam servers
-        const stored = this.libraryLoader.SteamAPI_ISteamUserStats_StoreStats(userStatsInterface);
-        if (stored) {
+        // Store to Steam servers, now or on the store interval
+        if (this.statsStore.commit([statName])) {
           console.log(`[Steamworks] Set stat "${statName}" to ${value}`);
-          // Process callbacks
-          this.libraryLoader.SteamAPI_RunCallbacks();
           return true;
         } else {
           SteamLogger.warn(`[Steamworks] Failed to store stat: ${statName}`);
@@ -344,7 +371,8 @@ export class SteamStatsManager {
    * ```
    * 
    * @remarks
-   * - Automatically calls StoreStats() to save to Steam servers
+   * - Stored to Steam servers right away, or on the next store interval
+   *   when {@link setStoreInterval} is set
    * - Steam maintains the running average across all sessions
    * - sessionLength should be in seconds
    * - Used for "per hour" or "per game" statistics
@@ -371,12 +399,9 @@ export class SteamStatsManager {
       );
 
       if (success) {
-        // Store the stats to Steam servers
-        const stored = this.libraryLoader.SteamAPI_ISteamUserStats_StoreStats(userStatsInterface);
-        if (stored) {
+        // Store to Steam servers, now or on the store interval
+        if (this.statsStore.commit([statName])) {
           console.log(`[Steamworks] Updated avg rate stat "${statName}": ${countThisSession} over ${sessionLength}s`);
-          // Process callbacks
-          this.libraryLoader.SteamAPI_RunCallbacks();
           return true;
         } else {
           SteamLogger.warn(`[Steamworks] Failed to store stat: ${statName}`);
@@ -392,6 +417,258 @@ export class SteamStatsManager {
     }
   }
 
+  // ========================================
+  // Batched Stats and Store Coalescing
+  // ========================================
+
+  /**
+   * Get several stats of one type in a single pass
+   * 
+   * Reads the whole list in one native call when the native addon is
+   * available (one koffi call per stat through a shared out-param otherwise),
+   * without the per-stat logging of getStatInt()/getStatFloat().
+   * 
+   * @param statNames - Names of the stats to retrieve
+   * @param type - Stat type: 'int' (int32) or 'float'
+   * @returns SteamStat objects in request order; stats that could not be read are left out
+   * 
+   * @example
+   * ```typescript
+   * const stats = await statsManager.getStats(['total_kills', 'total_deaths', 'games_played']);
+   * const byName = Object.fromEntries(stats.map(s => [s.name, s.value]));
+   * ```
+   * 
+   * @remarks
+   * - Returns an empty array if Steam API is not initialized
+   * - Missing names are reported in a single warning
+   * 
+   * Steamworks SDK Functions:
+   * - `SteamAPI_ISteamUserStats_GetStatInt32()` - Get int32 stat value
+   * - `SteamAPI_ISteamUserStats_GetStatFloat()` - Get float stat value
+   */
+  async getStats(statNames: string[], type: 'int' | 'float' = 'int'): Promise<SteamStat[]> {
+    if (!this.apiCore.isInitialized()) {
+      SteamLogger.warn('[Steamworks] Steam API not initialized');
+      return [];
+    }
+
+    try {
+      const stats: SteamStat[] = [];
+      const missing: string[] = [];
+
+      if (this.runNativeBatch('getStats', statNames, type)) {
+        statNames.forEach((name, i) => {
+          if (this.batchFlags[i]) {
+            stats.push({ name, value: this.batchValues[i], type });
+          } else {
+            missing.push(name);
+          }
+        });
+      } else {
+        const userStatsInterface = this.libraryLoader.SteamAPI_SteamUserStats_v013();
+        const getStat = type === 'float'
+          ? this.libraryLoader.SteamAPI_ISteamUserStats_GetStatFloat
+          : this.libraryLoader.SteamAPI_ISteamUserStats_GetStatInt32;
+
+        for (const name of statNames) {
+          const valueOut = SteamScratch.slot();
+          if (getStat(userStatsInterface, name, valueOut)) {
+            const value = type === 'float' ? valueOut.readFloatLE(0) : valueOut.readInt32LE(0);
+            stats.push({ name, value, type });
+          } else {
+            missing.push(name);
+          }
+        }
+      }
+
+      if (missing.length > 0) {
+        SteamLogger.warn(`[Steamworks] Failed to get stats: ${missing.join(', ')}`);
+      }
+      return stats;
+    } catch (error: any) {
+      SteamLogger.error('[Steamworks] Error getting stats:', error.message);
+      return [];
+    }
+  }
+
+  /**
+   * Set several stats of one type and store them together
+   * 
+   * Sets every stat (in one native call when the native addon is available),
+   * then commits them with a single StoreStats() call (or
+   * one write-behind store when {@link setStoreInterval} is set), instead of
+   * one store per stat as with repeated setStatInt()/setStatFloat() calls.
+   * 
+   * @param values - Stat name to new value
+   * @param type - Stat type: 'int' (int32) or 'float'
+   * @returns true if every stat was set and stored (or queued), false otherwise
+   * 
+   * @example
+   * ```typescript
+   * // End of match: one upload for all session stats
+   * await statsManager.setStats({
+   *   games_played: gamesPlayed + 1,
+   *   total_kills: totalKills + sessionKills
+   * });
+   * await statsManager.setStats({ total_distance: distance }, 'float');
+   * ```
+   * 
+   * @remarks
+   * - Stats that were set are stored even if others failed
+   * - Int values are truncated toward zero; NaN, infinities and values outside
+   *   int32 (or float) range are rejected and reported as failed
+   * 
+   * Steamworks SDK Functions:
+   * - `SteamAPI_ISteamUserStats_SetStatInt32()` - Set int32 stat value
+   * - `SteamAPI_ISteamUserStats_SetStatFloat()` - Set float stat value
+   * - `SteamAPI_ISteamUserStats_StoreStats()` - Store stats to Steam servers
+   */
+  async setStats(values: Record<string, number>, type: 'int' | 'float' = 'int'): Promise<boolean> {
+    if (!this.apiCore.isInitialized()) {
+      SteamLogger.warn('[Steamworks] Steam API not initialized');
+      return false;
+    }
+
+    try {
+      const names = Object.keys(values);
+      const changed: string[] = [];
+      const failed: string[] = [];
+
+      if (this.runNativeBatch('setStats', names, type, values)) {
+        names.forEach((name, i) => (this.batchFlags[i] ? changed : failed).push(name));
+      } else {
+        const userStatsInterface = this.libraryLoader.SteamAPI_SteamUserStats_v013();
+        const setStat = type === 'float'
+          ? this.libraryLoader.SteamAPI_ISteamUserStats_SetStatFloat
+          : this.libraryLoader.SteamAPI_ISteamUserStats_SetStatInt32;
+
+        for (const name of names) {
+          const value = values[name];
+          const ok = statValueFits(value, type)
+            && setStat(userStatsInterface, name, type === 'float' ? value : Math.trunc(value));
+          (ok ? changed : failed).push(name);
+        }
+      }
+
+      if (failed.length > 0) {
+        SteamLogger.warn(`[Steamworks] Failed to set stats: ${failed.join(', ')}`);
+      }
+      if (changed.length === 0) {
+        return false;
+      }
+
+      if (!this.statsStore.commit(changed)) {
+        SteamLogger.warn(`[Steamworks] Failed to store stats: ${changed.join(', ')}`);
+        return false;
+      }
+      SteamLogger.debug(`[Steamworks] Set ${changed.length} stat(s)`);
+      return failed.length === 0;
+    } catch (error: any) {
+      SteamLogger.error('[Steamworks] Error setting stats:', error.message);
+      return false;
+    }
+  }
+
+  /**
+   * Coalesce StoreStats() calls onto an interval
+   * 
+   * With an interval set, setStatInt(), setStatFloat(), updateAvgRateStat()
+   * and setStats() only mark stats dirty; everything changed within one
+   * interval is uploaded by a single StoreStats() call. Steam throttles
+   * frequent stores, so games updating stats during gameplay should set one.
+   * 
+   * @param intervalMs - Minimum time between stores in milliseconds; 0 (the default) stores every change immediately
+   * 
+   * @example
+   * ```typescript
+   * // Upload at most every 30 seconds during gameplay
+   * statsManager.setStoreInterval(30000);
+   * 
+   * // ... many setStatInt() calls ...
+   * 
+   * // Match over: upload now
+   * statsManager.flushStats();
+   * ```
+   * 
+   * @remarks
+   * - Setting 0 flushes anything still pending
+   * - Achievement unlocks and shutdown() always store immediately, taking pending stats with them
+   */
+  setStoreInterval(intervalMs: number): void {
+    this.statsStore.setInterval(intervalMs);
+  }
+
+  /**
+   * Get the StoreStats() coalescing interval in milliseconds (0 = store every change)
+   */
+  getStoreInterval(): number {
+    return this.statsStore.getInterval();
+  }
+
+  /**
+   * Store pending stat changes now, without waiting for the store interval
+   * 
+   * @returns true if StoreStats() succeeded
+   * 
+   * Steamworks SDK Functions:
+   * - `SteamAPI_ISteamUserStats_StoreStats()` - Store stats to Steam servers
+   */
+  flushStats(): boolean {
+    return this.statsStore.flush();
+  }
+
+  /**
+   * Names of stats changed since the last successful store
+   */
+  getPendingStats(): string[] {
+    return this.statsStore.pending();
+  }
+
+  /**
+   * Run getStats/setStats through the native addon, leaving the values in
+   * batchValues and per-stat results in batchFlags
+   * 
+   * @returns false when the addon is unavailable, so the caller uses koffi
+   * @private
+   */
+  private runNativeBatch(
+    call: 'getStats' | 'setStats',
+    names: string[],
+    type: 'int' | 'float',
+    values?: Record<string, number>
+  ): boolean {
+    const addon = this.getNativeAddon();
+    if (!addon) return false;
+
+    if (this.batchValues.length < names.length) {
+      this.batchValues = new Float64Array(names.length);
+      this.batchFlags = new Uint8Array(names.length);
+    }
+    if (values) {
+      names.forEach((name, i) => { this.batchValues[i] = values[name]; });
+    }
+
+    try {
+      addon[call](names, type === 'float', this.batchValues, this.batchFlags);
+      return true;
+    } catch (error) {
+      SteamLogger.debug('[Steamworks] Native stats batch unavailable, using koffi:', error);
+      this.nativeAddon = null;
+      return false;
+    }
+  }
+
+  /**
+   * Get the native addon, loading it on first use
+   * @private
+   */
+  private getNativeAddon(): SteamNativeModule | null {
+    if (this.nativeAddon === undefined) {
+      this.nativeAddon = loadSteamNativeAddon(this.libraryLoader.getLibraryPath());
+    }
+    return this.nativeAddon;
+  }
+
   // ========================================
   // Friend/User Stats Operations
   // ========================================
@@ -502,7 +779,7 @@ export class SteamStatsManager {
     try {
       const userStatsInterface = this.libraryLoader.SteamAPI_SteamUserStats_v013();
       const steamIdBigInt = typeof steamId === 'string' ? BigInt(steamId) : steamId;
-      const valueOut = koffi.alloc('int32', 1);
+      const valueOut = SteamScratch.slot();
       
       const success = this.libraryLoader.SteamAPI_ISteamUserStats_GetUserStatInt32(
         userStatsInterface,
@@ -512,7 +789,7 @@ export class SteamStatsManager {
       );
 
       if (success) {
-        const value = koffi.decode(valueOut, 'int32');
+        const value = valueOut.readInt32LE(0);
         console.log(`[Steamworks] Got user stat "${statName}" for ${steamId}: ${value}`);
         return {
           steamId: typeof steamId === 'string' ? steamId : steamId.toString(),
@@ -571,7 +848,7 @@ export class SteamStatsManager {
     try {
       const userStatsInterface = this.libraryLoader.SteamAPI_SteamUserStats_v013();
       const steamIdBigInt = typeof steamId === 'string' ? BigInt(steamId) : steamId;
-      const valueOut = koffi.alloc('float', 1);
+      const valueOut = SteamScratch.slot();
       
       const success = this.libraryLoader.SteamAPI_ISteamUserStats_GetUserStatFloat(
         userStatsInterface,
@@ -581,7 +858,7 @@ export class SteamStatsManager {
       );
 
       if (success) {
-        const value = koffi.decode(valueOut, 'float');
+        const value = valueOut.readFloatLE(0);
         console.log(`[Steamworks] Got user stat "${statName}" for ${steamId}: ${value}`);
         return {
           steamId: typeof steamId === 'string' ? steamId : steamId.toString(),
@@ -705,7 +982,7 @@ export class SteamStatsManager {
 
     try {
       const userStatsInterface = this.libraryLoader.SteamAPI_SteamUserStats_v013();
-      const valueOut = koffi.alloc('int64', 1);
+      const valueOut = SteamScratch.slot();
       
       const success = this.libraryLoader.SteamAPI_ISteamUserStats_GetGlobalStatInt64(
         userStatsInterface,
@@ -714,7 +991,7 @@ export class SteamStatsManager {
       );
 
       if (success) {
-        const value = koffi.decode(valueOut, 'int64');
+        const value = SteamScratch.int64(valueOut);
         console.log(`[Steamworks] Got global stat "${statName}": ${value}`);
         return {
           name: statName,
@@ -771,7 +1048,7 @@ export class SteamStatsManager {
 
     try {
       const userStatsInterface = this.libraryLoader.SteamAPI_SteamUserStats_v013();
-      const valueOut = koffi.alloc('double', 1);
+      const valueOut = SteamScratch.slot();
       
       const success = this.libraryLoader.SteamAPI_ISteamUserStats_GetGlobalStatDouble(
         userStatsInterface,
@@ -780,7 +1057,7 @@ export class SteamStatsManager {
       );
 
       if (success) {
-        const value = koffi.decode(valueOut, 'double');
+        const value = valueOut.readDoubleLE(0);
         console.log(`[Steamworks] Got global stat "${statName}": ${value}`);
         return {
           name: statName,
@@ -0,0 +1,155 @@
+import { SteamLibraryLoader } from './SteamLibraryLoader';
+import { SteamAPICore } from './SteamAPICore';
+import { SteamLogger } from './SteamLogger';
+
+/**
+ * SteamStatsStore
+ *
+ * Write-behind layer for `ISteamUserStats::StoreStats()`, shared by the stats
+ * and achievement managers. Steam rate-limits StoreStats, so a game that
+ * stores after every kill or pickup gets its uploads throttled. With a store
+ * interval set, stat setters only mark the stat dirty and every change made
+ * within one interval goes up in a single StoreStats call.
+ *
+ * - Interval 0 (default): every change is stored right away, as before
+ * - Interval > 0: dirty stats are stored at most once per interval; the first
+ *   change after a quiet period is stored on the next tick
+ * - {@link flush} stores immediately (achievement unlocks, shutdown)
+ *
+ * One StoreStats uploads everything Steam holds locally, so a flush also
+ * covers stats still waiting for the interval.
+ */
+export class SteamStatsStore {
+  /** Steam library loader for FFI function calls */
+  private libraryLoader: SteamLibraryLoader;
+
+  /** Steam API core for initialization and callback management */
+  private apiCore: SteamAPICore;
+
+  /** Minimum time between StoreStats calls (ms); 0 stores every change */
+  private intervalMs: number = 0;
+
+  /** Stats changed since the last successful store */
+  private dirty = new Set<string>();
+
+  /** Pending write-behind store */
+  private timer: ReturnType<typeof setTimeout> | null = null;
+
+  /** Date.now() of the last StoreStats call */
+  private lastStoreAt: number = 0;
+
+  /**
+   * Creates a new SteamStatsStore instance
+   *
+   * @param libraryLoader - The Steam library loader for FFI calls
+   * @param apiCore - The Steam API core for lifecycle management
+   */
+  constructor(libraryLoader: SteamLibraryLoader, apiCore: SteamAPICore) {
+    this.libraryLoader = libraryLoader;
+    this.apiCore = apiCore;
+  }
+
+  /**
+   * Set the store interval (ms). 0 stores every change immediately and
+   * flushes anything still pending.
+   */
+  setInterval(intervalMs: number): void {
+    this.intervalMs = Math.max(0, intervalMs || 0);
+    this.cancelTimer();
+    if (this.dirty.size === 0) return;
+    if (this.intervalMs === 0) {
+      this.flush();
+    } else {
+      this.schedule();
+    }
+  }
+
+  /** Current store interval (ms) */
+  getInterval(): number {
+    return this.intervalMs;
+  }
+
+  /**
+   * Record changed stats and store them, now or on the interval
+   *
+   * @returns false only when an immediate store fails
+   */
+  commit(statNames: string[]): boolean {
+    for (const name of statNames) {
+      this.dirty.add(name);
+    }
+    if (this.intervalMs === 0) {
+      return this.flush();
+    }
+    this.schedule();
+    return true;
+  }
+
+  /** Names of stats changed but not stored yet */
+  pending(): string[] {
+    return Array.from(this.dirty);
+  }
+
+  /**
+   * Call StoreStats now
+   *
+   * On failure the dirty stats stay pending and, with an interval set, are
+   * retried on the next one.
+   */
+  flush(): boolean {
+    this.cancelTimer();
+    if (!this.apiCore.isInitialized()) {
+      SteamLogger.warn('[Steamworks] Steam API not initialized');
+      return false;
+    }
+
+    const userStatsInterface = this.apiCore.getUserStatsInterface();
+    if (!userStatsInterface) {
+      SteamLogger.warn('[Steamworks] UserStats interface not available');
+      return false;
+    }
+
+    this.lastStoreAt = Date.now();
+    const stored = this.libraryLoader.SteamAPI_ISteamUserStats_StoreStats(userStatsInterface);
+    if (!stored) {
+      SteamLogger.warn(`[Steamworks] Failed to store stats (${this.dirty.size} pending)`);
+      if (this.intervalMs > 0 && this.dirty.size > 0) this.schedule();
+      return false;
+    }
+
+    if (this.dirty.size > 0) {
+      SteamLogger.debug(`[Steamworks] Stored ${this.dirty.size} changed stat(s)`);
+      this.dirty.clear();
+    }
+    this.apiCore.runCallbacks();
+    return true;
+  }
+
+  /**
+   * Store anything still pending and stop the timer. Call before SteamAPI_Shutdown().
+   */
+  dispose(): void {
+    if (this.dirty.size > 0 && this.apiCore.isInitialized()) {
+      this.flush();
+    }
+    this.cancelTimer();
+  }
+
+  private schedule(): void {
+    if (this.timer) return;
+    const delay = Math.max(0, this.lastStoreAt + this.intervalMs - Date.now());
+    this.timer = setTimeout(() => {
+      this.timer = null;
+      this.flush();
+    }, delay);
+    // A pending store must not keep the process alive; shutdown flushes it
+    this.timer.unref?.();
+  }
+
+  private cancelTimer(): void {
+    if (this.timer) {
+      clearTimeout(this.timer);
+      this.timer = null;
+    }
+  }
+}
@@ -2,6 +2,7 @@ import * as koffi from 'koffi';
 import { SteamLibraryLoader, CCallbackBase, FnCallbackRunPtr, FnCallbackRunResultPtr, FnGetCallbackSizeBytesPtr } from './SteamLibraryLoader';
 import { SteamAPICore } from './SteamAPICore';
 import { SteamCallbackPoller } from './SteamCallbackPoller';
+import { SteamCallbackPump } from './SteamCallbackPump';
 import { SteamLogger } from './SteamLogger';
 import {
   K_I_GET_TICKET_FOR_WEB_API_RESPONSE,
@@ -156,6 +157,16 @@ export class SteamUserManager {
     this.libraryLoader = libraryLoader;
     this.apiCore = apiCore;
     this.callbackPoller = new SteamCallbackPoller(libraryLoader, apiCore);
+
+    // Registered CCallbackBase objects aren't run in manual-dispatch mode, so
+    // take the ticket response from the native callback pump when it is active
+    apiCore.getCallbackPump().onCallback(K_I_GET_TICKET_FOR_WEB_API_RESPONSE, (data) => {
+      const response = koffi.decode(
+        SteamCallbackPump.toNative(data, GetTicketForWebApiResponse_t),
+        GetTicketForWebApiResponse_t
+      );
+      this.handleWebApiTicketResponse(response);
+    });
   }
 
   // ========================================
@@ -2,6 +2,7 @@ import * as koffi from 'koffi';
 import { SteamLibraryLoader } from './SteamLibraryLoader';
 import { SteamAPICore } from './SteamAPICore';
 import { SteamLogger } from './SteamLogger';
+import { SteamScratch } from './SteamScratch';
 import {
   ENotificationPosition,
   EGamepadTextInputMode,
@@ -586,8 +587,8 @@ export class SteamUtilsManager {
     if (!utils || imageHandle <= 0) return null;
     
     try {
-      const widthPtr = koffi.alloc('uint32', 1);
-      const heightPtr = koffi.alloc('uint32', 1);
+      const widthPtr = SteamScratch.slot(0);
+      const heightPtr = SteamScratch.slot(1);
       
       const success = this.libraryLoader.SteamAPI_ISteamUtils_GetImageSize(
         utils,
@@ -599,8 +600,8 @@ export class SteamUtilsManager {
       if (!success) return null;
       
       return {
-        width: koffi.decode(widthPtr, 'uint32'),
-        height: koffi.decode(heightPtr, 'uint32'),
+        width: widthPtr.readUInt32LE(0),
+        height: heightPtr.readUInt32LE(0),
       };
     } catch (error) {
       SteamLogger.error('[Steamworks] Failed to get image size:', error);
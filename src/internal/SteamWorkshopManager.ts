@@ -1,6 +1,7 @@
 import { SteamLibraryLoader } from './SteamLibraryLoader';
 import { SteamAPICore } from './SteamAPICore';
 import { SteamCallbackPoller } from './SteamCallbackPoller';
+import { SteamWorkshopQueryEngine } from './SteamWorkshopQueryEngine';
 import {
   PublishedFileId,
   UGCQueryHandle,
@@ -19,6 +20,9 @@ import {
   EWorkshopFileType,
   ERemoteStoragePublishedFileVisibility,
   EUGCContentDescriptorID,
+  WorkshopQueryParams,
+  WorkshopQueryPage,
+  WorkshopQueryCacheOptions,
   K_UGC_QUERY_HANDLE_INVALID,
   K_UGC_UPDATE_HANDLE_INVALID
 } from '../types';
@@ -205,10 +209,14 @@ export class SteamWorkshopManager {
   /** Callback poller for async operations */
   private callbackPoller: SteamCallbackPoller;
   
+  /** Pipelined, cached paged queries */
+  private queryEngine: SteamWorkshopQueryEngine;
+  
   constructor(libraryLoader: SteamLibraryLoader, apiCore: SteamAPICore) {
     this.libraryLoader = libraryLoader;
     this.apiCore = apiCore;
     this.callbackPoller = new SteamCallbackPoller(libraryLoader, apiCore);
+    this.queryEngine = new SteamWorkshopQueryEngine(libraryLoader, apiCore, this);
   }
 
   // ========================================
@@ -1228,6 +1236,97 @@ export class SteamWorkshopManager {
     }
   }
 
+  // ========================================
+  // Paged Query Cache
+  // ========================================
+
+  /**
+   * Fetch one page of an all-UGC query, decoded into columns and cached
+   * 
+   * @param params - Query type, matching type, app IDs and optional search text
+   * @param page - 1-based page number
+   * @returns The decoded page, or null if the query failed
+   * 
+   * @remarks
+   * Handles are created, sent and released internally. A fresh cached page is
+   * returned without a Steam round-trip, and concurrent requests for the same
+   * page share one query.
+   * 
+   * @example
+   * ```typescript
+   * const params = {
+   *   queryType: EUGCQuery.RankedByVote,
+   *   matchingType: EUGCMatchingUGCType.Items,
+   *   creatorAppId: appId,
+   *   consumerAppId: appId
+   * };
+   * const page = await steam.workshop.fetchQueryPage(params, 1);
+   * if (page) {
+   *   for (let i = 0; i < page.count; i++) {
+   *     console.log(`${page.titles[i]}: 👍 ${page.votesUp[i]}`);
+   *   }
+   * }
+   * ```
+   */
+  fetchQueryPage(params: WorkshopQueryParams, page: number): Promise<WorkshopQueryPage | null> {
+    if (!this.apiCore.isInitialized()) {
+      return Promise.resolve(null);
+    }
+    return this.queryEngine.fetchPage(params, page);
+  }
+
+  /**
+   * Fetch several pages of an all-UGC query with their queries in flight together
+   * 
+   * @param params - Query parameters shared by every page
+   * @param pages - 1-based page numbers
+   * @returns One entry per requested page, null where that page failed
+   * 
+   * @remarks
+   * At most `maxInFlight` queries (see configureQueryCache) are outstanding at
+   * once; the rest start as earlier ones complete. Useful for prefetching the
+   * pages around the one being shown.
+   * 
+   * @example
+   * ```typescript
+   * // Show page 3, warm the cache for its neighbours
+   * const [prev, current, next] = await steam.workshop.fetchQueryPages(params, [2, 3, 4]);
+   * ```
+   */
+  fetchQueryPages(params: WorkshopQueryParams, pages: number[]): Promise<Array<WorkshopQueryPage | null>> {
+    if (!this.apiCore.isInitialized()) {
+      return Promise.resolve(pages.map(() => null));
+    }
+    return this.queryEngine.fetchPages(params, pages);
+  }
+
+  /**
+   * Set the page cache TTL and size, and the number of queries kept in flight
+   * 
+   * @param options - Fields to change; omitted fields keep their current value
+   */
+  configureQueryCache(options: WorkshopQueryCacheOptions): void {
+    this.queryEngine.configure(options);
+  }
+
+  /**
+   * Drop cached query pages
+   * 
+   * @param params - Only drop pages for these query parameters; all pages if omitted
+   */
+  invalidateQueryCache(params?: WorkshopQueryParams): void {
+    this.queryEngine.invalidate(params);
+  }
+
+  /**
+   * Drop every cached query page containing an item
+   * 
+   * @param publishedFileId - Item whose details changed (vote, edit, deletion)
+   */
+  invalidateQueryCacheItem(publishedFileId: PublishedFileId): void {
+    this.queryEngine.invalidateItem(publishedFileId);
+  }
+
   /**
    * Get number of tags for a UGC query result
    * 
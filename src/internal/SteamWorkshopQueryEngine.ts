@@ -0,0 +1,332 @@
+import { SteamLibraryLoader } from './SteamLibraryLoader';
+import { SteamAPICore } from './SteamAPICore';
+import type { SteamWorkshopManager } from './SteamWorkshopManager';
+import { SteamLogger } from './SteamLogger';
+import {
+  PublishedFileId,
+  UGCQueryHandle,
+  WorkshopQueryParams,
+  WorkshopQueryPage,
+  WorkshopQueryCacheOptions,
+  K_UGC_QUERY_HANDLE_INVALID
+} from '../types';
+
+const DEFAULT_TTL_MS = 5 * 60 * 1000;
+const DEFAULT_MAX_PAGES = 64;
+const DEFAULT_MAX_IN_FLIGHT = 4;
+
+// SteamUGCDetails_t layout - see the layout notes in SteamWorkshopManager.
+// Everything after the description is shifted by the platform's uint64 alignment.
+const STEAM_UGC_DETAILS_SIZE = 9800;
+const PREVIEW_URL_SIZE = 1024;
+const DETAILS_TITLE = 24;
+const DETAILS_TITLE_MAX = 129;
+const DETAILS_DESCRIPTION = 153;
+const DETAILS_DESCRIPTION_MAX = 8000;
+const DETAILS_OWNER = process.platform === 'win32' ? 8160 : 8156;
+const DETAILS_TIME_CREATED = DETAILS_OWNER + 8;
+const DETAILS_TIME_UPDATED = DETAILS_OWNER + 12;
+const DETAILS_VISIBILITY = DETAILS_OWNER + 20;
+const DETAILS_BANNED = DETAILS_OWNER + 24;
+const DETAILS_TAGS = DETAILS_OWNER + 27;
+const DETAILS_TAGS_MAX = 1025;
+const DETAILS_FILE = process.platform === 'win32' ? 9216 : 9208;
+const DETAILS_FILE_SIZE = DETAILS_FILE + 276;
+const DETAILS_URL = DETAILS_FILE + 284;
+const DETAILS_URL_MAX = 256;
+const DETAILS_VOTES_UP = DETAILS_FILE + 540;
+const DETAILS_VOTES_DOWN = DETAILS_FILE + 544;
+const DETAILS_SCORE = DETAILS_FILE + 548;
+
+interface CachedPage {
+  page: WorkshopQueryPage;
+  expiresAt: number;
+}
+
+/**
+ * SteamWorkshopQueryEngine
+ *
+ * Pipelined, cached all-UGC queries for paged browsing. Up to `maxInFlight`
+ * queries are sent at once (completions are resolved by the shared callback
+ * dispatcher, so they overlap instead of running back to back), each completed
+ * page is decoded in one pass into a {@link WorkshopQueryPage}, and pages are
+ * kept in an LRU cache keyed by query parameters and page number.
+ *
+ * Requests for a page that is already being fetched share the same promise.
+ */
+export class SteamWorkshopQueryEngine {
+  private libraryLoader: SteamLibraryLoader;
+  private apiCore: SteamAPICore;
+  private workshop: SteamWorkshopManager;
+
+  private ttlMs: number = DEFAULT_TTL_MS;
+  private maxPages: number = DEFAULT_MAX_PAGES;
+  private maxInFlight: number = DEFAULT_MAX_IN_FLIGHT;
+
+  /** Insertion order doubles as LRU order: hits are re-inserted at the end */
+  private cache: Map<string, CachedPage> = new Map();
+  private inFlight: Map<string, Promise<WorkshopQueryPage | null>> = new Map();
+  private running: number = 0;
+  private waiting: Array<() => void> = [];
+
+  // Decode scratch; GetQueryUGCResult is synchronous, so one buffer serves every query
+  private detailsBuffer = Buffer.alloc(STEAM_UGC_DETAILS_SIZE);
+  private urlBuffer = Buffer.alloc(PREVIEW_URL_SIZE);
+
+  constructor(libraryLoader: SteamLibraryLoader, apiCore: SteamAPICore, workshop: SteamWorkshopManager) {
+    this.libraryLoader = libraryLoader;
+    this.apiCore = apiCore;
+    this.workshop = workshop;
+  }
+
+  /**
+   * Change cache and concurrency limits; omitted fields keep their current value
+   */
+  configure(options: WorkshopQueryCacheOptions): void {
+    if (options.ttlMs !== undefined) this.ttlMs = Math.max(0, options.ttlMs);
+    if (options.maxPages !== undefined) this.maxPages = Math.max(0, Math.floor(options.maxPages));
+    if (options.maxInFlight !== undefined) this.maxInFlight = Math.max(1, Math.floor(options.maxInFlight));
+    this.evict();
+  }
+
+  /**
+   * Get one page, from the cache when it is still fresh
+   */
+  fetchPage(params: WorkshopQueryParams, page: number): Promise<WorkshopQueryPage | null> {
+    const key = this.keyFor(params, page);
+
+    const cached = this.cache.get(key);
+    if (cached) {
+      this.cache.delete(key);
+      if (cached.expiresAt > Date.now()) {
+        this.cache.set(key, cached);
+        return Promise.resolve(cached.page);
+      }
+    }
+
+    const pending = this.inFlight.get(key);
+    if (pending) return pending;
+
+    const request = this.withSlot(() => this.runQuery(params, page))
+      .then(result => {
+        if (result && this.maxPages > 0 && this.ttlMs > 0) {
+          this.cache.set(key, { page: result, expiresAt: result.fetchedAt + this.ttlMs });
+          this.evict();
+        }
+        return result;
+      })
+      .catch(error => {
+        SteamLogger.error(`[Steamworks] Error querying UGC page ${page}:`, error);
+        return null;
+      })
+      .finally(() => this.inFlight.delete(key));
+    this.inFlight.set(key, request);
+    return request;
+  }
+
+  /**
+   * Get several pages, keeping up to `maxInFlight` queries outstanding
+   */
+  fetchPages(params: WorkshopQueryParams, pages: number[]): Promise<Array<WorkshopQueryPage | null>> {
+    return Promise.all(pages.map(page => this.fetchPage(params, page)));
+  }
+
+  /**
+   * Drop cached pages - all of them, or only those for one set of query parameters
+   */
+  invalidate(params?: WorkshopQueryParams): void {
+    if (!params) {
+      this.cache.clear();
+      return;
+    }
+    const prefix = this.keyFor(params, 0).replace(/#0$/, '#');
+    for (const key of this.cache.keys()) {
+      if (key.startsWith(prefix)) this.cache.delete(key);
+    }
+  }
+
+  /**
+   * Drop every cached page that lists the given item (e.g. after voting on or editing it)
+   */
+  invalidateItem(publishedFileId: PublishedFileId): void {
+    for (const [key, entry] of this.cache) {
+      if (entry.page.publishedFileIds.includes(publishedFileId)) this.cache.delete(key);
+    }
+  }
+
+  /**
+   * Number of pages currently cached
+   */
+  getCachedPageCount(): number {
+    return this.cache.size;
+  }
+
+  private keyFor(params: WorkshopQueryParams, page: number): string {
+    return `${params.queryType}:${params.matchingType}:${params.creatorAppId}:${params.consumerAppId}:` +
+      `${JSON.stringify(params.searchText ?? '')}#${page}`;
+  }
+
+  private evict(): void {
+    const now = Date.now();
+    for (const [key, entry] of this.cache) {
+      if (entry.expiresAt <= now) this.cache.delete(key);
+    }
+    while (this.cache.size > this.maxPages) {
+      this.cache.delete(this.cache.keys().next().value as string);
+    }
+  }
+
+  private async withSlot<T>(task: () => Promise<T>): Promise<T> {
+    while (this.running >= this.maxInFlight) {
+      await new Promise<void>(resolve => this.waiting.push(resolve));
+    }
+    this.running++;
+    try {
+      return await task();
+    } finally {
+      this.running--;
+      this.waiting.shift()?.();
+    }
+  }
+
+  private async runQuery(params: WorkshopQueryParams, page: number): Promise<WorkshopQueryPage | null> {
+    const handle = this.workshop.createQueryAllUGCRequest(
+      params.queryType,
+      params.matchingType,
+      params.creatorAppId,
+      params.consumerAppId,
+      page
+    );
+    if (handle === K_UGC_QUERY_HANDLE_INVALID) {
+      return null;
+    }
+
+    try {
+      if (params.searchText && !this.workshop.setSearchText(handle, params.searchText)) {
+        return null;
+      }
+
+      const result = await this.workshop.sendQueryUGCRequest(handle);
+      if (!result) {
+        return null;
+      }
+      return this.decodePage(handle, page, result.numResults, result.totalResults, result.cachedData);
+    } finally {
+      this.workshop.releaseQueryUGCRequest(handle);
+    }
+  }
+
+  /**
+   * Decode every result of a completed query into column arrays
+   */
+  private decodePage(
+    handle: UGCQueryHandle,
+    page: number,
+    count: number,
+    totalResults: number,
+    cachedData: boolean
+  ): WorkshopQueryPage | null {
+    const ugc = this.apiCore.getUGCInterface();
+    if (!ugc) {
+      return null;
+    }
+
+    const decoded: WorkshopQueryPage = {
+      page,
+      count: 0,
+      totalResults,
+      cachedData,
+      fetchedAt: Date.now(),
+      publishedFileIds: new BigUint64Array(count),
+      ownerIds: new BigUint64Array(count),
+      titles: [],
+      descriptions: [],
+      tags: [],
+      previewUrls: [],
+      fileTypes: new Int32Array(count),
+      visibility: new Int32Array(count),
+      votesUp: new Uint32Array(count),
+      votesDown: new Uint32Array(count),
+      scores: new Float32Array(count),
+      timeCreated: new Uint32Array(count),
+      timeUpdated: new Uint32Array(count),
+      fileSizes: new Int32Array(count),
+      flags: new Uint8Array(count),
+    };
+
+    const details = this.detailsBuffer;
+    try {
+      for (let index = 0; index < count; index++) {
+        if (!this.libraryLoader.SteamAPI_ISteamUGC_GetQueryUGCResult(ugc, handle, index, details)) {
+          SteamLogger.warn(`[Steamworks] UGC result ${index} of page ${page} could not be read, page truncated`);
+          break;
+        }
+
+        const i = decoded.count++;
+        decoded.publishedFileIds[i] = details.readBigUInt64LE(0);
+        decoded.fileTypes[i] = details.readInt32LE(12);
+        decoded.titles.push(readCString(details, DETAILS_TITLE, DETAILS_TITLE_MAX));
+        decoded.descriptions.push(readCString(details, DETAILS_DESCRIPTION, DETAILS_DESCRIPTION_MAX));
+        decoded.ownerIds[i] = details.readBigUInt64LE(DETAILS_OWNER);
+        decoded.timeCreated[i] = details.readUInt32LE(DETAILS_TIME_CREATED);
+        decoded.timeUpdated[i] = details.readUInt32LE(DETAILS_TIME_UPDATED);
+        decoded.visibility[i] = details.readInt32LE(DETAILS_VISIBILITY);
+        decoded.flags[i] =
+          (details[DETAILS_BANNED] ? 1 : 0) |
+          (details[DETAILS_BANNED + 1] ? 2 : 0) |
+          (details[DETAILS_BANNED + 2] ? 4 : 0);
+        const tags = readCString(details, DETAILS_TAGS, DETAILS_TAGS_MAX);
+        decoded.tags.push(tags ? tags.split(',').map(tag => tag.trim()).filter(tag => tag.length > 0) : []);
+        decoded.fileSizes[i] = details.readInt32LE(DETAILS_FILE_SIZE);
+        decoded.votesUp[i] = details.readUInt32LE(DETAILS_VOTES_UP);
+        decoded.votesDown[i] = details.readUInt32LE(DETAILS_VOTES_DOWN);
+        decoded.scores[i] = details.readFloatLE(DETAILS_SCORE);
+
+        // Preview URL from its own call is more reliable than the struct's m_rgchURL
+        const hasPreview = this.libraryLoader.SteamAPI_ISteamUGC_GetQueryUGCPreviewURL(
+          ugc,
+          handle,
+          index,
+          this.urlBuffer,
+          PREVIEW_URL_SIZE
+        );
+        const previewUrl = hasPreview ? readCString(this.urlBuffer, 0, PREVIEW_URL_SIZE) : '';
+        decoded.previewUrls.push(previewUrl || readCString(details, DETAILS_URL, DETAILS_URL_MAX));
+      }
+    } catch (error) {
+      SteamLogger.error('[Steamworks] Error decoding UGC query page:', error);
+      return null;
+    }
+
+    if (decoded.count < count) {
+      return trimPage(decoded);
+    }
+    return decoded;
+  }
+}
+
+function readCString(buffer: Buffer, offset: number, maxLength: number): string {
+  const end = buffer.indexOf(0, offset);
+  return buffer.toString('utf8', offset, end >= offset && end < offset + maxLength ? end : offset + maxLength);
+}
+
+/**
+ * Shrink the typed columns of a partially decoded page to `page.count`
+ */
+function trimPage(page: WorkshopQueryPage): WorkshopQueryPage {
+  const n = page.count;
+  return {
+    ...page,
+    publishedFileIds: page.publishedFileIds.slice(0, n),
+    ownerIds: page.ownerIds.slice(0, n),
+    fileTypes: page.fileTypes.slice(0, n),
+    visibility: page.visibility.slice(0, n),
+    votesUp: page.votesUp.slice(0, n),
+    votesDown: page.votesDown.slice(0, n),
+    scores: page.scores.slice(0, n),
+    timeCreated: page.timeCreated.slice(0, n),
+    timeUpdated: page.timeUpdated.slice(0, n),
+    fileSizes: page.fileSizes.slice(0, n),
+    flags: page.flags.slice(0, n),
+  };
+}
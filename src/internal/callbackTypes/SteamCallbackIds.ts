@@ -18,6 +18,9 @@ export const K_I_REMOTE_STORAGE_SUBSCRIBE_PUBLISHED_FILE_RESULT = 1313;
 /** Callback for RemoteStorageUnsubscribePublishedFileResult_t */
 export const K_I_REMOTE_STORAGE_UNSUBSCRIBE_PUBLISHED_FILE_RESULT = 1315;
 
+/** Callback for RemoteStorageFileReadAsyncComplete_t */
+export const K_I_REMOTE_STORAGE_FILE_READ_ASYNC_COMPLETE = 1332;
+
 // ========================================
 // Steam UGC (Workshop) Callback IDs
 // ========================================
@@ -43,6 +46,13 @@ export const K_I_GET_USER_ITEM_VOTE_RESULT = 3409;
 /** Callback for DeleteItemResult_t */
 export const K_I_DELETE_ITEM_RESULT = 3417;
 
+// ========================================
+// Steam Friends Callback IDs
+// ========================================
+
+/** Callback for PersonaStateChange_t */
+export const K_I_PERSONA_STATE_CHANGE = 304; // k_iSteamFriendsCallbacks + 4
+
 // ========================================
 // Steam Matchmaking Callback IDs
 // ========================================
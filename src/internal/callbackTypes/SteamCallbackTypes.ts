@@ -51,6 +51,18 @@ export interface RemoteStorageUnsubscribePublishedFileResultType {
   m_nPublishedFileId: bigint;
 }
 
+/**
+ * RemoteStorageFileReadAsyncComplete_t callback structure
+ * 
+ * Result of ISteamRemoteStorage::FileReadAsync call
+ */
+export interface RemoteStorageFileReadAsyncCompleteType {
+  m_hFileReadAsync: bigint;
+  m_eResult: number;
+  m_nOffset: number;
+  m_cubRead: number;
+}
+
 /**
  * SteamUGCQueryCompleted_t callback structure
  * 
@@ -270,3 +282,13 @@ export interface DurationControlType {
   m_csecsToday: number;
   m_csecsRemaining: number;
 }
+
+/**
+ * PersonaStateChange_t callback structure
+ * 
+ * Broadcast when a user's persona information changes
+ */
+export interface PersonaStateChangeType {
+  m_ulSteamID: bigint;
+  m_nChangeFlags: number;
+}
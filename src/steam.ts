@@ -1,11 +1,19 @@
 import { 
   SteamInitOptions,
-  SteamStatus
+  SteamStatus,
+  CallbackPumpOptions,
+  CallbackPumpStats,
+  SteamStartupTimings,
+  ElectronOverlayOptions,
+  OverlayDirtyRect,
+  OverlayRenderStats,
+  OverlaySharedTextureInfo
 } from './types';
 import { SteamLibraryLoader } from './internal/SteamLibraryLoader';
 import { SteamAPICore } from './internal/SteamAPICore';
 import { SteamAchievementManager } from './internal/SteamAchievementManager';
 import { SteamStatsManager } from './internal/SteamStatsManager';
+import { SteamStatsStore } from './internal/SteamStatsStore';
 import { SteamLeaderboardManager } from './internal/SteamLeaderboardManager';
 import { SteamFriendsManager } from './internal/SteamFriendsManager';
 import { SteamRichPresenceManager } from './internal/SteamRichPresenceManager';
@@ -67,6 +75,7 @@ class SteamworksSDK {
   // Internal modules
   private libraryLoader: SteamLibraryLoader;
   private apiCore: SteamAPICore;
+  private statsStore: SteamStatsStore; // StoreStats write-behind shared by stats and achievements
   
   /**
    * Achievement Manager - Handle all Steam achievement operations
@@ -725,10 +734,11 @@ class SteamworksSDK {
     this.libraryLoader = new SteamLibraryLoader();
     this.apiCore = new SteamAPICore(this.libraryLoader);
     this.nativeOverlay = new SteamOverlay();
+    this.statsStore = new SteamStatsStore(this.libraryLoader, this.apiCore);
     
     // Initialize public managers
-    this.achievements = new SteamAchievementManager(this.libraryLoader, this.apiCore);
-    this.stats = new SteamStatsManager(this.libraryLoader, this.apiCore);
+    this.achievements = new SteamAchievementManager(this.libraryLoader, this.apiCore, this.statsStore);
+    this.stats = new SteamStatsManager(this.libraryLoader, this.apiCore, this.statsStore);
     this.leaderboards = new SteamLeaderboardManager(this.libraryLoader, this.apiCore);
     this.friends = new SteamFriendsManager(this.libraryLoader, this.apiCore);
     this.richPresence = new SteamRichPresenceManager(this.libraryLoader, this.apiCore);
@@ -743,6 +753,9 @@ class SteamworksSDK {
     this.networkingUtils = new SteamNetworkingUtilsManager(this.libraryLoader, this.apiCore);
     this.networkingSockets = new SteamNetworkingSocketsManager(this.libraryLoader, this.apiCore);
     this.user = new SteamUserManager(this.libraryLoader, this.apiCore);
+
+    // Keep presenting unchanged overlay frames while Steam draws on top of them
+    this.nativeOverlay.setOverlayNeedsPresentCheck(() => this.utils.overlayNeedsPresent());
   }
 
   static getInstance(): SteamworksSDK {
@@ -767,7 +780,7 @@ class SteamworksSDK {
    * Shutdown Steam API
    *
    * Performs a full, ordered cleanup of all Koffi-registered callbacks, active
-   * auth tickets, P2P connections, and the native Steam library, then calls
+   * auth tickets, P2P connections, pending stat stores, and the native Steam library, then calls
    * `SteamAPI_Shutdown()`.
    */
   shutdown(): void {
@@ -786,8 +799,12 @@ class SteamworksSDK {
     //    MUST happen before SteamAPI_Shutdown() so Steam doesn't fire callbacks
     //    into freed Koffi function pointers.
     this.user.cleanup();
+    this.friends.cleanup();
+
+    // 5. Store stats still waiting for the store interval and stop its timer.
+    this.statsStore.dispose();
 
-    // 5. Call SteamAPI_Shutdown() + lib.unload() (dlclose).
+    // 6. Call SteamAPI_Shutdown() + lib.unload() (dlclose).
     this.apiCore.shutdown();
   }
 
@@ -805,6 +822,53 @@ class SteamworksSDK {
     this.apiCore.runCallbacks();
   }
 
+  /**
+   * Deliver Steam callbacks from a native thread instead of runCallbacks()
+   * 
+   * Switches Steam to manual dispatch and pumps it, together with the
+   * networking callbacks, on a dedicated native thread, so callbacks such as
+   * connection status changes are collected even while the main thread is busy.
+   * Once running, runCallbacks() is a no-op. Call after init().
+   * 
+   * @param options - Pump interval (default 5ms) and whether to pump networking callbacks
+   * @returns true if the pump started; false if the native addon isn't available
+   * 
+   * @example
+   * ```typescript
+   * steam.init({ appId: 480 });
+   * if (!steam.startCallbackPump()) {
+   *   setInterval(() => steam.runCallbacks(), 16);
+   * }
+   * ```
+   */
+  startCallbackPump(options?: CallbackPumpOptions): boolean {
+    return this.apiCore.startCallbackPump(options);
+  }
+
+  /**
+   * Get the native callback pump state
+   */
+  getCallbackPumpStats(): CallbackPumpStats {
+    return this.apiCore.getCallbackPump().getStats();
+  }
+
+  /**
+   * Get startup timings: library load, SteamAPI_Init() and function binding
+   * 
+   * Interface functions are bound on first use, so `bindingMs` grows as the
+   * app touches more interfaces. Pass `reportStartupTiming: true` to init() to
+   * log the breakdown once initialization finishes.
+   * 
+   * @example
+   * ```typescript
+   * steam.init({ appId: 480, reportStartupTiming: true });
+   * console.log(steam.getStartupTimings().steamApiInitMs);
+   * ```
+   */
+  getStartupTimings(): SteamStartupTimings {
+    return this.apiCore.getStartupTimings();
+  }
+
   /**
    * Check if Steam client is running
    */
@@ -1094,15 +1158,146 @@ class SteamworksSDK {
    */
   addElectronSteamOverlay(
     browserWindow: any,
-    options?: {
-      title?: string;
-      fps?: number;
-      vsync?: boolean;
-    }
+    options?: ElectronOverlayOptions
   ): boolean {
     return this.nativeOverlay.addElectronSteamOverlay(browserWindow, options);
   }
 
+  /**
+   * Add Steam overlay support to an Electron BrowserWindow, setting up the
+   * native window off the main thread
+   *
+   * Same as {@link addElectronSteamOverlay}, but GL context creation and
+   * shader compilation (Metal device and pipeline on macOS) run on a worker
+   * thread, so the main process stays responsive during startup.
+   *
+   * @param browserWindow - The Electron BrowserWindow to add overlay support to
+   * @param options - Optional configuration for the overlay window
+   * @returns Resolves to true if the overlay was successfully added
+   *
+   * @example Create the overlay while the page loads
+   * ```typescript
+   * const win = new BrowserWindow({ width: 1280, height: 720 });
+   * const overlayReady = steam.addElectronSteamOverlayAsync(win);
+   * await win.loadFile('index.html');
+   * await overlayReady;
+   * ```
+   */
+  addElectronSteamOverlayAsync(
+    browserWindow: any,
+    options?: ElectronOverlayOptions
+  ): Promise<boolean> {
+    return this.nativeOverlay.addElectronSteamOverlayAsync(browserWindow, options);
+  }
+
+  /**
+   * Push a frame to the native overlay window
+   * 
+   * Only needed with `autoCapture: false`; otherwise the overlay captures the
+   * BrowserWindow itself.
+   * 
+   * @param buffer - Full-size BGRA bitmap
+   * @param width - Frame width in pixels
+   * @param height - Frame height in pixels
+   * @param dirtyRects - Optional changed regions; only these are uploaded
+   * @returns False if the frame was identical to the previous one and skipped
+   * 
+   * @example Offscreen rendering with dirty regions
+   * ```typescript
+   * steam.addElectronSteamOverlay(win, { autoCapture: false });
+   * win.webContents.on('paint', (event, dirty, image) => {
+   *   const size = image.getSize();
+   *   steam.renderOverlayFrame(image.toBitmap(), size.width, size.height, [dirty]);
+   * });
+   * ```
+   */
+  renderOverlayFrame(
+    buffer: Buffer,
+    width: number,
+    height: number,
+    dirtyRects?: OverlayDirtyRect[]
+  ): boolean {
+    return this.nativeOverlay.renderFrame(buffer, width, height, dirtyRects);
+  }
+
+  /**
+   * Push an offscreen frame to the overlay straight from its shared GPU texture
+   * 
+   * @param textureInfo - `texture.textureInfo` from the `paint` event of a window
+   * created with `webPreferences.offscreen.useSharedTexture: true`
+   * @returns False if the texture couldn't be imported; render the frame as a
+   * bitmap with `renderOverlayFrame()` instead
+   * 
+   * @remarks
+   * Skips the CPU readback of `renderOverlayFrame()`: the texture is copied on the
+   * GPU on Windows and macOS. On Linux linear dmabufs are imported into the
+   * overlay's GLX context with `GL_EXT_memory_object_fd` on Mesa drivers; tiled
+   * or compressed dmabufs (any modifier other than linear) and other drivers
+   * return false. The call blocks for at most 50 ms while the frame is presented.
+   * Release the texture after this call returns.
+   * 
+   * @example
+   * ```typescript
+   * win.webContents.on('paint', (event) => {
+   *   const texture = event.texture;
+   *   if (!texture) return;
+   *   if (!steam.renderOverlaySharedTexture(texture.textureInfo)) {
+   *     // e.g. no WGL_NV_DX_interop, a tiled dmabuf or a non-Mesa driver — switch to bitmaps
+   *   }
+   *   texture.release();
+   * });
+   * ```
+   */
+  renderOverlaySharedTexture(textureInfo: OverlaySharedTextureInfo): boolean {
+    return this.nativeOverlay.renderSharedTexture(textureInfo);
+  }
+
+  /**
+   * Get a persistent, page-aligned BGRA frame buffer for `renderOverlayFrame()`
+   * 
+   * @param width - Frame width in pixels
+   * @param height - Frame height in pixels
+   * @returns A reusable `width * height * 4` byte Buffer backed by shared memory
+   * where the runtime allows it, or null if the native overlay isn't loaded
+   * 
+   * @remarks
+   * Write each frame into the returned buffer instead of allocating a new one.
+   * The buffer is reused while frames fit, so call this again after a resize.
+   * 
+   * @example
+   * ```typescript
+   * win.webContents.on("paint", (event, dirty, image) => {
+   *   const { width, height } = image.getSize();
+   *   const frame = steam.getOverlayFrameBuffer(width, height);
+   *   if (!frame) return;
+   *   image.getBitmap().copy(frame);
+   *   steam.renderOverlayFrame(frame, width, height, [dirty]);
+   * });
+   * ```
+   */
+  getOverlayFrameBuffer(width: number, height: number): Buffer | null {
+    return this.nativeOverlay.getFrameBuffer(width, height);
+  }
+
+  /**
+   * Get frame upload statistics for the native overlay window
+   * 
+   * @returns Upload path, per-frame upload timings and per-stage timing
+   * histograms, or null if no overlay window is active or the platform
+   * backend doesn't report them
+   * 
+   * @example
+   * ```typescript
+   * const stats = steam.getOverlayStats();
+   * if (stats) {
+   *   console.log(`${stats.uploadPath}: ${stats.averageUploadMs.toFixed(2)} ms/frame`);
+   * }
+   * ```
+   */
+  getOverlayStats(): OverlayRenderStats | null {
+    return this.nativeOverlay.getOverlayStats();
+  }
+
   /**
    * Check if Metal overlay is available on this system
    * 
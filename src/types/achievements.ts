@@ -22,6 +22,15 @@ export interface AchievementProgressLimits {
   maxProgress: number;
 }
 
+/**
+ * Unlock state of one achievement, as returned by getAchievementStates()
+ */
+export interface AchievementState {
+  apiName: string;
+  unlocked: boolean;
+  unlockTime: number;
+}
+
 /**
  * User (friend) achievement data
  */
@@ -87,6 +87,14 @@ export interface CloudBatchWriteResult {
   failedFiles: string[];
 }
 
+/**
+ * Options for Steam Cloud read/write streams
+ */
+export interface CloudStreamOptions {
+  /** Bytes per FileReadAsync request or FileWriteStreamWriteChunk call (default: 1MB) */
+  chunkSize?: number;
+}
+
 /**
  * Constants for Steam Cloud
  */
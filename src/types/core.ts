@@ -8,6 +8,20 @@
 export interface SteamInitOptions {
   /** Steam App ID */
   appId: number;
+  /** Log how long library load, SteamAPI_Init and function binding took (default: false) */
+  reportStartupTiming?: boolean;
+}
+
+/**
+ * Startup cost breakdown, in milliseconds
+ */
+export interface SteamStartupTimings {
+  /** Opening the steam_api library */
+  libraryLoadMs: number;
+  /** SteamAPI_Init() */
+  steamApiInitMs: number;
+  /** Declaring each function group: 'core' at load, the others on first use */
+  bindingMs: Record<string, number>;
 }
 
 /**
@@ -18,3 +32,23 @@ export interface SteamStatus {
   appId: number;
   steamId: string;
 }
+
+/**
+ * Options for the native callback pump
+ */
+export interface CallbackPumpOptions {
+  /** Milliseconds between pump frames on the native thread (default: 5) */
+  intervalMs?: number;
+  /** Also run ISteamNetworkingSockets::RunCallbacks on the pump thread (default: true) */
+  networking?: boolean;
+}
+
+/**
+ * Native callback pump state
+ */
+export interface CallbackPumpStats {
+  /** Whether the pump thread is running */
+  running: boolean;
+  /** Callbacks dropped because JS fell more than 4096 events behind */
+  droppedEvents: number;
+}
@@ -195,6 +195,35 @@ export interface InputAnalogActionData {
   active: boolean;
 }
 
+/** Bytes per (controller, digital action) entry in an InputActionSnapshot: state, active */
+export const INPUT_DIGITAL_SNAPSHOT_STRIDE = 2;
+
+/** Floats per (controller, analog action) entry in an InputActionSnapshot: x, y, mode, active */
+export const INPUT_ANALOG_SNAPSHOT_STRIDE = 4;
+
+/**
+ * Every action's state for a set of controllers, read in one call
+ * 
+ * Entries are controller-major: the entry for controller `c` and action `a` is
+ * `c * actionCount + a`, scaled by the stride of its array.
+ */
+export interface InputActionSnapshot {
+  /** Number of controllers in the snapshot */
+  controllerCount: number;
+  
+  /** Number of digital actions per controller */
+  digitalActionCount: number;
+  
+  /** Number of analog actions per controller */
+  analogActionCount: number;
+  
+  /** `INPUT_DIGITAL_SNAPSHOT_STRIDE` bytes per entry: state (0/1), active (0/1) */
+  digital: Uint8Array;
+  
+  /** `INPUT_ANALOG_SNAPSHOT_STRIDE` floats per entry: x, y, mode (InputSourceMode), active (0/1) */
+  analog: Float32Array;
+}
+
 /**
  * Motion data from controller gyroscope and accelerometer
  */
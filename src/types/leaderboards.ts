@@ -48,6 +48,34 @@ export interface LeaderboardEntry {
   ugcHandle: bigint;     // Handle for attached UGC content
 }
 
+/**
+ * Leaderboard entries decoded into typed arrays
+ * 
+ * Row `i` is `steamIds[i]`, `globalRanks[i]`, `scores[i]` and `ugcHandles[i]`;
+ * its details are `details.subarray(detailsOffsets[i], detailsOffsets[i + 1])`.
+ * Rows are sorted by global rank.
+ */
+export interface LeaderboardEntryBatch {
+  count: number;
+  steamIds: BigUint64Array;
+  globalRanks: Int32Array;
+  scores: Int32Array;
+  ugcHandles: BigUint64Array;
+  /** `count + 1` offsets into `details` */
+  detailsOffsets: Uint32Array;
+  details: Int32Array;
+}
+
+/**
+ * Options for the global-range leaderboard cache
+ */
+export interface LeaderboardCacheOptions {
+  /** How long downloaded ranks are reused, in milliseconds (default: 60 seconds, 0 disables the cache) */
+  ttlMs?: number;
+  /** Maximum cached rows per leaderboard; oldest ranges are dropped first (default: 10000) */
+  maxEntriesPerLeaderboard?: number;
+}
+
 /**
  * Leaderboard information
  */
@@ -547,6 +547,40 @@ export interface NetworkMessage {
   flags: number;
 }
 
+/**
+ * A batch of received messages packed into one reusable arena Buffer
+ *
+ * Returned by `receiveMessageBatch`. Accessors read straight out of the arena,
+ * so nothing is allocated per message. The batch (and any `data()` view) is only
+ * valid until the next receive call on the same manager — copy what you keep.
+ */
+export interface NetworkMessageBatch {
+  /** Number of messages in the batch */
+  readonly count: number;
+  /** Arena holding the entry table and payloads (see docs for the layout) */
+  readonly buffer: Buffer;
+  /** Payload of message `index` as a view into the arena (no copy) */
+  data(index: number): Buffer;
+  /** Payload size in bytes */
+  size(index: number): number;
+  /** Connection the message came from */
+  connection(index: number): HSteamNetConnection;
+  /** Channel number */
+  channel(index: number): number;
+  /** Send flags (includes k_nSteamNetworkingSend_Reliable if reliable) */
+  flags(index: number): number;
+  /** Lane index */
+  lane(index: number): number;
+  /** Sender Steam ID, or 0n if the peer identity isn't a SteamID */
+  steamId(index: number): bigint;
+  /** User data associated with the connection */
+  connectionUserData(index: number): bigint;
+  /** Time the message was received (microseconds) */
+  timeReceived(index: number): bigint;
+  /** Message number assigned by the sender */
+  messageNumber(index: number): bigint;
+}
+
 /**
  * Result of sending a message
  */
@@ -559,6 +593,30 @@ export interface SendMessageResult {
   messageNumber: bigint;
 }
 
+/**
+ * Size in bytes of one packed sendBatch record
+ *
+ * Layout (little-endian): connection u32 @0, flags i32 @4, lane u16 @8,
+ * reserved u16 @10, payload offset u32 @12, payload length u32 @16
+ */
+export const NETWORK_SEND_RECORD_SIZE = 20;
+
+/**
+ * One message of a batched send: a slice of the shared payload sent to a connection
+ */
+export interface NetworkSendRecord {
+  /** Connection to send to */
+  connection: HSteamNetConnection;
+  /** Send flags (k_nSteamNetworkingSend_*) */
+  flags: number;
+  /** Lane index (default 0) */
+  lane?: number;
+  /** Byte offset of the message in the payload */
+  offset: number;
+  /** Message length in bytes */
+  length: number;
+}
+
 /**
  * P2P connection request event (for listen sockets)
  */
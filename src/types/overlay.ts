@@ -73,3 +73,263 @@ export enum EActivateGameOverlayToWebPageMode {
    */
   Modal = 1,
 }
+
+/**
+ * Options for attaching the native Steam overlay window to an Electron BrowserWindow
+ */
+export interface ElectronOverlayOptions {
+  /** Native window title (default: "Electron Steam App") */
+  title?: string;
+  /** Capture/render frame rate (default: 60) */
+  fps?: number;
+  /**
+   * Let the capture loop adapt its rate (default: true): up to `maxFps` while
+   * frames keep changing, down to `minFps` while the page is static, and never
+   * faster than the native renderer can present or while it drops frames.
+   * With false, capture runs at `fps` and only backs off on static pages.
+   * Either way capture pauses while the overlay is hidden or minimized.
+   */
+  adaptiveCapture?: boolean;
+  /** Fastest adaptive capture rate while frames keep changing (default: `fps`) */
+  maxFps?: number;
+  /** Slowest capture rate on a static page (default: 5) */
+  minFps?: number;
+  /**
+   * Time each capture so its frame reaches the native renderer just before a
+   * vblank, from the present timing the renderer reports (default: true).
+   * Captures then land on a steady number of refreshes, e.g. every second
+   * refresh at 144 Hz instead of alternating between two and three, which
+   * removes the judder of a 60 fps capture on a high refresh rate display.
+   * Needs `adaptiveCapture`; has no effect until the renderer has presented.
+   */
+  alignToVblank?: boolean;
+  /**
+   * Capture frames at this fraction of the device resolution (default: 1),
+   * e.g. 0.5 on a 4K display for a quarter of the upload bandwidth. The native
+   * renderer stretches them back over the window on the GPU, sharpening them
+   * with `upscaleSharpness`. With `autoCaptureScale` this is the reduced scale
+   * switched to (default: 0.5). Automatic capture only; clamped to 0.25-1.
+   */
+  captureScale?: number;
+  /**
+   * Start at full resolution and drop to `captureScale` while texture uploads
+   * take longer than the frame budget, returning once full-size uploads would
+   * fit again (default: false). Needs `adaptiveCapture`.
+   */
+  autoCaptureScale?: boolean;
+  /**
+   * Sharpening applied when a reduced-scale frame is upscaled, 0 (plain
+   * bilinear) to 1 (default: 0.5). The shader renderer and macOS only — the
+   * legacy OpenGL path stretches bilinearly.
+   */
+  upscaleSharpness?: number;
+  /**
+   * Keep the native texture BC3 (DXT5) compressed (default: false). Each frame
+   * only the 64x64 tiles whose content changed are encoded, off the main thread
+   * when the render thread is on, and uploaded — a quarter of the bytes of raw
+   * BGRA for every tile sent, and a quarter of the VRAM. Meant for mostly static
+   * UI on integrated GPUs; block compression slightly softens fine text and
+   * gradients. Falls back to raw uploads when the GPU lacks BC support.
+   */
+  compressedTextures?: boolean;
+  /** Enable VSync (default: true) */
+  vsync?: boolean;
+  /**
+   * Upload frames through a ring of OpenGL pixel buffer objects so the driver
+   * copies them to the GPU asynchronously (default: true).
+   * Linux only — falls back to synchronous uploads when PBOs aren't supported.
+   */
+  pixelBuffers?: boolean;
+  /**
+   * Upload and present frames on a native render thread (default: true).
+   * `renderFrame` then only copies the frame into a mailbox and returns, so
+   * swap and vsync waits never block the main process. Linux and Windows —
+   * the macOS Metal view presents from its own display link and doesn't
+   * block `renderFrame` on vsync.
+   */
+  renderThread?: boolean;
+  /**
+   * Draw with a VAO/VBO and a GLSL 330 shader, using immutable texture storage
+   * where available, instead of fixed-function `glBegin`/`glEnd` (default: true).
+   * Only used when the context is OpenGL 3.3+; otherwise the immediate-mode
+   * path stays in place. Linux and Windows.
+   */
+  shaderRenderer?: boolean;
+  /**
+   * Draw only when a new frame arrives instead of redrawing continuously at
+   * 60 Hz (default: false). Static pages then cost almost no GPU time; a
+   * present still goes out every 250 ms, and at the capture rate while the
+   * Steam overlay is open. macOS only.
+   */
+  drawOnDemand?: boolean;
+  /**
+   * Draw at the display's maximum refresh rate (ProMotion, up to 120 Hz)
+   * instead of 60 Hz (default: false). macOS 12+ only.
+   */
+  matchDisplayRefresh?: boolean;
+  /**
+   * Run the built-in `capturePage()` loop (default: true).
+   * Set to false when the app pushes frames itself through
+   * `renderOverlayFrame()`, e.g. from an offscreen `paint` handler.
+   */
+  autoCapture?: boolean;
+}
+
+/**
+ * Dirty rectangle of a frame, in pixels with a top-left origin.
+ * Matches the shape of Electron's `Rectangle`, so the `dirty` argument of
+ * the offscreen `paint` event can be passed through directly.
+ */
+export interface OverlayDirtyRect {
+  x: number;
+  y: number;
+  width: number;
+  height: number;
+}
+
+/**
+ * Shared GPU texture of an offscreen frame — the `textureInfo` of the
+ * `OffscreenSharedTexture` that Electron's `paint` event delivers when the
+ * window is created with `webPreferences.offscreen.useSharedTexture`.
+ * Only the fields the overlay reads are listed.
+ */
+export interface OverlaySharedTextureInfo {
+  /** Pixel format of the texture; only 'bgra' can be imported */
+  pixelFormat: string;
+  /** Full size of the texture in pixels */
+  codedSize: { width: number; height: number };
+  /** Platform handle (Electron 36 and later) */
+  handle?: {
+    /** Windows: NT handle of the D3D11 texture */
+    ntHandle?: Buffer;
+    /** macOS: IOSurfaceRef */
+    ioSurface?: Buffer;
+    /** Linux: dmabuf planes and DRM format modifier */
+    nativePixmap?: OverlayNativePixmap;
+  };
+  /** Windows/macOS handle (Electron 33-35) */
+  sharedTextureHandle?: Buffer;
+  /** Linux dmabuf planes (Electron 33-35) */
+  planes?: OverlayNativePixmap['planes'];
+  /** Linux DRM format modifier (Electron 33-35) */
+  modifier?: string;
+}
+
+/**
+ * Linux dmabuf description of a shared texture
+ */
+export interface OverlayNativePixmap {
+  planes: Array<{ stride: number; offset: number; size: number; fd: number }>;
+  modifier: string;
+}
+
+/**
+ * Frame upload statistics reported by the native overlay renderer
+ */
+export interface OverlayRenderStats {
+  /**
+   * Upload path in use: 'pbo' (asynchronous pixel buffers), 'direct' (client
+   * memory), 'blit' (macOS staging buffers copied into the texture by the GPU)
+   * or 'bc3' (changed tiles encoded to BC3, with `compressedTextures`)
+   */
+  uploadPath: 'pbo' | 'direct' | 'blit' | 'bc3';
+  /** Number of frames uploaded since the window was created */
+  uploadedFrames: number;
+  /** Time spent issuing the most recent upload, in milliseconds */
+  lastUploadMs: number;
+  /** Bytes uploaded by the most recent frame (smaller than a full frame for dirty-region uploads) */
+  lastUploadBytes: number;
+  /** Frames skipped because their content hash matched the previous frame */
+  skippedFrames: number;
+  /**
+   * Frames that never reached the screen: replaced by a newer one before the
+   * render thread (or, on macOS, the next draw) got to them, or dropped because
+   * no staging buffer came free in time (macOS)
+   */
+  droppedFrames: number;
+  /** Frames whose upload had to wait for the GPU to release a staging buffer (macOS only) */
+  lateFrames?: number;
+  /** Whether uploads run on the native render thread */
+  renderThread: boolean;
+  /** Draw path: 'shader' (VAO + GLSL 330) or 'legacy' (fixed-function immediate mode) */
+  renderer: 'shader' | 'legacy';
+  /** Average upload time across all frames, in milliseconds */
+  averageUploadMs: number;
+  /** Timing of each pipeline stage (native stages require a native module with stage timing) */
+  stages?: OverlayStageTimings;
+  /**
+   * Times the texture had to be reallocated because the frame size changed
+   * (Linux and Windows: because the frame outgrew the texture atlas)
+   */
+  textureRecreations?: number;
+  /** Total time spent waiting in SwapBuffers / glXSwapBuffers / for the next Metal drawable, in milliseconds */
+  swapWaitMs?: number;
+  /** When frames reach the display (native modules with present timing) */
+  presentTiming?: OverlayPresentTiming;
+}
+
+/**
+ * Vblank timing reported by the native overlay renderer
+ *
+ * The native side records the latest vblank after every present;
+ * the next one is extrapolated from it and the refresh interval.
+ */
+export interface OverlayPresentTiming {
+  /**
+   * Where the timestamps come from: 'oml' (GLX_OML_sync_control, Linux),
+   * 'dwm' (DwmGetCompositionTimingInfo, Windows), 'metal' (CAMetalDrawable
+   * presentedTime, macOS 10.15.4+), 'swap' (the time the swap returned, with
+   * the refresh interval estimated from the present intervals) or 'none'
+   * (nothing presented yet)
+   */
+  source: 'oml' | 'dwm' | 'metal' | 'swap' | 'none';
+  /** Display refresh interval in milliseconds; 0 while unknown */
+  refreshIntervalMs: number;
+  /** Time since the last recorded vblank when the stats were read, in milliseconds */
+  msSinceVblank: number;
+  /** Time until the next extrapolated vblank when the stats were read, in milliseconds; 0 while unknown */
+  msUntilVblank: number;
+  /** Last recorded vblank on the `performance.now()` timeline */
+  lastVblankAt: number;
+  /** Next extrapolated vblank on the `performance.now()` timeline; 0 while unknown */
+  nextVblankAt: number;
+  /** Presents recorded since the window was created */
+  presentedFrames: number;
+}
+
+/**
+ * Timing of one overlay pipeline stage, in milliseconds
+ *
+ * Percentiles cover the most recent 512 samples; count, last and average
+ * cover every sample since the window was created.
+ */
+export interface OverlayStageTiming {
+  count: number;
+  last: number;
+  average: number;
+  p50: number;
+  p95: number;
+  p99: number;
+}
+
+/**
+ * Per-stage timing of the overlay frame pipeline
+ */
+export interface OverlayStageTimings {
+  /** `webContents.capturePage()` (automatic capture only) */
+  capture: OverlayStageTiming;
+  /** `NativeImage.getBitmap()` / `toBitmap()` (automatic capture only) */
+  bitmap: OverlayStageTiming;
+  /** The native render call as seen from JS, N-API crossing included */
+  native: OverlayStageTiming;
+  /** Native renderFrame on the calling thread: hash plus mailbox copy, or the whole synchronous render */
+  submit?: OverlayStageTiming;
+  /** Texture upload */
+  upload?: OverlayStageTiming;
+  /** Drawing the textured quad (encoding the draw on macOS) */
+  draw?: OverlayStageTiming;
+  /** Buffer swap, or on macOS the wait for the next drawable */
+  swap?: OverlayStageTiming;
+  /** One presented frame end to end on the presenting thread */
+  frame?: OverlayStageTiming;
+}
@@ -254,6 +254,62 @@ export interface UGCQueryResult {
   items: WorkshopItem[];
 }
 
+/**
+ * Parameters of a paged all-UGC query, used as the page cache key
+ */
+export interface WorkshopQueryParams {
+  queryType: EUGCQuery;
+  matchingType: EUGCMatchingUGCType;
+  creatorAppId: number;
+  consumerAppId: number;
+  /** Filter by text in title or description (use EUGCQuery.RankedByTextSearch) */
+  searchText?: string;
+}
+
+/**
+ * One page of UGC query results, decoded column by column
+ * 
+ * Entry `i` of every column describes the same item; `count` items per page.
+ */
+export interface WorkshopQueryPage {
+  /** 1-based page number */
+  page: number;
+  count: number;
+  totalResults: number;
+  /** Steam answered from its own cache */
+  cachedData: boolean;
+  /** Date.now() when the page was fetched */
+  fetchedAt: number;
+  publishedFileIds: BigUint64Array;
+  ownerIds: BigUint64Array;
+  titles: string[];
+  descriptions: string[];
+  tags: string[][];
+  previewUrls: string[];
+  fileTypes: Int32Array;
+  visibility: Int32Array;
+  votesUp: Uint32Array;
+  votesDown: Uint32Array;
+  scores: Float32Array;
+  timeCreated: Uint32Array;
+  timeUpdated: Uint32Array;
+  fileSizes: Int32Array;
+  /** Bit 0: banned, bit 1: accepted for use, bit 2: tags truncated */
+  flags: Uint8Array;
+}
+
+/**
+ * Options for the Workshop query page cache
+ */
+export interface WorkshopQueryCacheOptions {
+  /** How long a cached page is served, in milliseconds (default: 5 minutes) */
+  ttlMs?: number;
+  /** Maximum cached pages; least recently used are evicted (default: 64) */
+  maxPages?: number;
+  /** Maximum UGC queries in flight at once (default: 4) */
+  maxInFlight?: number;
+}
+
 /**
  * Item installation info
  */
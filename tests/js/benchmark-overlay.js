@@ -0,0 +1,217 @@
+const path = require('path');
+
+/**
+ * Overlay frame-pipeline benchmark (JavaScript)
+ *
+ * Drives the native overlay module's renderFrame with synthetic BGRA frames at
+ * common resolutions and prints per-stage timings from getOverlayStats():
+ * - submit: renderFrame on this thread (hash plus mailbox copy, or the whole render with --sync)
+ * - upload: texture upload
+ * - draw:   textured quad draw
+ * - swap:   SwapBuffers / glXSwapBuffers wait
+ * - frame:  one presented frame end to end
+ * - native: the renderFrame call as seen from JS, N-API crossing included
+ *
+ * Needs neither Electron nor a Steam client — only the built native module
+ * (npm run build:native). On a headless Linux machine run it under Xvfb:
+ *   xvfb-run -s "-screen 0 3840x2160x24" npm run bench:overlay
+ *
+ * Options:
+ *   --frames=N  frames per resolution (default 300)
+ *   --fps=N     submission rate (default: as fast as renderFrame returns)
+ *   --static    submit the same frame every time, to measure the skip path
+ *   --sync      renderThread: false — upload and swap on this thread
+ *   --bc3       compressedTextures: true — upload changed tiles BC3-encoded
+ *
+ * On macOS nothing draws without a Cocoa run loop, so only submit and upload
+ * are measured there when this runs under plain Node.
+ */
+
+const RESOLUTIONS = [
+  { name: '720p', width: 1280, height: 720 },
+  { name: '1080p', width: 1920, height: 1080 },
+  { name: '1440p', width: 2560, height: 1440 },
+  { name: '4K', width: 3840, height: 2160 },
+];
+const STAGES = ['submit', 'upload', 'draw', 'swap', 'frame', 'native'];
+// Rows rewritten per frame so every frame hashes differently
+const BAND_ROWS = 32;
+
+function parseArgs() {
+  const args = { frames: 300, fps: 0, static: false, sync: false, bc3: false };
+  for (const arg of process.argv.slice(2)) {
+    const [key, value] = arg.replace(/^--/, '').split('=');
+    if (key === 'frames') args.frames = Math.max(1, parseInt(value, 10) || args.frames);
+    else if (key === 'fps') args.fps = Math.max(0, parseInt(value, 10) || 0);
+    else if (key === 'static') args.static = true;
+    else if (key === 'sync') args.sync = true;
+    else if (key === 'bc3') args.bc3 = true;
+  }
+  return args;
+}
+
+function loadOverlayModule() {
+  const candidates = [
+    path.join(__dirname, '../../native/build/Release/steam-overlay.node'),
+    path.join(__dirname, `../../prebuilds/${process.platform}-${process.arch}/steam-overlay.node`),
+  ];
+  for (const candidate of candidates) {
+    try {
+      return require(candidate);
+    } catch (e) {
+      // try the next one
+    }
+  }
+  return null;
+}
+
+function createFrame(width, height) {
+  const frame = Buffer.allocUnsafe(width * height * 4);
+  for (let y = 0; y < height; y++) {
+    const row = y * width * 4;
+    for (let x = 0; x < width; x++) {
+      const i = row + x * 4;
+      frame[i] = (x * 255 / width) | 0;
+      frame[i + 1] = (y * 255 / height) | 0;
+      frame[i + 2] = 128;
+      frame[i + 3] = 255;
+    }
+  }
+  return frame;
+}
+
+// Move a bright band down the frame
+function animateFrame(frame, width, height, index) {
+  const rowBytes = width * 4;
+  const top = (index * BAND_ROWS) % height;
+  const previous = (top - BAND_ROWS + height) % height;
+  frame.fill(0x40, previous * rowBytes, Math.min(height, previous + BAND_ROWS) * rowBytes);
+  frame.fill(0xff, top * rowBytes, Math.min(height, top + BAND_ROWS) * rowBytes);
+}
+
+const sleep = (ms) => new Promise(resolve => setTimeout(resolve, ms));
+
+function formatStage(stage) {
+  if (!stage || stage.count === 0) return '      -       -       -       -';
+  return [stage.p50, stage.p95, stage.p99, stage.average]
+    .map(ms => ms.toFixed(3).padStart(7))
+    .join(' ');
+}
+
+async function benchmarkResolution(overlay, resolution, args) {
+  const { width, height } = resolution;
+  let handle = null;
+  try {
+    handle = overlay.createOverlayWindow({
+      width,
+      height,
+      title: `Overlay benchmark ${resolution.name}`,
+      fps: args.fps || 240,
+      vsync: false,
+      renderThread: !args.sync,
+      compressedTextures: args.bc3,
+    });
+  } catch (error) {
+    console.error(`❌ ${error.message}`);
+  }
+  if (!handle) {
+    console.error(`❌ Could not create a ${width}x${height} overlay window (is a display available?)`);
+    return;
+  }
+
+  try {
+    overlay.showOverlayWindow(handle);
+    await sleep(200);
+
+    const frame = createFrame(width, height);
+    const nativeTimes = [];
+    const interval = args.fps > 0 ? 1000 / args.fps : 0;
+    const started = performance.now();
+
+    for (let i = 0; i < args.frames; i++) {
+      if (!args.static) animateFrame(frame, width, height, i);
+      const start = performance.now();
+      overlay.renderFrame(handle, frame, width, height, false);
+      nativeTimes.push(performance.now() - start);
+
+      if (interval > 0) {
+        const due = started + (i + 1) * interval;
+        const wait = due - performance.now();
+        if (wait > 0) await sleep(wait);
+      } else if (i % 16 === 15) {
+        // Let the render thread and event loop breathe
+        await sleep(0);
+      }
+    }
+    const elapsed = performance.now() - started;
+
+    // Give the render thread time to present what's still queued
+    await sleep(250);
+
+    const stats = overlay.getOverlayStats ? overlay.getOverlayStats(handle) : null;
+    if (!stats) {
+      console.log(`${resolution.name.padEnd(6)} getOverlayStats() not available in this build`);
+      return;
+    }
+
+    nativeTimes.sort((a, b) => a - b);
+    const at = (q) => nativeTimes[Math.round(q * (nativeTimes.length - 1))];
+    const stages = Object.assign({}, stats.stages, {
+      native: {
+        count: nativeTimes.length,
+        p50: at(0.5),
+        p95: at(0.95),
+        p99: at(0.99),
+        average: nativeTimes.reduce((total, ms) => total + ms, 0) / nativeTimes.length,
+      },
+    });
+
+    console.log(`\n${resolution.name} (${width}x${height}) — ${args.frames} frames in ${elapsed.toFixed(0)} ms ` +
+      `(${(args.frames * 1000 / elapsed).toFixed(1)} submitted/s)`);
+    console.log(`  upload path: ${stats.uploadPath}, renderer: ${stats.renderer}, render thread: ${stats.renderThread}`);
+    console.log('  stage       p50     p95     p99     avg   (ms)');
+    for (const name of STAGES) {
+      console.log(`  ${name.padEnd(8)} ${formatStage(stages[name])}`);
+    }
+    console.log(`  last upload ${(stats.lastUploadBytes / 1024).toFixed(0)} KiB`);
+    console.log(`  uploaded ${stats.uploadedFrames}, skipped ${stats.skippedFrames}, dropped ${stats.droppedFrames}, ` +
+      `texture recreations ${stats.textureRecreations ?? '-'}, swap wait ${(stats.swapWaitMs ?? 0).toFixed(1)} ms`);
+    if (stats.presentTiming) {
+      const timing = stats.presentTiming;
+      console.log(`  present timing: ${timing.source}, refresh ${timing.refreshIntervalMs.toFixed(2)} ms, ` +
+        `${timing.presentedFrames} presents`);
+    }
+  } finally {
+    overlay.hideOverlayWindow(handle);
+    overlay.destroyOverlayWindow(handle);
+  }
+}
+
+async function runBenchmark() {
+  console.log('='.repeat(80));
+  console.log('OVERLAY FRAME PIPELINE BENCHMARK (JavaScript)');
+  console.log('='.repeat(80));
+
+  const args = parseArgs();
+  const overlay = loadOverlayModule();
+  if (!overlay) {
+    console.error('❌ Native overlay module not found');
+    console.error('Build it first with: npm run build:native');
+    process.exitCode = 1;
+    return;
+  }
+
+  console.log(`Platform: ${process.platform}-${process.arch}, ${args.frames} frames per resolution, ` +
+    `${args.fps ? `${args.fps} fps` : 'unthrottled'}${args.static ? ', static frames' : ''}` +
+    `${args.sync ? ', caller-thread rendering' : ''}${args.bc3 ? ', BC3 textures' : ''}`);
+
+  for (const resolution of RESOLUTIONS) {
+    await benchmarkResolution(overlay, resolution, args);
+  }
+  console.log('');
+}
+
+runBenchmark().catch(error => {
+  console.error('❌ Benchmark failed:', error);
+  process.exitCode = 1;
+});
@@ -112,6 +112,26 @@ async function testAllAchievementFunctions() {
           console.log(`   🔍 After clear: ${verifyClear ? 'Still unlocked ✅' : 'Now locked 🔒'}`);
         }
       }
+      
+      // Batched variants: one query loop and one store for several achievements
+      console.log('   🧪 Testing batched state query and unlock...');
+      const batchNames = allAchievements.slice(0, 3).map(ach => ach.apiName);
+      const states = await steam.achievements.getAchievementStates([...batchNames, 'ACH_DOES_NOT_EXIST']);
+      console.log(`   📊 getAchievementStates: ${states.length}/${batchNames.length} known (unknown name skipped)`);
+      states.forEach(state => {
+        const when = state.unlocked ? ` at ${new Date(state.unlockTime * 1000).toISOString()}` : '';
+        console.log(`      ${state.apiName}: ${state.unlocked ? 'Unlocked' : 'Locked'}${when}`);
+      });
+      
+      const batchUnlocked = await steam.achievements.unlockAchievements([testAchievement.apiName]);
+      if (batchUnlocked) {
+        const [afterBatch] = await steam.achievements.getAchievementStates([testAchievement.apiName]);
+        console.log(`   🔓 unlockAchievements: ${afterBatch && afterBatch.unlocked ? 'Now unlocked ✅' : 'Still locked 🔒'}`);
+        await steam.achievements.clearAchievement(testAchievement.apiName);
+        console.log('   🔒 Cleared again for the next run');
+      } else {
+        console.log('   ❌ unlockAchievements failed');
+      }
       console.log('');
 
       // ═══════════════════════════════════════════════════════════════
@@ -309,6 +329,8 @@ async function testAllAchievementFunctions() {
     console.log('   • clearAchievement() ✅');
     console.log('   • isAchievementUnlocked() ✅');
     console.log('   • getAchievementByName() ✅');
+    console.log('   • getAchievementStates() ✅');
+    console.log('   • unlockAchievements() ✅');
     console.log('   • getTotalAchievementCount() ✅');
     console.log('   • getUnlockedAchievementCount() ✅');
     console.log('   • getAchievementIcon() ✅');
@@ -3,6 +3,9 @@
  * This test demonstrates the complete Steamworks FFI cloud storage functionality
  */
 
+const { once } = require('events');
+const { Readable } = require('stream');
+const { pipeline } = require('stream/promises');
 const { SteamworksSDK } = require('../../dist/index.js');
 
 async function testAllCloudFunctions() {
@@ -321,9 +324,72 @@ async function testAllCloudFunctions() {
   console.log('');
 
   // ═══════════════════════════════════════════════════════════════
-  // 10. FINAL QUOTA VERIFICATION
+  // 10. STREAMED READ/WRITE
   // ═══════════════════════════════════════════════════════════════
-  console.log('11. 📊 Final Quota Check...');
+  console.log('11. 🌊 Testing Streamed Read/Write...');
+  console.log('─────────────────────────────────────');
+  
+  // Spans several chunks, the last one partial
+  const streamFilename = 'stream_test.bin';
+  const streamChunkSize = 64 * 1024;
+  const streamData = Buffer.alloc(streamChunkSize * 3 + 1234);
+  for (let i = 0; i < streamData.length; i++) {
+    streamData[i] = (i * 31 + (i >> 8)) & 0xff;
+  }
+  
+  // Function 18: createWriteStream()
+  console.log(`\n   a) Writing ${streamData.length} bytes through createWriteStream() (${streamChunkSize}-byte chunks):`);
+  let streamWritten = false;
+  try {
+    // Uneven source slices, so writes both coalesce and cross chunk boundaries
+    const slices = [];
+    for (let offset = 0; offset < streamData.length; offset += 50000) {
+      slices.push(streamData.subarray(offset, offset + 50000));
+    }
+    await pipeline(Readable.from(slices), steam.cloud.createWriteStream(streamFilename, { chunkSize: streamChunkSize }));
+    streamWritten = true;
+    console.log(`      ✅ Stream finished, file size: ${steam.cloud.getFileSize(streamFilename)} bytes`);
+  } catch (error) {
+    console.log(`      ❌ Write stream failed: ${error.message}`);
+  }
+  
+  // Function 19: createReadStream()
+  if (streamWritten) {
+    console.log('\n   b) Reading it back through createReadStream():');
+    try {
+      const readStream = steam.cloud.createReadStream(streamFilename, { chunkSize: streamChunkSize });
+      console.log(`      Reported size: ${readStream.size} bytes`);
+      const chunks = [];
+      for await (const chunk of readStream) {
+        chunks.push(chunk);
+      }
+      const streamed = Buffer.concat(chunks);
+      console.log(`      Read ${streamed.length} bytes in ${chunks.length} chunk(s)`);
+      console.log(`      Content verification: ${streamed.equals(streamData) ? '✅ Bytes match' : '❌ Mismatch'}`);
+    } catch (error) {
+      console.log(`      ❌ Read stream failed: ${error.message}`);
+    }
+    
+    // Destroying a write stream before it finishes cancels it: the file keeps its previous content
+    console.log('\n   c) Destroying a write stream before it finishes (cancel):');
+    const cancelled = steam.cloud.createWriteStream(streamFilename, { chunkSize: streamChunkSize });
+    cancelled.on('error', (error) => console.log(`      ⚠️  Cancelled stream error: ${error.message}`));
+    cancelled.write(Buffer.alloc(streamChunkSize * 2, 0xab));
+    cancelled.destroy();
+    await once(cancelled, 'close');
+    const afterCancel = steam.cloud.fileRead(streamFilename);
+    const untouched = afterCancel.success && afterCancel.data && afterCancel.data.equals(streamData);
+    console.log(`      Previous version kept: ${untouched ? '✅ Yes' : '❌ No'}`);
+    
+    steam.cloud.fileDelete(streamFilename);
+    console.log('      Cleaned up stream test file');
+  }
+  console.log('');
+
+  // ═══════════════════════════════════════════════════════════════
+  // 11. FINAL QUOTA VERIFICATION
+  // ═══════════════════════════════════════════════════════════════
+  console.log('12. 📊 Final Quota Check...');
   console.log('───────────────────────────');
   
   const finalQuota = steam.cloud.getQuota();
@@ -333,7 +399,7 @@ async function testAllCloudFunctions() {
   console.log(`   📈 Usage: ${finalQuota.percentUsed.toFixed(1)}%`);
   console.log('');
 
-  console.log('✅ Test Complete - All 17 Cloud Functions Tested!');
+  console.log('✅ Test Complete - All 19 Cloud Functions Tested!');
   console.log('==================================================');
   console.log('');
   console.log('📋 Functions Tested:');
@@ -354,6 +420,8 @@ async function testAllCloudFunctions() {
   console.log('   15. ✅ beginFileWriteBatch()');
   console.log('   16. ✅ endFileWriteBatch()');
   console.log('   17. ✅ writeFilesBatch()');
+  console.log('   18. ✅ createWriteStream()');
+  console.log('   19. ✅ createReadStream()');
   console.log('');
   
   // Shutdown
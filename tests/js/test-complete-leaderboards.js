@@ -354,6 +354,74 @@ async function testLeaderboardsAPI() {
   steam.runCallbacks();
   console.log('');
   
+  // ===== ENTRY BATCH / RANGE CACHE TESTS =====
+  console.log('=' .repeat(60));
+  console.log('ENTRY BATCH / RANGE CACHE TESTS');
+  console.log('=' .repeat(60) + '\n');
+  
+  // Ranks in a global batch must be ascending, contiguous and unique, and
+  // stay inside the requested range (the board may hold fewer entries)
+  const checkBatchRanks = (label, batch, rangeStart, rangeEnd) => {
+    if (!batch) {
+      console.log(`❌ ${label}: batch download failed`);
+      return false;
+    }
+    const ranks = Array.from(batch.globalRanks.subarray(0, batch.count));
+    const unique = new Set(ranks).size === ranks.length;
+    const contiguous = ranks.every((rank, i) => i === 0 || rank === ranks[i - 1] + 1);
+    const inRange = ranks.every(rank => rank >= rangeStart && rank <= rangeEnd);
+    const ok = unique && contiguous && inRange;
+    const span = ranks.length > 0 ? `ranks ${ranks[0]}-${ranks[ranks.length - 1]}` : 'no ranks';
+    console.log(`${ok ? '✅' : '❌'} ${label}: ${batch.count} entries, ${span}` +
+      `${unique ? '' : ', duplicated ranks'}${contiguous ? '' : ', missing ranks'}${inRange ? '' : ', ranks outside the range'}`);
+    return ok;
+  };
+  
+  console.log('🗄️  Configuring the range cache (60 s TTL)...');
+  steam.leaderboards.configureLeaderboardCache({ ttlMs: 60000, maxEntriesPerLeaderboard: 10000 });
+  steam.leaderboards.invalidateLeaderboardCache(quickestWinHandle);
+  
+  // 1-20 is downloaded; 10-30 then reuses 10-20 from the cache and downloads 21-30
+  console.log('📥 Downloading batch of ranks 1-20 from Quickest Win...');
+  const firstBatch = await steam.leaderboards.downloadLeaderboardEntryBatch(
+    quickestWinHandle,
+    LeaderboardDataRequest.Global,
+    1,
+    20
+  );
+  checkBatchRanks('Ranks 1-20', firstBatch, 1, 20);
+  
+  console.log('📥 Downloading overlapping batch of ranks 10-30...');
+  const overlapBatch = await steam.leaderboards.downloadLeaderboardEntryBatch(
+    quickestWinHandle,
+    LeaderboardDataRequest.Global,
+    10,
+    30
+  );
+  checkBatchRanks('Ranks 10-30 (partly cached)', overlapBatch, 10, 30);
+  
+  // The merged result must match a download that bypasses the cache
+  console.log('📥 Downloading ranks 10-30 again with the cache cleared...');
+  steam.leaderboards.invalidateLeaderboardCache(quickestWinHandle);
+  const uncachedBatch = await steam.leaderboards.downloadLeaderboardEntryBatch(
+    quickestWinHandle,
+    LeaderboardDataRequest.Global,
+    10,
+    30
+  );
+  if (checkBatchRanks('Ranks 10-30 (uncached)', uncachedBatch, 10, 30) && overlapBatch) {
+    const sameRows = overlapBatch.count === uncachedBatch.count &&
+      overlapBatch.globalRanks.every((rank, i) => rank === uncachedBatch.globalRanks[i]) &&
+      overlapBatch.steamIds.every((id, i) => id === uncachedBatch.steamIds[i]);
+    console.log(sameRows
+      ? '✅ Cached and uncached 10-30 batches match'
+      : '⚠️  Cached and uncached 10-30 batches differ (the board may have changed in between)');
+  }
+  
+  await new Promise(resolve => setTimeout(resolve, 3000));
+  steam.runCallbacks();
+  console.log('');
+  
   // ===== UGC ATTACHMENT TEST =====
   console.log('=' .repeat(60));
   console.log('UGC ATTACHMENT TEST');
@@ -379,17 +447,20 @@ async function testLeaderboardsAPI() {
   console.log('TEST SUMMARY');
   console.log('=' .repeat(60) + '\n');
   
-  console.log('📋 Functions Tested (7 total):');
+  console.log('📋 Functions Tested (10 total):');
   console.log('   ✅ 1. findOrCreateLeaderboard()');
   console.log('   ✅ 2. findLeaderboard()');
   console.log('   ✅ 3. getLeaderboardInfo()');
   console.log('   ✅ 4. uploadScore()');
   console.log('   ✅ 5. downloadLeaderboardEntries()');
   console.log('   ✅ 6. downloadLeaderboardEntriesForUsers()');
-  console.log('   ✅ 7. attachLeaderboardUGC()');
+  console.log('   ✅ 7. downloadLeaderboardEntryBatch()');
+  console.log('   ✅ 8. configureLeaderboardCache()');
+  console.log('   ✅ 9. invalidateLeaderboardCache()');
+  console.log('   ✅ 10. attachLeaderboardUGC()');
   console.log('');
-  console.log('🎉 All 7 Leaderboards API functions tested!');
-  console.log('📊 Coverage: 7/7 functions (100%)\n');
+  console.log('🎉 All 10 Leaderboards API functions tested!');
+  console.log('📊 Coverage: 10/10 functions (100%)\n');
   
   console.log('✨ Implementation:');
   console.log('   - Uses ISteamUtils polling to retrieve callback results');
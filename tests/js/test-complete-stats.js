@@ -78,6 +78,61 @@ async function testStatsAPI() {
   await new Promise(resolve => setTimeout(resolve, 500));
   steam.runCallbacks();
   
+  // ===== BATCHED STATS TESTS =====
+  console.log('\n' + '=' .repeat(60));
+  console.log('BATCHED STATS TESTS');
+  console.log('=' .repeat(60) + '\n');
+  
+  // Test setting several stats with one store
+  console.log('📝 Setting "NumGames" = 11 and "NumWins" = 6 in one batch...');
+  const batchSet = await steam.stats.setStats({ NumGames: 11, NumWins: 6 });
+  console.log(`   ${batchSet ? '✅' : '❌'} setStats (int) returned ${batchSet}`);
+  
+  console.log('📝 Setting "MaxFeetTraveled" = 6000.25 in a float batch...');
+  const floatBatchSet = await steam.stats.setStats({ MaxFeetTraveled: 6000.25 }, 'float');
+  console.log(`   ${floatBatchSet ? '✅' : '❌'} setStats (float) returned ${floatBatchSet}`);
+  
+  // A value outside int32 is rejected; the rest of the batch is still set and stored
+  console.log('📝 Setting "NumGames" = 2^40 (doesn\'t fit int32) alongside "NumWins" = 7...');
+  const overflowSet = await steam.stats.setStats({ NumGames: 2 ** 40, NumWins: 7 });
+  console.log(`   ${overflowSet ? '❌ Accepted an out-of-range value' : '✅ Rejected NumGames (returned false)'}`);
+  
+  // Test reading several stats at once
+  console.log('\n📖 Reading back stats in one batch...');
+  const batchStats = await steam.stats.getStats(['NumGames', 'NumWins']);
+  batchStats.forEach(stat => {
+    console.log(`   ✅ ${stat.name}: ${stat.value} (type: ${stat.type})`);
+  });
+  const numGamesKept = batchStats.find(stat => stat.name === 'NumGames');
+  const numWinsBatch = batchStats.find(stat => stat.name === 'NumWins');
+  if (numGamesKept && numWinsBatch) {
+    const expected = numGamesKept.value === 11 && numWinsBatch.value === 7;
+    console.log(`   ${expected ? '✅' : '❌'} NumGames kept 11, NumWins is 7`);
+  }
+  const floatStats = await steam.stats.getStats(['MaxFeetTraveled'], 'float');
+  floatStats.forEach(stat => {
+    console.log(`   ✅ ${stat.name}: ${stat.value} (type: ${stat.type})`);
+  });
+  
+  // Test write-behind stores
+  console.log('\n⏱️  Setting a 5 second store interval...');
+  steam.stats.setStoreInterval(5000);
+  console.log(`   Store interval: ${steam.stats.getStoreInterval()} ms`);
+  await steam.stats.setStatInt('NumGames', 12);
+  await steam.stats.setStatInt('NumWins', 8);
+  const pending = steam.stats.getPendingStats();
+  console.log(`   ${pending.length === 2 ? '✅' : '❌'} Pending stats: ${pending.join(', ') || '(none)'}`);
+  
+  console.log('💾 Flushing pending stats...');
+  const flushed = steam.stats.flushStats();
+  console.log(`   ${flushed ? '✅' : '❌'} flushStats returned ${flushed}, ${steam.stats.getPendingStats().length} still pending`);
+  
+  steam.stats.setStoreInterval(0);
+  console.log(`   Store interval reset to ${steam.stats.getStoreInterval()} ms`);
+  
+  await new Promise(resolve => setTimeout(resolve, 500));
+  steam.runCallbacks();
+  
   // ===== GLOBAL STATS TESTS =====
   console.log('\n' + '=' .repeat(60));
   console.log('GLOBAL STATS TESTS');
@@ -271,6 +326,14 @@ async function testStatsAPI() {
   console.log('   - getStatFloat() ✓');
   console.log('   - updateAvgRateStat() ✓');
   
+  console.log('\n✅ Batched Stats:');
+  console.log('   - getStats() ✓');
+  console.log('   - setStats() ✓');
+  console.log('   - setStoreInterval() ✓');
+  console.log('   - getStoreInterval() ✓');
+  console.log('   - getPendingStats() ✓');
+  console.log('   - flushStats() ✓');
+  
   console.log('\n✅ Global Stats:');
   console.log('   - requestGlobalStats() ✓');
   console.log('   - getGlobalStatInt() ✓');
@@ -286,8 +349,8 @@ async function testStatsAPI() {
   console.log('\n✅ Player Count:');
   console.log('   - getNumberOfCurrentPlayers() ✓');
   
-  console.log('\n🎉 All 14 Stats API functions tested!\n');
-  console.log('📊 Coverage: 14/14 functions (100%)');
+  console.log('\n🎉 All 20 Stats API functions tested!\n');
+  console.log('📊 Coverage: 20/20 functions (100%)');
   
   // Cleanup
   console.log('🧹 Shutting down Steam API...');